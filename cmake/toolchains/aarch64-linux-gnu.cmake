@@ -0,0 +1,30 @@
+# Cross compiles for 64-bit ARM Linux and runs the tests under qemu-user:
+#
+#   cmake -S . -B build-aarch64 -DAVML_BUILD_TESTS=ON \
+#       -DCMAKE_TOOLCHAIN_FILE=cmake/toolchains/aarch64-linux-gnu.cmake
+#   cmake --build build-aarch64
+#   ctest --test-dir build-aarch64
+#
+# Requires the aarch64-linux-gnu GCC cross toolchain and qemu-aarch64. The
+# tests are built with SVE enabled, which qemu emulates at a 512-bit vector
+# length by default; pass -cpu max,sve<N>=on via AVML_QEMU_FLAGS to try
+# other lengths. AVML has no NEON or SVE intrinsics paths yet, so this
+# checks the scalar code and the capability queries on AArch64.
+
+set(CMAKE_SYSTEM_NAME Linux)
+set(CMAKE_SYSTEM_PROCESSOR aarch64)
+
+set(AVML_CROSS_PREFIX aarch64-linux-gnu- CACHE STRING "Cross toolchain prefix")
+set(AVML_SYSROOT /usr/aarch64-linux-gnu CACHE PATH "Target libraries used by qemu")
+set(AVML_QEMU_FLAGS "" CACHE STRING "Extra qemu-aarch64 arguments")
+
+set(CMAKE_C_COMPILER ${AVML_CROSS_PREFIX}gcc)
+set(CMAKE_CXX_COMPILER ${AVML_CROSS_PREFIX}g++)
+
+set(CMAKE_FIND_ROOT_PATH ${AVML_SYSROOT})
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
+
+separate_arguments(AVML_QEMU_ARGS UNIX_COMMAND "${AVML_QEMU_FLAGS}")
+set(CMAKE_CROSSCOMPILING_EMULATOR qemu-aarch64 -L ${AVML_SYSROOT} ${AVML_QEMU_ARGS})
@@ -2,10 +2,28 @@
 #define AVML_AVML_HPP
 
 #include "impl/Capabilities.hpp"
+#include "Capabilities.hpp"
 
 #include "Vectors.hpp"
 #include "Matrices.hpp"
 #include "Transforms.hpp"
 #include "Math.hpp"
+#include "Encodings.hpp"
+#include "Geometry.hpp"
+#include "Parallel.hpp"
+#include "Batch.hpp"
+#include "Streaming.hpp"
+#include "Memory.hpp"
+#include "Instrumentation.hpp"
+#include "Dense.hpp"
+#include "Decompositions.hpp"
+#include "Spatial.hpp"
+#include "Noise.hpp"
+#include "Curves.hpp"
+#include "Dual_quaternions.hpp"
+#include "Skinning.hpp"
+#include "Overlap.hpp"
+#include "Convex.hpp"
+#include "Planes.hpp"
 
 #endif //AVML_AVML_HPP
@@ -0,0 +1,92 @@
+#ifndef AVML_BATCH_HPP
+#define AVML_BATCH_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Vectors.hpp"
+#include "Matrices.hpp"
+#include "Geometry.hpp"
+#include "Parallel.hpp"
+
+namespace avml {
+
+    // Every batch operation has an overload taking an Executor which splits
+    // the array into chunks of default_grain() elements and processes them
+    // concurrently.
+
+    //=====================================================
+    // Normalization
+    //=====================================================
+
+    void normalize(const vec3f* in, uvec3f* out, std::size_t n);
+    void normalize(const vec3f* in, uvec3f* out, std::size_t n, Executor& executor);
+
+    //=====================================================
+    // Transforms
+    //=====================================================
+
+    ///
+    /// Transforms points by an affine matrix, i.e. one whose last row is
+    /// {0, 0, 0, 1}. in and out may be the same array.
+    ///
+    void transform_points(const mat4x4f& m, const vec3f* in, vec3f* out, std::size_t n);
+    void transform_points(const mat4x4f& m, const vec3f* in, vec3f* out, std::size_t n, Executor& executor);
+
+    ///
+    /// Transforms direction vectors by the upper-left 3x3 portion of m.
+    /// in and out may be the same array.
+    ///
+    void transform_vectors(const mat4x4f& m, const vec3f* in, vec3f* out, std::size_t n);
+    void transform_vectors(const mat4x4f& m, const vec3f* in, vec3f* out, std::size_t n, Executor& executor);
+
+    //=====================================================
+    // Matrix arrays
+    //=====================================================
+
+    ///
+    /// Computes out[i] = a[i] * b[i]. out may be the same array as a or b.
+    ///
+    void multiply_batch(const mat4x4f* a, const mat4x4f* b, mat4x4f* out, std::size_t n);
+    void multiply_batch(const mat4x4f* a, const mat4x4f* b, mat4x4f* out, std::size_t n, Executor& executor);
+
+    ///
+    /// Computes out[i] = a[a_indices[i]] * b[i], e.g. a level of a scene
+    /// graph's world matrices from their parents' world matrices. out must
+    /// not overlap with the elements of a which are referenced.
+    ///
+    void multiply_batch(const mat4x4f* a, const std::uint32_t* a_indices, const mat4x4f* b, mat4x4f* out, std::size_t n);
+    void multiply_batch(const mat4x4f* a, const std::uint32_t* a_indices, const mat4x4f* b, mat4x4f* out, std::size_t n, Executor& executor);
+
+    ///
+    /// Index marking a root node in propagate_hierarchy()
+    ///
+    constexpr std::uint32_t no_parent = ~std::uint32_t(0);
+
+    ///
+    /// Computes world[i] = world[parents[i]] * local[i], or local[i] for
+    /// nodes whose parent is no_parent. Parents must precede their children.
+    ///
+    void propagate_hierarchy(const std::uint32_t* parents, const mat4x4f* local, mat4x4f* world, std::size_t n);
+
+    ///
+    /// Computes out[i] = inverse(in[i]). out may be the same array as in.
+    ///
+    void inverse_batch(const mat4x4f* in, mat4x4f* out, std::size_t n);
+    void inverse_batch(const mat4x4f* in, mat4x4f* out, std::size_t n, Executor& executor);
+
+    //=====================================================
+    // Reductions
+    //=====================================================
+
+    ///
+    /// \return Smallest box containing all n points. aabb3f::empty() if n
+    /// is zero.
+    aabb3f bounds(const vec3f* in, std::size_t n);
+    aabb3f bounds(const vec3f* in, std::size_t n, Executor& executor);
+
+}
+
+#include "impl/batchf.ipp"
+
+#endif //AVML_BATCH_HPP
@@ -0,0 +1,155 @@
+#ifndef AVML_CAPABILITIES_HPP
+#define AVML_CAPABILITIES_HPP
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "impl/Capabilities.hpp"
+
+namespace avml {
+
+    //=====================================================
+    // Instruction set features
+    //=====================================================
+
+    enum class Isa_feature : std::uint32_t {
+        sse,
+        sse2,
+        sse3,
+        ssse3,
+        sse41,
+        sse42,
+        avx,
+        avx2,
+        fma,
+        bmi2,
+        avx512f,
+        avx512vl,
+        avx512bw,
+        avx512dq,
+        avx512_bitalg,
+        avx512vpopcntdq,
+        neon,
+        sve,
+        sve2
+    };
+
+    ///
+    /// Widest vector extension a build was compiled for. Selects which of the
+    /// #if defined(AVML_*) paths are active.
+    ///
+    enum class Isa_tier {
+        scalar,
+        sse2,
+        sse3,
+        ssse3,
+        sse41,
+        sse42,
+        avx,
+        avx2,
+        avx512f,
+        neon,
+        sve
+    };
+
+    AVML_FINL constexpr std::uint32_t feature_bit(Isa_feature f) {
+        return std::uint32_t{1} << static_cast<std::uint32_t>(f);
+    }
+
+    ///
+    /// A set of instruction set features
+    ///
+    struct Capabilities {
+        std::uint32_t features;
+
+        AVML_FINL constexpr bool has(Isa_feature f) const {
+            return (features & feature_bit(f)) != 0;
+        }
+
+        /// \return Features of required that are not in this set
+        AVML_FINL constexpr Capabilities missing(Capabilities required) const {
+            return Capabilities{required.features & ~features};
+        }
+
+        AVML_FINL constexpr bool covers(Capabilities required) const {
+            return missing(required).features == 0;
+        }
+    };
+
+    ///
+    /// \return Features enabled by the AVML_* macros of this translation unit
+    ///
+    constexpr Capabilities compiled_capabilities();
+
+    constexpr Isa_tier compiled_tier();
+
+    ///
+    /// Queries the executing CPU with cpuid, including whether the OS saves
+    /// AVX and AVX-512 register state. On AArch64 Linux the features come
+    /// from the kernel's hwcaps. On other ARM targets this returns
+    /// compiled_capabilities() since features can't be queried portably.
+    ///
+    Capabilities cpu_capabilities();
+
+    const char* to_string(Isa_feature f);
+
+    const char* to_string(Isa_tier tier);
+
+    /// \return Space separated names of the features in c
+    std::string to_string(Capabilities c);
+
+    //=====================================================
+    // Startup check
+    //=====================================================
+
+    ///
+    /// Writes a message naming the missing features to stderr and aborts if
+    /// the CPU lacks any feature the build was compiled for. Call it first
+    /// thing in main, before any AVML code runs.
+    ///
+    /// This is best effort. The function is compiled with the same flags as
+    /// its caller, so under -march or /arch the compiler is free to use the
+    /// very instructions being checked for, and the program may still die
+    /// with SIGILL before the diagnostic is written. A hard guarantee needs
+    /// the check to live in a translation unit compiled with baseline flags,
+    /// comparing cpu_capabilities() against the features the rest of the
+    /// program requires.
+    ///
+    /// Defining AVML_VERIFY_CPU also runs it during static initialization
+    /// of every translation unit including this header. The order of static
+    /// initialization across translation units is unspecified, so other
+    /// static initializers may run AVML code before the check.
+    ///
+    void require_cpu_support();
+
+    //=====================================================
+    // Code path report
+    //=====================================================
+
+    ///
+    /// Implementation selected at compile time for a family of functions
+    ///
+    struct Code_path {
+        const char* name;
+
+        /// Instruction set used, or "scalar" for the portable fallback
+        const char* isa;
+
+        bool simd;
+    };
+
+    std::vector<Code_path> code_paths();
+
+    ///
+    /// Writes the compiled tier, the CPU's features and code_paths() to
+    /// stream
+    ///
+    void capabilities_report(std::ostream& stream);
+
+}
+
+#include "impl/Capabilities.ipp"
+
+#endif //AVML_CAPABILITIES_HPP
@@ -0,0 +1,150 @@
+#ifndef AVML_CONVEX_HPP
+#define AVML_CONVEX_HPP
+
+#include <cstddef>
+
+#include "Vectors.hpp"
+#include "Matrices.hpp"
+#include "Geometry.hpp"
+#include "Parallel.hpp"
+
+namespace avml {
+
+    //=====================================================
+    // Convex shapes
+    //=====================================================
+
+    // A convex shape is any type S with a member type scalar and an overload
+    //
+    //     Vector3R<typename S::scalar> support(const S& s, Vector3R<typename S::scalar> d)
+    //
+    // found by argument dependent lookup, which returns a point of s that is
+    // furthest along d. d need not be of unit length and may be zero, in
+    // which case any point of s may be returned.
+    //
+    // Supports are provided below for the primitives of Geometry.hpp and for
+    // arrays of vertices.
+
+    ///
+    /// Convex hull of an array of vertices, which is not copied
+    ///
+    template<class R>
+    struct Convex_vertices {
+        using scalar = R;
+
+        const Vector3R<R>* vertices;
+        std::size_t count;
+    };
+
+    template<class R>
+    Vector3R<R> support(const SphereR<R>& s, Vector3R<R> d);
+
+    template<class R>
+    Vector3R<R> support(const CapsuleR<R>& c, Vector3R<R> d);
+
+    template<class R>
+    Vector3R<R> support(const Aabb3R<R>& b, Vector3R<R> d);
+
+    template<class R>
+    Vector3R<R> support(const ObbR<R>& b, Vector3R<R> d);
+
+    template<class R>
+    Vector3R<R> support(const Convex_vertices<R>& v, Vector3R<R> d);
+
+    ///
+    /// \return Index of a vertex furthest along d, or zero if n is zero
+    ///
+    /// With AVX or AVX-512 8 or 16 vertices are tested at a time.
+    ///
+    std::size_t support_index(const vec3f* vertices, std::size_t n, vec3f d);
+    std::size_t support_index(const vec3d* vertices, std::size_t n, vec3d d);
+
+    //=====================================================
+    // GJK
+    //=====================================================
+
+    template<class R>
+    struct Gjk_result {
+        bool intersecting;
+
+        /// Distance between the shapes, zero if they intersect
+        R distance;
+
+        /// Closest points of either shape. They coincide when the shapes
+        /// intersect.
+        Vector3R<R> on_a;
+        Vector3R<R> on_b;
+
+        unsigned iterations;
+    };
+
+    ///
+    /// Gilbert-Johnson-Keerthi distance between two convex shapes. Each
+    /// iteration finds the point of the simplex closest to the origin with
+    /// the Voronoi region tests of Ericson's Real-Time Collision Detection,
+    /// 5.1, and drops the vertices not needed to express it.
+    ///
+    template<class A, class B>
+    Gjk_result<typename A::scalar> gjk_distance(const A& a, const B& b);
+
+    ///
+    /// Boolean form of gjk_distance() which stops as soon as a separating
+    /// direction is found
+    ///
+    template<class A, class B>
+    bool gjk_intersect(const A& a, const B& b);
+
+    //=====================================================
+    // EPA
+    //=====================================================
+
+    template<class R>
+    struct Penetration {
+        bool intersecting;
+
+        /// Penetration depth when intersecting, negative distance otherwise
+        R depth;
+
+        /// Unit direction from a to b along which b is moved by depth to
+        /// separate the shapes
+        Vector3R<R> normal;
+
+        /// Deepest points of either shape within the other, or the closest
+        /// points if the shapes are separate
+        Vector3R<R> on_a;
+        Vector3R<R> on_b;
+    };
+
+    ///
+    /// Runs GJK and, if the shapes intersect, the expanding polytope
+    /// algorithm on its final simplex. The polytope lives on the stack and
+    /// holds at most 64 supports. Polyhedra are usually resolved exactly,
+    /// while smooth shapes are approximated by that many supports, which
+    /// leaves their depth off by around a percent.
+    ///
+    template<class A, class B>
+    Penetration<typename A::scalar> epa_penetration(const A& a, const B& b);
+
+    //=====================================================
+    // Batch queries
+    //=====================================================
+
+    // Query the pairs a[i], b[i] and write the results to out[i]
+
+    template<class A, class B>
+    void gjk_distance(const A* a, const B* b, Gjk_result<typename A::scalar>* out, std::size_t n);
+
+    template<class A, class B>
+    void epa_penetration(const A* a, const B* b, Penetration<typename A::scalar>* out, std::size_t n);
+
+    template<class A, class B>
+    void gjk_distance(const A* a, const B* b, Gjk_result<typename A::scalar>* out, std::size_t n, Executor& executor);
+
+    template<class A, class B>
+    void epa_penetration(const A* a, const B* b, Penetration<typename A::scalar>* out, std::size_t n, Executor& executor);
+
+}
+
+#include "impl/Convex.ipp"
+
+#endif //AVML_CONVEX_HPP
@@ -0,0 +1,74 @@
+#ifndef AVML_CURVES_HPP
+#define AVML_CURVES_HPP
+
+#include <cstddef>
+
+#include "Vectors.hpp"
+#include "Math.hpp"
+#include "Parallel.hpp"
+
+namespace avml {
+
+    //=====================================================
+    // Cubic curves
+    //=====================================================
+
+    // Curves are evaluated at t in [0, 1] as a weighted sum of four control
+    // points, with weights given by the curve's basis functions.
+
+    enum class Cubic_basis {
+        /// Control points p0, p1, p2, p3. Passes through p0 and p3.
+        bezier,
+
+        /// Control points p0, m0, p1, m1: end points and their tangents
+        hermite,
+
+        /// Control points p0, p1, p2, p3. Passes through p1 and p2 with
+        /// tangents (p2 - p0) / 2 and (p3 - p1) / 2.
+        catmull_rom
+    };
+
+    vec2f bezier(vec2f p0, vec2f p1, vec2f p2, vec2f p3, float t);
+    vec3f bezier(vec3f p0, vec3f p1, vec3f p2, vec3f p3, float t);
+
+    vec2f hermite(vec2f p0, vec2f m0, vec2f p1, vec2f m1, float t);
+    vec3f hermite(vec3f p0, vec3f m0, vec3f p1, vec3f m1, float t);
+
+    vec2f catmull_rom(vec2f p0, vec2f p1, vec2f p2, vec2f p3, float t);
+    vec3f catmull_rom(vec3f p0, vec3f p1, vec3f p2, vec3f p3, float t);
+
+    ///
+    /// \return Values of the four basis functions at t
+    ///
+    void cubic_weights(Cubic_basis basis, float t, float (&weights)[4]);
+
+    //=====================================================
+    // Batch evaluation
+    //=====================================================
+
+    ///
+    /// Evaluates one curve at many parameters, e.g. to tessellate a path.
+    /// out[i] is the curve at t[i].
+    ///
+    void sample_curve(Cubic_basis basis, const vec2f (&control)[4], const float* t, vec2f* out, std::size_t n);
+    void sample_curve(Cubic_basis basis, const vec3f (&control)[4], const float* t, vec3f* out, std::size_t n);
+
+    void sample_curve(Cubic_basis basis, const vec2f (&control)[4], const float* t, vec2f* out, std::size_t n, Executor& executor);
+    void sample_curve(Cubic_basis basis, const vec3f (&control)[4], const float* t, vec3f* out, std::size_t n, Executor& executor);
+
+    ///
+    /// Evaluates many curves at one parameter, e.g. to sample animation
+    /// channels at the current time. Curve i has the control points
+    /// control[4 * i] to control[4 * i + 3] and out[i] is its value at t.
+    ///
+    void sample_curves(Cubic_basis basis, const vec2f* control, float t, vec2f* out, std::size_t n);
+    void sample_curves(Cubic_basis basis, const vec3f* control, float t, vec3f* out, std::size_t n);
+
+    void sample_curves(Cubic_basis basis, const vec2f* control, float t, vec2f* out, std::size_t n, Executor& executor);
+    void sample_curves(Cubic_basis basis, const vec3f* control, float t, vec3f* out, std::size_t n, Executor& executor);
+
+}
+
+#include "impl/curvesf.ipp"
+
+#endif //AVML_CURVES_HPP
@@ -0,0 +1,257 @@
+#ifndef AVML_DECOMPOSITIONS_HPP
+#define AVML_DECOMPOSITIONS_HPP
+
+#include <cstddef>
+
+#include "Dense.hpp"
+#include "Matrices.hpp"
+#include "Parallel.hpp"
+
+//=========================================================
+// Iteration counts
+//=========================================================
+
+// Number of Jacobi sweeps, each rotating all three off-diagonal pairs, used
+// to diagonalize a symmetric 3x3 matrix. Fixed so that the SIMD versions
+// process every lane identically.
+#ifndef AVML_JACOBI_SWEEPS
+    #define AVML_JACOBI_SWEEPS 5
+#endif
+
+namespace avml {
+
+    //=====================================================
+    // Result types
+    //=====================================================
+
+    ///
+    /// a = u * diag(sigma) * transpose(v) with u and v rotations. Singular
+    /// values are sorted by decreasing magnitude. When det(a) < 0 the last
+    /// one is negative rather than either factor being a reflection.
+    ///
+    template<class R>
+    struct Svd3x3R {
+        Matrix3x3R<R> u;
+        Vector3R<R> sigma;
+        Matrix3x3R<R> v;
+    };
+
+    ///
+    /// a = r * s with r a rotation and s symmetric
+    ///
+    template<class R>
+    struct Polar3x3R {
+        Matrix3x3R<R> r;
+        Matrix3x3R<R> s;
+    };
+
+    ///
+    /// a = vectors * diag(values) * transpose(vectors). Eigenvectors are the
+    /// columns of vectors, which is a rotation, sorted by decreasing
+    /// eigenvalue.
+    ///
+    template<class R>
+    struct Eigen3x3R {
+        Vector3R<R> values;
+        Matrix3x3R<R> vectors;
+    };
+
+    using svd3x3f = Svd3x3R<float>;
+    using svd3x3d = Svd3x3R<double>;
+
+    using polar3x3f = Polar3x3R<float>;
+    using polar3x3d = Polar3x3R<double>;
+
+    using eigen3x3f = Eigen3x3R<float>;
+    using eigen3x3d = Eigen3x3R<double>;
+
+    //=====================================================
+    // Decompositions
+    //=====================================================
+
+    // Implemented after McAdams et al., "Computing the Singular Value
+    // Decomposition of 3x3 matrices with minimal branching and elementary
+    // floating point operations": a fixed number of Jacobi sweeps with
+    // approximate Givens rotations diagonalizes transpose(a) * a, then Givens
+    // QR of a * v yields u and sigma. There are no data dependent branches,
+    // so the batch versions run 8 or 16 matrices per instruction.
+
+    template<class R>
+    Svd3x3R<R> svd(const Matrix3x3R<R>& a);
+
+    template<class R>
+    Polar3x3R<R> polar_decomposition(const Matrix3x3R<R>& a);
+
+    ///
+    /// \param a Symmetric matrix. Only its upper triangle is read.
+    template<class R>
+    Eigen3x3R<R> eigen_symmetric(const Matrix3x3R<R>& a);
+
+    //=====================================================
+    // Batch decompositions
+    //=====================================================
+
+    void svd_batch(const mat3x3f* in, svd3x3f* out, std::size_t n);
+    void svd_batch(const mat3x3f* in, svd3x3f* out, std::size_t n, Executor& executor);
+
+    void polar_decomposition_batch(const mat3x3f* in, polar3x3f* out, std::size_t n);
+    void polar_decomposition_batch(const mat3x3f* in, polar3x3f* out, std::size_t n, Executor& executor);
+
+    void eigen_symmetric_batch(const mat3x3f* in, eigen3x3f* out, std::size_t n);
+    void eigen_symmetric_batch(const mat3x3f* in, eigen3x3f* out, std::size_t n, Executor& executor);
+
+    //=====================================================
+    // Linear systems
+    //=====================================================
+
+    // Factorizations and solvers for small systems. Each is provided for the
+    // fixed size matrices and for square Matrix<R, N, N>, whose right-hand
+    // sides are Matrix<R, N, 1>. Prefer these over multiplying by an
+    // inverse, which costs more and loses more precision.
+    //
+    // Functions returning bool return false, leaving their outputs
+    // untouched, if a is singular or, for Cholesky, not positive definite.
+    // LU treats a as singular when its smallest pivot is no more than
+    // N * epsilon times the largest entry of a, since rounding rarely leaves
+    // it at exactly zero.
+
+    ///
+    /// Factors a symmetric positive definite a into l * transpose(l) with l
+    /// lower triangular. Only the lower triangle of a is read.
+    ///
+    template<class R>
+    bool cholesky(const Matrix2x2R<R>& a, Matrix2x2R<R>& l);
+
+    template<class R>
+    bool cholesky(const Matrix3x3R<R>& a, Matrix3x3R<R>& l);
+
+    template<class R>
+    bool cholesky(const Matrix4x4R<R>& a, Matrix4x4R<R>& l);
+
+    template<class R, unsigned N>
+    bool cholesky(const Matrix<R, N, N>& a, Matrix<R, N, N>& l);
+
+    ///
+    /// \param l Factor computed by cholesky()
+    /// \return Solution x of l * transpose(l) * x = b
+    template<class R>
+    Vector2R<R> cholesky_solve(const Matrix2x2R<R>& l, const Vector2R<R>& b);
+
+    template<class R>
+    Vector3R<R> cholesky_solve(const Matrix3x3R<R>& l, const Vector3R<R>& b);
+
+    template<class R>
+    Vector4R<R> cholesky_solve(const Matrix4x4R<R>& l, const Vector4R<R>& b);
+
+    template<class R, unsigned N>
+    Matrix<R, N, 1> cholesky_solve(const Matrix<R, N, N>& l, const Matrix<R, N, 1>& b);
+
+    ///
+    /// Factors a with partial pivoting so that row i of l * u is row
+    /// permutation[i] of a. The unit lower triangle l is stored below the
+    /// diagonal of lu and u on and above it.
+    ///
+    template<class R>
+    bool lu(const Matrix2x2R<R>& a, Matrix2x2R<R>& lu, unsigned (&permutation)[2]);
+
+    template<class R>
+    bool lu(const Matrix3x3R<R>& a, Matrix3x3R<R>& lu, unsigned (&permutation)[3]);
+
+    template<class R>
+    bool lu(const Matrix4x4R<R>& a, Matrix4x4R<R>& lu, unsigned (&permutation)[4]);
+
+    template<class R, unsigned N>
+    bool lu(const Matrix<R, N, N>& a, Matrix<R, N, N>& lu, unsigned (&permutation)[N]);
+
+    ///
+    /// \param lu Factors computed by lu()
+    /// \param permutation Permutation computed by lu()
+    /// \return Solution x of a * x = b
+    template<class R>
+    Vector2R<R> lu_solve(const Matrix2x2R<R>& lu, const unsigned (&permutation)[2], const Vector2R<R>& b);
+
+    template<class R>
+    Vector3R<R> lu_solve(const Matrix3x3R<R>& lu, const unsigned (&permutation)[3], const Vector3R<R>& b);
+
+    template<class R>
+    Vector4R<R> lu_solve(const Matrix4x4R<R>& lu, const unsigned (&permutation)[4], const Vector4R<R>& b);
+
+    template<class R, unsigned N>
+    Matrix<R, N, 1> lu_solve(const Matrix<R, N, N>& lu, const unsigned (&permutation)[N], const Matrix<R, N, 1>& b);
+
+    ///
+    /// Solves a * x = b by LU decomposition with partial pivoting
+    ///
+    template<class R>
+    bool solve(const Matrix2x2R<R>& a, const Vector2R<R>& b, Vector2R<R>& x);
+
+    template<class R>
+    bool solve(const Matrix3x3R<R>& a, const Vector3R<R>& b, Vector3R<R>& x);
+
+    template<class R>
+    bool solve(const Matrix4x4R<R>& a, const Vector4R<R>& b, Vector4R<R>& x);
+
+    template<class R, unsigned N>
+    bool solve(const Matrix<R, N, N>& a, const Matrix<R, N, 1>& b, Matrix<R, N, 1>& x);
+
+    ///
+    /// Solves a * x = b for symmetric positive definite a by Cholesky
+    /// decomposition. Only the lower triangle of a is read.
+    ///
+    template<class R>
+    bool solve_spd(const Matrix2x2R<R>& a, const Vector2R<R>& b, Vector2R<R>& x);
+
+    template<class R>
+    bool solve_spd(const Matrix3x3R<R>& a, const Vector3R<R>& b, Vector3R<R>& x);
+
+    template<class R>
+    bool solve_spd(const Matrix4x4R<R>& a, const Vector4R<R>& b, Vector4R<R>& x);
+
+    template<class R, unsigned N>
+    bool solve_spd(const Matrix<R, N, N>& a, const Matrix<R, N, 1>& b, Matrix<R, N, 1>& x);
+
+    //=====================================================
+    // Batch linear systems
+    //=====================================================
+
+    // Solve a[i] * x[i] = b[i] for i in [0, n). Systems are transposed into
+    // structures of arrays and solved 8 or 16 at a time, one per SIMD lane,
+    // so there is no per-system branching. x[i] is non-finite where a[i] is
+    // singular or, for solve_spd_batch, not positive definite.
+
+    void solve_batch(const mat2x2f* a, const vec2f* b, vec2f* x, std::size_t n);
+    void solve_batch(const mat2x2f* a, const vec2f* b, vec2f* x, std::size_t n, Executor& executor);
+
+    void solve_batch(const mat3x3f* a, const vec3f* b, vec3f* x, std::size_t n);
+    void solve_batch(const mat3x3f* a, const vec3f* b, vec3f* x, std::size_t n, Executor& executor);
+
+    void solve_batch(const mat4x4f* a, const vec4f* b, vec4f* x, std::size_t n);
+    void solve_batch(const mat4x4f* a, const vec4f* b, vec4f* x, std::size_t n, Executor& executor);
+
+    template<unsigned N>
+    void solve_batch(const Matrix<float, N, N>* a, const Matrix<float, N, 1>* b, Matrix<float, N, 1>* x, std::size_t n);
+
+    template<unsigned N>
+    void solve_batch(const Matrix<float, N, N>* a, const Matrix<float, N, 1>* b, Matrix<float, N, 1>* x, std::size_t n, Executor& executor);
+
+    void solve_spd_batch(const mat2x2f* a, const vec2f* b, vec2f* x, std::size_t n);
+    void solve_spd_batch(const mat2x2f* a, const vec2f* b, vec2f* x, std::size_t n, Executor& executor);
+
+    void solve_spd_batch(const mat3x3f* a, const vec3f* b, vec3f* x, std::size_t n);
+    void solve_spd_batch(const mat3x3f* a, const vec3f* b, vec3f* x, std::size_t n, Executor& executor);
+
+    void solve_spd_batch(const mat4x4f* a, const vec4f* b, vec4f* x, std::size_t n);
+    void solve_spd_batch(const mat4x4f* a, const vec4f* b, vec4f* x, std::size_t n, Executor& executor);
+
+    template<unsigned N>
+    void solve_spd_batch(const Matrix<float, N, N>* a, const Matrix<float, N, 1>* b, Matrix<float, N, 1>* x, std::size_t n);
+
+    template<unsigned N>
+    void solve_spd_batch(const Matrix<float, N, N>* a, const Matrix<float, N, 1>* b, Matrix<float, N, 1>* x, std::size_t n, Executor& executor);
+
+}
+
+#include "impl/decompositionsf.ipp"
+#include "impl/solversf.ipp"
+
+#endif //AVML_DECOMPOSITIONS_HPP
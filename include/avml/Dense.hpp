@@ -0,0 +1,319 @@
+#ifndef AVML_DENSE_HPP
+#define AVML_DENSE_HPP
+
+#include <cstddef>
+
+#include "impl/Capabilities.hpp"
+#include "impl/Shared.hpp"
+#include "Instrumentation.hpp"
+#include "Memory.hpp"
+#include "Parallel.hpp"
+
+namespace avml {
+
+    //=====================================================
+    // Matrix
+    //=====================================================
+
+    ///
+    /// Row-major matrix with N rows and M columns whose size is known at
+    /// compile time. Intended for the 16x16 to a few hundred wide range where
+    /// the fixed 2x2/3x3/4x4 types don't apply. Storage is inline, so large
+    /// instances belong on the heap rather than the stack.
+    ///
+    template<class R, unsigned N, unsigned M>
+    class Matrix {
+    public:
+
+        using scalar = R;
+
+        static constexpr unsigned width = M;
+        static constexpr unsigned height = N;
+
+        //=================================================
+        // Creation methods
+        //=================================================
+
+        AVML_FINL static Matrix read(const R* ptr) {
+            Matrix ret;
+            for (unsigned i = 0; i < N * M; ++i) {
+                ret.elements[i] = ptr[i];
+            }
+            return ret;
+        }
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        ///
+        /// \param d Value of the elements on the main diagonal. All other
+        /// elements are zero.
+        AVML_FINL explicit Matrix(R d):
+            elements() {
+
+            for (unsigned i = 0; i < N && i < M; ++i) {
+                elements[i * M + i] = d;
+            }
+        }
+
+        Matrix() = default;
+        Matrix(const Matrix&) = default;
+        Matrix(Matrix&&) = default;
+        ~Matrix() = default;
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        Matrix& operator=(const Matrix&) = default;
+        Matrix& operator=(Matrix&&) = default;
+
+        //=================================================
+        // Unary arithmetic operators
+        //=================================================
+
+        AVML_FINL Matrix operator+() const {
+            return *this;
+        }
+
+        AVML_FINL Matrix operator-() const {
+            Matrix ret;
+            for (unsigned i = 0; i < N * M; ++i) {
+                ret.elements[i] = -elements[i];
+            }
+            return ret;
+        }
+
+        //=================================================
+        // Arithmetic assignment operators
+        //=================================================
+
+        AVML_FINL Matrix& operator*=(R rhs) {
+            for (unsigned i = 0; i < N * M; ++i) {
+                elements[i] *= rhs;
+            }
+            return *this;
+        }
+
+        AVML_FINL Matrix& operator/=(R rhs) {
+            for (unsigned i = 0; i < N * M; ++i) {
+                elements[i] /= rhs;
+            }
+            return *this;
+        }
+
+        AVML_FINL Matrix& operator+=(const Matrix& rhs) {
+            for (unsigned i = 0; i < N * M; ++i) {
+                elements[i] += rhs.elements[i];
+            }
+            return *this;
+        }
+
+        AVML_FINL Matrix& operator-=(const Matrix& rhs) {
+            for (unsigned i = 0; i < N * M; ++i) {
+                elements[i] -= rhs.elements[i];
+            }
+            return *this;
+        }
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        AVML_FINL R& operator()(unsigned i, unsigned j) {
+            return elements[i * M + j];
+        }
+
+        AVML_FINL const R& operator()(unsigned i, unsigned j) const {
+            return elements[i * M + j];
+        }
+
+        AVML_FINL R* data() {
+            return elements;
+        }
+
+        AVML_FINL const R* data() const {
+            return elements;
+        }
+
+    private:
+
+        R elements[N * M];
+
+    };
+
+    template<class R, unsigned N, unsigned M>
+    bool operator==(const Matrix<R, N, M>& lhs, const Matrix<R, N, M>& rhs);
+
+    template<class R, unsigned N, unsigned M>
+    bool operator!=(const Matrix<R, N, M>& lhs, const Matrix<R, N, M>& rhs);
+
+    template<class R, unsigned N, unsigned M>
+    Matrix<R, N, M> operator+(Matrix<R, N, M> lhs, const Matrix<R, N, M>& rhs);
+
+    template<class R, unsigned N, unsigned M>
+    Matrix<R, N, M> operator-(Matrix<R, N, M> lhs, const Matrix<R, N, M>& rhs);
+
+    template<class R, unsigned N, unsigned M>
+    Matrix<R, N, M> operator*(Matrix<R, N, M> lhs, R rhs);
+
+    template<class R, unsigned N, unsigned M>
+    Matrix<R, N, M> operator*(R lhs, Matrix<R, N, M> rhs);
+
+    template<class R, unsigned N, unsigned K, unsigned M>
+    Matrix<R, N, M> operator*(const Matrix<R, N, K>& lhs, const Matrix<R, K, M>& rhs);
+
+    template<class R, unsigned N, unsigned M>
+    Matrix<R, M, N> transpose(const Matrix<R, N, M>& m);
+
+    //=====================================================
+    // Dynamic_matrix
+    //=====================================================
+
+    ///
+    /// Row-major matrix whose size is chosen at runtime. Rows are stored
+    /// contiguously in storage aligned to default_alignment.
+    ///
+    template<class R>
+    class Dynamic_matrix {
+    public:
+
+        using scalar = R;
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        ///
+        /// \param height Number of rows
+        /// \param width Number of columns
+        /// \param value Initial value of every element
+        Dynamic_matrix(std::size_t height, std::size_t width, R value = R(0)):
+            num_rows(height),
+            num_cols(width),
+            elements(height * width, value) {}
+
+        Dynamic_matrix() = default;
+        Dynamic_matrix(const Dynamic_matrix&) = default;
+        Dynamic_matrix(Dynamic_matrix&&) = default;
+        ~Dynamic_matrix() = default;
+
+        ///
+        /// \return Square matrix of size n with ones on its main diagonal
+        static Dynamic_matrix identity(std::size_t n) {
+            Dynamic_matrix ret{n, n};
+            for (std::size_t i = 0; i < n; ++i) {
+                ret(i, i) = R(1);
+            }
+            return ret;
+        }
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        Dynamic_matrix& operator=(const Dynamic_matrix&) = default;
+        Dynamic_matrix& operator=(Dynamic_matrix&&) = default;
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        AVML_FINL R& operator()(std::size_t i, std::size_t j) {
+            return elements[i * num_cols + j];
+        }
+
+        AVML_FINL const R& operator()(std::size_t i, std::size_t j) const {
+            return elements[i * num_cols + j];
+        }
+
+        AVML_FINL R* data() {
+            return elements.data();
+        }
+
+        AVML_FINL const R* data() const {
+            return elements.data();
+        }
+
+        AVML_FINL std::size_t height() const {
+            return num_rows;
+        }
+
+        AVML_FINL std::size_t width() const {
+            return num_cols;
+        }
+
+    private:
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        std::size_t num_rows = 0;
+        std::size_t num_cols = 0;
+
+        aligned_vector<R> elements;
+
+    };
+
+    using dynamic_matf = Dynamic_matrix<float>;
+    using dynamic_matd = Dynamic_matrix<double>;
+
+    template<class R>
+    bool operator==(const Dynamic_matrix<R>& lhs, const Dynamic_matrix<R>& rhs);
+
+    template<class R>
+    bool operator!=(const Dynamic_matrix<R>& lhs, const Dynamic_matrix<R>& rhs);
+
+    ///
+    /// \return lhs * rhs. lhs.width() must equal rhs.height().
+    template<class R>
+    Dynamic_matrix<R> operator*(const Dynamic_matrix<R>& lhs, const Dynamic_matrix<R>& rhs);
+
+    template<class R>
+    Dynamic_matrix<R> transpose(const Dynamic_matrix<R>& m);
+
+    //=====================================================
+    // General matrix multiply
+    //=====================================================
+
+    ///
+    /// Computes C = alpha * A * B + beta * C for row-major A (m x k), B (k x n)
+    /// and C (m x n) with row strides lda, ldb and ldc. When beta is zero, C is
+    /// not read, so it may be uninitialized. C must not overlap A or B.
+    ///
+    /// Panels of A and B are packed into contiguous buffers and multiplied by
+    /// a register-blocked micro-kernel. The executor overload spreads packing
+    /// and the blocks of C across threads.
+    ///
+    template<class R>
+    void gemm(
+        std::size_t m, std::size_t n, std::size_t k,
+        R alpha, const R* a, std::size_t lda, const R* b, std::size_t ldb,
+        R beta, R* c, std::size_t ldc
+    );
+
+    template<class R>
+    void gemm(
+        std::size_t m, std::size_t n, std::size_t k,
+        R alpha, const R* a, std::size_t lda, const R* b, std::size_t ldb,
+        R beta, R* c, std::size_t ldc,
+        Executor& executor
+    );
+
+    ///
+    /// Computes c = alpha * a * b + beta * c
+    ///
+    /// \return False, leaving c untouched, if the dimensions don't agree
+    template<class R>
+    bool gemm(R alpha, const Dynamic_matrix<R>& a, const Dynamic_matrix<R>& b, R beta, Dynamic_matrix<R>& c);
+
+    template<class R>
+    bool gemm(R alpha, const Dynamic_matrix<R>& a, const Dynamic_matrix<R>& b, R beta, Dynamic_matrix<R>& c, Executor& executor);
+
+}
+
+#include "impl/Dense.ipp"
+
+#endif //AVML_DENSE_HPP
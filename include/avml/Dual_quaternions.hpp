@@ -0,0 +1,27 @@
+#ifndef AVML_DUAL_QUATERNIONS_HPP
+#define AVML_DUAL_QUATERNIONS_HPP
+
+#include "Vectors.hpp"
+#include "Matrices.hpp"
+
+namespace avml {
+
+    template<class R>
+    class Dual_quaternionR;
+
+}
+
+#include "impl/generic/dualquatr.hpp"
+
+namespace avml {
+
+    //=====================================================
+    // Type aliases
+    //=====================================================
+
+    using dualquatf = Dual_quaternionR<float>;
+    using dualquatd = Dual_quaternionR<double>;
+
+}
+
+#endif //AVML_DUAL_QUATERNIONS_HPP
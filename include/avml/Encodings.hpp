@@ -0,0 +1,99 @@
+#ifndef AVML_ENCODINGS_HPP
+#define AVML_ENCODINGS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Vectors.hpp"
+#include "Parallel.hpp"
+
+namespace avml {
+
+    //=====================================================
+    // Packed types
+    //=====================================================
+
+    ///
+    /// Two 12-bit snorm octahedral coordinates packed into three bytes
+    ///
+    struct Packed_oct24 {
+        std::uint8_t bytes[3];
+    };
+
+    ///
+    /// Three 16-bit snorm components
+    ///
+    struct Packed_snorm16x3 {
+        std::int16_t elements[3];
+    };
+
+    static_assert(sizeof(Packed_oct24) == 3, "");
+    static_assert(sizeof(Packed_snorm16x3) == 6, "");
+
+    //=====================================================
+    // Error bounds
+    //=====================================================
+
+    // Maximum angle, in radians, between a unit vector and the result of
+    // encoding and then decoding it.
+
+    constexpr float oct32_max_error = 8.0e-5f;
+    constexpr float oct24_max_error = 1.3e-3f;
+    constexpr float snorm16x3_max_error = 3.0e-5f;
+    constexpr float snorm1010102_max_error = 1.8e-3f;
+
+    //=====================================================
+    // Single vector encodings
+    //=====================================================
+
+    std::uint32_t encode_oct32(uvec3f v);
+    uvec3f decode_oct32(std::uint32_t v);
+
+    Packed_oct24 encode_oct24(uvec3f v);
+    uvec3f decode_oct24(Packed_oct24 v);
+
+    Packed_snorm16x3 encode_snorm16x3(uvec3f v);
+    uvec3f decode_snorm16x3(Packed_snorm16x3 v);
+
+    ///
+    /// \param v Unit vector to encode into the low 30 bits
+    /// \param w Two-bit value stored in the high bits, e.g. tangent handedness
+    /// \return 10:10:10:2 encoding of v and w
+    std::uint32_t encode_snorm1010102(uvec3f v, std::uint32_t w = 0);
+    uvec3f decode_snorm1010102(std::uint32_t v);
+
+    std::uint32_t extract_snorm1010102_w(std::uint32_t v);
+
+    //=====================================================
+    // Batch encodings
+    //=====================================================
+
+    void encode_oct32(const uvec3f* in, std::uint32_t* out, std::size_t n);
+    void decode_oct32(const std::uint32_t* in, uvec3f* out, std::size_t n);
+
+    void encode_oct24(const uvec3f* in, Packed_oct24* out, std::size_t n);
+    void decode_oct24(const Packed_oct24* in, uvec3f* out, std::size_t n);
+
+    void encode_snorm16x3(const uvec3f* in, Packed_snorm16x3* out, std::size_t n);
+    void decode_snorm16x3(const Packed_snorm16x3* in, uvec3f* out, std::size_t n);
+
+    void encode_snorm1010102(const uvec3f* in, std::uint32_t* out, std::size_t n);
+    void decode_snorm1010102(const std::uint32_t* in, uvec3f* out, std::size_t n);
+
+    void encode_oct32(const uvec3f* in, std::uint32_t* out, std::size_t n, Executor& executor);
+    void decode_oct32(const std::uint32_t* in, uvec3f* out, std::size_t n, Executor& executor);
+
+    void encode_oct24(const uvec3f* in, Packed_oct24* out, std::size_t n, Executor& executor);
+    void decode_oct24(const Packed_oct24* in, uvec3f* out, std::size_t n, Executor& executor);
+
+    void encode_snorm16x3(const uvec3f* in, Packed_snorm16x3* out, std::size_t n, Executor& executor);
+    void decode_snorm16x3(const Packed_snorm16x3* in, uvec3f* out, std::size_t n, Executor& executor);
+
+    void encode_snorm1010102(const uvec3f* in, std::uint32_t* out, std::size_t n, Executor& executor);
+    void decode_snorm1010102(const std::uint32_t* in, uvec3f* out, std::size_t n, Executor& executor);
+
+}
+
+#include "impl/encodingsf.ipp"
+
+#endif //AVML_ENCODINGS_HPP
@@ -0,0 +1,69 @@
+#ifndef AVML_GEOMETRY_HPP
+#define AVML_GEOMETRY_HPP
+
+#include "Vectors.hpp"
+#include "Matrices.hpp"
+
+namespace avml {
+
+    template<class R>
+    class Aabb3R;
+
+    template<class R>
+    class SphereR;
+
+    template<class R>
+    class CapsuleR;
+
+    template<class R>
+    class ObbR;
+
+    template<class R>
+    class PlaneR;
+
+    template<class R>
+    class LineR;
+
+    template<class R>
+    class SegmentR;
+
+}
+
+#include "impl/generic/aabb3r.hpp"
+#include "impl/generic/spherer.hpp"
+#include "impl/generic/capsuler.hpp"
+#include "impl/generic/obbr.hpp"
+#include "impl/generic/planer.hpp"
+#include "impl/generic/liner.hpp"
+#include "impl/generic/segmentr.hpp"
+
+namespace avml {
+
+    //=================================
+    // Type aliases
+    //=================================
+
+    using aabb3f = Aabb3R<float>;
+    using aabb3d = Aabb3R<double>;
+
+    using spheref = SphereR<float>;
+    using sphered = SphereR<double>;
+
+    using capsulef = CapsuleR<float>;
+    using capsuled = CapsuleR<double>;
+
+    using obbf = ObbR<float>;
+    using obbd = ObbR<double>;
+
+    using planef = PlaneR<float>;
+    using planed = PlaneR<double>;
+
+    using linef = LineR<float>;
+    using lined = LineR<double>;
+
+    using segmentf = SegmentR<float>;
+    using segmentd = SegmentR<double>;
+
+}
+
+#endif //AVML_GEOMETRY_HPP
@@ -0,0 +1,73 @@
+#ifndef AVML_INSTRUMENTATION_HPP
+#define AVML_INSTRUMENTATION_HPP
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "impl/Capabilities.hpp"
+
+//=========================================================
+// Profiling macros
+//=========================================================
+
+// When AVML_INSTRUMENT is defined, every public function containing one of
+// these macros counts its calls, the number of elements it processed, and
+// the timestamp counter cycles spent inside of it. Counts are kept per
+// thread and summed by profile_snapshot(). Cycles are inclusive of nested
+// instrumented calls. Without AVML_INSTRUMENT the macros expand to nothing.
+
+#if defined(AVML_INSTRUMENT)
+
+    // Maximum number of distinct instrumented functions
+    #ifndef AVML_INSTRUMENT_MAX_SITES
+        #define AVML_INSTRUMENT_MAX_SITES 256
+    #endif
+
+    #define AVML_PROFILE_BATCH(name, n) \
+        static const std::size_t avml_profile_site = ::avml_impl::register_profile_site(name); \
+        const ::avml_impl::Profile_scope avml_profile_scope{avml_profile_site, static_cast<std::uint64_t>(n)}
+
+#else
+
+    #define AVML_PROFILE_BATCH(name, n)
+
+#endif
+
+#define AVML_PROFILE(name) AVML_PROFILE_BATCH(name, 1)
+
+namespace avml {
+
+    ///
+    /// Accumulated statistics for one instrumented function
+    ///
+    struct Profile_entry {
+        std::string name;
+        std::uint64_t calls;
+        std::uint64_t elements;
+        std::uint64_t cycles;
+    };
+
+    ///
+    /// \return Totals for every instrumented function which has been called,
+    /// summed over all threads and sorted by descending cycle count. Empty
+    /// unless AVML_INSTRUMENT is defined.
+    std::vector<Profile_entry> profile_snapshot();
+
+    ///
+    /// Zeroes all counters. Counts from calls running concurrently with
+    /// this may be lost.
+    ///
+    void profile_reset();
+
+    ///
+    /// Writes profile_snapshot() to stream as a table
+    ///
+    void profile_report(std::ostream& stream);
+
+}
+
+#include "impl/Instrumentation.ipp"
+
+#endif //AVML_INSTRUMENTATION_HPP
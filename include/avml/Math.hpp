@@ -1,10 +1,12 @@
 #ifndef AVML_MATH_HPP
 #define AVML_MATH_HPP
 
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 
 #include "impl/Capabilities.hpp"
+#include "Vectors.hpp"
 
 namespace avml {
 
@@ -32,7 +34,7 @@ namespace avml {
     double fmnadd(double m, double x, double b);
 
     double fmsub(double m, double x, double b);
-    double fmsub(double m, double x, double b);
+    double fmnsub(double m, double x, double b);
 
     double fract(double x);
 
@@ -42,6 +44,198 @@ namespace avml {
 
     bool compare_equal(double x, double y, std::uint64_t margin);
 
+    //=====================================================
+    // Interpolation
+    //=====================================================
+
+    ///
+    /// \return a * (1 - t) + b * t, exact at t = 0 and t = 1
+    float lerp(float a, float b, float t);
+    double lerp(double a, double b, double t);
+
+    ///
+    /// Same as lerp, under its GLSL name
+    ///
+    float mix(float a, float b, float t);
+    double mix(double a, double b, double t);
+
+    ///
+    /// \return 0 if x < edge and 1 otherwise
+    float step(float edge, float x);
+    double step(double edge, double x);
+
+    ///
+    /// Hermite interpolation between 0 at edge0 and 1 at edge1, clamped
+    /// outside of that range. edge0 must be less than edge1.
+    ///
+    float smoothstep(float edge0, float edge1, float x);
+    double smoothstep(double edge0, double edge1, double x);
+
+    ///
+    /// \return x clamped to [0, 1]
+    float saturate(float x);
+    double saturate(double x);
+
+    //=====================================================
+    // Component-wise vector math
+    //=====================================================
+
+    // Apply the scalar function of the same name to each component. Float
+    // vectors are computed in a single SSE register, in which case the
+    // multiply-adds are only fused when AVML_FMA is defined, which AVML_AVX2
+    // implies when the compiler is allowed to emit FMA instructions.
+
+    template<class R>
+    Vector2R<R> fmadd(Vector2R<R> m, Vector2R<R> x, Vector2R<R> b);
+    template<class R>
+    Vector3R<R> fmadd(Vector3R<R> m, Vector3R<R> x, Vector3R<R> b);
+    template<class R>
+    Vector4R<R> fmadd(Vector4R<R> m, Vector4R<R> x, Vector4R<R> b);
+
+    template<class R>
+    Vector2R<R> fmnadd(Vector2R<R> m, Vector2R<R> x, Vector2R<R> b);
+    template<class R>
+    Vector3R<R> fmnadd(Vector3R<R> m, Vector3R<R> x, Vector3R<R> b);
+    template<class R>
+    Vector4R<R> fmnadd(Vector4R<R> m, Vector4R<R> x, Vector4R<R> b);
+
+    template<class R>
+    Vector2R<R> fmsub(Vector2R<R> m, Vector2R<R> x, Vector2R<R> b);
+    template<class R>
+    Vector3R<R> fmsub(Vector3R<R> m, Vector3R<R> x, Vector3R<R> b);
+    template<class R>
+    Vector4R<R> fmsub(Vector4R<R> m, Vector4R<R> x, Vector4R<R> b);
+
+    template<class R>
+    Vector2R<R> fmnsub(Vector2R<R> m, Vector2R<R> x, Vector2R<R> b);
+    template<class R>
+    Vector3R<R> fmnsub(Vector3R<R> m, Vector3R<R> x, Vector3R<R> b);
+    template<class R>
+    Vector4R<R> fmnsub(Vector4R<R> m, Vector4R<R> x, Vector4R<R> b);
+
+    template<class R>
+    Vector2R<R> fract(Vector2R<R> x);
+    template<class R>
+    Vector3R<R> fract(Vector3R<R> x);
+    template<class R>
+    Vector4R<R> fract(Vector4R<R> x);
+
+    template<class R>
+    Vector2R<R> clamp(Vector2R<R> x, Vector2R<R> min, Vector2R<R> max);
+    template<class R>
+    Vector3R<R> clamp(Vector3R<R> x, Vector3R<R> min, Vector3R<R> max);
+    template<class R>
+    Vector4R<R> clamp(Vector4R<R> x, Vector4R<R> min, Vector4R<R> max);
+
+    template<class R>
+    Vector2R<R> clamp(Vector2R<R> x, R min, R max);
+    template<class R>
+    Vector3R<R> clamp(Vector3R<R> x, R min, R max);
+    template<class R>
+    Vector4R<R> clamp(Vector4R<R> x, R min, R max);
+
+    template<class R>
+    Vector2R<R> average(Vector2R<R> x, Vector2R<R> y);
+    template<class R>
+    Vector3R<R> average(Vector3R<R> x, Vector3R<R> y);
+    template<class R>
+    Vector4R<R> average(Vector4R<R> x, Vector4R<R> y);
+
+    template<class R>
+    Vector2R<R> lerp(Vector2R<R> a, Vector2R<R> b, Vector2R<R> t);
+    template<class R>
+    Vector3R<R> lerp(Vector3R<R> a, Vector3R<R> b, Vector3R<R> t);
+    template<class R>
+    Vector4R<R> lerp(Vector4R<R> a, Vector4R<R> b, Vector4R<R> t);
+
+    template<class R>
+    Vector2R<R> lerp(Vector2R<R> a, Vector2R<R> b, R t);
+    template<class R>
+    Vector3R<R> lerp(Vector3R<R> a, Vector3R<R> b, R t);
+    template<class R>
+    Vector4R<R> lerp(Vector4R<R> a, Vector4R<R> b, R t);
+
+    template<class R>
+    Vector2R<R> mix(Vector2R<R> a, Vector2R<R> b, Vector2R<R> t);
+    template<class R>
+    Vector3R<R> mix(Vector3R<R> a, Vector3R<R> b, Vector3R<R> t);
+    template<class R>
+    Vector4R<R> mix(Vector4R<R> a, Vector4R<R> b, Vector4R<R> t);
+
+    template<class R>
+    Vector2R<R> mix(Vector2R<R> a, Vector2R<R> b, R t);
+    template<class R>
+    Vector3R<R> mix(Vector3R<R> a, Vector3R<R> b, R t);
+    template<class R>
+    Vector4R<R> mix(Vector4R<R> a, Vector4R<R> b, R t);
+
+    template<class R>
+    Vector2R<R> step(Vector2R<R> edge, Vector2R<R> x);
+    template<class R>
+    Vector3R<R> step(Vector3R<R> edge, Vector3R<R> x);
+    template<class R>
+    Vector4R<R> step(Vector4R<R> edge, Vector4R<R> x);
+
+    template<class R>
+    Vector2R<R> step(R edge, Vector2R<R> x);
+    template<class R>
+    Vector3R<R> step(R edge, Vector3R<R> x);
+    template<class R>
+    Vector4R<R> step(R edge, Vector4R<R> x);
+
+    template<class R>
+    Vector2R<R> smoothstep(Vector2R<R> edge0, Vector2R<R> edge1, Vector2R<R> x);
+    template<class R>
+    Vector3R<R> smoothstep(Vector3R<R> edge0, Vector3R<R> edge1, Vector3R<R> x);
+    template<class R>
+    Vector4R<R> smoothstep(Vector4R<R> edge0, Vector4R<R> edge1, Vector4R<R> x);
+
+    template<class R>
+    Vector2R<R> smoothstep(R edge0, R edge1, Vector2R<R> x);
+    template<class R>
+    Vector3R<R> smoothstep(R edge0, R edge1, Vector3R<R> x);
+    template<class R>
+    Vector4R<R> smoothstep(R edge0, R edge1, Vector4R<R> x);
+
+    template<class R>
+    Vector2R<R> saturate(Vector2R<R> x);
+    template<class R>
+    Vector3R<R> saturate(Vector3R<R> x);
+    template<class R>
+    Vector4R<R> saturate(Vector4R<R> x);
+
+    //=====================================================
+    // Array math
+    //=====================================================
+
+    // out[i] is the scalar function applied to the i-th element of each
+    // input. out may be the same array as any of the inputs.
+    //
+    // Elements are computed several at a time in SIMD lanes, whose
+    // multiply-adds, including those of lerp, are only fused when AVML_FMA
+    // is defined or with AVX-512. Otherwise the product is rounded
+    // before the sum, whereas the scalar functions always use std::fma, so
+    // out[i] may differ from them in the last place. Elements past the last
+    // full group of lanes are computed by the scalar functions.
+
+    void fmadd(const float* m, const float* x, const float* b, float* out, std::size_t n);
+    void fmnadd(const float* m, const float* x, const float* b, float* out, std::size_t n);
+
+    void fmsub(const float* m, const float* x, const float* b, float* out, std::size_t n);
+    void fmnsub(const float* m, const float* x, const float* b, float* out, std::size_t n);
+
+    void fract(const float* x, float* out, std::size_t n);
+
+    void clamp(const float* x, float min, float max, float* out, std::size_t n);
+
+    void average(const float* x, const float* y, float* out, std::size_t n);
+
+    void lerp(const float* a, const float* b, const float* t, float* out, std::size_t n);
+
+    void smoothstep(float edge0, float edge1, const float* x, float* out, std::size_t n);
+
+    void saturate(const float* x, float* out, std::size_t n);
+
 }
 
 #include "impl/Math.hpp"
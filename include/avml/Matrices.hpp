@@ -14,6 +14,9 @@ namespace avml {
     template<class T>
     class Matrix4x4R;
 
+    template<class T>
+    class Affine3x4R;
+
 
     template<class T>
     class Matrix2x2I;
@@ -29,10 +32,13 @@ namespace avml {
 #include "impl/generic/mat2x2r.hpp"
 #include "impl/generic/mat3x3r.hpp"
 #include "impl/generic/mat4x4r.hpp"
+#include "impl/generic/affine3x4r.hpp"
 
 #include "impl/mat2x2f.ipp"
 //#include "impl/mat3x3f.ipp"
 //#include "impl/mat4x4f.ipp"
+#include "impl/mat4x4f_products.ipp"
+#include "impl/affine3x4f.ipp"
 
 namespace avml {
 
@@ -48,6 +54,9 @@ namespace avml {
     using mat3x3d = Matrix3x3R<double>;
     using mat4x4d = Matrix4x4R<double>;
 
+    using affine3x4f = Affine3x4R<float>;
+    using affine3x4d = Affine3x4R<double>;
+
 
     using mat2x2i = Matrix2x2I<std::int32_t>;
     using mat3x3i = Matrix3x3I<std::int32_t>;
@@ -0,0 +1,312 @@
+#ifndef AVML_MEMORY_HPP
+#define AVML_MEMORY_HPP
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "impl/Capabilities.hpp"
+
+//=========================================================
+// Allocation padding
+//=========================================================
+
+// Number of bytes reserved past the end of every allocation made through
+// this header so that full-width SIMD loads which run past the last element
+// stay within mapped memory. The contents of these bytes are unspecified.
+#ifndef AVML_ALLOCATION_PADDING
+    #define AVML_ALLOCATION_PADDING 64
+#endif
+
+namespace avml {
+
+    ///
+    /// Alignment used by the allocators below unless otherwise specified.
+    /// Equal to a cache line and to the widest supported register, so it
+    /// satisfies vector_alignment<T, N>() for every AVML vector and matrix.
+    ///
+    constexpr std::size_t default_alignment = 64;
+
+    //=====================================================
+    // Aligned_allocator
+    //=====================================================
+
+    ///
+    /// Standard allocator returning storage aligned to at least A bytes and
+    /// followed by AVML_ALLOCATION_PADDING bytes of padding
+    ///
+    template<class T, std::size_t A = default_alignment>
+    class Aligned_allocator {
+    public:
+
+        static_assert((A & (A - 1)) == 0, "Alignment must be a power of two");
+
+        using value_type = T;
+
+        static constexpr std::size_t alignment = (A < alignof(T)) ? alignof(T) : A;
+
+        template<class U>
+        struct rebind {
+            using other = Aligned_allocator<U, A>;
+        };
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        Aligned_allocator() = default;
+
+        template<class U>
+        Aligned_allocator(const Aligned_allocator<U, A>&) noexcept {}
+
+        //=================================================
+        // Allocation methods
+        //=================================================
+
+        T* allocate(std::size_t n);
+
+        void deallocate(T* p, std::size_t n) noexcept;
+
+    };
+
+    template<class T, class U, std::size_t A>
+    bool operator==(const Aligned_allocator<T, A>&, const Aligned_allocator<U, A>&) {
+        return true;
+    }
+
+    template<class T, class U, std::size_t A>
+    bool operator!=(const Aligned_allocator<T, A>&, const Aligned_allocator<U, A>&) {
+        return false;
+    }
+
+    ///
+    /// std::vector whose data() is aligned to default_alignment and may be
+    /// read past its end by up to AVML_ALLOCATION_PADDING bytes
+    ///
+    template<class T>
+    using aligned_vector = std::vector<T, Aligned_allocator<T>>;
+
+    //=====================================================
+    // Arena
+    //=====================================================
+
+    ///
+    /// Bump allocator which hands out memory from large blocks and releases
+    /// all of it at once. Destructors of objects placed in an arena are never
+    /// run, so it only accepts trivially destructible types.
+    ///
+    /// Typical use is per-frame scratch memory: allocate freely during the
+    /// frame then call reset() at its end. Blocks are kept across resets so a
+    /// steady-state frame performs no heap allocations.
+    ///
+    class Arena {
+    public:
+
+        ///
+        /// Position in an arena which it can be rewound to
+        ///
+        struct Marker {
+            std::size_t block;
+            std::size_t offset;
+        };
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        ///
+        /// \param block_size Usable size, in bytes, of each block. Larger
+        /// allocations get a block of their own.
+        explicit Arena(std::size_t block_size = 64 * 1024);
+        Arena(const Arena&) = delete;
+        Arena(Arena&&) noexcept;
+        ~Arena();
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        Arena& operator=(const Arena&) = delete;
+        Arena& operator=(Arena&&) noexcept;
+
+        //=================================================
+        // Allocation methods
+        //=================================================
+
+        ///
+        /// \param size Number of bytes to allocate
+        /// \param alignment Power of two which the result is aligned to
+        /// \return Uninitialized storage valid until the arena is reset or
+        /// rewound past this allocation
+        void* allocate(std::size_t size, std::size_t alignment = default_alignment);
+
+        ///
+        /// \return Uninitialized storage for n objects of type T
+        template<class T>
+        T* allocate(std::size_t n = 1) {
+            static_assert(std::is_trivially_destructible<T>::value, "Arena never runs destructors");
+            std::size_t a = (alignof(T) < default_alignment) ? default_alignment : alignof(T);
+            return static_cast<T*>(allocate(n * sizeof(T), a));
+        }
+
+        ///
+        /// \return Object of type T constructed from args
+        template<class T, class...Args>
+        T* create(Args&&...args) {
+            return new (allocate<T>(1)) T(std::forward<Args>(args)...);
+        }
+
+        //=================================================
+        // Mutators
+        //=================================================
+
+        ///
+        /// Releases every allocation made from the arena
+        ///
+        void reset();
+
+        ///
+        /// \return Current position which later allocations come after
+        Marker mark() const;
+
+        ///
+        /// Releases every allocation made since m was obtained
+        ///
+        void rewind(Marker m);
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        ///
+        /// \return Number of bytes held in blocks, including unused space
+        std::size_t capacity() const;
+
+    private:
+
+        struct Block {
+            char* data;
+            std::size_t size;
+        };
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        std::vector<Block> blocks;
+
+        std::size_t block_size;
+
+        std::size_t current = 0;
+
+        std::size_t offset = 0;
+
+        //=================================================
+        // Helper functions
+        //=================================================
+
+        void release();
+
+    };
+
+    ///
+    /// RAII wrapper which rewinds an arena to where it was on construction
+    ///
+    class Arena_scope {
+    public:
+
+        explicit Arena_scope(Arena& arena):
+            arena(arena),
+            marker(arena.mark()) {}
+
+        Arena_scope(const Arena_scope&) = delete;
+
+        ~Arena_scope() {
+            arena.rewind(marker);
+        }
+
+        Arena_scope& operator=(const Arena_scope&) = delete;
+
+    private:
+
+        Arena& arena;
+
+        Arena::Marker marker;
+
+    };
+
+    //=====================================================
+    // Arena_allocator
+    //=====================================================
+
+    ///
+    /// Standard allocator drawing from an Arena. deallocate() is a no-op so
+    /// memory is only reclaimed when the arena is reset or rewound.
+    ///
+    template<class T>
+    class Arena_allocator {
+    public:
+
+        using value_type = T;
+
+        template<class U>
+        struct rebind {
+            using other = Arena_allocator<U>;
+        };
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        explicit Arena_allocator(Arena& arena) noexcept:
+            arena_ptr(&arena) {}
+
+        template<class U>
+        Arena_allocator(const Arena_allocator<U>& other) noexcept:
+            arena_ptr(&other.arena()) {}
+
+        //=================================================
+        // Allocation methods
+        //=================================================
+
+        T* allocate(std::size_t n) {
+            std::size_t a = (alignof(T) < default_alignment) ? default_alignment : alignof(T);
+            return static_cast<T*>(arena_ptr->allocate(n * sizeof(T), a));
+        }
+
+        void deallocate(T*, std::size_t) noexcept {}
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        Arena& arena() const noexcept {
+            return *arena_ptr;
+        }
+
+    private:
+
+        Arena* arena_ptr;
+
+    };
+
+    template<class T, class U>
+    bool operator==(const Arena_allocator<T>& lhs, const Arena_allocator<U>& rhs) {
+        return &lhs.arena() == &rhs.arena();
+    }
+
+    template<class T, class U>
+    bool operator!=(const Arena_allocator<T>& lhs, const Arena_allocator<U>& rhs) {
+        return !(lhs == rhs);
+    }
+
+    template<class T>
+    using arena_vector = std::vector<T, Arena_allocator<T>>;
+
+}
+
+#include "impl/Memory.ipp"
+
+#endif //AVML_MEMORY_HPP
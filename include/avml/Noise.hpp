@@ -0,0 +1,96 @@
+#ifndef AVML_NOISE_HPP
+#define AVML_NOISE_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Vectors.hpp"
+#include "Parallel.hpp"
+
+namespace avml {
+
+    //=====================================================
+    // Noise functions
+    //=====================================================
+
+    // Lattice noise hashed from integer cell coordinates, so it is
+    // deterministic across platforms and instruction sets up to floating
+    // point rounding. seed selects an independent noise field.
+    //
+    // value, perlin and simplex noise lie approximately in [-1, 1]. worley
+    // noise is the distance to the nearest of one random feature point per
+    // cell. It is mostly below 1 and never above sqrt(dimensions).
+
+    enum class Noise_basis {
+        value,
+        perlin,
+        simplex,
+        worley
+    };
+
+    float value_noise(vec2f p, std::uint32_t seed = 0);
+    float value_noise(vec3f p, std::uint32_t seed = 0);
+    float value_noise(vec4f p, std::uint32_t seed = 0);
+
+    float perlin_noise(vec2f p, std::uint32_t seed = 0);
+    float perlin_noise(vec3f p, std::uint32_t seed = 0);
+    float perlin_noise(vec4f p, std::uint32_t seed = 0);
+
+    float simplex_noise(vec2f p, std::uint32_t seed = 0);
+    float simplex_noise(vec3f p, std::uint32_t seed = 0);
+    float simplex_noise(vec4f p, std::uint32_t seed = 0);
+
+    float worley_noise(vec2f p, std::uint32_t seed = 0);
+    float worley_noise(vec3f p, std::uint32_t seed = 0);
+    float worley_noise(vec4f p, std::uint32_t seed = 0);
+
+    //=====================================================
+    // Fractal noise
+    //=====================================================
+
+    struct Fbm_settings {
+        /// Seed of the first octave. Each following octave uses the next.
+        std::uint32_t seed = 0;
+
+        unsigned octaves = 6;
+
+        /// Frequency multiplier between octaves
+        float lacunarity = 2.0f;
+
+        /// Amplitude multiplier between octaves
+        float gain = 0.5f;
+    };
+
+    ///
+    /// Fractal Brownian motion: sum of octaves of basis noise at increasing
+    /// frequency and decreasing amplitude, divided by the sum of amplitudes
+    /// so that the range matches that of a single octave
+    ///
+    float fbm(Noise_basis basis, vec2f p, const Fbm_settings& settings);
+    float fbm(Noise_basis basis, vec3f p, const Fbm_settings& settings);
+    float fbm(Noise_basis basis, vec4f p, const Fbm_settings& settings);
+
+    //=====================================================
+    // Batch noise
+    //=====================================================
+
+    // Coordinates are given as separate arrays so that 8 or 16 points can be
+    // loaded into SIMD lanes directly. out[i] is the noise at point i.
+    // Points left over after the last full group of lanes use the scalar
+    // fbm(), which the compiler may contract into multiply-adds differently,
+    // so results can differ in the last places from one call or chunking to
+    // another.
+
+    void fbm_batch(Noise_basis basis, const Fbm_settings& settings, const float* x, const float* y, float* out, std::size_t n);
+    void fbm_batch(Noise_basis basis, const Fbm_settings& settings, const float* x, const float* y, const float* z, float* out, std::size_t n);
+    void fbm_batch(Noise_basis basis, const Fbm_settings& settings, const float* x, const float* y, const float* z, const float* w, float* out, std::size_t n);
+
+    void fbm_batch(Noise_basis basis, const Fbm_settings& settings, const float* x, const float* y, float* out, std::size_t n, Executor& executor);
+    void fbm_batch(Noise_basis basis, const Fbm_settings& settings, const float* x, const float* y, const float* z, float* out, std::size_t n, Executor& executor);
+    void fbm_batch(Noise_basis basis, const Fbm_settings& settings, const float* x, const float* y, const float* z, const float* w, float* out, std::size_t n, Executor& executor);
+
+}
+
+#include "impl/noisef.ipp"
+
+#endif //AVML_NOISE_HPP
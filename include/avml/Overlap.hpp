@@ -0,0 +1,77 @@
+#ifndef AVML_OVERLAP_HPP
+#define AVML_OVERLAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Vectors.hpp"
+#include "Matrices.hpp"
+#include "Geometry.hpp"
+#include "Parallel.hpp"
+
+namespace avml {
+
+    //=====================================================
+    // Pairwise tests
+    //=====================================================
+
+    // Primitives which touch overlap. OBB axes must be of unit length.
+
+    template<class R>
+    bool overlaps(const SphereR<R>& a, const SphereR<R>& b);
+
+    template<class R>
+    bool overlaps(const SphereR<R>& s, const Aabb3R<R>& b);
+
+    template<class R>
+    bool overlaps(const Aabb3R<R>& b, const SphereR<R>& s);
+
+    ///
+    /// Separating axis test over the boxes' face normals and the cross
+    /// products of their edges. A small tolerance is added to the boxes'
+    /// projected radii, so boxes within about 1e-6 of touching overlap.
+    ///
+    template<class R>
+    bool overlaps(const ObbR<R>& a, const ObbR<R>& b);
+
+    template<class R>
+    bool overlaps(const CapsuleR<R>& a, const CapsuleR<R>& b);
+
+    ///
+    /// Closest points of the segments of two capsules. When the segments are
+    /// parallel the points are one of the closest pairs.
+    ///
+    /// \param on_a Set to the point on the segment of a
+    /// \param on_b Set to the point on the segment of b
+    /// \return Squared distance between on_a and on_b
+    template<class R>
+    R closest_points(const CapsuleR<R>& a, const CapsuleR<R>& b, Vector3R<R>& on_a, Vector3R<R>& on_b);
+
+    //=====================================================
+    // One against many
+    //=====================================================
+
+    // Test a query primitive against n others. Bit i % 64 of mask[i / 64]
+    // is set iff the query overlaps others[i], so mask must hold
+    // (n + 63) / 64 words. Bits past n in the last word are cleared.
+    //
+    // With AVX2 or AVX-512 the others are tested 8 or 16 at a time, their
+    // fields being gathered straight from the array of primitives.
+
+    void overlaps(const spheref& s, const spheref* others, std::uint64_t* mask, std::size_t n);
+    void overlaps(const spheref& s, const aabb3f* boxes, std::uint64_t* mask, std::size_t n);
+    void overlaps(const aabb3f& b, const spheref* spheres, std::uint64_t* mask, std::size_t n);
+    void overlaps(const obbf& b, const obbf* others, std::uint64_t* mask, std::size_t n);
+    void overlaps(const capsulef& c, const capsulef* others, std::uint64_t* mask, std::size_t n);
+
+    void overlaps(const spheref& s, const spheref* others, std::uint64_t* mask, std::size_t n, Executor& executor);
+    void overlaps(const spheref& s, const aabb3f* boxes, std::uint64_t* mask, std::size_t n, Executor& executor);
+    void overlaps(const aabb3f& b, const spheref* spheres, std::uint64_t* mask, std::size_t n, Executor& executor);
+    void overlaps(const obbf& b, const obbf* others, std::uint64_t* mask, std::size_t n, Executor& executor);
+    void overlaps(const capsulef& c, const capsulef* others, std::uint64_t* mask, std::size_t n, Executor& executor);
+
+}
+
+#include "impl/Overlap.ipp"
+
+#endif //AVML_OVERLAP_HPP
@@ -0,0 +1,106 @@
+#ifndef AVML_PARALLEL_HPP
+#define AVML_PARALLEL_HPP
+
+#include <cstddef>
+#include <functional>
+
+#include "impl/Capabilities.hpp"
+
+//=========================================================
+// Chunk sizes
+//=========================================================
+
+// Number of bytes of input and output a single chunk of a batch operation
+// touches. Chosen so that a chunk stays resident in L1/L2 while processed.
+#ifndef AVML_BATCH_CHUNK_BYTES
+    #define AVML_BATCH_CHUNK_BYTES (32 * 1024)
+#endif
+
+namespace avml {
+
+    ///
+    /// Function invoked on the half-open range [begin, end) of a batch
+    ///
+    using Range_function = std::function<void(std::size_t begin, std::size_t end)>;
+
+    ///
+    /// Interface through which batch operations split work across threads.
+    /// Implement this to route AVML's work onto an existing job system.
+    ///
+    class Executor {
+    public:
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        Executor() = default;
+        Executor(const Executor&) = delete;
+        virtual ~Executor() = default;
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        Executor& operator=(const Executor&) = delete;
+
+        //=================================================
+        // Interface
+        //=================================================
+
+        ///
+        /// Invokes f once for each chunk [i * grain, min((i + 1) * grain, n))
+        /// of [0, n). Every chunk begins at a multiple of grain, which
+        /// callers rely on to index per-chunk results and to keep chunks
+        /// from sharing a bitmask word. Returns once every chunk has
+        /// completed. Chunks may run concurrently and in any order.
+        ///
+        virtual void parallel_for(std::size_t n, std::size_t grain, const Range_function& f) = 0;
+
+        ///
+        /// \return Number of threads which may run chunks at once
+        virtual unsigned concurrency() const = 0;
+
+    };
+
+    ///
+    /// Executor which runs every chunk on the calling thread
+    ///
+    class Serial_executor final : public Executor {
+    public:
+
+        void parallel_for(std::size_t n, std::size_t grain, const Range_function& f) override;
+
+        unsigned concurrency() const override;
+
+    };
+
+    ///
+    /// Work-stealing thread pool. Each worker owns a deque of chunks. A
+    /// worker pops from the back of its own deque and steals from the front
+    /// of the others' once it runs dry. Threads calling parallel_for run
+    /// chunks too while they wait.
+    ///
+    /// If chunks throw, the remaining chunks still run and parallel_for
+    /// rethrows the first exception on the calling thread once all of them
+    /// have completed.
+    ///
+    class Thread_pool;
+
+    ///
+    /// \return Thread pool sized to the machine, created on first use
+    Executor& default_executor();
+
+    ///
+    /// \tparam In Input element type
+    /// \tparam Out Output element type
+    /// \return Number of elements per chunk so that one chunk's input and
+    /// output fit into AVML_BATCH_CHUNK_BYTES. Always a multiple of 64
+    template<class In, class Out = In>
+    constexpr std::size_t default_grain();
+
+}
+
+#include "impl/Parallel.ipp"
+
+#endif //AVML_PARALLEL_HPP
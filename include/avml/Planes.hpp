@@ -0,0 +1,113 @@
+#ifndef AVML_PLANES_HPP
+#define AVML_PLANES_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Vectors.hpp"
+#include "Geometry.hpp"
+#include "Overlap.hpp"
+#include "Parallel.hpp"
+
+namespace avml {
+
+    //=====================================================
+    // Single queries
+    //=====================================================
+
+    enum class Plane_side : int {
+        back = -1,
+        on = 0,
+        front = 1
+    };
+
+    ///
+    /// \return Side of the plane p is on. Points within epsilon of the plane
+    /// are on it.
+    ///
+    template<class R>
+    Plane_side classify(const PlaneR<R>& plane, Vector3R<R> p, R epsilon);
+
+    ///
+    /// \param t Set to the parameter at which the line crosses the plane
+    /// \return False if the line is parallel to the plane
+    ///
+    template<class R>
+    bool intersect(const PlaneR<R>& plane, const LineR<R>& line, R& t);
+
+    ///
+    /// \param t Set to the parameter at which the segment crosses the plane
+    /// \return True if the segment's end points aren't strictly on the same
+    /// side of the plane. A segment lying in the plane has t set to zero.
+    ///
+    template<class R>
+    bool intersect(const PlaneR<R>& plane, const SegmentR<R>& s, R& t);
+
+    ///
+    /// Cuts off the part of s behind the plane
+    ///
+    /// \return False if all of s is behind the plane, which leaves s as it
+    /// was
+    template<class R>
+    bool clip(const PlaneR<R>& plane, SegmentR<R>& s);
+
+    ///
+    /// Closest points of two segments, as closest_points() of capsules
+    ///
+    /// \return Squared distance between on_a and on_b
+    template<class R>
+    R closest_points(const SegmentR<R>& a, const SegmentR<R>& b, Vector3R<R>& on_a, Vector3R<R>& on_b);
+
+    //=====================================================
+    // Batch queries
+    //=====================================================
+
+    // With AVX or AVX-512 the points are processed 8 or 16 at a time.
+    // Bit masks follow the layout of the batch overlaps() of Overlap.hpp:
+    // bit i % 64 of mask[i / 64] is set for element i, and bits past n in
+    // the last word are cleared.
+
+    void signed_distances(const planef& plane, const vec3f* points, float* out, std::size_t n);
+
+    ///
+    /// Sets the bits of the points in front of the plane in front and those
+    /// behind it in back. Points within epsilon of the plane are in
+    /// neither.
+    ///
+    void classify(const planef& plane, const vec3f* points, std::uint64_t* front, std::uint64_t* back, std::size_t n, float epsilon);
+
+    ///
+    /// Writes the indices of the points on the given side of the plane to
+    /// indices in increasing order, which must have room for n of them
+    ///
+    /// \return Number of indices written
+    std::size_t select(const planef& plane, const vec3f* points, std::size_t n, Plane_side side, float epsilon, std::uint32_t* indices);
+
+    ///
+    /// Clips each segment with clip() above, writing the result to out and
+    /// setting the bit of the segments which aren't entirely behind the
+    /// plane in kept. out may equal segments.
+    ///
+    /// With AVX2 or AVX-512 the segments are gathered 8 or 16 at a time.
+    ///
+    void clip(const planef& plane, const segmentf* segments, segmentf* out, std::uint64_t* kept, std::size_t n);
+
+    // Point on the shape closest to each of the points. out may equal
+    // points.
+
+    void closest_points(const planef& plane, const vec3f* points, vec3f* out, std::size_t n);
+    void closest_points(const linef& line, const vec3f* points, vec3f* out, std::size_t n);
+    void closest_points(const segmentf& s, const vec3f* points, vec3f* out, std::size_t n);
+
+    void signed_distances(const planef& plane, const vec3f* points, float* out, std::size_t n, Executor& executor);
+    void classify(const planef& plane, const vec3f* points, std::uint64_t* front, std::uint64_t* back, std::size_t n, float epsilon, Executor& executor);
+    void clip(const planef& plane, const segmentf* segments, segmentf* out, std::uint64_t* kept, std::size_t n, Executor& executor);
+    void closest_points(const planef& plane, const vec3f* points, vec3f* out, std::size_t n, Executor& executor);
+    void closest_points(const linef& line, const vec3f* points, vec3f* out, std::size_t n, Executor& executor);
+    void closest_points(const segmentf& s, const vec3f* points, vec3f* out, std::size_t n, Executor& executor);
+
+}
+
+#include "impl/Planes.ipp"
+
+#endif //AVML_PLANES_HPP
@@ -0,0 +1,75 @@
+#ifndef AVML_SKINNING_HPP
+#define AVML_SKINNING_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Vectors.hpp"
+#include "Matrices.hpp"
+#include "Dual_quaternions.hpp"
+#include "Parallel.hpp"
+
+namespace avml {
+
+    //=====================================================
+    // Skinning
+    //=====================================================
+
+    // Every vertex is influenced by four bones. Vertex i uses the bones
+    // bone_indices[4 * i] to bone_indices[4 * i + 3] with the weights at the
+    // same positions in bone_weights, which should sum to one. Unused
+    // influences should be given a weight of zero.
+    //
+    // normals and out_normals may be null, in which case only positions are
+    // skinned. Skinned normals are renormalized.
+
+    ///
+    /// Linear blend skinning: vertices are transformed by the weighted sum
+    /// of their bones' matrices. Normals are transformed by the blended
+    /// linear part, which is correct for bones without non-uniform scale.
+    ///
+    void linear_blend_skinning(
+        const affine3x4f* bones, const std::uint32_t* bone_indices, const float* bone_weights,
+        const vec3f* positions, const vec3f* normals,
+        vec3f* out_positions, vec3f* out_normals, std::size_t n);
+
+    ///
+    /// Same as above with bones given as matrices whose last row is
+    /// assumed to be {0, 0, 0, 1}
+    ///
+    void linear_blend_skinning(
+        const mat4x4f* bones, const std::uint32_t* bone_indices, const float* bone_weights,
+        const vec3f* positions, const vec3f* normals,
+        vec3f* out_positions, vec3f* out_normals, std::size_t n);
+
+    ///
+    /// Dual quaternion linear blending: the bones' dual quaternions are
+    /// blended and normalized, which avoids the volume loss of linear blend
+    /// skinning around twisting joints. Each bone is flipped into the same
+    /// hemisphere as the vertex's first bone before blending.
+    ///
+    void dual_quaternion_skinning(
+        const dualquatf* bones, const std::uint32_t* bone_indices, const float* bone_weights,
+        const vec3f* positions, const vec3f* normals,
+        vec3f* out_positions, vec3f* out_normals, std::size_t n);
+
+    void linear_blend_skinning(
+        const affine3x4f* bones, const std::uint32_t* bone_indices, const float* bone_weights,
+        const vec3f* positions, const vec3f* normals,
+        vec3f* out_positions, vec3f* out_normals, std::size_t n, Executor& executor);
+
+    void linear_blend_skinning(
+        const mat4x4f* bones, const std::uint32_t* bone_indices, const float* bone_weights,
+        const vec3f* positions, const vec3f* normals,
+        vec3f* out_positions, vec3f* out_normals, std::size_t n, Executor& executor);
+
+    void dual_quaternion_skinning(
+        const dualquatf* bones, const std::uint32_t* bone_indices, const float* bone_weights,
+        const vec3f* positions, const vec3f* normals,
+        vec3f* out_positions, vec3f* out_normals, std::size_t n, Executor& executor);
+
+}
+
+#include "impl/skinningf.ipp"
+
+#endif //AVML_SKINNING_HPP
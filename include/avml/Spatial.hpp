@@ -0,0 +1,106 @@
+#ifndef AVML_SPATIAL_HPP
+#define AVML_SPATIAL_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Vectors.hpp"
+#include "Geometry.hpp"
+#include "Parallel.hpp"
+
+namespace avml {
+
+    //=====================================================
+    // Quantization
+    //=====================================================
+
+    ///
+    /// Divides bounds into a grid of 2^bits cells along each axis
+    ///
+    /// \param bounds Box which p is mapped relative to
+    /// \param p Position. Points outside bounds are clamped to it.
+    /// \param bits Number of bits per component, at most 21
+    /// \return Grid coordinates of the cell containing p
+    vec3u quantize(const aabb3f& bounds, vec3f p, unsigned bits);
+
+    //=====================================================
+    // Space-filling curves
+    //=====================================================
+
+    // Codes place x in the most significant bit of each triple. Sorting
+    // points by code orders them along the curve, which keeps points close
+    // in space close in memory.
+    //
+    // With AVML_BMI2 defined, Morton codes are computed with pdep and pext.
+    // AVML_BMI2 is not implied by any other extension since BMI2 is
+    // enabled separately from AVX2 by compilers.
+
+    ///
+    /// \param v Coordinates of at most 10 bits each
+    /// \return 30-bit Morton code of v
+    std::uint32_t morton_encode30(vec3u v);
+
+    ///
+    /// \param v Coordinates of at most 21 bits each
+    /// \return 63-bit Morton code of v
+    std::uint64_t morton_encode63(vec3u v);
+
+    vec3u morton_decode30(std::uint32_t code);
+    vec3u morton_decode63(std::uint64_t code);
+
+    ///
+    /// Hilbert curve codes, computed with Skilling's transposition algorithm.
+    /// Unlike Morton order, consecutive codes always map to adjacent cells,
+    /// which gives somewhat better locality at a higher cost.
+    ///
+    /// \param v Coordinates of at most 10 bits each
+    /// \return 30-bit Hilbert code of v
+    std::uint32_t hilbert_encode30(vec3u v);
+
+    ///
+    /// \param v Coordinates of at most 21 bits each
+    /// \return 63-bit Hilbert code of v
+    std::uint64_t hilbert_encode63(vec3u v);
+
+    vec3u hilbert_decode30(std::uint32_t code);
+    vec3u hilbert_decode63(std::uint64_t code);
+
+    //=====================================================
+    // Batch codes
+    //=====================================================
+
+    // Quantize in[i] against bounds and write its code to out[i]
+
+    void morton_codes30(const aabb3f& bounds, const vec3f* in, std::uint32_t* out, std::size_t n);
+    void morton_codes63(const aabb3f& bounds, const vec3f* in, std::uint64_t* out, std::size_t n);
+
+    void hilbert_codes30(const aabb3f& bounds, const vec3f* in, std::uint32_t* out, std::size_t n);
+    void hilbert_codes63(const aabb3f& bounds, const vec3f* in, std::uint64_t* out, std::size_t n);
+
+    void morton_codes30(const aabb3f& bounds, const vec3f* in, std::uint32_t* out, std::size_t n, Executor& executor);
+    void morton_codes63(const aabb3f& bounds, const vec3f* in, std::uint64_t* out, std::size_t n, Executor& executor);
+
+    void hilbert_codes30(const aabb3f& bounds, const vec3f* in, std::uint32_t* out, std::size_t n, Executor& executor);
+    void hilbert_codes63(const aabb3f& bounds, const vec3f* in, std::uint64_t* out, std::size_t n, Executor& executor);
+
+    //=====================================================
+    // Sorting
+    //=====================================================
+
+    ///
+    /// Stable least significant digit radix sort of keys in 8-bit digits.
+    /// Passes over digits which are the same for every key are skipped, so
+    /// 30-bit codes take at most four passes.
+    ///
+    /// \param keys Keys to sort in place
+    /// \param values Values to permute along with keys, e.g. point indices.
+    /// May be null.
+    /// \param n Number of keys
+    void radix_sort(std::uint32_t* keys, std::uint32_t* values, std::size_t n);
+    void radix_sort(std::uint64_t* keys, std::uint32_t* values, std::size_t n);
+
+}
+
+#include "impl/Spatial.ipp"
+
+#endif //AVML_SPATIAL_HPP
@@ -0,0 +1,163 @@
+#ifndef AVML_STREAMING_HPP
+#define AVML_STREAMING_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Vectors.hpp"
+#include "Matrices.hpp"
+#include "Geometry.hpp"
+#include "Parallel.hpp"
+#include "Batch.hpp"
+
+namespace avml {
+
+    //=====================================================
+    // Mapped_file
+    //=====================================================
+
+    ///
+    /// Read-only or read-write memory mapping of an entire file. Only
+    /// available on POSIX systems. Elsewhere opening a file always fails.
+    ///
+    class Mapped_file {
+    public:
+
+        //=================================================
+        // Creation functions
+        //=================================================
+
+        ///
+        /// \param path Path of file to map read-only
+        /// \return Mapping of the file. Closed if the file could not be mapped
+        static Mapped_file open_read(const char* path);
+
+        ///
+        /// \param path Path of file to create or truncate
+        /// \param size Size, in bytes, which the file is resized to
+        /// \return Read-write mapping of the file. Closed if the file could
+        /// not be created or mapped
+        static Mapped_file create(const char* path, std::size_t size);
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        Mapped_file() = default;
+        Mapped_file(const Mapped_file&) = delete;
+        Mapped_file(Mapped_file&&) noexcept;
+        ~Mapped_file();
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        Mapped_file& operator=(const Mapped_file&) = delete;
+        Mapped_file& operator=(Mapped_file&&) noexcept;
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        bool is_open() const;
+
+        explicit operator bool() const;
+
+        void* data();
+        const void* data() const;
+
+        std::size_t size() const;
+
+        //=================================================
+        // Mutators
+        //=================================================
+
+        void close();
+
+    private:
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        void* ptr = nullptr;
+
+        std::size_t length = 0;
+
+        bool open = false;
+
+    };
+
+    //=====================================================
+    // Array streams
+    //=====================================================
+
+    // Stream operations read packed arrays of three-component points, i.e.
+    // raw float[3] or double[3] data, and write their results with
+    // non-temporal stores so that passes over data much larger than the
+    // cache don't evict the working set of the rest of the program.
+
+    ///
+    /// Transforms n points by an affine matrix.
+    ///
+    /// \return Bounds of the transformed points
+    aabb3f stream_transform(const mat4x4f& m, const float* in, float* out, std::size_t n);
+    aabb3f stream_transform(const mat4x4f& m, const float* in, float* out, std::size_t n, Executor& executor);
+
+    aabb3d stream_transform(const mat4x4d& m, const double* in, double* out, std::size_t n);
+    aabb3d stream_transform(const mat4x4d& m, const double* in, double* out, std::size_t n, Executor& executor);
+
+    ///
+    /// Quantizes n points to three 16-bit coordinates relative to box.
+    /// Points outside of box are clamped to its surface. NaN coordinates
+    /// quantize to zero.
+    ///
+    void stream_quantize(const aabb3f& box, const float* in, std::uint16_t* out, std::size_t n);
+    void stream_quantize(const aabb3f& box, const float* in, std::uint16_t* out, std::size_t n, Executor& executor);
+
+    void stream_quantize(const aabb3d& box, const double* in, std::uint16_t* out, std::size_t n);
+    void stream_quantize(const aabb3d& box, const double* in, std::uint16_t* out, std::size_t n, Executor& executor);
+
+    ///
+    /// \return Point which q was quantized from, to within the quantization
+    /// step of box
+    vec3f dequantize(const aabb3f& box, const std::uint16_t* q);
+    vec3d dequantize(const aabb3d& box, const std::uint16_t* q);
+
+    //=====================================================
+    // File streams
+    //=====================================================
+
+    ///
+    /// Maps the float[3] points in the file at in_path, transforms them by m,
+    /// and writes them to the file at out_path.
+    ///
+    /// \param bounds Receives the bounds of the transformed points if not null
+    /// \return True on success. False if either file could not be mapped or
+    /// the input's size isn't a multiple of the point size
+    bool transform_file(const char* in_path, const char* out_path, const mat4x4f& m, aabb3f* bounds = nullptr);
+    bool transform_file(const char* in_path, const char* out_path, const mat4x4f& m, Executor& executor, aabb3f* bounds = nullptr);
+
+    ///
+    /// double[3] variant of transform_file
+    ///
+    bool transform_file(const char* in_path, const char* out_path, const mat4x4d& m, aabb3d* bounds = nullptr);
+    bool transform_file(const char* in_path, const char* out_path, const mat4x4d& m, Executor& executor, aabb3d* bounds = nullptr);
+
+    ///
+    /// Maps the float[3] points in the file at in_path, quantizes them
+    /// relative to box, and writes them to the file at out_path as
+    /// std::uint16_t[3].
+    ///
+    /// \return True on success
+    bool quantize_file(const char* in_path, const char* out_path, const aabb3f& box);
+    bool quantize_file(const char* in_path, const char* out_path, const aabb3f& box, Executor& executor);
+
+    bool quantize_file(const char* in_path, const char* out_path, const aabb3d& box);
+    bool quantize_file(const char* in_path, const char* out_path, const aabb3d& box, Executor& executor);
+
+}
+
+#include "impl/Streaming.ipp"
+
+#endif //AVML_STREAMING_HPP
@@ -27,6 +27,30 @@ namespace avml {
 
     mat4x4f rotation_matrix(uvec3f axis, float angle);
 
+    ///
+    /// \return translation_matrix(t) * rotation * scaling_matrix(s), computed
+    /// directly without intermediate matrix products. The rotation is given
+    /// as a unit quaternion {x, y, z, w}.
+    ///
+    mat4x4f trs_matrix(vec3f t, uvec4f rotation, vec3f s);
+    mat4x4f trs_matrix(vec3f t, uvec3f axis, float angle, vec3f s);
+
+    affine3x4f trs_affine(vec3f t, uvec4f rotation, vec3f s);
+    affine3x4f trs_affine(vec3f t, uvec3f axis, float angle, vec3f s);
+
+    ///
+    /// \return Right-handed view matrix placing eye at the origin and looking
+    /// down the negative z axis towards target
+    ///
+    mat4x4f look_at(vec3f eye, vec3f target, vec3f up);
+
+    ///
+    /// Right-handed projections mapping the view volume between -z_near and
+    /// -z_far to clip space with depth in [-1, 1]
+    ///
+    mat4x4f perspective(float fov_y, float aspect, float z_near, float z_far);
+    mat4x4f orthographic(float left, float right, float bottom, float top, float z_near, float z_far);
+
 
 
 
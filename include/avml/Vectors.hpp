@@ -2,6 +2,7 @@
 #define AVML_VECTORS_HPP
 
 #include "impl/Capabilities.hpp"
+#include "Instrumentation.hpp"
 
 namespace avml {
 
@@ -39,6 +40,7 @@ namespace avml {
 }
 
 #include "impl/Shared.hpp"
+#include "impl/Swizzle.hpp"
 
 #include "impl/generic/uvec2r.hpp"
 #include "impl/generic/uvec3r.hpp"
@@ -48,6 +50,9 @@ namespace avml {
 #include "impl/generic/vec3r.hpp"
 #include "impl/generic/vec4r.hpp"
 
+#include "impl/generic/vec2i.hpp"
+#include "impl/generic/vec3i.hpp"
+
 #include "impl/uvec2f.ipp"
 #include "impl/uvec3f.ipp"
 #include "impl/uvec4f.ipp"
@@ -1,5 +1,5 @@
-#ifndef AVML_CAPABILITIES_HPP
-#define AVML_CAPABILITIES_HPP
+#ifndef AVML_IMPL_CAPABILITIES_HPP
+#define AVML_IMPL_CAPABILITIES_HPP
 
 #include <climits>
 #include <limits>
@@ -49,7 +49,19 @@ static_assert(sizeof(double) == 8, "Size of doubles should be 64 bits");
 #endif
 
 
-#ifdef AVML_AVX2
+// Every AVX2 processor also implements FMA3, so x86-64-v3 builds get fused
+// multiply-add paths without defining AVML_FMA separately. That needs the
+// compiler to allow FMA instructions too, e.g. with -mfma, which
+// -march=x86-64-v3 or later implies. Builds with only -mavx2 keep the
+// separate multiply and add. MSVC's /arch:AVX2 enables FMA without
+// defining __FMA__.
+
+#if defined(AVML_AVX2) && (defined(__FMA__) || defined(_MSC_VER))
+    #define AVML_FMA
+#endif
+
+
+#if defined(AVML_AVX2) || defined(AVML_FMA)
     #define AVML_AVX
 #endif
 
@@ -92,6 +104,12 @@ static_assert(sizeof(double) == 8, "Size of doubles should be 64 bits");
 #ifdef AVML_X86
 #endif
 
+// Bit manipulation instructions are enabled independently of the vector
+// extensions by compilers, so they aren't implied by any of the above
+
+#ifdef AVML_BMI2
+#endif
+
 #if defined(AVML_SSE) && !defined(AVML_SSE2)
     static_assert(false, "AVML does not currently support SSE without SSE2 enabled as well");
 #endif
@@ -104,8 +122,10 @@ static_assert(sizeof(double) == 8, "Size of doubles should be 64 bits");
     #define AVML_SVE
 #endif
 
+// Advanced SIMD is mandatory on AArch64, so every SVE processor has NEON
+
 #ifdef AVML_SVE
-    #define AVML_ARM
+    #define AVML_NEON
 #endif
 
 #ifdef AVML_NEON
@@ -123,6 +143,41 @@ static_assert(sizeof(double) == 8, "Size of doubles should be 64 bits");
     static_assert(false, "Extensions for multiple ISAs specified.");
 #endif
 
+//=========================================================
+// Scalar mode
+//=========================================================
+
+// AVML_SCALAR builds only the portable code paths and includes no intrinsics
+// headers. It serves targets without a supported vector extension, such as
+// WebAssembly and RISC-V, and is the reference for differential testing.
+
+#if defined(AVML_SCALAR) && (defined(AVML_X86) || defined(AVML_ARM) || defined(AVML_FMA) || defined(AVML_BMI2))
+    static_assert(false, "AVML_SCALAR cannot be combined with instruction set extensions.");
+#endif
+
+//=========================================================
+// Target architecture
+//=========================================================
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define AVML_TARGET_X86
+#elif defined(__aarch64__) || defined(__arm__) || defined(_M_ARM64) || defined(_M_ARM)
+    #define AVML_TARGET_ARM
+#endif
+
+#if defined(AVML_X86) && !defined(AVML_TARGET_X86)
+    static_assert(false, "x86 extensions specified for a non-x86 target.");
+#endif
+
+#if defined(AVML_ARM) && !defined(AVML_TARGET_ARM)
+    static_assert(false, "ARM extensions specified for a non-ARM target.");
+#endif
+
+// The NEON paths use instructions only present in the A64 instruction set
+#if defined(AVML_NEON) && !(defined(__aarch64__) || defined(_M_ARM64))
+    static_assert(false, "AVML_NEON requires an AArch64 target.");
+#endif
+
 //=========================================================
 // Compiler-specific
 //=========================================================
@@ -134,9 +189,6 @@ static_assert(sizeof(double) == 8, "Size of doubles should be 64 bits");
 
     #define AVML_UNROLL(x) _Pragma("#pragma unroll x")
 
-    #include <x86intrin.h>
-    #include <immintrin.h>
-
 #elif defined(__GNUC__)
     #define AVML_GCC
 
@@ -149,8 +201,6 @@ static_assert(sizeof(double) == 8, "Size of doubles should be 64 bits");
 
     #define AVML_UNROLL(x) _Pragma("#pragma GCC unroll x")
 
-    #include <x86intrin.h>
-    #include <immintrin.h>
 #elif defined(_MSC_VER)
     #define AVML_MSVC
 
@@ -158,8 +208,6 @@ static_assert(sizeof(double) == 8, "Size of doubles should be 64 bits");
 
     #define AVML_UNROLL(x) _Prgama("loopivdep)")
 
-    #include "intrin.h"
-
 #elif
     #define AVML_FINL inline
     static_assert(false, "Compiler not supported");
@@ -167,4 +215,22 @@ static_assert(sizeof(double) == 8, "Size of doubles should be 64 bits");
 
 
 
-#endif //AVML_CAPABILITIES_HPP
+//=========================================================
+// Intrinsics
+//=========================================================
+
+#if defined(AVML_SCALAR)
+#elif defined(AVML_TARGET_X86)
+    #if defined(AVML_MSVC)
+        #include <intrin.h>
+    #else
+        #include <x86intrin.h>
+        #include <immintrin.h>
+    #endif
+#endif
+
+// AVML_NEON and AVML_SVE are reported by the capability queries, but have
+// no intrinsics paths until they can be tested under emulation, so ARM
+// builds use the scalar code
+
+#endif //AVML_IMPL_CAPABILITIES_HPP
@@ -0,0 +1,475 @@
+#ifndef AVML_CAPABILITIES_IPP
+#define AVML_CAPABILITIES_IPP
+
+#include <cstdio>
+#include <cstdlib>
+#include <ostream>
+
+#if defined(AVML_TARGET_X86)
+    #define AVML_CPUID
+
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#elif defined(__aarch64__) && defined(__linux__)
+    #define AVML_HWCAP
+
+    #include <sys/auxv.h>
+#endif
+
+namespace avml_impl {
+
+    #if defined(AVML_CPUID)
+
+    inline void cpuid(std::uint32_t leaf, std::uint32_t subleaf, std::uint32_t (&regs)[4]) {
+        #if defined(_MSC_VER)
+        int r[4];
+        __cpuidex(r, static_cast<int>(leaf), static_cast<int>(subleaf));
+        for (int i = 0; i < 4; ++i) {
+            regs[i] = static_cast<std::uint32_t>(r[i]);
+        }
+        #else
+        __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+        #endif
+    }
+
+    /// \return Register state components the OS saves on context switches
+    inline std::uint64_t xgetbv0() {
+        #if defined(_MSC_VER)
+        return _xgetbv(0);
+        #else
+        std::uint32_t lo, hi;
+        __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+        return (std::uint64_t(hi) << 32) | lo;
+        #endif
+    }
+
+    #endif
+
+    inline bool bit(std::uint32_t reg, unsigned i) {
+        return ((reg >> i) & 1) != 0;
+    }
+
+}
+
+namespace avml {
+
+    //=====================================================
+    // Compiled capabilities
+    //=====================================================
+
+    AVML_FINL constexpr Capabilities compiled_capabilities() {
+        return Capabilities{0u
+            #if defined(AVML_SSE)
+            | feature_bit(Isa_feature::sse)
+            #endif
+            #if defined(AVML_SSE2)
+            | feature_bit(Isa_feature::sse2)
+            #endif
+            #if defined(AVML_SSE3)
+            | feature_bit(Isa_feature::sse3)
+            #endif
+            #if defined(AVML_SSSE3)
+            | feature_bit(Isa_feature::ssse3)
+            #endif
+            #if defined(AVML_SSE41)
+            | feature_bit(Isa_feature::sse41)
+            #endif
+            #if defined(AVML_SSE42)
+            | feature_bit(Isa_feature::sse42)
+            #endif
+            #if defined(AVML_AVX)
+            | feature_bit(Isa_feature::avx)
+            #endif
+            #if defined(AVML_AVX2)
+            | feature_bit(Isa_feature::avx2)
+            #endif
+            #if defined(AVML_FMA)
+            | feature_bit(Isa_feature::fma)
+            #endif
+            #if defined(AVML_BMI2)
+            | feature_bit(Isa_feature::bmi2)
+            #endif
+            #if defined(AVML_AVX512F)
+            | feature_bit(Isa_feature::avx512f)
+            #endif
+            #if defined(AVML_AVX512VL)
+            | feature_bit(Isa_feature::avx512vl)
+            #endif
+            #if defined(AVML_AVX512BW)
+            | feature_bit(Isa_feature::avx512bw)
+            #endif
+            #if defined(AVML_AVX512DQ)
+            | feature_bit(Isa_feature::avx512dq)
+            #endif
+            #if defined(AVML_AVX512_BITALG)
+            | feature_bit(Isa_feature::avx512_bitalg)
+            #endif
+            #if defined(AVML_AVX512VPOPCNTDQ)
+            | feature_bit(Isa_feature::avx512vpopcntdq)
+            #endif
+            #if defined(AVML_NEON)
+            | feature_bit(Isa_feature::neon)
+            #endif
+            #if defined(AVML_SVE)
+            | feature_bit(Isa_feature::sve)
+            #endif
+            #if defined(AVML_SVE2)
+            | feature_bit(Isa_feature::sve2)
+            #endif
+        };
+    }
+
+    AVML_FINL constexpr Isa_tier compiled_tier() {
+        #if defined(AVML_AVX512F)
+        return Isa_tier::avx512f;
+        #elif defined(AVML_AVX2)
+        return Isa_tier::avx2;
+        #elif defined(AVML_AVX)
+        return Isa_tier::avx;
+        #elif defined(AVML_SSE42)
+        return Isa_tier::sse42;
+        #elif defined(AVML_SSE41)
+        return Isa_tier::sse41;
+        #elif defined(AVML_SSSE3)
+        return Isa_tier::ssse3;
+        #elif defined(AVML_SSE3)
+        return Isa_tier::sse3;
+        #elif defined(AVML_SSE2)
+        return Isa_tier::sse2;
+        #elif defined(AVML_SVE)
+        return Isa_tier::sve;
+        #elif defined(AVML_NEON)
+        return Isa_tier::neon;
+        #else
+        return Isa_tier::scalar;
+        #endif
+    }
+
+    //=====================================================
+    // CPU capabilities
+    //=====================================================
+
+    inline Capabilities cpu_capabilities() {
+        #if defined(AVML_CPUID) || defined(AVML_HWCAP)
+        using avml_impl::bit;
+
+        Capabilities ret{0};
+        auto add = [&](Isa_feature f, bool present) {
+            if (present) {
+                ret.features |= feature_bit(f);
+            }
+        };
+        #endif
+
+        #if defined(AVML_CPUID)
+        std::uint32_t regs[4];
+        avml_impl::cpuid(0, 0, regs);
+        const std::uint32_t max_leaf = regs[0];
+        if (max_leaf < 1) {
+            return ret;
+        }
+
+        // Leaf 1: eax, ebx, ecx, edx
+        avml_impl::cpuid(1, 0, regs);
+        const std::uint32_t ecx1 = regs[2];
+        const std::uint32_t edx1 = regs[3];
+
+        add(Isa_feature::sse, bit(edx1, 25));
+        add(Isa_feature::sse2, bit(edx1, 26));
+        add(Isa_feature::sse3, bit(ecx1, 0));
+        add(Isa_feature::ssse3, bit(ecx1, 9));
+        add(Isa_feature::sse41, bit(ecx1, 19));
+        add(Isa_feature::sse42, bit(ecx1, 20));
+
+        // AVX state must also be enabled by the OS through XCR0
+        const bool osxsave = bit(ecx1, 27);
+        const std::uint64_t xcr0 = osxsave ? avml_impl::xgetbv0() : 0;
+        const bool ymm_state = (xcr0 & 0x06) == 0x06;
+        const bool zmm_state = (xcr0 & 0xE6) == 0xE6;
+
+        add(Isa_feature::avx, ymm_state && bit(ecx1, 28));
+        add(Isa_feature::fma, ymm_state && bit(ecx1, 12));
+
+        if (max_leaf >= 7) {
+            avml_impl::cpuid(7, 0, regs);
+            const std::uint32_t ebx7 = regs[1];
+            const std::uint32_t ecx7 = regs[2];
+
+            add(Isa_feature::avx2, ymm_state && bit(ebx7, 5));
+            add(Isa_feature::bmi2, bit(ebx7, 8));
+            add(Isa_feature::avx512f, zmm_state && bit(ebx7, 16));
+            add(Isa_feature::avx512dq, zmm_state && bit(ebx7, 17));
+            add(Isa_feature::avx512bw, zmm_state && bit(ebx7, 30));
+            add(Isa_feature::avx512vl, zmm_state && bit(ebx7, 31));
+            add(Isa_feature::avx512_bitalg, zmm_state && bit(ecx7, 12));
+            add(Isa_feature::avx512vpopcntdq, zmm_state && bit(ecx7, 14));
+        }
+
+        return ret;
+
+        #elif defined(AVML_HWCAP)
+        // Bit positions of HWCAP_ASIMD, HWCAP_SVE and HWCAP2_SVE2, spelled out
+        // since older C libraries don't define the latter two
+        const auto hwcap = static_cast<std::uint32_t>(getauxval(AT_HWCAP));
+        const auto hwcap2 = static_cast<std::uint32_t>(getauxval(AT_HWCAP2));
+
+        add(Isa_feature::neon, bit(hwcap, 1));
+        add(Isa_feature::sve, bit(hwcap, 22));
+        add(Isa_feature::sve2, bit(hwcap2, 1));
+
+        return ret;
+
+        #else
+        return compiled_capabilities();
+
+        #endif
+    }
+
+    //=====================================================
+    // Names
+    //=====================================================
+
+    inline const char* to_string(Isa_feature f) {
+        switch (f) {
+            case Isa_feature::sse: return "SSE";
+            case Isa_feature::sse2: return "SSE2";
+            case Isa_feature::sse3: return "SSE3";
+            case Isa_feature::ssse3: return "SSSE3";
+            case Isa_feature::sse41: return "SSE4.1";
+            case Isa_feature::sse42: return "SSE4.2";
+            case Isa_feature::avx: return "AVX";
+            case Isa_feature::avx2: return "AVX2";
+            case Isa_feature::fma: return "FMA";
+            case Isa_feature::bmi2: return "BMI2";
+            case Isa_feature::avx512f: return "AVX-512F";
+            case Isa_feature::avx512vl: return "AVX-512VL";
+            case Isa_feature::avx512bw: return "AVX-512BW";
+            case Isa_feature::avx512dq: return "AVX-512DQ";
+            case Isa_feature::avx512_bitalg: return "AVX-512BITALG";
+            case Isa_feature::avx512vpopcntdq: return "AVX-512VPOPCNTDQ";
+            case Isa_feature::neon: return "NEON";
+            case Isa_feature::sve: return "SVE";
+            case Isa_feature::sve2: return "SVE2";
+        }
+        return "unknown";
+    }
+
+    inline const char* to_string(Isa_tier tier) {
+        switch (tier) {
+            case Isa_tier::scalar: return "scalar";
+            case Isa_tier::sse2: return "SSE2";
+            case Isa_tier::sse3: return "SSE3";
+            case Isa_tier::ssse3: return "SSSE3";
+            case Isa_tier::sse41: return "SSE4.1";
+            case Isa_tier::sse42: return "SSE4.2";
+            case Isa_tier::avx: return "AVX";
+            case Isa_tier::avx2: return "AVX2";
+            case Isa_tier::avx512f: return "AVX-512F";
+            case Isa_tier::neon: return "NEON";
+            case Isa_tier::sve: return "SVE";
+        }
+        return "unknown";
+    }
+
+    inline std::string to_string(Capabilities c) {
+        std::string ret;
+        for (std::uint32_t i = 0; i <= static_cast<std::uint32_t>(Isa_feature::sve2); ++i) {
+            Isa_feature f = static_cast<Isa_feature>(i);
+            if (c.has(f)) {
+                if (!ret.empty()) {
+                    ret += ' ';
+                }
+                ret += to_string(f);
+            }
+        }
+        return ret;
+    }
+
+    //=====================================================
+    // Startup check
+    //=====================================================
+
+    inline void require_cpu_support() {
+        // Kept to integer code and stdio so that there's little for the
+        // compiler to vectorize, though nothing stops it using VEX or EVEX
+        // encodings here when the extensions are enabled
+        Capabilities missing = cpu_capabilities().missing(compiled_capabilities());
+        if (missing.features == 0) {
+            return;
+        }
+
+        std::fputs("AVML: this program was compiled for ", stderr);
+        std::fputs(to_string(compiled_tier()), stderr);
+        std::fputs(" but the CPU does not support:", stderr);
+        for (std::uint32_t i = 0; i <= static_cast<std::uint32_t>(Isa_feature::sve2); ++i) {
+            Isa_feature f = static_cast<Isa_feature>(i);
+            if (missing.has(f)) {
+                std::fputs(" ", stderr);
+                std::fputs(to_string(f), stderr);
+            }
+        }
+        std::fputs("\n", stderr);
+        std::abort();
+    }
+
+    //=====================================================
+    // Code path report
+    //=====================================================
+
+    inline std::vector<Code_path> code_paths() {
+        auto path = [](const char* name, const char* isa) {
+            return Code_path{name, isa, std::string{isa} != "scalar"};
+        };
+
+        std::vector<Code_path> ret;
+
+        #if defined(AVML_AVX)
+        ret.push_back(path("vec2f, vec3f, unit vectors", "AVX"));
+        ret.push_back(path("float swizzles", "AVX"));
+        #elif defined(AVML_SSE2)
+        ret.push_back(path("vec2f, vec3f, unit vectors", "SSE2"));
+        ret.push_back(path("float swizzles", "SSE2"));
+        #else
+        ret.push_back(path("vec2f, vec3f, unit vectors", "scalar"));
+        ret.push_back(path("float swizzles", "scalar"));
+        #endif
+
+        ret.push_back(path("vec4f arithmetic", "scalar"));
+        ret.push_back(path("double and integer vectors", "scalar"));
+        ret.push_back(path("mat2x2f, mat3x3f", "scalar"));
+
+        // Follows the guards of mat4x4f_products.ipp and affine3x4f.ipp
+        #if defined(AVML_FMA)
+        ret.push_back(path("mat4x4f and affine3x4f products", "FMA"));
+        #elif defined(AVML_SSE2)
+        ret.push_back(path("mat4x4f and affine3x4f products", "SSE2"));
+        #else
+        ret.push_back(path("mat4x4f and affine3x4f products", "scalar"));
+        #endif
+
+        // Each block below follows the guards of the kernels it names, so
+        // that a row only reports an instruction set which has a code path
+
+        // batchf.ipp normalize, transform_points and bounds
+        #if defined(AVML_AVX512F)
+        ret.push_back(path("batch transforms", "AVX-512F"));
+        #elif defined(AVML_AVX)
+        ret.push_back(path("batch transforms", "AVX"));
+        #else
+        ret.push_back(path("batch transforms", "scalar"));
+        #endif
+
+        // batchf.ipp multiply4x4f, used by multiply_batch and
+        // propagate_hierarchy
+        #if defined(AVML_AVX512F)
+        ret.push_back(path("batch matrix products", "AVX-512F"));
+        #elif defined(AVML_AVX)
+        ret.push_back(path("batch matrix products", "AVX"));
+        #elif defined(AVML_SSE2)
+        ret.push_back(path("batch matrix products", "SSE2"));
+        #else
+        ret.push_back(path("batch matrix products", "scalar"));
+        #endif
+
+        // mathf.ipp map_arrays
+        #if defined(AVML_AVX512F)
+        ret.push_back(path("array math", "AVX-512F"));
+        #elif defined(AVML_AVX)
+        ret.push_back(path("array math", "AVX"));
+        #elif defined(AVML_SSE2)
+        ret.push_back(path("array math", "SSE2"));
+        #else
+        ret.push_back(path("array math", "scalar"));
+        #endif
+
+        // curvesf.ipp, decompositionsf.ipp and solversf.ipp
+        #if defined(AVML_AVX512F)
+        ret.push_back(path("curves, decompositions, solvers", "AVX-512F"));
+        #elif defined(AVML_AVX)
+        ret.push_back(path("curves, decompositions, solvers", "AVX"));
+        #else
+        ret.push_back(path("curves, decompositions, solvers", "scalar"));
+        #endif
+
+        // noisef.ipp, skinningf.ipp, encodingsf.ipp and the Spatial.ipp
+        // batches
+        #if defined(AVML_AVX512F)
+        ret.push_back(path("noise, skinning, encodings", "AVX-512F"));
+        ret.push_back(path("Morton and Hilbert batches", "AVX-512F"));
+        #elif defined(AVML_AVX2)
+        ret.push_back(path("noise, skinning, encodings", "AVX2"));
+        ret.push_back(path("Morton and Hilbert batches", "AVX2"));
+        #else
+        ret.push_back(path("noise, skinning, encodings", "scalar"));
+        ret.push_back(path("Morton and Hilbert batches", "scalar"));
+        #endif
+
+        // Dense.ipp micro-kernels
+        #if defined(AVML_AVX512F)
+        ret.push_back(path("dense gemm", "AVX-512F"));
+        #elif defined(AVML_FMA)
+        ret.push_back(path("dense gemm", "FMA"));
+        #elif defined(AVML_AVX)
+        ret.push_back(path("dense gemm", "AVX"));
+        #elif defined(AVML_SSE2)
+        ret.push_back(path("dense gemm", "SSE2"));
+        #else
+        ret.push_back(path("dense gemm", "scalar"));
+        #endif
+
+        // Streaming.ipp stream_transform and stream_quantize
+        #if defined(AVML_AVX512F)
+        ret.push_back(path("float streaming transforms", "AVX-512F"));
+        #elif defined(AVML_AVX)
+        ret.push_back(path("float streaming transforms", "AVX"));
+        #else
+        ret.push_back(path("float streaming transforms", "scalar"));
+        #endif
+
+        #if defined(AVML_SSE2)
+        ret.push_back(path("double streaming transforms", "SSE2"));
+        #else
+        ret.push_back(path("double streaming transforms", "scalar"));
+        #endif
+
+        #if defined(AVML_AVX2)
+        ret.push_back(path("float streaming quantization", "AVX2"));
+        #else
+        ret.push_back(path("float streaming quantization", "scalar"));
+        #endif
+
+        #if defined(AVML_BMI2)
+        ret.push_back(path("Morton bit interleaving", "BMI2"));
+        #else
+        ret.push_back(path("Morton bit interleaving", "scalar"));
+        #endif
+
+        return ret;
+    }
+
+    inline void capabilities_report(std::ostream& stream) {
+        stream << "Compiled tier: " << to_string(compiled_tier()) << '\n';
+        stream << "Compiled features: " << to_string(compiled_capabilities()) << '\n';
+        stream << "CPU features: " << to_string(cpu_capabilities()) << '\n';
+
+        for (const Code_path& p : code_paths()) {
+            stream << "  " << p.name << ": " << p.isa << '\n';
+        }
+    }
+
+}
+
+#if defined(AVML_VERIFY_CPU)
+
+namespace avml_impl {
+
+    static const bool cpu_verified = (avml::require_cpu_support(), true);
+
+}
+
+#endif
+
+#endif //AVML_CAPABILITIES_IPP
@@ -0,0 +1,804 @@
+#ifndef AVML_CONVEX_IPP
+#define AVML_CONVEX_IPP
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "Lanes.hpp"
+
+namespace avml_impl {
+
+    //=====================================================
+    // Support points
+    //=====================================================
+
+    ///
+    /// Finds the furthest of W vertices at a time along d, tracking each
+    /// lane's best index as a float. Callers keep n below 2^24 so indices
+    /// are exact.
+    ///
+    /// \return Number of vertices tested
+    template<class T, unsigned W>
+    AVML_FINL std::size_t support_groups(const float* p, std::size_t n, avml::vec3f d, float& best, std::size_t& best_index) {
+        const T dx{d[0]};
+        const T dy{d[1]};
+        const T dz{d[2]};
+
+        float iota[W];
+        for (unsigned k = 0; k < W; ++k) {
+            iota[k] = static_cast<float>(k);
+        }
+
+        T index = lanes_load(iota);
+        T top{-std::numeric_limits<float>::infinity()};
+        T top_index{0.0f};
+
+        std::size_t i = 0;
+        for (; i + W <= n; i += W) {
+            T r[3];
+            lanes_load_interleaved(p + 3 * i, r);
+
+            T t = lanes_fmadd(r[0], dx, lanes_fmadd(r[1], dy, r[2] * dz));
+            auto m = lanes_less(top, t);
+            top = lanes_select(m, t, top);
+            top_index = lanes_select(m, index, top_index);
+            index = index + T{static_cast<float>(W)};
+        }
+
+        float tops[W];
+        float indices[W];
+        lanes_store(tops, top);
+        lanes_store(indices, top_index);
+        for (unsigned k = 0; k < W; ++k) {
+            std::size_t j = static_cast<std::size_t>(indices[k]);
+            if (best < tops[k] || (best == tops[k] && j < best_index)) {
+                best = tops[k];
+                best_index = j;
+            }
+        }
+
+        return i;
+    }
+
+    //=====================================================
+    // Simplices
+    //=====================================================
+
+    ///
+    /// Point w = a - b of the Minkowski difference of two shapes along with
+    /// the supports it came from
+    ///
+    template<class R>
+    struct Simplex_vertex {
+        avml::Vector3R<R> w;
+        avml::Vector3R<R> a;
+        avml::Vector3R<R> b;
+    };
+
+    ///
+    /// Up to four vertices with the barycentric coordinates of the point
+    /// closest to the origin
+    ///
+    template<class R>
+    struct Simplex {
+        Simplex_vertex<R> v[4];
+        R lambda[4];
+        unsigned size;
+    };
+
+    template<class R, class A, class B>
+    AVML_FINL Simplex_vertex<R> minkowski_support(const A& a, const B& b, avml::Vector3R<R> d) {
+        Simplex_vertex<R> ret;
+        ret.a = support(a, d);
+        ret.b = support(b, -d);
+        ret.w = ret.a - ret.b;
+        return ret;
+    }
+
+    template<class R>
+    AVML_FINL avml::Vector3R<R> simplex_point(const Simplex<R>& s, avml::Vector3R<R> Simplex_vertex<R>::* member) {
+        avml::Vector3R<R> ret = s.v[0].*member * s.lambda[0];
+        for (unsigned i = 1; i < s.size; ++i) {
+            ret += s.v[i].*member * s.lambda[i];
+        }
+        return ret;
+    }
+
+    template<class R>
+    AVML_FINL void simplex_of(Simplex<R>& s, const Simplex_vertex<R>& a) {
+        s.size = 1;
+        s.v[0] = a;
+        s.lambda[0] = R(1);
+    }
+
+    template<class R>
+    AVML_FINL void simplex_of(Simplex<R>& s, const Simplex_vertex<R>& a, const Simplex_vertex<R>& b, R t) {
+        s.size = 2;
+        s.v[0] = a;
+        s.v[1] = b;
+        s.lambda[0] = R(1) - t;
+        s.lambda[1] = t;
+    }
+
+    // Closest points to the origin on simplices of each size. Each replaces
+    // out with the smallest face of its input containing the closest point.
+    // out may alias the input vertices only through copies.
+
+    template<class R>
+    AVML_FINL void closest_on_segment(Simplex_vertex<R> a, Simplex_vertex<R> b, Simplex<R>& out) {
+        avml::Vector3R<R> ab = b.w - a.w;
+        R den = length2(ab);
+        R t = (den > R(0)) ? -dot(a.w, ab) / den : R(0);
+
+        if (t <= R(0)) {
+            simplex_of(out, a);
+        } else if (t >= R(1)) {
+            simplex_of(out, b);
+        } else {
+            simplex_of(out, a, b, t);
+        }
+    }
+
+    template<class R>
+    AVML_FINL void closest_on_triangle(Simplex_vertex<R> a, Simplex_vertex<R> b, Simplex_vertex<R> c, Simplex<R>& out) {
+        avml::Vector3R<R> ab = b.w - a.w;
+        avml::Vector3R<R> ac = c.w - a.w;
+
+        R d1 = -dot(ab, a.w);
+        R d2 = -dot(ac, a.w);
+        if (d1 <= R(0) && d2 <= R(0)) {
+            simplex_of(out, a);
+            return;
+        }
+
+        R d3 = -dot(ab, b.w);
+        R d4 = -dot(ac, b.w);
+        if (d3 >= R(0) && d4 <= d3) {
+            simplex_of(out, b);
+            return;
+        }
+
+        R vc = d1 * d4 - d3 * d2;
+        if (vc <= R(0) && d1 >= R(0) && d3 <= R(0)) {
+            simplex_of(out, a, b, d1 / (d1 - d3));
+            return;
+        }
+
+        R d5 = -dot(ab, c.w);
+        R d6 = -dot(ac, c.w);
+        if (d6 >= R(0) && d5 <= d6) {
+            simplex_of(out, c);
+            return;
+        }
+
+        R vb = d5 * d2 - d1 * d6;
+        if (vb <= R(0) && d2 >= R(0) && d6 <= R(0)) {
+            simplex_of(out, a, c, d2 / (d2 - d6));
+            return;
+        }
+
+        R va = d3 * d6 - d5 * d4;
+        if (va <= R(0) && (d4 - d3) >= R(0) && (d5 - d6) >= R(0)) {
+            simplex_of(out, b, c, (d4 - d3) / ((d4 - d3) + (d5 - d6)));
+            return;
+        }
+
+        R sum = va + vb + vc;
+        if (!(sum > R(0))) {
+            // Collinear vertices which slipped past the region tests
+            Simplex<R> edge;
+            closest_on_segment(a, b, out);
+            closest_on_segment(b, c, edge);
+            if (length2(simplex_point(edge, &Simplex_vertex<R>::w)) < length2(simplex_point(out, &Simplex_vertex<R>::w))) {
+                out = edge;
+            }
+            return;
+        }
+
+        out.size = 3;
+        out.v[0] = a;
+        out.v[1] = b;
+        out.v[2] = c;
+        out.lambda[1] = vb / sum;
+        out.lambda[2] = vc / sum;
+        out.lambda[0] = R(1) - out.lambda[1] - out.lambda[2];
+    }
+
+    template<class R>
+    AVML_FINL void closest_on_tetrahedron(Simplex_vertex<R> a, Simplex_vertex<R> b, Simplex_vertex<R> c, Simplex_vertex<R> d, Simplex<R>& out) {
+        // Faces with the vertex opposite them
+        const Simplex_vertex<R>* faces[4][4] = {
+            {&a, &b, &c, &d},
+            {&a, &c, &d, &b},
+            {&a, &d, &b, &c},
+            {&b, &d, &c, &a}
+        };
+
+        bool outside[4];
+        bool inside = true;
+        for (unsigned i = 0; i < 4; ++i) {
+            const auto& f = faces[i];
+            avml::Vector3R<R> n = cross(f[1]->w - f[0]->w, f[2]->w - f[0]->w);
+            R origin_side = -dot(f[0]->w, n);
+            R opposite_side = dot(f[3]->w - f[0]->w, n);
+
+            // The origin is outside of the face, on it, or the tetrahedron
+            // is flat
+            outside[i] = origin_side * opposite_side <= R(0);
+            inside = inside && !outside[i];
+        }
+
+        if (inside) {
+            avml::Vector3R<R> ab = b.w - a.w;
+            avml::Vector3R<R> ac = c.w - a.w;
+            avml::Vector3R<R> ad = d.w - a.w;
+            R volume = dot(ab, cross(ac, ad));
+
+            R lambda[4];
+            lambda[1] = -dot(a.w, cross(ac, ad)) / volume;
+            lambda[2] = -dot(ab, cross(a.w, ad)) / volume;
+            lambda[3] = -dot(ab, cross(ac, a.w)) / volume;
+            lambda[0] = R(1) - lambda[1] - lambda[2] - lambda[3];
+
+            // The side tests of a nearly flat tetrahedron can all pass
+            // through rounding alone, which shows as negative weights
+            if (lambda[0] >= R(0) && lambda[1] >= R(0) && lambda[2] >= R(0) && lambda[3] >= R(0)) {
+                out.size = 4;
+                out.v[0] = a;
+                out.v[1] = b;
+                out.v[2] = c;
+                out.v[3] = d;
+                for (unsigned i = 0; i < 4; ++i) {
+                    out.lambda[i] = lambda[i];
+                }
+                return;
+            }
+
+            for (bool& o : outside) {
+                o = true;
+            }
+        }
+
+        R best = std::numeric_limits<R>::infinity();
+        for (unsigned i = 0; i < 4; ++i) {
+            if (!outside[i]) {
+                continue;
+            }
+
+            Simplex<R> candidate;
+            closest_on_triangle(*faces[i][0], *faces[i][1], *faces[i][2], candidate);
+            R dist = length2(simplex_point(candidate, &Simplex_vertex<R>::w));
+            if (dist < best) {
+                best = dist;
+                out = candidate;
+            }
+        }
+    }
+
+    template<class R>
+    AVML_FINL void reduce_simplex(Simplex<R>& s) {
+        switch (s.size) {
+        case 2: closest_on_segment(s.v[0], s.v[1], s); break;
+        case 3: closest_on_triangle(s.v[0], s.v[1], s.v[2], s); break;
+        case 4: closest_on_tetrahedron(s.v[0], s.v[1], s.v[2], s.v[3], s); break;
+        default: break;
+        }
+    }
+
+    //=====================================================
+    // GJK
+    //=====================================================
+
+    constexpr unsigned gjk_max_iterations = 64;
+
+    ///
+    /// \param separation_only Stop as soon as a separating direction is
+    /// found, leaving the distance and closest points approximate
+    /// \param s Set to the final simplex
+    ///
+    template<class R, class A, class B>
+    avml::Gjk_result<R> gjk(const A& a, const B& b, bool separation_only, Simplex<R>& s) {
+        // Iteration stops once the distance is known to within this
+        // fraction, or the point closest to the origin is within this
+        // fraction of the simplex's extent from it
+        const R tolerance = R(100) * std::numeric_limits<R>::epsilon();
+
+        avml::Gjk_result<R> ret;
+        ret.intersecting = false;
+        ret.iterations = 0;
+
+        simplex_of(s, minkowski_support(a, b, avml::Vector3R<R>{R(1), R(0), R(0)}));
+        avml::Vector3R<R> v = s.v[0].w;
+        R extent2 = length2(v);
+
+        for (; ret.iterations < gjk_max_iterations; ++ret.iterations) {
+            R vv = length2(v);
+            if (vv <= tolerance * tolerance * extent2) {
+                ret.intersecting = true;
+                break;
+            }
+
+            Simplex_vertex<R> p = minkowski_support(a, b, -v);
+            R vw = dot(v, p.w);
+            if (separation_only && vw > R(0)) {
+                break;
+            }
+            if (vv - vw <= tolerance * vv) {
+                break;
+            }
+
+            // A support within rounding of one already in the simplex would
+            // make it degenerate
+            bool repeated = false;
+            for (unsigned i = 0; i < s.size; ++i) {
+                repeated = repeated || (length2(s.v[i].w - p.w) <= tolerance * tolerance * extent2);
+            }
+            if (repeated) {
+                break;
+            }
+
+            Simplex<R> previous = s;
+            s.v[s.size++] = p;
+            extent2 = std::max(extent2, length2(p.w));
+            reduce_simplex(s);
+
+            avml::Vector3R<R> next = simplex_point(s, &Simplex_vertex<R>::w);
+            if (s.size == 4) {
+                ++ret.iterations;
+                v = next;
+                ret.intersecting = true;
+                break;
+            }
+
+            // Rounding can keep the simplex from getting any closer
+            if (!(length2(next) < vv)) {
+                s = previous;
+                break;
+            }
+            v = next;
+        }
+
+        ret.on_a = simplex_point(s, &Simplex_vertex<R>::a);
+        ret.on_b = simplex_point(s, &Simplex_vertex<R>::b);
+        ret.distance = ret.intersecting ? R(0) : std::sqrt(length2(v));
+        return ret;
+    }
+
+    //=====================================================
+    // EPA
+    //=====================================================
+
+    constexpr unsigned epa_max_supports = 64;
+
+    template<class R>
+    struct Epa_face {
+        unsigned i[3];
+        avml::Vector3R<R> n;
+        R d;
+    };
+
+    ///
+    /// Convex polytope around the origin with outward facing triangles.
+    /// Faces are oriented away from an interior point, the centroid of the
+    /// initial tetrahedron, rather than the origin, which may lie on them.
+    ///
+    template<class R>
+    struct Epa_polytope {
+        static constexpr unsigned max_vertices = 4 + epa_max_supports;
+        static constexpr unsigned max_faces = 2 * max_vertices;
+        static constexpr unsigned max_edges = 3 * max_faces;
+
+        Simplex_vertex<R> vertices[max_vertices];
+        Epa_face<R> faces[max_faces];
+        unsigned edges[max_edges][2];
+
+        unsigned vertex_count;
+        unsigned face_count;
+        avml::Vector3R<R> interior;
+
+        AVML_FINL bool add_face(unsigned i0, unsigned i1, unsigned i2) {
+            if (face_count == max_faces) {
+                return false;
+            }
+
+            const avml::Vector3R<R>& w0 = vertices[i0].w;
+            avml::Vector3R<R> n = cross(vertices[i1].w - w0, vertices[i2].w - w0);
+            R len = std::sqrt(length2(n));
+
+            Epa_face<R>& f = faces[face_count++];
+            f.i[0] = i0;
+            f.i[1] = i1;
+            f.i[2] = i2;
+            if (!(len > R(0))) {
+                // Never closest and never visible
+                f.n = avml::Vector3R<R>{R(0)};
+                f.d = std::numeric_limits<R>::infinity();
+                return true;
+            }
+
+            f.n = n / len;
+            if (dot(f.n, w0 - interior) < R(0)) {
+                f.n = -f.n;
+                std::swap(f.i[1], f.i[2]);
+            }
+            f.d = dot(f.n, w0);
+            return true;
+        }
+
+        ///
+        /// Replaces the faces visible from vertex v with a fan of faces from
+        /// the horizon to v
+        ///
+        AVML_FINL bool expand(unsigned v) {
+            unsigned edge_count = 0;
+            const avml::Vector3R<R>& w = vertices[v].w;
+
+            for (unsigned f = 0; f < face_count;) {
+                const Epa_face<R>& face = faces[f];
+                if (!(dot(face.n, w - vertices[face.i[0]].w) > R(0))) {
+                    ++f;
+                    continue;
+                }
+
+                // Edges shared by two visible faces are interior to the hole
+                for (unsigned k = 0; k < 3; ++k) {
+                    unsigned e0 = face.i[k];
+                    unsigned e1 = face.i[(k + 1) % 3];
+
+                    unsigned j = 0;
+                    while (j < edge_count && !(edges[j][0] == e1 && edges[j][1] == e0)) {
+                        ++j;
+                    }
+
+                    if (j < edge_count) {
+                        edges[j][0] = edges[edge_count - 1][0];
+                        edges[j][1] = edges[edge_count - 1][1];
+                        --edge_count;
+                    } else if (edge_count < max_edges) {
+                        edges[edge_count][0] = e0;
+                        edges[edge_count][1] = e1;
+                        ++edge_count;
+                    } else {
+                        return false;
+                    }
+                }
+
+                faces[f] = faces[--face_count];
+            }
+
+            for (unsigned e = 0; e < edge_count; ++e) {
+                if (!add_face(edges[e][0], edges[e][1], v)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    ///
+    /// Grows a simplex containing the origin, possibly on its boundary, into
+    /// a tetrahedron
+    ///
+    /// \return False if the Minkowski difference is flat
+    template<class R, class A, class B>
+    bool complete_tetrahedron(const A& a, const B& b, Simplex<R>& s) {
+        using vector = avml::Vector3R<R>;
+        const R eps = std::numeric_limits<R>::epsilon();
+
+        if (s.size == 1) {
+            const vector axes[6] = {
+                vector{R(1), R(0), R(0)}, vector{R(-1), R(0), R(0)},
+                vector{R(0), R(1), R(0)}, vector{R(0), R(-1), R(0)},
+                vector{R(0), R(0), R(1)}, vector{R(0), R(0), R(-1)}
+            };
+
+            for (const vector& d : axes) {
+                Simplex_vertex<R> p = minkowski_support(a, b, d);
+                vector e = p.w - s.v[0].w;
+                if (length2(e) > eps * std::max(length2(p.w), length2(s.v[0].w))) {
+                    s.v[s.size++] = p;
+                    break;
+                }
+            }
+            if (s.size == 1) {
+                return false;
+            }
+        }
+
+        if (s.size == 2) {
+            vector e = s.v[1].w - s.v[0].w;
+
+            // Start perpendicular to e from the axis it's least aligned with
+            vector axis{R(0)};
+            unsigned k = (std::abs(e[0]) < std::abs(e[1])) ? 0 : 1;
+            k = (std::abs(e[k]) < std::abs(e[2])) ? k : 2;
+            axis[k] = R(1);
+
+            vector d = cross(e, axis);
+            avml::Unit_vector3R<R> around = normalize(e);
+            for (unsigned i = 0; i < 6; ++i) {
+                Simplex_vertex<R> p = minkowski_support(a, b, rotate(d, R(i) * R(1.0471975511965976), around));
+                vector c = cross(p.w - s.v[0].w, e);
+                if (length2(c) > eps * length2(e) * length2(p.w - s.v[0].w)) {
+                    s.v[s.size++] = p;
+                    break;
+                }
+            }
+            if (s.size == 2) {
+                return false;
+            }
+        }
+
+        if (s.size == 3) {
+            vector n = cross(s.v[1].w - s.v[0].w, s.v[2].w - s.v[0].w);
+            R scale = std::sqrt(length2(n));
+
+            Simplex_vertex<R> p = minkowski_support(a, b, n);
+            if (std::abs(dot(p.w - s.v[0].w, n)) <= std::sqrt(eps) * scale * std::sqrt(length2(p.w - s.v[0].w))) {
+                p = minkowski_support(a, b, -n);
+            }
+            if (std::abs(dot(p.w - s.v[0].w, n)) <= std::sqrt(eps) * scale * std::sqrt(length2(p.w - s.v[0].w))) {
+                return false;
+            }
+            s.v[s.size++] = p;
+        }
+
+        return true;
+    }
+
+    ///
+    /// \return Barycentric coordinates of p with respect to triangle abc
+    template<class R>
+    AVML_FINL void barycentric(avml::Vector3R<R> p, avml::Vector3R<R> a, avml::Vector3R<R> b, avml::Vector3R<R> c, R (&uvw)[3]) {
+        avml::Vector3R<R> n = cross(b - a, c - a);
+        R area = length2(n);
+        uvw[1] = dot(cross(c - p, a - p), n) / area;
+        uvw[2] = dot(cross(a - p, b - p), n) / area;
+        uvw[0] = R(1) - uvw[1] - uvw[2];
+    }
+
+    template<class R, class A, class B>
+    avml::Penetration<R> epa(const A& a, const B& b) {
+        Simplex<R> s;
+        avml::Gjk_result<R> g = gjk(a, b, false, s);
+
+        avml::Penetration<R> ret;
+        ret.intersecting = g.intersecting;
+        ret.on_a = g.on_a;
+        ret.on_b = g.on_b;
+
+        if (!g.intersecting) {
+            ret.depth = -g.distance;
+            ret.normal = (g.distance > R(0)) ? (g.on_b - g.on_a) / g.distance : avml::Vector3R<R>{R(1), R(0), R(0)};
+            return ret;
+        }
+
+        // Touching within tolerance
+        ret.depth = R(0);
+        ret.normal = avml::Vector3R<R>{R(1), R(0), R(0)};
+        if (!complete_tetrahedron(a, b, s)) {
+            return ret;
+        }
+
+        Epa_polytope<R> poly;
+        poly.vertex_count = 4;
+        poly.face_count = 0;
+        poly.interior = avml::Vector3R<R>{R(0)};
+        for (unsigned i = 0; i < 4; ++i) {
+            poly.vertices[i] = s.v[i];
+            poly.interior += s.v[i].w * R(0.25);
+        }
+        poly.add_face(0, 1, 2);
+        poly.add_face(0, 3, 1);
+        poly.add_face(0, 2, 3);
+        poly.add_face(1, 3, 2);
+
+        const R tolerance = std::sqrt(std::numeric_limits<R>::epsilon());
+        R extent = R(0);
+        for (unsigned i = 0; i < 4; ++i) {
+            extent = std::max(extent, std::sqrt(length2(s.v[i].w)));
+        }
+
+        // Copied since a failed expansion leaves the polytope inconsistent
+        Epa_face<R> face;
+        for (unsigned iteration = 0;; ++iteration) {
+            if (poly.face_count == 0) {
+                return ret;
+            }
+
+            unsigned closest = 0;
+            for (unsigned f = 1; f < poly.face_count; ++f) {
+                if (poly.faces[f].d < poly.faces[closest].d) {
+                    closest = f;
+                }
+            }
+
+            face = poly.faces[closest];
+            if (iteration == epa_max_supports || !(face.d < std::numeric_limits<R>::infinity())) {
+                break;
+            }
+
+            Simplex_vertex<R> p = minkowski_support(a, b, face.n);
+            if (dot(p.w, face.n) - face.d <= tolerance * extent) {
+                break;
+            }
+
+            poly.vertices[poly.vertex_count] = p;
+            if (!poly.expand(poly.vertex_count++)) {
+                break;
+            }
+            extent = std::max(extent, std::sqrt(length2(p.w)));
+        }
+
+        if (!(face.d < std::numeric_limits<R>::infinity())) {
+            return ret;
+        }
+
+        const Simplex_vertex<R>& v0 = poly.vertices[face.i[0]];
+        const Simplex_vertex<R>& v1 = poly.vertices[face.i[1]];
+        const Simplex_vertex<R>& v2 = poly.vertices[face.i[2]];
+
+        R uvw[3];
+        barycentric(face.n * face.d, v0.w, v1.w, v2.w, uvw);
+
+        ret.depth = std::max(face.d, R(0));
+        ret.normal = face.n;
+        ret.on_a = v0.a * uvw[0] + v1.a * uvw[1] + v2.a * uvw[2];
+        ret.on_b = v0.b * uvw[0] + v1.b * uvw[1] + v2.b * uvw[2];
+        return ret;
+    }
+
+}
+
+namespace avml {
+
+    //=====================================================
+    // Supports
+    //=====================================================
+
+    template<class R>
+    AVML_FINL Vector3R<R> support(const SphereR<R>& s, Vector3R<R> d) {
+        R len2 = length2(d);
+        if (!(len2 > R(0))) {
+            return s.center();
+        }
+        return s.center() + d * (s.radius() / std::sqrt(len2));
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> support(const CapsuleR<R>& c, Vector3R<R> d) {
+        bool upper = dot(d, c.p1() - c.p0()) > R(0);
+        return support(SphereR<R>{upper ? c.p1() : c.p0(), c.radius()}, d);
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> support(const Aabb3R<R>& b, Vector3R<R> d) {
+        return Vector3R<R>{
+            (d[0] < R(0)) ? b.minimum()[0] : b.maximum()[0],
+            (d[1] < R(0)) ? b.minimum()[1] : b.maximum()[1],
+            (d[2] < R(0)) ? b.minimum()[2] : b.maximum()[2]
+        };
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> support(const ObbR<R>& b, Vector3R<R> d) {
+        Vector3R<R> ret = b.center();
+        for (unsigned i = 0; i < 3; ++i) {
+            R e = (dot(d, b.axes()[i]) < R(0)) ? -b.extents()[i] : b.extents()[i];
+            ret += b.axes()[i] * e;
+        }
+        return ret;
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> support(const Convex_vertices<R>& v, Vector3R<R> d) {
+        return v.vertices[support_index(v.vertices, v.count, d)];
+    }
+
+    inline std::size_t support_index(const vec3f* vertices, std::size_t n, vec3f d) {
+        const float* p = reinterpret_cast<const float*>(vertices);
+        const std::size_t block = std::size_t{1} << 24;
+
+        float best = -std::numeric_limits<float>::infinity();
+        std::size_t best_index = 0;
+        for (std::size_t begin = 0; begin < n; begin += block) {
+            std::size_t m = std::min(n - begin, block);
+            float block_best = -std::numeric_limits<float>::infinity();
+            std::size_t block_index = 0;
+            std::size_t i = 0;
+
+            #if defined(AVML_AVX512F)
+            i = avml_impl::support_groups<avml_impl::Lanes16f, 16>(p + 3 * begin, m, d, block_best, block_index);
+            #elif defined(AVML_AVX)
+            i = avml_impl::support_groups<avml_impl::Lanes8f, 8>(p + 3 * begin, m, d, block_best, block_index);
+            #endif
+
+            for (; i < m; ++i) {
+                const float* v = p + 3 * (begin + i);
+                float t = avml_impl::lanes_fmadd(v[0], d[0], avml_impl::lanes_fmadd(v[1], d[1], v[2] * d[2]));
+                if (block_best < t) {
+                    block_best = t;
+                    block_index = i;
+                }
+            }
+
+            if (best < block_best) {
+                best = block_best;
+                best_index = begin + block_index;
+            }
+        }
+
+        return best_index;
+    }
+
+    inline std::size_t support_index(const vec3d* vertices, std::size_t n, vec3d d) {
+        double best = -std::numeric_limits<double>::infinity();
+        std::size_t best_index = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            double t = dot(vertices[i], d);
+            if (best < t) {
+                best = t;
+                best_index = i;
+            }
+        }
+        return best_index;
+    }
+
+    //=====================================================
+    // Queries
+    //=====================================================
+
+    template<class A, class B>
+    AVML_FINL Gjk_result<typename A::scalar> gjk_distance(const A& a, const B& b) {
+        avml_impl::Simplex<typename A::scalar> s;
+        return avml_impl::gjk(a, b, false, s);
+    }
+
+    template<class A, class B>
+    AVML_FINL bool gjk_intersect(const A& a, const B& b) {
+        avml_impl::Simplex<typename A::scalar> s;
+        return avml_impl::gjk(a, b, true, s).intersecting;
+    }
+
+    template<class A, class B>
+    AVML_FINL Penetration<typename A::scalar> epa_penetration(const A& a, const B& b) {
+        return avml_impl::epa<typename A::scalar>(a, b);
+    }
+
+    template<class A, class B>
+    inline void gjk_distance(const A* a, const B* b, Gjk_result<typename A::scalar>* out, std::size_t n) {
+        AVML_PROFILE_BATCH("gjk_distance[batch]", n);
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = gjk_distance(a[i], b[i]);
+        }
+    }
+
+    template<class A, class B>
+    inline void epa_penetration(const A* a, const B* b, Penetration<typename A::scalar>* out, std::size_t n) {
+        AVML_PROFILE_BATCH("epa_penetration[batch]", n);
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = epa_penetration(a[i], b[i]);
+        }
+    }
+
+    // A pair costs far more than its size suggests, so chunks are kept to 64
+    // pairs rather than sized by default_grain()
+
+    template<class A, class B>
+    inline void gjk_distance(const A* a, const B* b, Gjk_result<typename A::scalar>* out, std::size_t n, Executor& executor) {
+        executor.parallel_for(n, 64, [&](std::size_t begin, std::size_t end) {
+            gjk_distance(a + begin, b + begin, out + begin, end - begin);
+        });
+    }
+
+    template<class A, class B>
+    inline void epa_penetration(const A* a, const B* b, Penetration<typename A::scalar>* out, std::size_t n, Executor& executor) {
+        executor.parallel_for(n, 64, [&](std::size_t begin, std::size_t end) {
+            epa_penetration(a + begin, b + begin, out + begin, end - begin);
+        });
+    }
+
+}
+
+#endif
@@ -0,0 +1,640 @@
+#ifndef AVML_DENSE_IPP
+#define AVML_DENSE_IPP
+
+namespace avml_impl {
+
+    //=====================================================
+    // Blocking parameters
+    //=====================================================
+
+    // mr x nr is the block of C held in registers by the micro-kernel. A
+    // kc x nr panel of B is sized to stay in L1 and an mc x kc block of A to
+    // stay in L2. nc bounds the packed columns of B, which are shared by all
+    // threads. Threads take tiles of mc rows by tile columns of C.
+
+    template<class R>
+    struct Gemm_blocking {
+        static constexpr std::size_t mr = 4;
+        static constexpr std::size_t nr = 4;
+        static constexpr std::size_t kc = 256;
+        static constexpr std::size_t mc = 96;
+        static constexpr std::size_t nc = 4096;
+        static constexpr std::size_t tile = 128;
+    };
+
+    template<>
+    struct Gemm_blocking<float> {
+        #if defined(AVML_AVX512F)
+        static constexpr std::size_t mr = 8;
+        static constexpr std::size_t nr = 32;
+        #elif defined(AVML_AVX)
+        static constexpr std::size_t mr = 6;
+        static constexpr std::size_t nr = 16;
+        #elif defined(AVML_SSE2)
+        static constexpr std::size_t mr = 4;
+        static constexpr std::size_t nr = 8;
+        #else
+        static constexpr std::size_t mr = 4;
+        static constexpr std::size_t nr = 4;
+        #endif
+        static constexpr std::size_t kc = 256;
+        static constexpr std::size_t mc = 96;
+        static constexpr std::size_t nc = 4096;
+        static constexpr std::size_t tile = 128;
+    };
+
+    // Products smaller than this many multiply-adds skip packing
+    constexpr std::size_t gemm_small_volume = 8 * 8 * 8;
+
+    AVML_FINL std::size_t gemm_min(std::size_t a, std::size_t b) {
+        return (a < b) ? a : b;
+    }
+
+    AVML_FINL std::size_t gemm_ceil_div(std::size_t a, std::size_t b) {
+        return (a + b - 1) / b;
+    }
+
+    //=====================================================
+    // Micro-kernels
+    //=====================================================
+
+    // Each kernel computes C = alpha * A * B + beta * C for a full mr x nr
+    // block of C from a packed mr-row panel of A and nr-column panel of B.
+    // C isn't read when beta is zero. The SIMD kernels name every
+    // accumulator individually, as compilers won't reliably keep an array of
+    // registers out of memory.
+
+    template<class R>
+    AVML_FINL void gemm_micro_kernel(std::size_t kc, const R* a, const R* b, R* c, std::size_t ldc, R alpha, R beta) {
+        R acc[Gemm_blocking<R>::mr][Gemm_blocking<R>::nr] = {};
+
+        for (std::size_t p = 0; p < kc; ++p) {
+            for (std::size_t i = 0; i < Gemm_blocking<R>::mr; ++i) {
+                for (std::size_t j = 0; j < Gemm_blocking<R>::nr; ++j) {
+                    acc[i][j] += a[i] * b[j];
+                }
+            }
+
+            a += Gemm_blocking<R>::mr;
+            b += Gemm_blocking<R>::nr;
+        }
+
+        for (std::size_t i = 0; i < Gemm_blocking<R>::mr; ++i) {
+            for (std::size_t j = 0; j < Gemm_blocking<R>::nr; ++j) {
+                R r = alpha * acc[i][j];
+                c[i * ldc + j] = (beta == R(0)) ? r : r + beta * c[i * ldc + j];
+            }
+        }
+    }
+
+#if defined(AVML_AVX512F)
+
+    AVML_FINL void gemm_update16f(float* c, __m512 acc, __m512 alpha, __m512 beta, bool read_c) {
+        __m512 r = _mm512_mul_ps(acc, alpha);
+        if (read_c) {
+            r = _mm512_fmadd_ps(beta, _mm512_loadu_ps(c), r);
+        }
+        _mm512_storeu_ps(c, r);
+    }
+
+    AVML_FINL void gemm_micro_kernel(std::size_t kc, const float* a, const float* b, float* c, std::size_t ldc, float alpha, float beta) {
+        __m512 c00 = _mm512_setzero_ps(), c01 = _mm512_setzero_ps();
+        __m512 c10 = _mm512_setzero_ps(), c11 = _mm512_setzero_ps();
+        __m512 c20 = _mm512_setzero_ps(), c21 = _mm512_setzero_ps();
+        __m512 c30 = _mm512_setzero_ps(), c31 = _mm512_setzero_ps();
+        __m512 c40 = _mm512_setzero_ps(), c41 = _mm512_setzero_ps();
+        __m512 c50 = _mm512_setzero_ps(), c51 = _mm512_setzero_ps();
+        __m512 c60 = _mm512_setzero_ps(), c61 = _mm512_setzero_ps();
+        __m512 c70 = _mm512_setzero_ps(), c71 = _mm512_setzero_ps();
+
+        for (std::size_t p = 0; p < kc; ++p) {
+            __m512 b0 = _mm512_load_ps(b + 0x00);
+            __m512 b1 = _mm512_load_ps(b + 0x10);
+
+            __m512 ai;
+            ai = _mm512_set1_ps(a[0]);
+            c00 = _mm512_fmadd_ps(ai, b0, c00);
+            c01 = _mm512_fmadd_ps(ai, b1, c01);
+            ai = _mm512_set1_ps(a[1]);
+            c10 = _mm512_fmadd_ps(ai, b0, c10);
+            c11 = _mm512_fmadd_ps(ai, b1, c11);
+            ai = _mm512_set1_ps(a[2]);
+            c20 = _mm512_fmadd_ps(ai, b0, c20);
+            c21 = _mm512_fmadd_ps(ai, b1, c21);
+            ai = _mm512_set1_ps(a[3]);
+            c30 = _mm512_fmadd_ps(ai, b0, c30);
+            c31 = _mm512_fmadd_ps(ai, b1, c31);
+            ai = _mm512_set1_ps(a[4]);
+            c40 = _mm512_fmadd_ps(ai, b0, c40);
+            c41 = _mm512_fmadd_ps(ai, b1, c41);
+            ai = _mm512_set1_ps(a[5]);
+            c50 = _mm512_fmadd_ps(ai, b0, c50);
+            c51 = _mm512_fmadd_ps(ai, b1, c51);
+            ai = _mm512_set1_ps(a[6]);
+            c60 = _mm512_fmadd_ps(ai, b0, c60);
+            c61 = _mm512_fmadd_ps(ai, b1, c61);
+            ai = _mm512_set1_ps(a[7]);
+            c70 = _mm512_fmadd_ps(ai, b0, c70);
+            c71 = _mm512_fmadd_ps(ai, b1, c71);
+
+            a += 8;
+            b += 32;
+        }
+
+        __m512 va = _mm512_set1_ps(alpha);
+        __m512 vb = _mm512_set1_ps(beta);
+        bool read_c = (beta != 0.0f);
+
+        gemm_update16f(c + 0 * ldc + 0x00, c00, va, vb, read_c);
+        gemm_update16f(c + 0 * ldc + 0x10, c01, va, vb, read_c);
+        gemm_update16f(c + 1 * ldc + 0x00, c10, va, vb, read_c);
+        gemm_update16f(c + 1 * ldc + 0x10, c11, va, vb, read_c);
+        gemm_update16f(c + 2 * ldc + 0x00, c20, va, vb, read_c);
+        gemm_update16f(c + 2 * ldc + 0x10, c21, va, vb, read_c);
+        gemm_update16f(c + 3 * ldc + 0x00, c30, va, vb, read_c);
+        gemm_update16f(c + 3 * ldc + 0x10, c31, va, vb, read_c);
+        gemm_update16f(c + 4 * ldc + 0x00, c40, va, vb, read_c);
+        gemm_update16f(c + 4 * ldc + 0x10, c41, va, vb, read_c);
+        gemm_update16f(c + 5 * ldc + 0x00, c50, va, vb, read_c);
+        gemm_update16f(c + 5 * ldc + 0x10, c51, va, vb, read_c);
+        gemm_update16f(c + 6 * ldc + 0x00, c60, va, vb, read_c);
+        gemm_update16f(c + 6 * ldc + 0x10, c61, va, vb, read_c);
+        gemm_update16f(c + 7 * ldc + 0x00, c70, va, vb, read_c);
+        gemm_update16f(c + 7 * ldc + 0x10, c71, va, vb, read_c);
+    }
+
+#elif defined(AVML_AVX)
+
+    AVML_FINL void gemm_update8f(float* c, __m256 acc, __m256 alpha, __m256 beta, bool read_c) {
+        __m256 r = _mm256_mul_ps(acc, alpha);
+        if (read_c) {
+            r = fmadd8f(beta, _mm256_loadu_ps(c), r);
+        }
+        _mm256_storeu_ps(c, r);
+    }
+
+    AVML_FINL void gemm_micro_kernel(std::size_t kc, const float* a, const float* b, float* c, std::size_t ldc, float alpha, float beta) {
+        __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+        __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+        __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+        __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+        __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+        __m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+
+        for (std::size_t p = 0; p < kc; ++p) {
+            __m256 b0 = _mm256_load_ps(b + 0x0);
+            __m256 b1 = _mm256_load_ps(b + 0x8);
+
+            __m256 ai;
+            ai = _mm256_broadcast_ss(a + 0);
+            c00 = fmadd8f(ai, b0, c00);
+            c01 = fmadd8f(ai, b1, c01);
+            ai = _mm256_broadcast_ss(a + 1);
+            c10 = fmadd8f(ai, b0, c10);
+            c11 = fmadd8f(ai, b1, c11);
+            ai = _mm256_broadcast_ss(a + 2);
+            c20 = fmadd8f(ai, b0, c20);
+            c21 = fmadd8f(ai, b1, c21);
+            ai = _mm256_broadcast_ss(a + 3);
+            c30 = fmadd8f(ai, b0, c30);
+            c31 = fmadd8f(ai, b1, c31);
+            ai = _mm256_broadcast_ss(a + 4);
+            c40 = fmadd8f(ai, b0, c40);
+            c41 = fmadd8f(ai, b1, c41);
+            ai = _mm256_broadcast_ss(a + 5);
+            c50 = fmadd8f(ai, b0, c50);
+            c51 = fmadd8f(ai, b1, c51);
+
+            a += 6;
+            b += 16;
+        }
+
+        __m256 va = _mm256_set1_ps(alpha);
+        __m256 vb = _mm256_set1_ps(beta);
+        bool read_c = (beta != 0.0f);
+
+        gemm_update8f(c + 0 * ldc + 0x0, c00, va, vb, read_c);
+        gemm_update8f(c + 0 * ldc + 0x8, c01, va, vb, read_c);
+        gemm_update8f(c + 1 * ldc + 0x0, c10, va, vb, read_c);
+        gemm_update8f(c + 1 * ldc + 0x8, c11, va, vb, read_c);
+        gemm_update8f(c + 2 * ldc + 0x0, c20, va, vb, read_c);
+        gemm_update8f(c + 2 * ldc + 0x8, c21, va, vb, read_c);
+        gemm_update8f(c + 3 * ldc + 0x0, c30, va, vb, read_c);
+        gemm_update8f(c + 3 * ldc + 0x8, c31, va, vb, read_c);
+        gemm_update8f(c + 4 * ldc + 0x0, c40, va, vb, read_c);
+        gemm_update8f(c + 4 * ldc + 0x8, c41, va, vb, read_c);
+        gemm_update8f(c + 5 * ldc + 0x0, c50, va, vb, read_c);
+        gemm_update8f(c + 5 * ldc + 0x8, c51, va, vb, read_c);
+    }
+
+#elif defined(AVML_SSE2)
+
+    AVML_FINL void gemm_update4f(float* c, __m128 acc, __m128 alpha, __m128 beta, bool read_c) {
+        __m128 r = _mm_mul_ps(acc, alpha);
+        if (read_c) {
+            r = fmadd4f(beta, _mm_loadu_ps(c), r);
+        }
+        _mm_storeu_ps(c, r);
+    }
+
+    AVML_FINL void gemm_micro_kernel(std::size_t kc, const float* a, const float* b, float* c, std::size_t ldc, float alpha, float beta) {
+        __m128 c00 = _mm_setzero_ps(), c01 = _mm_setzero_ps();
+        __m128 c10 = _mm_setzero_ps(), c11 = _mm_setzero_ps();
+        __m128 c20 = _mm_setzero_ps(), c21 = _mm_setzero_ps();
+        __m128 c30 = _mm_setzero_ps(), c31 = _mm_setzero_ps();
+
+        for (std::size_t p = 0; p < kc; ++p) {
+            __m128 b0 = _mm_load_ps(b + 0x0);
+            __m128 b1 = _mm_load_ps(b + 0x4);
+
+            __m128 ai;
+            ai = _mm_set1_ps(a[0]);
+            c00 = fmadd4f(ai, b0, c00);
+            c01 = fmadd4f(ai, b1, c01);
+            ai = _mm_set1_ps(a[1]);
+            c10 = fmadd4f(ai, b0, c10);
+            c11 = fmadd4f(ai, b1, c11);
+            ai = _mm_set1_ps(a[2]);
+            c20 = fmadd4f(ai, b0, c20);
+            c21 = fmadd4f(ai, b1, c21);
+            ai = _mm_set1_ps(a[3]);
+            c30 = fmadd4f(ai, b0, c30);
+            c31 = fmadd4f(ai, b1, c31);
+
+            a += 4;
+            b += 8;
+        }
+
+        __m128 va = _mm_set1_ps(alpha);
+        __m128 vb = _mm_set1_ps(beta);
+        bool read_c = (beta != 0.0f);
+
+        gemm_update4f(c + 0 * ldc + 0x0, c00, va, vb, read_c);
+        gemm_update4f(c + 0 * ldc + 0x4, c01, va, vb, read_c);
+        gemm_update4f(c + 1 * ldc + 0x0, c10, va, vb, read_c);
+        gemm_update4f(c + 1 * ldc + 0x4, c11, va, vb, read_c);
+        gemm_update4f(c + 2 * ldc + 0x0, c20, va, vb, read_c);
+        gemm_update4f(c + 2 * ldc + 0x4, c21, va, vb, read_c);
+        gemm_update4f(c + 3 * ldc + 0x0, c30, va, vb, read_c);
+        gemm_update4f(c + 3 * ldc + 0x4, c31, va, vb, read_c);
+    }
+
+#endif
+
+    //=====================================================
+    // Packing
+    //=====================================================
+
+    ///
+    /// Copies rows x kc elements of A into an mr-row panel laid out so the
+    /// micro-kernel reads one column of the panel per step. Rows past the end
+    /// of A are zeroed.
+    ///
+    template<class R>
+    void gemm_pack_a(std::size_t rows, std::size_t kc, const R* a, std::size_t lda, R* out) {
+        const std::size_t mr = Gemm_blocking<R>::mr;
+
+        for (std::size_t i = 0; i < rows; ++i) {
+            const R* row = a + i * lda;
+            for (std::size_t p = 0; p < kc; ++p) {
+                out[p * mr + i] = row[p];
+            }
+        }
+
+        for (std::size_t i = rows; i < mr; ++i) {
+            for (std::size_t p = 0; p < kc; ++p) {
+                out[p * mr + i] = R(0);
+            }
+        }
+    }
+
+    ///
+    /// Copies kc x cols elements of B into an nr-column panel. Columns past
+    /// the end of B are zeroed.
+    ///
+    template<class R>
+    void gemm_pack_b(std::size_t cols, std::size_t kc, const R* b, std::size_t ldb, R* out) {
+        const std::size_t nr = Gemm_blocking<R>::nr;
+
+        for (std::size_t p = 0; p < kc; ++p) {
+            const R* row = b + p * ldb;
+            R* dst = out + p * nr;
+
+            std::size_t j = 0;
+            for (; j < cols; ++j) {
+                dst[j] = row[j];
+            }
+            for (; j < nr; ++j) {
+                dst[j] = R(0);
+            }
+        }
+    }
+
+    //=====================================================
+    // Drivers
+    //=====================================================
+
+    template<class R>
+    void gemm_small(
+        std::size_t m, std::size_t n, std::size_t k,
+        R alpha, const R* a, std::size_t lda, const R* b, std::size_t ldb,
+        R beta, R* c, std::size_t ldc) {
+
+        for (std::size_t i = 0; i < m; ++i) {
+            R* row = c + i * ldc;
+            for (std::size_t j = 0; j < n; ++j) {
+                row[j] = (beta == R(0)) ? R(0) : beta * row[j];
+            }
+
+            for (std::size_t p = 0; p < k; ++p) {
+                R x = alpha * a[i * lda + p];
+                const R* b_row = b + p * ldb;
+                for (std::size_t j = 0; j < n; ++j) {
+                    row[j] += x * b_row[j];
+                }
+            }
+        }
+    }
+
+    ///
+    /// Multiplies one mr x nr block, going through a temporary when the
+    /// block is cut off by the edge of C
+    ///
+    template<class R>
+    AVML_FINL void gemm_block(
+        std::size_t rows, std::size_t cols, std::size_t kc,
+        const R* a_panel, const R* b_panel,
+        R alpha, R beta, R* c, std::size_t ldc) {
+
+        const std::size_t mr = Gemm_blocking<R>::mr;
+        const std::size_t nr = Gemm_blocking<R>::nr;
+
+        if (rows == mr && cols == nr) {
+            gemm_micro_kernel(kc, a_panel, b_panel, c, ldc, alpha, beta);
+            return;
+        }
+
+        alignas(64) R tmp[Gemm_blocking<R>::mr * Gemm_blocking<R>::nr];
+        gemm_micro_kernel(kc, a_panel, b_panel, tmp, nr, R(1), R(0));
+
+        for (std::size_t i = 0; i < rows; ++i) {
+            for (std::size_t j = 0; j < cols; ++j) {
+                R r = alpha * tmp[i * nr + j];
+                c[i * ldc + j] = (beta == R(0)) ? r : r + beta * c[i * ldc + j];
+            }
+        }
+    }
+
+    template<class R>
+    void gemm_blocked(
+        std::size_t m, std::size_t n, std::size_t k,
+        R alpha, const R* a, std::size_t lda, const R* b, std::size_t ldb,
+        R beta, R* c, std::size_t ldc,
+        avml::Executor& executor) {
+
+        using blocking = Gemm_blocking<R>;
+
+        const std::size_t mr = blocking::mr;
+        const std::size_t nr = blocking::nr;
+        const std::size_t kc_max = blocking::kc;
+        const std::size_t nc_max = blocking::nc;
+        const std::size_t mc = blocking::mc;
+        const std::size_t tile = blocking::tile;
+
+        const std::size_t m_panels = gemm_ceil_div(m, mr);
+        const std::size_t m_blocks = gemm_ceil_div(m, mc);
+
+        avml::aligned_vector<R> a_packed(m_panels * mr * gemm_min(k, kc_max));
+        avml::aligned_vector<R> b_packed(gemm_ceil_div(gemm_min(n, nc_max), nr) * nr * gemm_min(k, kc_max));
+
+        for (std::size_t jc = 0; jc < n; jc += nc_max) {
+            const std::size_t nc = gemm_min(nc_max, n - jc);
+            const std::size_t n_panels = gemm_ceil_div(nc, nr);
+            const std::size_t n_tiles = gemm_ceil_div(nc, tile);
+
+            for (std::size_t pc = 0; pc < k; pc += kc_max) {
+                const std::size_t kc = gemm_min(kc_max, k - pc);
+
+                // Later slices of k accumulate onto the first
+                const R beta_pc = (pc == 0) ? beta : R(1);
+
+                R* a_pack = a_packed.data();
+                R* b_pack = b_packed.data();
+
+                executor.parallel_for(n_panels, 16, [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t jp = begin; jp < end; ++jp) {
+                        std::size_t j = jp * nr;
+                        gemm_pack_b(gemm_min(nr, nc - j), kc, b + pc * ldb + jc + j, ldb, b_pack + jp * nr * kc);
+                    }
+                });
+
+                executor.parallel_for(m_panels, 16, [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t ip = begin; ip < end; ++ip) {
+                        std::size_t i = ip * mr;
+                        gemm_pack_a(gemm_min(mr, m - i), kc, a + i * lda + pc, lda, a_pack + ip * mr * kc);
+                    }
+                });
+
+                executor.parallel_for(m_blocks * n_tiles, 1, [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t t = begin; t < end; ++t) {
+                        const std::size_t ic = (t / n_tiles) * mc;
+                        const std::size_t jt = (t % n_tiles) * tile;
+
+                        const std::size_t i_end = gemm_min(ic + mc, m);
+                        const std::size_t j_end = gemm_min(jt + tile, nc);
+
+                        // Each panel of B is reused across the whole block of A
+                        for (std::size_t j = jt; j < j_end; j += nr) {
+                            const R* b_panel = b_pack + (j / nr) * nr * kc;
+
+                            for (std::size_t i = ic; i < i_end; i += mr) {
+                                const R* a_panel = a_pack + (i / mr) * mr * kc;
+
+                                gemm_block(
+                                    gemm_min(mr, m - i), gemm_min(nr, nc - j), kc,
+                                    a_panel, b_panel,
+                                    alpha, beta_pc, c + i * ldc + jc + j, ldc
+                                );
+                            }
+                        }
+                    }
+                });
+            }
+        }
+    }
+
+    template<class R>
+    void gemm_dispatch(
+        std::size_t m, std::size_t n, std::size_t k,
+        R alpha, const R* a, std::size_t lda, const R* b, std::size_t ldb,
+        R beta, R* c, std::size_t ldc,
+        avml::Executor& executor) {
+
+        if (m == 0 || n == 0) {
+            return;
+        }
+
+        if (k == 0 || m * n * k < gemm_small_volume) {
+            gemm_small(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+            return;
+        }
+
+        gemm_blocked(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, executor);
+    }
+
+}
+
+namespace avml {
+
+    //=====================================================
+    // General matrix multiply
+    //=====================================================
+
+    template<class R>
+    void gemm(
+        std::size_t m, std::size_t n, std::size_t k,
+        R alpha, const R* a, std::size_t lda, const R* b, std::size_t ldb,
+        R beta, R* c, std::size_t ldc) {
+
+        AVML_PROFILE_BATCH("gemm", m * n * k);
+
+        Serial_executor executor;
+        avml_impl::gemm_dispatch(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, executor);
+    }
+
+    template<class R>
+    void gemm(
+        std::size_t m, std::size_t n, std::size_t k,
+        R alpha, const R* a, std::size_t lda, const R* b, std::size_t ldb,
+        R beta, R* c, std::size_t ldc,
+        Executor& executor) {
+
+        AVML_PROFILE_BATCH("gemm", m * n * k);
+
+        avml_impl::gemm_dispatch(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, executor);
+    }
+
+    template<class R>
+    bool gemm(R alpha, const Dynamic_matrix<R>& a, const Dynamic_matrix<R>& b, R beta, Dynamic_matrix<R>& c) {
+        Serial_executor executor;
+        return gemm(alpha, a, b, beta, c, executor);
+    }
+
+    template<class R>
+    bool gemm(R alpha, const Dynamic_matrix<R>& a, const Dynamic_matrix<R>& b, R beta, Dynamic_matrix<R>& c, Executor& executor) {
+        if (a.width() != b.height() || c.height() != a.height() || c.width() != b.width()) {
+            return false;
+        }
+
+        gemm(
+            a.height(), b.width(), a.width(),
+            alpha, a.data(), a.width(), b.data(), b.width(),
+            beta, c.data(), c.width(),
+            executor
+        );
+        return true;
+    }
+
+    //=====================================================
+    // Matrix
+    //=====================================================
+
+    template<class R, unsigned N, unsigned M>
+    bool operator==(const Matrix<R, N, M>& lhs, const Matrix<R, N, M>& rhs) {
+        bool ret = true;
+        for (unsigned i = 0; i < N * M; ++i) {
+            ret &= (lhs.data()[i] == rhs.data()[i]);
+        }
+        return ret;
+    }
+
+    template<class R, unsigned N, unsigned M>
+    bool operator!=(const Matrix<R, N, M>& lhs, const Matrix<R, N, M>& rhs) {
+        return !(lhs == rhs);
+    }
+
+    template<class R, unsigned N, unsigned M>
+    Matrix<R, N, M> operator+(Matrix<R, N, M> lhs, const Matrix<R, N, M>& rhs) {
+        lhs += rhs;
+        return lhs;
+    }
+
+    template<class R, unsigned N, unsigned M>
+    Matrix<R, N, M> operator-(Matrix<R, N, M> lhs, const Matrix<R, N, M>& rhs) {
+        lhs -= rhs;
+        return lhs;
+    }
+
+    template<class R, unsigned N, unsigned M>
+    Matrix<R, N, M> operator*(Matrix<R, N, M> lhs, R rhs) {
+        lhs *= rhs;
+        return lhs;
+    }
+
+    template<class R, unsigned N, unsigned M>
+    Matrix<R, N, M> operator*(R lhs, Matrix<R, N, M> rhs) {
+        rhs *= lhs;
+        return rhs;
+    }
+
+    template<class R, unsigned N, unsigned K, unsigned M>
+    Matrix<R, N, M> operator*(const Matrix<R, N, K>& lhs, const Matrix<R, K, M>& rhs) {
+        Matrix<R, N, M> ret;
+        gemm<R>(N, M, K, R(1), lhs.data(), K, rhs.data(), M, R(0), ret.data(), M);
+        return ret;
+    }
+
+    template<class R, unsigned N, unsigned M>
+    Matrix<R, M, N> transpose(const Matrix<R, N, M>& m) {
+        Matrix<R, M, N> ret;
+        for (unsigned i = 0; i < N; ++i) {
+            for (unsigned j = 0; j < M; ++j) {
+                ret(j, i) = m(i, j);
+            }
+        }
+        return ret;
+    }
+
+    //=====================================================
+    // Dynamic_matrix
+    //=====================================================
+
+    template<class R>
+    bool operator==(const Dynamic_matrix<R>& lhs, const Dynamic_matrix<R>& rhs) {
+        if (lhs.height() != rhs.height() || lhs.width() != rhs.width()) {
+            return false;
+        }
+
+        bool ret = true;
+        for (std::size_t i = 0; i < lhs.height() * lhs.width(); ++i) {
+            ret &= (lhs.data()[i] == rhs.data()[i]);
+        }
+        return ret;
+    }
+
+    template<class R>
+    bool operator!=(const Dynamic_matrix<R>& lhs, const Dynamic_matrix<R>& rhs) {
+        return !(lhs == rhs);
+    }
+
+    template<class R>
+    Dynamic_matrix<R> operator*(const Dynamic_matrix<R>& lhs, const Dynamic_matrix<R>& rhs) {
+        Dynamic_matrix<R> ret{lhs.height(), rhs.width()};
+        gemm(R(1), lhs, rhs, R(0), ret);
+        return ret;
+    }
+
+    template<class R>
+    Dynamic_matrix<R> transpose(const Dynamic_matrix<R>& m) {
+        Dynamic_matrix<R> ret{m.width(), m.height()};
+        for (std::size_t i = 0; i < m.height(); ++i) {
+            for (std::size_t j = 0; j < m.width(); ++j) {
+                ret(j, i) = m(i, j);
+            }
+        }
+        return ret;
+    }
+
+}
+
+#endif
@@ -0,0 +1,232 @@
+#ifndef AVML_INSTRUMENTATION_IPP
+#define AVML_INSTRUMENTATION_IPP
+
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+
+#if defined(AVML_INSTRUMENT)
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+namespace avml_impl {
+
+    //=====================================================
+    // Counters
+    //=====================================================
+
+    struct Profile_counters {
+        std::atomic<std::uint64_t> calls{0};
+        std::atomic<std::uint64_t> elements{0};
+        std::atomic<std::uint64_t> cycles{0};
+    };
+
+    struct Thread_profile;
+
+    ///
+    /// Names of instrumented functions and the counters of every live thread.
+    /// Counters of exited threads are folded into retired.
+    ///
+    struct Profile_registry {
+        std::mutex mutex;
+        std::vector<std::string> names;
+        std::vector<Thread_profile*> threads;
+        std::uint64_t retired[AVML_INSTRUMENT_MAX_SITES][3] = {};
+    };
+
+    inline Profile_registry& profile_registry() {
+        // Never destroyed so that threads outliving static destruction,
+        // e.g. those of a static Thread_pool, can still retire their counters
+        static Profile_registry* registry = new Profile_registry{};
+        return *registry;
+    }
+
+    ///
+    /// Counters for a single thread. Only the owning thread writes to them,
+    /// so increments are plain loads and stores rather than RMW operations.
+    ///
+    struct Thread_profile {
+
+        Thread_profile() {
+            Profile_registry& r = profile_registry();
+            std::lock_guard<std::mutex> lock{r.mutex};
+            r.threads.push_back(this);
+        }
+
+        ~Thread_profile() {
+            Profile_registry& r = profile_registry();
+            std::lock_guard<std::mutex> lock{r.mutex};
+            for (std::size_t i = 0; i < AVML_INSTRUMENT_MAX_SITES; ++i) {
+                r.retired[i][0] += counters[i].calls.load(std::memory_order_relaxed);
+                r.retired[i][1] += counters[i].elements.load(std::memory_order_relaxed);
+                r.retired[i][2] += counters[i].cycles.load(std::memory_order_relaxed);
+            }
+            r.threads.erase(std::find(r.threads.begin(), r.threads.end(), this));
+        }
+
+        Profile_counters counters[AVML_INSTRUMENT_MAX_SITES];
+
+    };
+
+    inline Thread_profile& thread_profile() {
+        static thread_local Thread_profile profile;
+        return profile;
+    }
+
+    ///
+    /// \return Index of the counters for the function called name. Functions
+    /// past AVML_INSTRUMENT_MAX_SITES share the index AVML_INSTRUMENT_MAX_SITES
+    /// and aren't recorded.
+    inline std::size_t register_profile_site(const char* name) {
+        Profile_registry& r = profile_registry();
+        std::lock_guard<std::mutex> lock{r.mutex};
+
+        for (std::size_t i = 0; i < r.names.size(); ++i) {
+            if (r.names[i] == name) {
+                return i;
+            }
+        }
+
+        if (r.names.size() == AVML_INSTRUMENT_MAX_SITES) {
+            return AVML_INSTRUMENT_MAX_SITES;
+        }
+
+        r.names.emplace_back(name);
+        return r.names.size() - 1;
+    }
+
+    //=====================================================
+    // Timing
+    //=====================================================
+
+    AVML_FINL std::uint64_t profile_clock() {
+        #if defined(AVML_TARGET_X86) && !defined(AVML_SCALAR)
+        return __rdtsc();
+        #elif defined(__aarch64__) && !defined(AVML_MSVC)
+        std::uint64_t ticks;
+        __asm__ volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+        return ticks;
+        #else
+        return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+        #endif
+    }
+
+    AVML_FINL void profile_add(std::atomic<std::uint64_t>& counter, std::uint64_t x) {
+        counter.store(counter.load(std::memory_order_relaxed) + x, std::memory_order_relaxed);
+    }
+
+    class Profile_scope {
+    public:
+
+        AVML_FINL Profile_scope(std::size_t site, std::uint64_t elements):
+            site(site),
+            elements(elements),
+            start(profile_clock()) {}
+
+        Profile_scope(const Profile_scope&) = delete;
+
+        AVML_FINL ~Profile_scope() {
+            std::uint64_t end = profile_clock();
+            if (site == AVML_INSTRUMENT_MAX_SITES) {
+                return;
+            }
+
+            Profile_counters& c = thread_profile().counters[site];
+            profile_add(c.calls, 1);
+            profile_add(c.elements, elements);
+            profile_add(c.cycles, end - start);
+        }
+
+        Profile_scope& operator=(const Profile_scope&) = delete;
+
+    private:
+
+        std::size_t site;
+        std::uint64_t elements;
+        std::uint64_t start;
+
+    };
+
+}
+
+#endif
+
+namespace avml {
+
+    inline std::vector<Profile_entry> profile_snapshot() {
+        std::vector<Profile_entry> ret;
+
+        #if defined(AVML_INSTRUMENT)
+        avml_impl::Profile_registry& r = avml_impl::profile_registry();
+        std::lock_guard<std::mutex> lock{r.mutex};
+
+        for (std::size_t i = 0; i < r.names.size(); ++i) {
+            Profile_entry entry{r.names[i], r.retired[i][0], r.retired[i][1], r.retired[i][2]};
+            for (const avml_impl::Thread_profile* t : r.threads) {
+                entry.calls += t->counters[i].calls.load(std::memory_order_relaxed);
+                entry.elements += t->counters[i].elements.load(std::memory_order_relaxed);
+                entry.cycles += t->counters[i].cycles.load(std::memory_order_relaxed);
+            }
+
+            if (entry.calls != 0) {
+                ret.push_back(entry);
+            }
+        }
+        #endif
+
+        std::sort(ret.begin(), ret.end(), [](const Profile_entry& a, const Profile_entry& b) {
+            return a.cycles > b.cycles;
+        });
+        return ret;
+    }
+
+    inline void profile_reset() {
+        #if defined(AVML_INSTRUMENT)
+        avml_impl::Profile_registry& r = avml_impl::profile_registry();
+        std::lock_guard<std::mutex> lock{r.mutex};
+
+        std::memset(r.retired, 0, sizeof(r.retired));
+        for (avml_impl::Thread_profile* t : r.threads) {
+            for (avml_impl::Profile_counters& c : t->counters) {
+                c.calls.store(0, std::memory_order_relaxed);
+                c.elements.store(0, std::memory_order_relaxed);
+                c.cycles.store(0, std::memory_order_relaxed);
+            }
+        }
+        #endif
+    }
+
+    inline void profile_report(std::ostream& stream) {
+        std::vector<Profile_entry> entries = profile_snapshot();
+
+        stream
+            << std::left << std::setw(40) << "function"
+            << std::right << std::setw(14) << "calls"
+            << std::setw(16) << "elements"
+            << std::setw(18) << "cycles"
+            << std::setw(14) << "cycles/elem"
+            << '\n';
+
+        for (const Profile_entry& e : entries) {
+            double per_element = e.elements ? double(e.cycles) / double(e.elements) : 0.0;
+
+            stream
+                << std::left << std::setw(40) << e.name
+                << std::right << std::setw(14) << e.calls
+                << std::setw(16) << e.elements
+                << std::setw(18) << e.cycles
+                << std::setw(14) << std::fixed << std::setprecision(2) << per_element
+                << '\n';
+        }
+    }
+
+}
+
+#endif
@@ -0,0 +1,677 @@
+#ifndef AVML_LANES_HPP
+#define AVML_LANES_HPP
+
+namespace avml_impl {
+
+    // Thin wrappers around SIMD registers which give them the arithmetic
+    // operators of a scalar. Kernels written as templates over their scalar
+    // type can then be instantiated once for float, to handle single
+    // elements, and once per wrapper, to handle one element per lane of data
+    // laid out as a structure of arrays.
+    //
+    // Functions beyond the arithmetic operators are prefixed with lanes_ and
+    // overloaded for the scalar types too. Comparisons return a mask which
+    // is only meaningful to lanes_select and lanes_bits.
+
+    //=====================================================
+    // Scalars
+    //=====================================================
+
+    AVML_FINL float lanes_load(const float (&p)[1]) {
+        return p[0];
+    }
+
+    AVML_FINL void lanes_store(float (&p)[1], float x) {
+        p[0] = x;
+    }
+
+    AVML_FINL float lanes_sqrt(float x) {
+        return std::sqrt(x);
+    }
+
+    AVML_FINL float lanes_rsqrt(float x) {
+        return 1.0f / std::sqrt(x);
+    }
+
+    AVML_FINL float lanes_abs(float x) {
+        return std::abs(x);
+    }
+
+    AVML_FINL float lanes_max(float a, float b) {
+        return (a < b) ? b : a;
+    }
+
+    AVML_FINL float lanes_min(float a, float b) {
+        return (a < b) ? a : b;
+    }
+
+    AVML_FINL float lanes_floor(float x) {
+        return std::floor(x);
+    }
+
+    AVML_FINL bool lanes_less(float a, float b) {
+        return a < b;
+    }
+
+    AVML_FINL bool lanes_less_equal(float a, float b) {
+        return a <= b;
+    }
+
+    AVML_FINL float lanes_select(bool m, float a, float b) {
+        return m ? a : b;
+    }
+
+    AVML_FINL double lanes_sqrt(double x) {
+        return std::sqrt(x);
+    }
+
+    AVML_FINL double lanes_rsqrt(double x) {
+        return 1.0 / std::sqrt(x);
+    }
+
+    AVML_FINL double lanes_abs(double x) {
+        return std::abs(x);
+    }
+
+    AVML_FINL double lanes_max(double a, double b) {
+        return (a < b) ? b : a;
+    }
+
+    AVML_FINL double lanes_min(double a, double b) {
+        return (a < b) ? a : b;
+    }
+
+    AVML_FINL double lanes_floor(double x) {
+        return std::floor(x);
+    }
+
+    AVML_FINL bool lanes_less(double a, double b) {
+        return a < b;
+    }
+
+    AVML_FINL bool lanes_less_equal(double a, double b) {
+        return a <= b;
+    }
+
+    AVML_FINL double lanes_select(bool m, double a, double b) {
+        return m ? a : b;
+    }
+
+    /// \return Integer with bit i set when lane i of the mask m is set
+    AVML_FINL std::uint32_t lanes_bits(bool m) {
+        return m ? 1u : 0u;
+    }
+
+    // Fused multiply-add and its negated forms. The wrappers only fuse when
+    // AVML_FMA is defined, or on AVX-512, while scalars are always fused.
+
+    AVML_FINL float lanes_fmadd(float m, float x, float b) {
+        return std::fma(m, x, b);
+    }
+
+    AVML_FINL float lanes_fmnadd(float m, float x, float b) {
+        return std::fma(-m, x, b);
+    }
+
+    AVML_FINL float lanes_fmsub(float m, float x, float b) {
+        return std::fma(m, x, -b);
+    }
+
+    AVML_FINL float lanes_fmnsub(float m, float x, float b) {
+        return std::fma(-m, x, -b);
+    }
+
+    AVML_FINL double lanes_fmadd(double m, double x, double b) {
+        return std::fma(m, x, b);
+    }
+
+    AVML_FINL double lanes_fmnadd(double m, double x, double b) {
+        return std::fma(-m, x, b);
+    }
+
+    AVML_FINL double lanes_fmsub(double m, double x, double b) {
+        return std::fma(m, x, -b);
+    }
+
+    AVML_FINL double lanes_fmnsub(double m, double x, double b) {
+        return std::fma(-m, x, -b);
+    }
+
+    // Unsigned integer lanes use the built-in operators for the scalar case
+
+    ///
+    /// \return x truncated towards zero and wrapped into 32 bits
+    AVML_FINL std::uint32_t lanes_to_uint(float x) {
+        return static_cast<std::uint32_t>(static_cast<std::int32_t>(x));
+    }
+
+    ///
+    /// \return x reinterpreted as signed and converted to float
+    AVML_FINL float lanes_to_float(std::uint32_t x) {
+        return static_cast<float>(static_cast<std::int32_t>(x));
+    }
+
+    AVML_FINL float lanes_gather(const float* base, std::uint32_t index) {
+        return base[index];
+    }
+
+    AVML_FINL std::uint32_t lanes_gather(const std::uint32_t* base, std::uint32_t index) {
+        return base[index];
+    }
+
+    ///
+    /// Loads D-component vectors from p, one component per element of r
+    ///
+    template<unsigned D>
+    AVML_FINL void lanes_load_interleaved(const float* p, float (&r)[D]) {
+        for (unsigned d = 0; d < D; ++d) {
+            r[d] = p[d];
+        }
+    }
+
+    template<unsigned D>
+    AVML_FINL void lanes_store_interleaved(float* p, const float (&r)[D]) {
+        for (unsigned d = 0; d < D; ++d) {
+            p[d] = r[d];
+        }
+    }
+
+    ///
+    /// Maps a float lane type to the unsigned integer lanes of equal width
+    ///
+    template<class T>
+    struct Lanes_uint;
+
+    template<>
+    struct Lanes_uint<float> {
+        using type = std::uint32_t;
+    };
+
+#if defined(AVML_AVX512F)
+
+    struct Lanes16f {
+
+        Lanes16f() = default;
+
+        AVML_FINL Lanes16f(__m512 r):
+            reg(r) {}
+
+        AVML_FINL explicit Lanes16f(float x):
+            reg(_mm512_set1_ps(x)) {}
+
+        __m512 reg;
+    };
+
+    AVML_FINL Lanes16f operator+(Lanes16f a, Lanes16f b) {
+        return _mm512_add_ps(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes16f operator-(Lanes16f a, Lanes16f b) {
+        return _mm512_sub_ps(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes16f operator*(Lanes16f a, Lanes16f b) {
+        return _mm512_mul_ps(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes16f operator/(Lanes16f a, Lanes16f b) {
+        return _mm512_div_ps(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes16f operator-(Lanes16f a) {
+        return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a.reg), _mm512_set1_epi32(0x80000000)));
+    }
+
+    AVML_FINL Lanes16f lanes_load(const float (&p)[16]) {
+        return _mm512_loadu_ps(p);
+    }
+
+    AVML_FINL void lanes_store(float (&p)[16], Lanes16f x) {
+        _mm512_storeu_ps(p, x.reg);
+    }
+
+    AVML_FINL Lanes16f lanes_sqrt(Lanes16f x) {
+        return _mm512_sqrt_ps(x.reg);
+    }
+
+    ///
+    /// Reciprocal square root estimate refined by one Newton-Raphson step
+    ///
+    AVML_FINL Lanes16f lanes_rsqrt(Lanes16f x) {
+        __m512 y = _mm512_rsqrt14_ps(x.reg);
+        __m512 xyy = _mm512_mul_ps(_mm512_mul_ps(x.reg, y), y);
+        return _mm512_mul_ps(_mm512_mul_ps(_mm512_set1_ps(0.5f), y), _mm512_sub_ps(_mm512_set1_ps(3.0f), xyy));
+    }
+
+    AVML_FINL Lanes16f lanes_abs(Lanes16f x) {
+        return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(x.reg), _mm512_set1_epi32(0x7FFFFFFF)));
+    }
+
+    AVML_FINL Lanes16f lanes_max(Lanes16f a, Lanes16f b) {
+        return _mm512_max_ps(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes16f lanes_min(Lanes16f a, Lanes16f b) {
+        return _mm512_min_ps(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes16f lanes_floor(Lanes16f x) {
+        return _mm512_roundscale_ps(x.reg, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    }
+
+    AVML_FINL __mmask16 lanes_less(Lanes16f a, Lanes16f b) {
+        return _mm512_cmp_ps_mask(a.reg, b.reg, _CMP_LT_OQ);
+    }
+
+    AVML_FINL __mmask16 lanes_less_equal(Lanes16f a, Lanes16f b) {
+        return _mm512_cmp_ps_mask(a.reg, b.reg, _CMP_LE_OQ);
+    }
+
+    AVML_FINL Lanes16f lanes_select(__mmask16 m, Lanes16f a, Lanes16f b) {
+        return _mm512_mask_blend_ps(m, b.reg, a.reg);
+    }
+
+    AVML_FINL std::uint32_t lanes_bits(__mmask16 m) {
+        return m;
+    }
+
+    AVML_FINL Lanes16f lanes_fmadd(Lanes16f m, Lanes16f x, Lanes16f b) {
+        return _mm512_fmadd_ps(m.reg, x.reg, b.reg);
+    }
+
+    AVML_FINL Lanes16f lanes_fmnadd(Lanes16f m, Lanes16f x, Lanes16f b) {
+        return _mm512_fnmadd_ps(m.reg, x.reg, b.reg);
+    }
+
+    AVML_FINL Lanes16f lanes_fmsub(Lanes16f m, Lanes16f x, Lanes16f b) {
+        return _mm512_fmsub_ps(m.reg, x.reg, b.reg);
+    }
+
+    AVML_FINL Lanes16f lanes_fmnsub(Lanes16f m, Lanes16f x, Lanes16f b) {
+        return _mm512_fnmsub_ps(m.reg, x.reg, b.reg);
+    }
+
+    struct Lanes16u {
+
+        Lanes16u() = default;
+
+        AVML_FINL Lanes16u(__m512i r):
+            reg(r) {}
+
+        AVML_FINL explicit Lanes16u(std::uint32_t x):
+            reg(_mm512_set1_epi32(static_cast<int>(x))) {}
+
+        __m512i reg;
+    };
+
+    AVML_FINL Lanes16u operator+(Lanes16u a, Lanes16u b) {
+        return _mm512_add_epi32(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes16u operator*(Lanes16u a, Lanes16u b) {
+        return _mm512_mullo_epi32(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes16u operator^(Lanes16u a, Lanes16u b) {
+        return _mm512_xor_si512(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes16u operator&(Lanes16u a, Lanes16u b) {
+        return _mm512_and_si512(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes16u operator>>(Lanes16u a, unsigned s) {
+        return _mm512_srli_epi32(a.reg, s);
+    }
+
+    AVML_FINL Lanes16u lanes_to_uint(Lanes16f x) {
+        return _mm512_cvttps_epi32(x.reg);
+    }
+
+    AVML_FINL Lanes16f lanes_to_float(Lanes16u x) {
+        return _mm512_cvtepi32_ps(x.reg);
+    }
+
+    template<>
+    struct Lanes_uint<Lanes16f> {
+        using type = Lanes16u;
+    };
+
+    AVML_FINL Lanes16f lanes_gather(const float* base, Lanes16u index) {
+        return _mm512_i32gather_ps(index.reg, base, 4);
+    }
+
+    AVML_FINL Lanes16u lanes_gather(const std::uint32_t* base, Lanes16u index) {
+        return _mm512_i32gather_epi32(index.reg, base, 4);
+    }
+
+    AVML_FINL void lanes_load_interleaved(const float* p, Lanes16f (&r)[3]) {
+        load3x16f(p, r[0].reg, r[1].reg, r[2].reg);
+    }
+
+    AVML_FINL void lanes_store_interleaved(float* p, const Lanes16f (&r)[2]) {
+        store2x16f(p, r[0].reg, r[1].reg);
+    }
+
+    AVML_FINL void lanes_store_interleaved(float* p, const Lanes16f (&r)[3]) {
+        store3x16f(p, r[0].reg, r[1].reg, r[2].reg);
+    }
+
+#endif
+
+#if defined(AVML_AVX)
+
+    struct Lanes8f {
+
+        Lanes8f() = default;
+
+        AVML_FINL Lanes8f(__m256 r):
+            reg(r) {}
+
+        AVML_FINL explicit Lanes8f(float x):
+            reg(_mm256_set1_ps(x)) {}
+
+        __m256 reg;
+    };
+
+    AVML_FINL Lanes8f operator+(Lanes8f a, Lanes8f b) {
+        return _mm256_add_ps(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes8f operator-(Lanes8f a, Lanes8f b) {
+        return _mm256_sub_ps(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes8f operator*(Lanes8f a, Lanes8f b) {
+        return _mm256_mul_ps(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes8f operator/(Lanes8f a, Lanes8f b) {
+        return _mm256_div_ps(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes8f operator-(Lanes8f a) {
+        return _mm256_xor_ps(a.reg, _mm256_set1_ps(-0.0f));
+    }
+
+    AVML_FINL Lanes8f lanes_load(const float (&p)[8]) {
+        return _mm256_loadu_ps(p);
+    }
+
+    AVML_FINL void lanes_store(float (&p)[8], Lanes8f x) {
+        _mm256_storeu_ps(p, x.reg);
+    }
+
+    AVML_FINL Lanes8f lanes_sqrt(Lanes8f x) {
+        return _mm256_sqrt_ps(x.reg);
+    }
+
+    ///
+    /// Reciprocal square root estimate refined by one Newton-Raphson step
+    ///
+    AVML_FINL Lanes8f lanes_rsqrt(Lanes8f x) {
+        __m256 y = _mm256_rsqrt_ps(x.reg);
+        __m256 xyy = _mm256_mul_ps(_mm256_mul_ps(x.reg, y), y);
+        return _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), y), _mm256_sub_ps(_mm256_set1_ps(3.0f), xyy));
+    }
+
+    AVML_FINL Lanes8f lanes_abs(Lanes8f x) {
+        return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x.reg);
+    }
+
+    AVML_FINL Lanes8f lanes_max(Lanes8f a, Lanes8f b) {
+        return _mm256_max_ps(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes8f lanes_min(Lanes8f a, Lanes8f b) {
+        return _mm256_min_ps(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes8f lanes_floor(Lanes8f x) {
+        return _mm256_floor_ps(x.reg);
+    }
+
+    AVML_FINL __m256 lanes_less(Lanes8f a, Lanes8f b) {
+        return _mm256_cmp_ps(a.reg, b.reg, _CMP_LT_OQ);
+    }
+
+    AVML_FINL __m256 lanes_less_equal(Lanes8f a, Lanes8f b) {
+        return _mm256_cmp_ps(a.reg, b.reg, _CMP_LE_OQ);
+    }
+
+    AVML_FINL Lanes8f lanes_select(__m256 m, Lanes8f a, Lanes8f b) {
+        return _mm256_blendv_ps(b.reg, a.reg, m);
+    }
+
+    AVML_FINL std::uint32_t lanes_bits(__m256 m) {
+        return static_cast<std::uint32_t>(_mm256_movemask_ps(m));
+    }
+
+    AVML_FINL Lanes8f lanes_fmadd(Lanes8f m, Lanes8f x, Lanes8f b) {
+        #if defined(AVML_FMA)
+        return _mm256_fmadd_ps(m.reg, x.reg, b.reg);
+        #else
+        return _mm256_add_ps(_mm256_mul_ps(m.reg, x.reg), b.reg);
+        #endif
+    }
+
+    AVML_FINL Lanes8f lanes_fmnadd(Lanes8f m, Lanes8f x, Lanes8f b) {
+        #if defined(AVML_FMA)
+        return _mm256_fnmadd_ps(m.reg, x.reg, b.reg);
+        #else
+        return _mm256_sub_ps(b.reg, _mm256_mul_ps(m.reg, x.reg));
+        #endif
+    }
+
+    AVML_FINL Lanes8f lanes_fmsub(Lanes8f m, Lanes8f x, Lanes8f b) {
+        #if defined(AVML_FMA)
+        return _mm256_fmsub_ps(m.reg, x.reg, b.reg);
+        #else
+        return _mm256_sub_ps(_mm256_mul_ps(m.reg, x.reg), b.reg);
+        #endif
+    }
+
+    AVML_FINL Lanes8f lanes_fmnsub(Lanes8f m, Lanes8f x, Lanes8f b) {
+        #if defined(AVML_FMA)
+        return _mm256_fnmsub_ps(m.reg, x.reg, b.reg);
+        #else
+        return _mm256_sub_ps(-(m * x).reg, b.reg);
+        #endif
+    }
+
+    AVML_FINL void lanes_load_interleaved(const float* p, Lanes8f (&r)[3]) {
+        load3x8f(p, r[0].reg, r[1].reg, r[2].reg);
+    }
+
+    AVML_FINL void lanes_store_interleaved(float* p, const Lanes8f (&r)[2]) {
+        store2x8f(p, r[0].reg, r[1].reg);
+    }
+
+    AVML_FINL void lanes_store_interleaved(float* p, const Lanes8f (&r)[3]) {
+        store3x8f(p, r[0].reg, r[1].reg, r[2].reg);
+    }
+
+#endif
+
+#if defined(AVML_AVX2)
+
+    struct Lanes8u {
+
+        Lanes8u() = default;
+
+        AVML_FINL Lanes8u(__m256i r):
+            reg(r) {}
+
+        AVML_FINL explicit Lanes8u(std::uint32_t x):
+            reg(_mm256_set1_epi32(static_cast<int>(x))) {}
+
+        __m256i reg;
+    };
+
+    AVML_FINL Lanes8u operator+(Lanes8u a, Lanes8u b) {
+        return _mm256_add_epi32(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes8u operator*(Lanes8u a, Lanes8u b) {
+        return _mm256_mullo_epi32(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes8u operator^(Lanes8u a, Lanes8u b) {
+        return _mm256_xor_si256(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes8u operator&(Lanes8u a, Lanes8u b) {
+        return _mm256_and_si256(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes8u operator>>(Lanes8u a, unsigned s) {
+        return _mm256_srli_epi32(a.reg, s);
+    }
+
+    AVML_FINL Lanes8u lanes_to_uint(Lanes8f x) {
+        return _mm256_cvttps_epi32(x.reg);
+    }
+
+    AVML_FINL Lanes8f lanes_to_float(Lanes8u x) {
+        return _mm256_cvtepi32_ps(x.reg);
+    }
+
+    template<>
+    struct Lanes_uint<Lanes8f> {
+        using type = Lanes8u;
+    };
+
+    AVML_FINL Lanes8f lanes_gather(const float* base, Lanes8u index) {
+        return _mm256_i32gather_ps(base, index.reg, 4);
+    }
+
+    AVML_FINL Lanes8u lanes_gather(const std::uint32_t* base, Lanes8u index) {
+        return _mm256_i32gather_epi32(reinterpret_cast<const int*>(base), index.reg, 4);
+    }
+
+#endif
+
+#if defined(AVML_SSE2)
+
+    struct Lanes4f {
+
+        Lanes4f() = default;
+
+        AVML_FINL Lanes4f(__m128 r):
+            reg(r) {}
+
+        AVML_FINL explicit Lanes4f(float x):
+            reg(_mm_set1_ps(x)) {}
+
+        __m128 reg;
+    };
+
+    AVML_FINL Lanes4f operator+(Lanes4f a, Lanes4f b) {
+        return _mm_add_ps(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes4f operator-(Lanes4f a, Lanes4f b) {
+        return _mm_sub_ps(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes4f operator*(Lanes4f a, Lanes4f b) {
+        return _mm_mul_ps(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes4f operator/(Lanes4f a, Lanes4f b) {
+        return _mm_div_ps(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes4f operator-(Lanes4f a) {
+        return _mm_xor_ps(a.reg, _mm_set1_ps(-0.0f));
+    }
+
+    AVML_FINL Lanes4f lanes_load(const float (&p)[4]) {
+        return _mm_loadu_ps(p);
+    }
+
+    AVML_FINL void lanes_store(float (&p)[4], Lanes4f x) {
+        _mm_storeu_ps(p, x.reg);
+    }
+
+    AVML_FINL Lanes4f lanes_max(Lanes4f a, Lanes4f b) {
+        return _mm_max_ps(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes4f lanes_min(Lanes4f a, Lanes4f b) {
+        return _mm_min_ps(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes4f lanes_floor(Lanes4f x) {
+        #if defined(AVML_SSE41)
+        return _mm_floor_ps(x.reg);
+        #else
+        // Truncate and step down where that rounded up. Magnitudes of 2^23
+        // and above, as well as NaNs, are integral or would overflow the
+        // conversion, so they are passed through.
+        __m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(x.reg));
+        t = _mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, x.reg), _mm_set1_ps(1.0f)));
+
+        __m128 magnitude = _mm_andnot_ps(_mm_set1_ps(-0.0f), x.reg);
+        __m128 integral = _mm_cmpnlt_ps(magnitude, _mm_set1_ps(8388608.0f));
+        return _mm_or_ps(_mm_and_ps(integral, x.reg), _mm_andnot_ps(integral, t));
+        #endif
+    }
+
+    AVML_FINL __m128 lanes_less(Lanes4f a, Lanes4f b) {
+        return _mm_cmplt_ps(a.reg, b.reg);
+    }
+
+    AVML_FINL __m128 lanes_less_equal(Lanes4f a, Lanes4f b) {
+        return _mm_cmple_ps(a.reg, b.reg);
+    }
+
+    AVML_FINL Lanes4f lanes_select(__m128 m, Lanes4f a, Lanes4f b) {
+        #if defined(AVML_SSE41)
+        return _mm_blendv_ps(b.reg, a.reg, m);
+        #else
+        return _mm_or_ps(_mm_and_ps(m, a.reg), _mm_andnot_ps(m, b.reg));
+        #endif
+    }
+
+    AVML_FINL std::uint32_t lanes_bits(__m128 m) {
+        return static_cast<std::uint32_t>(_mm_movemask_ps(m));
+    }
+
+    AVML_FINL Lanes4f lanes_fmadd(Lanes4f m, Lanes4f x, Lanes4f b) {
+        #if defined(AVML_FMA)
+        return _mm_fmadd_ps(m.reg, x.reg, b.reg);
+        #else
+        return _mm_add_ps(_mm_mul_ps(m.reg, x.reg), b.reg);
+        #endif
+    }
+
+    AVML_FINL Lanes4f lanes_fmnadd(Lanes4f m, Lanes4f x, Lanes4f b) {
+        #if defined(AVML_FMA)
+        return _mm_fnmadd_ps(m.reg, x.reg, b.reg);
+        #else
+        return _mm_sub_ps(b.reg, _mm_mul_ps(m.reg, x.reg));
+        #endif
+    }
+
+    AVML_FINL Lanes4f lanes_fmsub(Lanes4f m, Lanes4f x, Lanes4f b) {
+        #if defined(AVML_FMA)
+        return _mm_fmsub_ps(m.reg, x.reg, b.reg);
+        #else
+        return _mm_sub_ps(_mm_mul_ps(m.reg, x.reg), b.reg);
+        #endif
+    }
+
+    AVML_FINL Lanes4f lanes_fmnsub(Lanes4f m, Lanes4f x, Lanes4f b) {
+        #if defined(AVML_FMA)
+        return _mm_fnmsub_ps(m.reg, x.reg, b.reg);
+        #else
+        return _mm_sub_ps(-(m * x).reg, b.reg);
+        #endif
+    }
+
+#endif
+
+}
+
+#endif
@@ -0,0 +1,174 @@
+#ifndef AVML_MEMORY_IPP
+#define AVML_MEMORY_IPP
+
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+
+namespace avml_impl {
+
+    //=====================================================
+    // Aligned allocation
+    //=====================================================
+
+    ///
+    /// \param size Number of bytes to allocate, excluding padding
+    /// \param alignment Power of two which the result is aligned to
+    /// \return Pointer to storage of size + AVML_ALLOCATION_PADDING bytes or
+    /// null on failure
+    inline void* aligned_malloc(std::size_t size, std::size_t alignment) {
+        // The address of the underlying allocation is kept in the bytes
+        // immediately preceding the returned pointer
+        const std::size_t overhead = alignment + sizeof(void*) + AVML_ALLOCATION_PADDING;
+        if (size > std::numeric_limits<std::size_t>::max() - overhead) {
+            return nullptr;
+        }
+
+        void* base = std::malloc(size + overhead);
+        if (!base) {
+            return nullptr;
+        }
+
+        std::uintptr_t first = reinterpret_cast<std::uintptr_t>(base) + sizeof(void*);
+        std::uintptr_t aligned = (first + alignment - 1) & ~std::uintptr_t(alignment - 1);
+
+        reinterpret_cast<void**>(aligned)[-1] = base;
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    inline void aligned_free(void* p) {
+        if (p) {
+            std::free(static_cast<void**>(p)[-1]);
+        }
+    }
+
+}
+
+namespace avml {
+
+    //=====================================================
+    // Aligned_allocator
+    //=====================================================
+
+    template<class T, std::size_t A>
+    constexpr std::size_t Aligned_allocator<T, A>::alignment;
+
+    template<class T, std::size_t A>
+    T* Aligned_allocator<T, A>::allocate(std::size_t n) {
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+            throw std::bad_alloc{};
+        }
+
+        void* p = avml_impl::aligned_malloc(n * sizeof(T), alignment);
+        if (!p) {
+            throw std::bad_alloc{};
+        }
+        return static_cast<T*>(p);
+    }
+
+    template<class T, std::size_t A>
+    void Aligned_allocator<T, A>::deallocate(T* p, std::size_t) noexcept {
+        avml_impl::aligned_free(p);
+    }
+
+    //=====================================================
+    // Arena
+    //=====================================================
+
+    inline Arena::Arena(std::size_t block_size):
+        blocks(),
+        block_size(block_size) {}
+
+    inline Arena::Arena(Arena&& other) noexcept:
+        blocks(std::move(other.blocks)),
+        block_size(other.block_size),
+        current(other.current),
+        offset(other.offset) {
+
+        other.blocks.clear();
+        other.current = 0;
+        other.offset = 0;
+    }
+
+    inline Arena::~Arena() {
+        release();
+    }
+
+    inline Arena& Arena::operator=(Arena&& other) noexcept {
+        if (this != &other) {
+            release();
+
+            blocks = std::move(other.blocks);
+            block_size = other.block_size;
+            current = other.current;
+            offset = other.offset;
+
+            other.blocks.clear();
+            other.current = 0;
+            other.offset = 0;
+        }
+        return *this;
+    }
+
+    inline void* Arena::allocate(std::size_t size, std::size_t alignment) {
+        // Blocks are aligned to default_alignment so offsets only need
+        // adjusting for larger alignments
+        for (; current < blocks.size(); ++current, offset = 0) {
+            const Block& block = blocks[current];
+            std::uintptr_t base = reinterpret_cast<std::uintptr_t>(block.data);
+            std::uintptr_t p = (base + offset + alignment - 1) & ~std::uintptr_t(alignment - 1);
+
+            if (p + size <= base + block.size) {
+                offset = (p - base) + size;
+                return reinterpret_cast<void*>(p);
+            }
+        }
+
+        std::size_t required = size + ((alignment > default_alignment) ? alignment : 0);
+        std::size_t length = (required > block_size) ? required : block_size;
+
+        char* data = static_cast<char*>(avml_impl::aligned_malloc(length, default_alignment));
+        if (!data) {
+            throw std::bad_alloc{};
+        }
+
+        blocks.push_back(Block{data, length});
+        current = blocks.size() - 1;
+        offset = 0;
+        return allocate(size, alignment);
+    }
+
+    inline void Arena::reset() {
+        current = 0;
+        offset = 0;
+    }
+
+    inline Arena::Marker Arena::mark() const {
+        return Marker{current, offset};
+    }
+
+    inline void Arena::rewind(Marker m) {
+        current = m.block;
+        offset = m.offset;
+    }
+
+    inline std::size_t Arena::capacity() const {
+        std::size_t ret = 0;
+        for (const Block& block : blocks) {
+            ret += block.size;
+        }
+        return ret;
+    }
+
+    inline void Arena::release() {
+        for (const Block& block : blocks) {
+            avml_impl::aligned_free(block.data);
+        }
+        blocks.clear();
+        current = 0;
+        offset = 0;
+    }
+
+}
+
+#endif
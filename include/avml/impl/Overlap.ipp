@@ -0,0 +1,451 @@
+#ifndef AVML_OVERLAP_IPP
+#define AVML_OVERLAP_IPP
+
+#include "Lanes.hpp"
+
+namespace avml_impl {
+
+    //=====================================================
+    // Fields
+    //=====================================================
+
+    // Kernels see a primitive as a flat array of its scalars in the order
+    // below. The float primitives are laid out the same way in memory, so
+    // batches gather field k of W primitives with a stride of one primitive.
+    //
+    // Sphere:  center, radius
+    // Box:     minimum, maximum
+    // Capsule: p0, p1, radius
+    // OBB:     center, axes by row, extents
+
+    static_assert(sizeof(avml::spheref) == 4 * sizeof(float), "spheref must be tightly packed.");
+    static_assert(sizeof(avml::aabb3f) == 6 * sizeof(float), "aabb3f must be tightly packed.");
+    static_assert(sizeof(avml::capsulef) == 7 * sizeof(float), "capsulef must be tightly packed.");
+    static_assert(sizeof(avml::obbf) == 15 * sizeof(float), "obbf must be tightly packed.");
+
+    template<class R>
+    AVML_FINL void primitive_fields(const avml::SphereR<R>& s, R (&f)[4]) {
+        for (unsigned d = 0; d < 3; ++d) {
+            f[d] = s.center()[d];
+        }
+        f[3] = s.radius();
+    }
+
+    template<class R>
+    AVML_FINL void primitive_fields(const avml::Aabb3R<R>& b, R (&f)[6]) {
+        for (unsigned d = 0; d < 3; ++d) {
+            f[d + 0] = b.minimum()[d];
+            f[d + 3] = b.maximum()[d];
+        }
+    }
+
+    template<class R>
+    AVML_FINL void primitive_fields(const avml::CapsuleR<R>& c, R (&f)[7]) {
+        for (unsigned d = 0; d < 3; ++d) {
+            f[d + 0] = c.p0()[d];
+            f[d + 3] = c.p1()[d];
+        }
+        f[6] = c.radius();
+    }
+
+    template<class R>
+    AVML_FINL void primitive_fields(const avml::ObbR<R>& b, R (&f)[15]) {
+        for (unsigned d = 0; d < 3; ++d) {
+            f[d + 0] = b.center()[d];
+            f[d + 3] = b.axes()[0][d];
+            f[d + 6] = b.axes()[1][d];
+            f[d + 9] = b.axes()[2][d];
+            f[d + 12] = b.extents()[d];
+        }
+    }
+
+    ///
+    /// Loads the F fields of W consecutive primitives, F floats apart
+    ///
+    template<unsigned F>
+    AVML_FINL void load_fields(const float* p, float (&f)[F]) {
+        for (unsigned k = 0; k < F; ++k) {
+            f[k] = p[k];
+        }
+    }
+
+#if defined(AVML_AVX512F)
+
+    template<unsigned F>
+    AVML_FINL void load_fields(const float* p, Lanes16f (&f)[F]) {
+        const Lanes16u offsets = Lanes16u{_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)} * Lanes16u(F);
+        for (unsigned k = 0; k < F; ++k) {
+            f[k] = lanes_gather(p + k, offsets);
+        }
+    }
+
+#endif
+
+#if defined(AVML_AVX2)
+
+    template<unsigned F>
+    AVML_FINL void load_fields(const float* p, Lanes8f (&f)[F]) {
+        const Lanes8u offsets = Lanes8u{_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)} * Lanes8u(F);
+        for (unsigned k = 0; k < F; ++k) {
+            f[k] = lanes_gather(p + k, offsets);
+        }
+    }
+
+#endif
+
+    //=====================================================
+    // Kernels
+    //=====================================================
+
+    // Each kernel returns a gap which is at most zero iff its two primitives
+    // overlap. Touching primitives overlap.
+
+    template<class T>
+    AVML_FINL T lanes_clamp01(T x) {
+        return lanes_max(T{0.0f}, lanes_min(x, T{1.0f}));
+    }
+
+    template<class T>
+    AVML_FINL T lanes_dot3(const T* a, const T* b) {
+        return lanes_fmadd(a[0], b[0], lanes_fmadd(a[1], b[1], a[2] * b[2]));
+    }
+
+    ///
+    /// Parameters s and t of the closest points p0 + s * (p1 - p0) and
+    /// q0 + t * (q1 - q0) of two segments, following Ericson's Real-Time
+    /// Collision Detection, 5.1.9. The branches on degenerate and parallel
+    /// segments are replaced by selects so that lanes can take different
+    /// cases. Quotients computed for the wrong case are discarded, so
+    /// division by zero is harmless.
+    ///
+    template<class T>
+    AVML_FINL void segment_closest_parameters(const T* p0, const T* p1, const T* q0, const T* q1, T& s, T& t) {
+        const T zero{0.0f};
+        const T one{1.0f};
+
+        T d1[3] = {p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2]};
+        T d2[3] = {q1[0] - q0[0], q1[1] - q0[1], q1[2] - q0[2]};
+        T r[3] = {p0[0] - q0[0], p0[1] - q0[1], p0[2] - q0[2]};
+
+        T a = lanes_dot3(d1, d1);
+        T b = lanes_dot3(d1, d2);
+        T c = lanes_dot3(d1, r);
+        T e = lanes_dot3(d2, d2);
+        T f = lanes_dot3(d2, r);
+        T denom = a * e - b * b;
+
+        // Closest point on the first line to the second, zero when parallel
+        T s_line = lanes_select(lanes_less(zero, denom), lanes_clamp01((b * f - c * e) / denom), zero);
+        T t_line = (b * s_line + f) / e;
+
+        // s for t clamped to 0 and to 1
+        T s_t0 = lanes_select(lanes_less(zero, a), lanes_clamp01(-c / a), zero);
+        T s_t1 = lanes_select(lanes_less(zero, a), lanes_clamp01((b - c) / a), zero);
+
+        auto second_is_point = lanes_less_equal(e, zero);
+        T s_clamped = lanes_select(lanes_less(t_line, zero), s_t0, lanes_select(lanes_less(one, t_line), s_t1, s_line));
+
+        s = lanes_select(second_is_point, s_t0, s_clamped);
+        t = lanes_select(second_is_point, zero, lanes_clamp01(t_line));
+    }
+
+    struct Sphere_sphere_kernel {
+        static constexpr unsigned query_fields = 4;
+        static constexpr unsigned fields = 4;
+
+        template<class T>
+        AVML_FINL static T gap(const T* a, const T* b) {
+            T d[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+            T r = a[3] + b[3];
+            return lanes_dot3(d, d) - r * r;
+        }
+    };
+
+    struct Sphere_box_kernel {
+        static constexpr unsigned query_fields = 4;
+        static constexpr unsigned fields = 6;
+
+        template<class T>
+        AVML_FINL static T gap(const T* s, const T* b) {
+            T d[3];
+            for (unsigned k = 0; k < 3; ++k) {
+                d[k] = s[k] - lanes_max(b[k], lanes_min(s[k], b[k + 3]));
+            }
+            return lanes_dot3(d, d) - s[3] * s[3];
+        }
+    };
+
+    struct Box_sphere_kernel {
+        static constexpr unsigned query_fields = 6;
+        static constexpr unsigned fields = 4;
+
+        template<class T>
+        AVML_FINL static T gap(const T* b, const T* s) {
+            return Sphere_box_kernel::gap(s, b);
+        }
+    };
+
+    struct Capsule_capsule_kernel {
+        static constexpr unsigned query_fields = 7;
+        static constexpr unsigned fields = 7;
+
+        template<class T>
+        AVML_FINL static T gap(const T* a, const T* b) {
+            T s;
+            T t;
+            segment_closest_parameters(a, a + 3, b, b + 3, s, t);
+
+            T d[3];
+            for (unsigned k = 0; k < 3; ++k) {
+                T on_a = lanes_fmadd(s, a[k + 3] - a[k], a[k]);
+                T on_b = lanes_fmadd(t, b[k + 3] - b[k], b[k]);
+                d[k] = on_b - on_a;
+            }
+
+            T r = a[6] + b[6];
+            return lanes_dot3(d, d) - r * r;
+        }
+    };
+
+    ///
+    /// Separating axis test over the 15 candidate axes of two boxes: the
+    /// faces of each and the cross products of their edges, following
+    /// Ericson's Real-Time Collision Detection, 4.4.1. The gap is the
+    /// largest separation along any axis.
+    ///
+    struct Obb_obb_kernel {
+        static constexpr unsigned query_fields = 15;
+        static constexpr unsigned fields = 15;
+
+        template<class T>
+        AVML_FINL static T gap(const T* a, const T* b) {
+            // Keeps cross products of near parallel edges, which are close
+            // to zero, from separating boxes due to rounding
+            const T epsilon{1e-6f};
+
+            const T* ea = a + 12;
+            const T* eb = b + 12;
+
+            // b's axes and center in a's frame
+            T r[3][3];
+            T abs_r[3][3];
+            T t[3];
+            T d[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+            for (unsigned i = 0; i < 3; ++i) {
+                for (unsigned j = 0; j < 3; ++j) {
+                    r[i][j] = lanes_dot3(a + 3 + 3 * i, b + 3 + 3 * j);
+                    abs_r[i][j] = lanes_abs(r[i][j]) + epsilon;
+                }
+                t[i] = lanes_dot3(d, a + 3 + 3 * i);
+            }
+
+            T g = T{-std::numeric_limits<float>::infinity()};
+
+            for (unsigned i = 0; i < 3; ++i) {
+                T rb = lanes_fmadd(eb[0], abs_r[i][0], lanes_fmadd(eb[1], abs_r[i][1], eb[2] * abs_r[i][2]));
+                g = lanes_max(g, lanes_abs(t[i]) - (ea[i] + rb));
+            }
+
+            for (unsigned j = 0; j < 3; ++j) {
+                T ra = lanes_fmadd(ea[0], abs_r[0][j], lanes_fmadd(ea[1], abs_r[1][j], ea[2] * abs_r[2][j]));
+                T tb = lanes_fmadd(t[0], r[0][j], lanes_fmadd(t[1], r[1][j], t[2] * r[2][j]));
+                g = lanes_max(g, lanes_abs(tb) - (ra + eb[j]));
+            }
+
+            for (unsigned i = 0; i < 3; ++i) {
+                unsigned i1 = (i + 1) % 3;
+                unsigned i2 = (i + 2) % 3;
+                for (unsigned j = 0; j < 3; ++j) {
+                    unsigned j1 = (j + 1) % 3;
+                    unsigned j2 = (j + 2) % 3;
+
+                    T ra = ea[i1] * abs_r[i2][j] + ea[i2] * abs_r[i1][j];
+                    T rb = eb[j1] * abs_r[i][j2] + eb[j2] * abs_r[i][j1];
+                    T tl = t[i2] * r[i1][j] - t[i1] * r[i2][j];
+                    g = lanes_max(g, lanes_abs(tl) - (ra + rb));
+                }
+            }
+
+            return g;
+        }
+    };
+
+    template<class Kernel, class A, class B>
+    AVML_FINL bool overlaps(const A& a, const B& b) {
+        using R = typename A::scalar;
+
+        R fa[Kernel::query_fields];
+        R fb[Kernel::fields];
+        primitive_fields(a, fa);
+        primitive_fields(b, fb);
+        return Kernel::gap(fa, fb) <= R(0);
+    }
+
+    //=====================================================
+    // Drivers
+    //=====================================================
+
+    // Overlap of others[i] is written to bit i % 64 of mask[i / 64]. Groups
+    // are at most 64 wide and start at multiples of their width so they
+    // never straddle two words.
+
+    AVML_FINL void store_bits(std::uint64_t* mask, std::size_t i, std::uint32_t bits) {
+        std::uint64_t word = std::uint64_t{bits} << (i % 64);
+        if (i % 64 == 0) {
+            mask[i / 64] = word;
+        } else {
+            mask[i / 64] |= word;
+        }
+    }
+
+    ///
+    /// Tests W primitives at a time with lanes of type T, starting at i
+    ///
+    /// \return Index past the last primitive tested
+    template<class T, unsigned W, class Kernel>
+    AVML_FINL std::size_t overlap_groups(const float* query, const float* others, std::uint64_t* mask, std::size_t i, std::size_t n) {
+        T q[Kernel::query_fields];
+        for (unsigned k = 0; k < Kernel::query_fields; ++k) {
+            q[k] = T{query[k]};
+        }
+
+        for (; i + W <= n; i += W) {
+            T f[Kernel::fields];
+            load_fields(others + Kernel::fields * i, f);
+            store_bits(mask, i, lanes_bits(lanes_less_equal(Kernel::gap(q, f), T{0.0f})));
+        }
+
+        return i;
+    }
+
+    template<class Kernel, class A, class B>
+    AVML_FINL void overlaps(const A& query, const B* others, std::uint64_t* mask, std::size_t n) {
+        const float* q = reinterpret_cast<const float*>(&query);
+        const float* o = reinterpret_cast<const float*>(others);
+
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        i = overlap_groups<Lanes16f, 16, Kernel>(q, o, mask, i, n);
+        #elif defined(AVML_AVX2)
+        i = overlap_groups<Lanes8f, 8, Kernel>(q, o, mask, i, n);
+        #endif
+
+        overlap_groups<float, 1, Kernel>(q, o, mask, i, n);
+    }
+
+    ///
+    /// Executors begin chunks at multiples of the grain, which is a multiple
+    /// of 64, so every chunk starts on its own mask word and store_bits never
+    /// overwrites bits belonging to another chunk
+    ///
+    template<class Kernel, class A, class B>
+    AVML_FINL void overlaps(const A& query, const B* others, std::uint64_t* mask, std::size_t n, avml::Executor& executor) {
+        static_assert(avml::default_grain<B, std::uint64_t>() % 64 == 0, "Chunks must start on a mask word");
+
+        executor.parallel_for(n, avml::default_grain<B, std::uint64_t>(), [&](std::size_t begin, std::size_t end) {
+            overlaps<Kernel>(query, others + begin, mask + begin / 64, end - begin);
+        });
+    }
+
+}
+
+namespace avml {
+
+    //=====================================================
+    // Pairwise tests
+    //=====================================================
+
+    template<class R>
+    AVML_FINL bool overlaps(const SphereR<R>& a, const SphereR<R>& b) {
+        return avml_impl::overlaps<avml_impl::Sphere_sphere_kernel>(a, b);
+    }
+
+    template<class R>
+    AVML_FINL bool overlaps(const SphereR<R>& s, const Aabb3R<R>& b) {
+        return avml_impl::overlaps<avml_impl::Sphere_box_kernel>(s, b);
+    }
+
+    template<class R>
+    AVML_FINL bool overlaps(const Aabb3R<R>& b, const SphereR<R>& s) {
+        return avml_impl::overlaps<avml_impl::Sphere_box_kernel>(s, b);
+    }
+
+    template<class R>
+    AVML_FINL bool overlaps(const ObbR<R>& a, const ObbR<R>& b) {
+        return avml_impl::overlaps<avml_impl::Obb_obb_kernel>(a, b);
+    }
+
+    template<class R>
+    AVML_FINL bool overlaps(const CapsuleR<R>& a, const CapsuleR<R>& b) {
+        return avml_impl::overlaps<avml_impl::Capsule_capsule_kernel>(a, b);
+    }
+
+    template<class R>
+    AVML_FINL R closest_points(const CapsuleR<R>& a, const CapsuleR<R>& b, Vector3R<R>& on_a, Vector3R<R>& on_b) {
+        R fa[7];
+        R fb[7];
+        avml_impl::primitive_fields(a, fa);
+        avml_impl::primitive_fields(b, fb);
+
+        R s;
+        R t;
+        avml_impl::segment_closest_parameters(fa, fa + 3, fb, fb + 3, s, t);
+
+        on_a = a.p0() + (a.p1() - a.p0()) * s;
+        on_b = b.p0() + (b.p1() - b.p0()) * t;
+        return length2(on_b - on_a);
+    }
+
+    //=====================================================
+    // One against many
+    //=====================================================
+
+    inline void overlaps(const spheref& s, const spheref* others, std::uint64_t* mask, std::size_t n) {
+        AVML_PROFILE_BATCH("overlaps[spheref, spheref]", n);
+        avml_impl::overlaps<avml_impl::Sphere_sphere_kernel>(s, others, mask, n);
+    }
+
+    inline void overlaps(const spheref& s, const aabb3f* boxes, std::uint64_t* mask, std::size_t n) {
+        AVML_PROFILE_BATCH("overlaps[spheref, aabb3f]", n);
+        avml_impl::overlaps<avml_impl::Sphere_box_kernel>(s, boxes, mask, n);
+    }
+
+    inline void overlaps(const aabb3f& b, const spheref* spheres, std::uint64_t* mask, std::size_t n) {
+        AVML_PROFILE_BATCH("overlaps[aabb3f, spheref]", n);
+        avml_impl::overlaps<avml_impl::Box_sphere_kernel>(b, spheres, mask, n);
+    }
+
+    inline void overlaps(const obbf& b, const obbf* others, std::uint64_t* mask, std::size_t n) {
+        AVML_PROFILE_BATCH("overlaps[obbf, obbf]", n);
+        avml_impl::overlaps<avml_impl::Obb_obb_kernel>(b, others, mask, n);
+    }
+
+    inline void overlaps(const capsulef& c, const capsulef* others, std::uint64_t* mask, std::size_t n) {
+        AVML_PROFILE_BATCH("overlaps[capsulef, capsulef]", n);
+        avml_impl::overlaps<avml_impl::Capsule_capsule_kernel>(c, others, mask, n);
+    }
+
+    inline void overlaps(const spheref& s, const spheref* others, std::uint64_t* mask, std::size_t n, Executor& executor) {
+        avml_impl::overlaps<avml_impl::Sphere_sphere_kernel>(s, others, mask, n, executor);
+    }
+
+    inline void overlaps(const spheref& s, const aabb3f* boxes, std::uint64_t* mask, std::size_t n, Executor& executor) {
+        avml_impl::overlaps<avml_impl::Sphere_box_kernel>(s, boxes, mask, n, executor);
+    }
+
+    inline void overlaps(const aabb3f& b, const spheref* spheres, std::uint64_t* mask, std::size_t n, Executor& executor) {
+        avml_impl::overlaps<avml_impl::Box_sphere_kernel>(b, spheres, mask, n, executor);
+    }
+
+    inline void overlaps(const obbf& b, const obbf* others, std::uint64_t* mask, std::size_t n, Executor& executor) {
+        avml_impl::overlaps<avml_impl::Obb_obb_kernel>(b, others, mask, n, executor);
+    }
+
+    inline void overlaps(const capsulef& c, const capsulef* others, std::uint64_t* mask, std::size_t n, Executor& executor) {
+        avml_impl::overlaps<avml_impl::Capsule_capsule_kernel>(c, others, mask, n, executor);
+    }
+
+}
+
+#endif
@@ -0,0 +1,346 @@
+#ifndef AVML_PARALLEL_IPP
+#define AVML_PARALLEL_IPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(_OPENMP)
+    #include <omp.h>
+#endif
+
+namespace avml {
+
+    //=====================================================
+    // Serial_executor
+    //=====================================================
+
+    inline void Serial_executor::parallel_for(std::size_t n, std::size_t grain, const Range_function& f) {
+        grain = std::max<std::size_t>(grain, 1);
+        for (std::size_t begin = 0; begin < n; begin += grain) {
+            f(begin, std::min(begin + grain, n));
+        }
+    }
+
+    inline unsigned Serial_executor::concurrency() const {
+        return 1;
+    }
+
+    //=====================================================
+    // Thread_pool
+    //=====================================================
+
+    class Thread_pool final : public Executor {
+    public:
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        ///
+        /// \param thread_count Number of worker threads. The threads that
+        /// call parallel_for also run chunks so a pool with zero workers is
+        /// equivalent to a Serial_executor.
+        explicit Thread_pool(unsigned thread_count = default_thread_count()):
+            queues(),
+            threads() {
+
+            queues.reserve(thread_count + 1);
+            for (unsigned i = 0; i < thread_count + 1; ++i) {
+                queues.emplace_back(new Queue{});
+            }
+
+            threads.reserve(thread_count);
+            for (unsigned i = 0; i < thread_count; ++i) {
+                threads.emplace_back([this, i] { work(i); });
+            }
+        }
+
+        ~Thread_pool() override {
+            {
+                std::lock_guard<std::mutex> lock{sleep_mutex};
+                stopping = true;
+            }
+            wake.notify_all();
+
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        }
+
+        //=================================================
+        // Interface
+        //=================================================
+
+        void parallel_for(std::size_t n, std::size_t grain, const Range_function& f) override {
+            grain = std::max<std::size_t>(grain, 1);
+            std::size_t chunk_count = (n + grain - 1) / grain;
+
+            if (chunk_count == 0) {
+                return;
+            }
+
+            if (chunk_count == 1 || threads.empty()) {
+                Serial_executor{}.parallel_for(n, grain, f);
+                return;
+            }
+
+            Job job{};
+            job.remaining.store(chunk_count);
+
+            // Counted before the chunks are published so that a worker which
+            // claims one straight away can't take pending below zero
+            {
+                std::lock_guard<std::mutex> lock{sleep_mutex};
+                pending += chunk_count;
+            }
+
+            // Chunks are dealt out round-robin so that every worker starts
+            // out with local work and only steals to balance the tail.
+            for (std::size_t i = 0; i < chunk_count; ++i) {
+                std::size_t begin = i * grain;
+                Task task{&f, &job, begin, std::min(begin + grain, n)};
+
+                Queue& queue = *queues[i % queues.size()];
+                std::lock_guard<std::mutex> lock{queue.mutex};
+                queue.tasks.push_back(task);
+            }
+            wake.notify_all();
+
+            unsigned self = current_worker();
+            if (self == no_worker) {
+                self = static_cast<unsigned>(threads.size());
+            }
+
+            while (job.remaining.load() != 0) {
+                Task task;
+                if (try_pop(self, task)) {
+                    run(task);
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock{job.mutex};
+                job.done.wait(lock, [&] { return job.remaining.load() == 0; });
+            }
+
+            // The thread which finished the last chunk may still hold the
+            // job's mutex. It must be released before the job goes away.
+            std::exception_ptr error;
+            {
+                std::lock_guard<std::mutex> lock{job.mutex};
+                error = job.error;
+            }
+
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        unsigned concurrency() const override {
+            return static_cast<unsigned>(threads.size() + 1);
+        }
+
+        static unsigned default_thread_count() {
+            unsigned n = std::thread::hardware_concurrency();
+            return (n > 1) ? n - 1 : 0;
+        }
+
+    private:
+
+        //=================================================
+        // Helper types
+        //=================================================
+
+        struct Job {
+            std::atomic<std::size_t> remaining;
+            std::mutex mutex;
+            std::condition_variable done;
+            std::exception_ptr error;
+        };
+
+        struct Task {
+            const Range_function* function;
+            Job* job;
+            std::size_t begin;
+            std::size_t end;
+        };
+
+        struct Queue {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        static constexpr unsigned no_worker = ~0u;
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        std::vector<std::unique_ptr<Queue>> queues;
+
+        std::vector<std::thread> threads;
+
+        std::mutex sleep_mutex;
+
+        std::condition_variable wake;
+
+        std::size_t pending = 0;
+
+        bool stopping = false;
+
+        //=================================================
+        // Helper functions
+        //=================================================
+
+        static unsigned& current_worker() {
+            static thread_local unsigned index = no_worker;
+            return index;
+        }
+
+        bool try_pop(unsigned self, Task& task) {
+            {
+                Queue& own = *queues[self];
+                std::lock_guard<std::mutex> lock{own.mutex};
+                if (!own.tasks.empty()) {
+                    task = own.tasks.back();
+                    own.tasks.pop_back();
+                    return claim();
+                }
+            }
+
+            for (std::size_t i = 1; i < queues.size(); ++i) {
+                Queue& victim = *queues[(self + i) % queues.size()];
+                std::lock_guard<std::mutex> lock{victim.mutex};
+                if (!victim.tasks.empty()) {
+                    task = victim.tasks.front();
+                    victim.tasks.pop_front();
+                    return claim();
+                }
+            }
+
+            return false;
+        }
+
+        bool claim() {
+            std::lock_guard<std::mutex> lock{sleep_mutex};
+            --pending;
+            return true;
+        }
+
+        ///
+        /// Runs a chunk, recording rather than propagating what it throws so
+        /// that the job is always completed before parallel_for returns and
+        /// its stack frame, which queued chunks point into, goes away
+        ///
+        static void run(const Task& task) {
+            std::exception_ptr error;
+            try {
+                (*task.function)(task.begin, task.end);
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            Job& job = *task.job;
+            std::lock_guard<std::mutex> lock{job.mutex};
+            if (error && !job.error) {
+                job.error = error;
+            }
+            if (job.remaining.fetch_sub(1) == 1) {
+                job.done.notify_all();
+            }
+        }
+
+        void work(unsigned index) {
+            current_worker() = index;
+
+            while (true) {
+                Task task;
+                if (try_pop(index, task)) {
+                    run(task);
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock{sleep_mutex};
+                wake.wait(lock, [this] { return stopping || pending != 0; });
+                if (stopping && pending == 0) {
+                    return;
+                }
+            }
+        }
+
+    };
+
+    //=====================================================
+    // Adapters
+    //=====================================================
+
+#if defined(_OPENMP)
+
+    ///
+    /// Executor which runs chunks on the OpenMP runtime's thread team
+    ///
+    class Openmp_executor final : public Executor {
+    public:
+
+        void parallel_for(std::size_t n, std::size_t grain, const Range_function& f) override {
+            grain = std::max<std::size_t>(grain, 1);
+            std::ptrdiff_t chunk_count = static_cast<std::ptrdiff_t>((n + grain - 1) / grain);
+
+            #pragma omp parallel for schedule(dynamic, 1)
+            for (std::ptrdiff_t i = 0; i < chunk_count; ++i) {
+                std::size_t begin = static_cast<std::size_t>(i) * grain;
+                f(begin, std::min(begin + grain, n));
+            }
+        }
+
+        unsigned concurrency() const override {
+            return static_cast<unsigned>(omp_get_max_threads());
+        }
+
+    };
+
+#endif
+
+    //=====================================================
+    // Free functions
+    //=====================================================
+
+    inline Executor& default_executor() {
+        static Thread_pool pool{};
+        return pool;
+    }
+
+    template<class In, class Out>
+    constexpr std::size_t default_grain() {
+        return (AVML_BATCH_CHUNK_BYTES / (sizeof(In) + sizeof(Out)) < 64) ?
+            64 :
+            AVML_BATCH_CHUNK_BYTES / (sizeof(In) + sizeof(Out)) / 64 * 64;
+    }
+
+}
+
+namespace avml_impl {
+
+    ///
+    /// Splits a batch kernel of the form kernel(in, out, n) across executor
+    ///
+    template<class In, class Out>
+    inline void parallel_batch(
+        avml::Executor& executor,
+        const In* in, Out* out, std::size_t n,
+        void (*kernel)(const In*, Out*, std::size_t)) {
+
+        executor.parallel_for(n, avml::default_grain<In, Out>(), [=](std::size_t begin, std::size_t end) {
+            kernel(in + begin, out + begin, end - begin);
+        });
+    }
+
+}
+
+#endif
@@ -0,0 +1,505 @@
+#ifndef AVML_PLANES_IPP
+#define AVML_PLANES_IPP
+
+#include "Lanes.hpp"
+
+namespace avml_impl {
+
+    //=====================================================
+    // Fields
+    //=====================================================
+
+    // As in Overlap.ipp, kernels see a primitive as a flat array of its
+    // scalars:
+    //
+    // Plane:   normal, distance
+    // Line:    origin, direction
+    // Segment: p0, p1
+
+    static_assert(sizeof(avml::planef) == 4 * sizeof(float), "planef must be tightly packed.");
+    static_assert(sizeof(avml::linef) == 6 * sizeof(float), "linef must be tightly packed.");
+    static_assert(sizeof(avml::segmentf) == 6 * sizeof(float), "segmentf must be tightly packed.");
+
+    template<class R>
+    AVML_FINL void primitive_fields(const avml::PlaneR<R>& p, R (&f)[4]) {
+        for (unsigned d = 0; d < 3; ++d) {
+            f[d] = p.normal()[d];
+        }
+        f[3] = p.distance();
+    }
+
+    template<class R>
+    AVML_FINL void primitive_fields(const avml::LineR<R>& l, R (&f)[6]) {
+        for (unsigned d = 0; d < 3; ++d) {
+            f[d + 0] = l.origin()[d];
+            f[d + 3] = l.direction()[d];
+        }
+    }
+
+    template<class R>
+    AVML_FINL void primitive_fields(const avml::SegmentR<R>& s, R (&f)[6]) {
+        for (unsigned d = 0; d < 3; ++d) {
+            f[d + 0] = s.p0()[d];
+            f[d + 3] = s.p1()[d];
+        }
+    }
+
+    //=====================================================
+    // Kernels
+    //=====================================================
+
+    template<class T>
+    AVML_FINL T plane_distance(const T* plane, const T* p) {
+        return lanes_fmadd(p[0], plane[0], lanes_fmadd(p[1], plane[1], lanes_fmsub(p[2], plane[2], plane[3])));
+    }
+
+    // Closest point kernels replace p with the point of the shape closest
+    // to it
+
+    struct Plane_closest_kernel {
+        static constexpr unsigned fields = 4;
+
+        template<class T>
+        AVML_FINL static void closest(const T* plane, T (&p)[3]) {
+            T s = plane_distance(plane, p);
+            for (unsigned d = 0; d < 3; ++d) {
+                p[d] = lanes_fmnadd(plane[d], s, p[d]);
+            }
+        }
+    };
+
+    struct Line_closest_kernel {
+        static constexpr unsigned fields = 6;
+
+        template<class T>
+        AVML_FINL static void closest(const T* line, T (&p)[3]) {
+            T op[3];
+            for (unsigned d = 0; d < 3; ++d) {
+                op[d] = p[d] - line[d];
+            }
+
+            T t = lanes_dot3(op, line + 3);
+            for (unsigned d = 0; d < 3; ++d) {
+                p[d] = lanes_fmadd(line[d + 3], t, line[d]);
+            }
+        }
+    };
+
+    struct Segment_closest_kernel {
+        static constexpr unsigned fields = 6;
+
+        template<class T>
+        AVML_FINL static void closest(const T* s, T (&p)[3]) {
+            T ab[3];
+            T ap[3];
+            for (unsigned d = 0; d < 3; ++d) {
+                ab[d] = s[d + 3] - s[d];
+                ap[d] = p[d] - s[d];
+            }
+
+            // Degenerate segments are points
+            T ab2 = lanes_dot3(ab, ab);
+            T t = lanes_clamp01(lanes_dot3(ap, ab) / ab2);
+            t = lanes_select(lanes_less(T{0.0f}, ab2), t, T{0.0f});
+
+            for (unsigned d = 0; d < 3; ++d) {
+                p[d] = lanes_fmadd(ab[d], t, s[d]);
+            }
+        }
+    };
+
+    ///
+    /// Moves the end points of segment s which are behind the plane to
+    /// where it crosses the plane, unless both of them are
+    ///
+    /// \return Mask of the segments not entirely behind the plane
+    template<class T>
+    AVML_FINL auto clip_segment(const T* plane, T (&s)[6]) -> decltype(lanes_less_equal(T{0.0f}, T{0.0f})) {
+        const T zero{0.0f};
+        const T one{1.0f};
+
+        T d0 = plane_distance(plane, s);
+        T d1 = plane_distance(plane, s + 3);
+
+        // Only used where the end points are on opposite sides, so the
+        // denominator isn't zero
+        T t = d0 / (d0 - d1);
+        T lo = lanes_select(lanes_less(d0, zero), t, zero);
+        T hi = lanes_select(lanes_less(d1, zero), t, one);
+
+        auto kept = lanes_less_equal(zero, lanes_max(d0, d1));
+        for (unsigned d = 0; d < 3; ++d) {
+            T ab = s[d + 3] - s[d];
+            T p0 = lanes_fmadd(ab, lo, s[d]);
+            T p1 = lanes_fmadd(ab, hi, s[d]);
+            s[d + 0] = lanes_select(kept, p0, s[d + 0]);
+            s[d + 3] = lanes_select(kept, p1, s[d + 3]);
+        }
+
+        return kept;
+    }
+
+    //=====================================================
+    // Drivers
+    //=====================================================
+
+    // Each driver handles W points at a time with lanes of type T, starting
+    // at i, and returns the index past the last point handled. Masks are
+    // written as in Overlap.ipp.
+
+    template<class T, unsigned W>
+    AVML_FINL std::size_t distance_groups(const float* plane, const float* points, float* out, std::size_t i, std::size_t n) {
+        T q[4];
+        for (unsigned k = 0; k < 4; ++k) {
+            q[k] = T{plane[k]};
+        }
+
+        for (; i + W <= n; i += W) {
+            T p[3];
+            lanes_load_interleaved(points + 3 * i, p);
+            lanes_store(*reinterpret_cast<float (*)[W]>(out + i), plane_distance(q, p));
+        }
+
+        return i;
+    }
+
+    template<class T, unsigned W>
+    AVML_FINL std::size_t classify_groups(const float* plane, const float* points, std::uint64_t* front, std::uint64_t* back, float epsilon, std::size_t i, std::size_t n) {
+        T q[4];
+        for (unsigned k = 0; k < 4; ++k) {
+            q[k] = T{plane[k]};
+        }
+
+        for (; i + W <= n; i += W) {
+            T p[3];
+            lanes_load_interleaved(points + 3 * i, p);
+            T s = plane_distance(q, p);
+            store_bits(front, i, lanes_bits(lanes_less(T{epsilon}, s)));
+            store_bits(back, i, lanes_bits(lanes_less(s, T{-epsilon})));
+        }
+
+        return i;
+    }
+
+    ///
+    /// Compacts the indices of the points on the given side. Every lane's
+    /// index is written and the count only advanced past the selected ones,
+    /// so there are no branches on the mask, and the writes stay in bounds
+    /// since no more than i + k indices precede lane k.
+    ///
+    template<class T, unsigned W>
+    AVML_FINL std::size_t select_groups(const float* plane, const float* points, avml::Plane_side side, float epsilon, std::uint32_t* indices, std::size_t& count, std::size_t i, std::size_t n) {
+        T q[4];
+        for (unsigned k = 0; k < 4; ++k) {
+            q[k] = T{plane[k]};
+        }
+
+        for (; i + W <= n; i += W) {
+            T p[3];
+            lanes_load_interleaved(points + 3 * i, p);
+            T s = plane_distance(q, p);
+
+            std::uint32_t front = lanes_bits(lanes_less(T{epsilon}, s));
+            std::uint32_t back = lanes_bits(lanes_less(s, T{-epsilon}));
+            std::uint32_t bits = 0;
+            switch (side) {
+            case avml::Plane_side::front: bits = front; break;
+            case avml::Plane_side::back: bits = back; break;
+            case avml::Plane_side::on: bits = ~(front | back); break;
+            }
+
+            for (unsigned k = 0; k < W; ++k) {
+                indices[count] = static_cast<std::uint32_t>(i + k);
+                count += (bits >> k) & 1;
+            }
+        }
+
+        return i;
+    }
+
+    template<class T, unsigned W, class Kernel>
+    AVML_FINL std::size_t closest_groups(const float* shape, const float* points, float* out, std::size_t i, std::size_t n) {
+        T q[Kernel::fields];
+        for (unsigned k = 0; k < Kernel::fields; ++k) {
+            q[k] = T{shape[k]};
+        }
+
+        for (; i + W <= n; i += W) {
+            T p[3];
+            lanes_load_interleaved(points + 3 * i, p);
+            Kernel::closest(q, p);
+            lanes_store_interleaved(out + 3 * i, p);
+        }
+
+        return i;
+    }
+
+    ///
+    /// Segments are gathered a field at a time and written back through a
+    /// transpose on the stack, there being no scatter before AVX-512
+    ///
+    template<class T, unsigned W>
+    AVML_FINL std::size_t clip_groups(const float* plane, const float* segments, float* out, std::uint64_t* kept, std::size_t i, std::size_t n) {
+        T q[4];
+        for (unsigned k = 0; k < 4; ++k) {
+            q[k] = T{plane[k]};
+        }
+
+        for (; i + W <= n; i += W) {
+            T s[6];
+            load_fields(segments + 6 * i, s);
+            store_bits(kept, i, lanes_bits(clip_segment(q, s)));
+
+            float fields[6][W];
+            for (unsigned k = 0; k < 6; ++k) {
+                lanes_store(fields[k], s[k]);
+            }
+            for (unsigned j = 0; j < W; ++j) {
+                for (unsigned k = 0; k < 6; ++k) {
+                    out[6 * (i + j) + k] = fields[k][j];
+                }
+            }
+        }
+
+        return i;
+    }
+
+    inline void signed_distances(const avml::planef& plane, const avml::vec3f* points, float* out, std::size_t n) {
+        const float* q = reinterpret_cast<const float*>(&plane);
+        const float* p = reinterpret_cast<const float*>(points);
+
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        i = distance_groups<Lanes16f, 16>(q, p, out, i, n);
+        #elif defined(AVML_AVX)
+        i = distance_groups<Lanes8f, 8>(q, p, out, i, n);
+        #endif
+
+        distance_groups<float, 1>(q, p, out, i, n);
+    }
+
+    inline void classify(const avml::planef& plane, const avml::vec3f* points, std::uint64_t* front, std::uint64_t* back, std::size_t n, float epsilon) {
+        const float* q = reinterpret_cast<const float*>(&plane);
+        const float* p = reinterpret_cast<const float*>(points);
+
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        i = classify_groups<Lanes16f, 16>(q, p, front, back, epsilon, i, n);
+        #elif defined(AVML_AVX)
+        i = classify_groups<Lanes8f, 8>(q, p, front, back, epsilon, i, n);
+        #endif
+
+        classify_groups<float, 1>(q, p, front, back, epsilon, i, n);
+    }
+
+    template<class Kernel, class S>
+    AVML_FINL void closest_points(const S& shape, const avml::vec3f* points, avml::vec3f* out, std::size_t n) {
+        const float* q = reinterpret_cast<const float*>(&shape);
+        const float* p = reinterpret_cast<const float*>(points);
+        float* o = reinterpret_cast<float*>(out);
+
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        i = closest_groups<Lanes16f, 16, Kernel>(q, p, o, i, n);
+        #elif defined(AVML_AVX)
+        i = closest_groups<Lanes8f, 8, Kernel>(q, p, o, i, n);
+        #endif
+
+        closest_groups<float, 1, Kernel>(q, p, o, i, n);
+    }
+
+    template<class Kernel, class S>
+    AVML_FINL void closest_points(const S& shape, const avml::vec3f* points, avml::vec3f* out, std::size_t n, avml::Executor& executor) {
+        executor.parallel_for(n, avml::default_grain<avml::vec3f, avml::vec3f>(), [&](std::size_t begin, std::size_t end) {
+            closest_points<Kernel>(shape, points + begin, out + begin, end - begin);
+        });
+    }
+
+    inline void clip(const avml::planef& plane, const avml::segmentf* segments, avml::segmentf* out, std::uint64_t* kept, std::size_t n) {
+        const float* q = reinterpret_cast<const float*>(&plane);
+        const float* s = reinterpret_cast<const float*>(segments);
+        float* o = reinterpret_cast<float*>(out);
+
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        i = clip_groups<Lanes16f, 16>(q, s, o, kept, i, n);
+        #elif defined(AVML_AVX2)
+        i = clip_groups<Lanes8f, 8>(q, s, o, kept, i, n);
+        #endif
+
+        clip_groups<float, 1>(q, s, o, kept, i, n);
+    }
+
+}
+
+namespace avml {
+
+    //=====================================================
+    // Single queries
+    //=====================================================
+
+    template<class R>
+    AVML_FINL Plane_side classify(const PlaneR<R>& plane, Vector3R<R> p, R epsilon) {
+        R s = signed_distance(plane, p);
+        if (epsilon < s) {
+            return Plane_side::front;
+        }
+        if (s < -epsilon) {
+            return Plane_side::back;
+        }
+        return Plane_side::on;
+    }
+
+    template<class R>
+    AVML_FINL bool intersect(const PlaneR<R>& plane, const LineR<R>& line, R& t) {
+        R denominator = dot(line.direction(), plane.normal());
+        if (denominator == R(0)) {
+            return false;
+        }
+
+        t = -signed_distance(plane, line.origin()) / denominator;
+        return true;
+    }
+
+    template<class R>
+    AVML_FINL bool intersect(const PlaneR<R>& plane, const SegmentR<R>& s, R& t) {
+        R d0 = signed_distance(plane, s.p0());
+        R d1 = signed_distance(plane, s.p1());
+        if ((R(0) < d0 && R(0) < d1) || (d0 < R(0) && d1 < R(0))) {
+            return false;
+        }
+
+        t = (d0 != d1) ? d0 / (d0 - d1) : R(0);
+        return true;
+    }
+
+    template<class R>
+    AVML_FINL bool clip(const PlaneR<R>& plane, SegmentR<R>& s) {
+        R q[4];
+        R f[6];
+        avml_impl::primitive_fields(plane, q);
+        avml_impl::primitive_fields(s, f);
+
+        if (!avml_impl::clip_segment(q, f)) {
+            return false;
+        }
+
+        s = SegmentR<R>{Vector3R<R>{f[0], f[1], f[2]}, Vector3R<R>{f[3], f[4], f[5]}};
+        return true;
+    }
+
+    template<class R>
+    AVML_FINL R closest_points(const SegmentR<R>& a, const SegmentR<R>& b, Vector3R<R>& on_a, Vector3R<R>& on_b) {
+        R fa[6];
+        R fb[6];
+        avml_impl::primitive_fields(a, fa);
+        avml_impl::primitive_fields(b, fb);
+
+        R s;
+        R t;
+        avml_impl::segment_closest_parameters(fa, fa + 3, fb, fb + 3, s, t);
+
+        on_a = a.p0() + (a.p1() - a.p0()) * s;
+        on_b = b.p0() + (b.p1() - b.p0()) * t;
+        return length2(on_b - on_a);
+    }
+
+    //=====================================================
+    // Batch queries
+    //=====================================================
+
+    inline void signed_distances(const planef& plane, const vec3f* points, float* out, std::size_t n) {
+        AVML_PROFILE_BATCH("signed_distances[planef]", n);
+        avml_impl::signed_distances(plane, points, out, n);
+    }
+
+    inline void classify(const planef& plane, const vec3f* points, std::uint64_t* front, std::uint64_t* back, std::size_t n, float epsilon) {
+        AVML_PROFILE_BATCH("classify[planef]", n);
+        avml_impl::classify(plane, points, front, back, n, epsilon);
+    }
+
+    inline std::size_t select(const planef& plane, const vec3f* points, std::size_t n, Plane_side side, float epsilon, std::uint32_t* indices) {
+        AVML_PROFILE_BATCH("select[planef]", n);
+
+        const float* q = reinterpret_cast<const float*>(&plane);
+        const float* p = reinterpret_cast<const float*>(points);
+
+        std::size_t count = 0;
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        i = avml_impl::select_groups<avml_impl::Lanes16f, 16>(q, p, side, epsilon, indices, count, i, n);
+        #elif defined(AVML_AVX)
+        i = avml_impl::select_groups<avml_impl::Lanes8f, 8>(q, p, side, epsilon, indices, count, i, n);
+        #endif
+
+        avml_impl::select_groups<float, 1>(q, p, side, epsilon, indices, count, i, n);
+        return count;
+    }
+
+    inline void clip(const planef& plane, const segmentf* segments, segmentf* out, std::uint64_t* kept, std::size_t n) {
+        AVML_PROFILE_BATCH("clip[planef, segmentf]", n);
+        avml_impl::clip(plane, segments, out, kept, n);
+    }
+
+    inline void closest_points(const planef& plane, const vec3f* points, vec3f* out, std::size_t n) {
+        AVML_PROFILE_BATCH("closest_points[planef]", n);
+        avml_impl::closest_points<avml_impl::Plane_closest_kernel>(plane, points, out, n);
+    }
+
+    inline void closest_points(const linef& line, const vec3f* points, vec3f* out, std::size_t n) {
+        AVML_PROFILE_BATCH("closest_points[linef]", n);
+        avml_impl::closest_points<avml_impl::Line_closest_kernel>(line, points, out, n);
+    }
+
+    inline void closest_points(const segmentf& s, const vec3f* points, vec3f* out, std::size_t n) {
+        AVML_PROFILE_BATCH("closest_points[segmentf]", n);
+        avml_impl::closest_points<avml_impl::Segment_closest_kernel>(s, points, out, n);
+    }
+
+    inline void signed_distances(const planef& plane, const vec3f* points, float* out, std::size_t n, Executor& executor) {
+        executor.parallel_for(n, default_grain<vec3f, float>(), [&](std::size_t begin, std::size_t end) {
+            avml_impl::signed_distances(plane, points + begin, out + begin, end - begin);
+        });
+    }
+
+    ///
+    /// Executors begin chunks at multiples of the grain, which is a multiple
+    /// of 64, so every chunk starts on its own mask word and never overwrites
+    /// bits belonging to another chunk. The same holds for clip below.
+    ///
+    inline void classify(const planef& plane, const vec3f* points, std::uint64_t* front, std::uint64_t* back, std::size_t n, float epsilon, Executor& executor) {
+        static_assert(default_grain<vec3f, std::uint64_t>() % 64 == 0, "Chunks must start on a mask word");
+
+        executor.parallel_for(n, default_grain<vec3f, std::uint64_t>(), [&](std::size_t begin, std::size_t end) {
+            avml_impl::classify(plane, points + begin, front + begin / 64, back + begin / 64, end - begin, epsilon);
+        });
+    }
+
+    inline void clip(const planef& plane, const segmentf* segments, segmentf* out, std::uint64_t* kept, std::size_t n, Executor& executor) {
+        static_assert(default_grain<segmentf, segmentf>() % 64 == 0, "Chunks must start on a mask word");
+
+        executor.parallel_for(n, default_grain<segmentf, segmentf>(), [&](std::size_t begin, std::size_t end) {
+            avml_impl::clip(plane, segments + begin, out + begin, kept + begin / 64, end - begin);
+        });
+    }
+
+    inline void closest_points(const planef& plane, const vec3f* points, vec3f* out, std::size_t n, Executor& executor) {
+        avml_impl::closest_points<avml_impl::Plane_closest_kernel>(plane, points, out, n, executor);
+    }
+
+    inline void closest_points(const linef& line, const vec3f* points, vec3f* out, std::size_t n, Executor& executor) {
+        avml_impl::closest_points<avml_impl::Line_closest_kernel>(line, points, out, n, executor);
+    }
+
+    inline void closest_points(const segmentf& s, const vec3f* points, vec3f* out, std::size_t n, Executor& executor) {
+        avml_impl::closest_points<avml_impl::Segment_closest_kernel>(s, points, out, n, executor);
+    }
+
+}
+
+#endif
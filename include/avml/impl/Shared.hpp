@@ -3,6 +3,7 @@
 
 #include "Capabilities.hpp"
 
+#include <array>
 #include <type_traits>
 
 namespace avml_impl {
@@ -41,11 +42,15 @@ namespace avml_impl {
 
 namespace avml_impl {
 
+#if defined(AVML_SSE2)
+
     static const __m128 sign_bit_mask = _mm_castsi128_ps(__m128i{
         0x7FFFFFFF7FFFFFFF,
         0x7FFFFFFF7FFFFFFF
     });
 
+#endif
+
 #if defined(AVML_AVX512VL)
 
     //=====================================================
@@ -53,7 +58,7 @@ namespace avml_impl {
     //=====================================================
 
     AVML_FINL __m128 load2f(const float* data) {
-        return _mm_maskz_load_ps(0x03, data);
+        return _mm_maskz_loadu_ps(0x03, data);
     }
 
     AVML_FINL __m128 load3f(const float* data) {
@@ -151,9 +156,9 @@ namespace avml_impl {
     //=====================================================
 
     AVML_FINL __m128 load2f(const float* data) {
-        __m128 ret;
-        ret = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(data)));
-        return ret;
+        // __m128i may alias floats, while loading through a double* would
+        // break strict aliasing
+        return _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(data)));
     }
 
     AVML_FINL __m128 load3f(const float* data) {
@@ -165,7 +170,7 @@ namespace avml_impl {
     }
 
     AVML_FINL void store2f(float* p, __m128 reg) {
-        _mm_store_sd(reinterpret_cast<double*>(p), _mm_castps_pd(reg));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_castps_si128(reg));
     }
 
     AVML_FINL void store3f(float* p, __m128 reg) {
@@ -251,9 +256,7 @@ namespace avml_impl {
     //=====================================================
 
     AVML_FINL __m128 load2f(const float* data) {
-        __m128 ret;
-        ret = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(data)));
-        return ret;
+        return _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(data)));
     }
 
     AVML_FINL __m128 load3f(const float* data) {
@@ -265,7 +268,7 @@ namespace avml_impl {
     }
 
     AVML_FINL void store2f(float* p, __m128 reg) {
-        _mm_store_sd(reinterpret_cast<double*>(p), _mm_castps_pd(reg));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_castps_si128(reg));
     }
 
     AVML_FINL void store3f(float* p, __m128 reg) {
@@ -343,9 +346,7 @@ namespace avml_impl {
     //=====================================================
 
     AVML_FINL __m128 load2f(const float* data) {
-        __m128 ret;
-        ret = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(data)));
-        return ret;
+        return _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(data)));
     }
 
     AVML_FINL __m128 load3f(const float* data) {
@@ -360,14 +361,14 @@ namespace avml_impl {
     }
 
     AVML_FINL void store2f(float* p, __m128 reg) {
-        _mm_store_sd(reinterpret_cast<double*>(p), _mm_castps_pd(reg));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_castps_si128(reg));
     }
 
     AVML_FINL void store3f(float* p, __m128 reg) {
         __m128 lo = reg;
         __m128 hi = _mm_movehl_ps(reg, reg);
 
-        _mm_store_sd(reinterpret_cast<double*>(p), _mm_castps_pd(lo));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_castps_si128(lo));
         _mm_store_ss(p + 0x02, hi);
     }
 
@@ -439,6 +440,262 @@ namespace avml_impl {
 
 #endif
 
+#if defined(AVML_SSE2)
+
+    /// Register holding four floats on the target's 128-bit vector extension
+    using Register4f = __m128;
+
+#endif
+
+}
+
+namespace avml_impl {
+
+    //=====================================================
+    // Multiply-add
+    //=====================================================
+
+    // m * x + b with a single rounding when AVML_FMA is defined, otherwise
+    // as a separate multiply and add
+
+#if defined(AVML_SSE2)
+
+    AVML_FINL __m128 fmadd4f(__m128 m, __m128 x, __m128 b) {
+        #if defined(AVML_FMA)
+        return _mm_fmadd_ps(m, x, b);
+        #else
+        return _mm_add_ps(_mm_mul_ps(m, x), b);
+        #endif
+    }
+
+    /// b - m * x
+    AVML_FINL __m128 fnmadd4f(__m128 m, __m128 x, __m128 b) {
+        #if defined(AVML_FMA)
+        return _mm_fnmadd_ps(m, x, b);
+        #else
+        return _mm_sub_ps(b, _mm_mul_ps(m, x));
+        #endif
+    }
+
+    /// m * x - b
+    AVML_FINL __m128 fmsub4f(__m128 m, __m128 x, __m128 b) {
+        #if defined(AVML_FMA)
+        return _mm_fmsub_ps(m, x, b);
+        #else
+        return _mm_sub_ps(_mm_mul_ps(m, x), b);
+        #endif
+    }
+
+#endif
+
+#if defined(AVML_AVX)
+
+    AVML_FINL __m256 fmadd8f(__m256 m, __m256 x, __m256 b) {
+        #if defined(AVML_FMA)
+        return _mm256_fmadd_ps(m, x, b);
+        #else
+        return _mm256_add_ps(_mm256_mul_ps(m, x), b);
+        #endif
+    }
+
+#endif
+
+}
+
+namespace avml_impl {
+
+    //=====================================================
+    // Interleaving
+    //=====================================================
+
+    // Conversions between arrays of three-component vectors and registers
+    // holding one component of several consecutive vectors.
+
+#if defined(AVML_AVX512F)
+
+    AVML_FINL void deinterleave3x16f(__m512 a, __m512 b, __m512 c, __m512& x, __m512& y, __m512& z) {
+        const __m512i x0 = _mm512_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 0, 0, 0, 0, 0);
+        const __m512i x1 = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 17, 20, 23, 26, 29);
+
+        const __m512i y0 = _mm512_setr_epi32(1, 4, 7, 10, 13, 16, 19, 22, 25, 28, 31, 0, 0, 0, 0, 0);
+        const __m512i y1 = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 18, 21, 24, 27, 30);
+
+        const __m512i z0 = _mm512_setr_epi32(2, 5, 8, 11, 14, 17, 20, 23, 26, 29, 0, 0, 0, 0, 0, 0);
+        const __m512i z1 = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 16, 19, 22, 25, 28, 31);
+
+        x = _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, x0, b), x1, c);
+        y = _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, y0, b), y1, c);
+        z = _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, z0, b), z1, c);
+    }
+
+    AVML_FINL void interleave3x16f(__m512 x, __m512 y, __m512 z, __m512& a, __m512& b, __m512& c) {
+        const __m512i a0 = _mm512_setr_epi32(0, 16, 0, 1, 17, 0, 2, 18, 0, 3, 19, 0, 4, 20, 0, 5);
+        const __m512i a1 = _mm512_setr_epi32(0, 1, 16, 3, 4, 17, 6, 7, 18, 9, 10, 19, 12, 13, 20, 15);
+
+        const __m512i b0 = _mm512_setr_epi32(21, 0, 6, 22, 0, 7, 23, 0, 8, 24, 0, 9, 25, 0, 10, 26);
+        const __m512i b1 = _mm512_setr_epi32(0, 21, 2, 3, 22, 5, 6, 23, 8, 9, 24, 11, 12, 25, 14, 15);
+
+        const __m512i c0 = _mm512_setr_epi32(0, 11, 27, 0, 12, 28, 0, 13, 29, 0, 14, 30, 0, 15, 31, 0);
+        const __m512i c1 = _mm512_setr_epi32(26, 1, 2, 27, 4, 5, 28, 7, 8, 29, 10, 11, 30, 13, 14, 31);
+
+        a = _mm512_permutex2var_ps(_mm512_permutex2var_ps(x, a0, y), a1, z);
+        b = _mm512_permutex2var_ps(_mm512_permutex2var_ps(x, b0, y), b1, z);
+        c = _mm512_permutex2var_ps(_mm512_permutex2var_ps(x, c0, y), c1, z);
+    }
+
+    AVML_FINL void load3x16f(const float* p, __m512& x, __m512& y, __m512& z) {
+        __m512 a = _mm512_loadu_ps(p + 0x00);
+        __m512 b = _mm512_loadu_ps(p + 0x10);
+        __m512 c = _mm512_loadu_ps(p + 0x20);
+        deinterleave3x16f(a, b, c, x, y, z);
+    }
+
+    AVML_FINL void store3x16f(float* p, __m512 x, __m512 y, __m512 z) {
+        __m512 a, b, c;
+        interleave3x16f(x, y, z, a, b, c);
+        _mm512_storeu_ps(p + 0x00, a);
+        _mm512_storeu_ps(p + 0x10, b);
+        _mm512_storeu_ps(p + 0x20, c);
+    }
+
+    ///
+    /// Stores 16 two-component vectors given one register per component
+    ///
+    AVML_FINL void store2x16f(float* p, __m512 x, __m512 y) {
+        const __m512i lo = _mm512_setr_epi32(0, 1, 2, 3, 16, 17, 18, 19, 4, 5, 6, 7, 20, 21, 22, 23);
+        const __m512i hi = _mm512_setr_epi32(8, 9, 10, 11, 24, 25, 26, 27, 12, 13, 14, 15, 28, 29, 30, 31);
+
+        __m512 a = _mm512_unpacklo_ps(x, y);
+        __m512 b = _mm512_unpackhi_ps(x, y);
+        _mm512_storeu_ps(p + 0x00, _mm512_permutex2var_ps(a, lo, b));
+        _mm512_storeu_ps(p + 0x10, _mm512_permutex2var_ps(a, hi, b));
+    }
+
+    ///
+    /// Non-temporal variant of store3x16f. p must be 64-byte aligned.
+    ///
+    AVML_FINL void stream3x16f(float* p, __m512 x, __m512 y, __m512 z) {
+        __m512 a, b, c;
+        interleave3x16f(x, y, z, a, b, c);
+        _mm512_stream_ps(p + 0x00, a);
+        _mm512_stream_ps(p + 0x10, b);
+        _mm512_stream_ps(p + 0x20, c);
+    }
+
+    AVML_FINL void normalize3x16f(__m512& x, __m512& y, __m512& z) {
+        __m512 l2 = _mm512_fmadd_ps(z, z, _mm512_fmadd_ps(y, y, _mm512_mul_ps(x, x)));
+        __m512 l = _mm512_sqrt_ps(l2);
+        x = _mm512_div_ps(x, l);
+        y = _mm512_div_ps(y, l);
+        z = _mm512_div_ps(z, l);
+    }
+
+#endif
+
+#if defined(AVML_AVX)
+
+    AVML_FINL void deinterleave3x8f(__m256 a, __m256 b, __m256 c, __m256& x, __m256& y, __m256& z) {
+        __m256 m03 = _mm256_permute2f128_ps(a, b, 0x30);
+        __m256 m14 = _mm256_permute2f128_ps(a, c, 0x21);
+        __m256 m25 = _mm256_permute2f128_ps(b, c, 0x30);
+
+        __m256 xy = _mm256_shuffle_ps(m14, m25, _MM_SHUFFLE(2, 1, 3, 2));
+        __m256 yz = _mm256_shuffle_ps(m03, m14, _MM_SHUFFLE(1, 0, 2, 1));
+
+        x = _mm256_shuffle_ps(m03, xy, _MM_SHUFFLE(2, 0, 3, 0));
+        y = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+        z = _mm256_shuffle_ps(yz, m25, _MM_SHUFFLE(3, 0, 3, 1));
+    }
+
+    AVML_FINL void interleave3x8f(__m256 x, __m256 y, __m256 z, __m256& a, __m256& b, __m256& c) {
+        __m256 rxy = _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 ryz = _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1));
+        __m256 rzx = _mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));
+
+        __m256 m03 = _mm256_shuffle_ps(rxy, rzx, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 m14 = _mm256_shuffle_ps(ryz, rxy, _MM_SHUFFLE(3, 1, 2, 0));
+        __m256 m25 = _mm256_shuffle_ps(rzx, ryz, _MM_SHUFFLE(3, 1, 3, 1));
+
+        a = _mm256_permute2f128_ps(m03, m14, 0x20);
+        b = _mm256_permute2f128_ps(m25, m03, 0x30);
+        c = _mm256_permute2f128_ps(m14, m25, 0x31);
+    }
+
+    AVML_FINL void load3x8f(const float* p, __m256& x, __m256& y, __m256& z) {
+        __m256 a = _mm256_loadu_ps(p + 0x00);
+        __m256 b = _mm256_loadu_ps(p + 0x08);
+        __m256 c = _mm256_loadu_ps(p + 0x10);
+        deinterleave3x8f(a, b, c, x, y, z);
+    }
+
+    AVML_FINL void store3x8f(float* p, __m256 x, __m256 y, __m256 z) {
+        __m256 a, b, c;
+        interleave3x8f(x, y, z, a, b, c);
+        _mm256_storeu_ps(p + 0x00, a);
+        _mm256_storeu_ps(p + 0x08, b);
+        _mm256_storeu_ps(p + 0x10, c);
+    }
+
+    AVML_FINL void store2x8f(float* p, __m256 x, __m256 y) {
+        __m256 a = _mm256_unpacklo_ps(x, y);
+        __m256 b = _mm256_unpackhi_ps(x, y);
+        _mm256_storeu_ps(p + 0x00, _mm256_permute2f128_ps(a, b, 0x20));
+        _mm256_storeu_ps(p + 0x08, _mm256_permute2f128_ps(a, b, 0x31));
+    }
+
+    ///
+    /// Non-temporal variant of store3x8f. p must be 32-byte aligned.
+    ///
+    AVML_FINL void stream3x8f(float* p, __m256 x, __m256 y, __m256 z) {
+        __m256 a, b, c;
+        interleave3x8f(x, y, z, a, b, c);
+        _mm256_stream_ps(p + 0x00, a);
+        _mm256_stream_ps(p + 0x08, b);
+        _mm256_stream_ps(p + 0x10, c);
+    }
+
+    ///
+    /// Transposes the 8x8 matrix whose rows are held in r
+    ///
+    AVML_FINL void transpose8x8f(__m256 (&r)[8]) {
+        __m256 t0 = _mm256_unpacklo_ps(r[0], r[1]);
+        __m256 t1 = _mm256_unpackhi_ps(r[0], r[1]);
+        __m256 t2 = _mm256_unpacklo_ps(r[2], r[3]);
+        __m256 t3 = _mm256_unpackhi_ps(r[2], r[3]);
+        __m256 t4 = _mm256_unpacklo_ps(r[4], r[5]);
+        __m256 t5 = _mm256_unpackhi_ps(r[4], r[5]);
+        __m256 t6 = _mm256_unpacklo_ps(r[6], r[7]);
+        __m256 t7 = _mm256_unpackhi_ps(r[6], r[7]);
+
+        __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+        __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+        __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+        r[0] = _mm256_permute2f128_ps(s0, s4, 0x20);
+        r[1] = _mm256_permute2f128_ps(s1, s5, 0x20);
+        r[2] = _mm256_permute2f128_ps(s2, s6, 0x20);
+        r[3] = _mm256_permute2f128_ps(s3, s7, 0x20);
+        r[4] = _mm256_permute2f128_ps(s0, s4, 0x31);
+        r[5] = _mm256_permute2f128_ps(s1, s5, 0x31);
+        r[6] = _mm256_permute2f128_ps(s2, s6, 0x31);
+        r[7] = _mm256_permute2f128_ps(s3, s7, 0x31);
+    }
+
+    AVML_FINL void normalize3x8f(__m256& x, __m256& y, __m256& z) {
+        __m256 l2 = fmadd8f(z, z, fmadd8f(y, y, _mm256_mul_ps(x, x)));
+        __m256 l = _mm256_sqrt_ps(l2);
+        x = _mm256_div_ps(x, l);
+        y = _mm256_div_ps(y, l);
+        z = _mm256_div_ps(z, l);
+    }
+
+#endif
+
 }
 
 #endif
@@ -0,0 +1,586 @@
+#ifndef AVML_SPATIAL_IPP
+#define AVML_SPATIAL_IPP
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace avml_impl {
+
+    //=====================================================
+    // Bit interleaving
+    //=====================================================
+
+    ///
+    /// Moves bit i of the low 10 bits of x to bit 3 * i
+    ///
+    AVML_FINL std::uint32_t spread_bits30(std::uint32_t x) {
+        x &= 0x000003FF;
+        x = (x | (x << 16)) & 0x030000FF;
+        x = (x | (x << 8)) & 0x0300F00F;
+        x = (x | (x << 4)) & 0x030C30C3;
+        x = (x | (x << 2)) & 0x09249249;
+        return x;
+    }
+
+    AVML_FINL std::uint32_t compact_bits30(std::uint32_t x) {
+        x &= 0x09249249;
+        x = (x | (x >> 2)) & 0x030C30C3;
+        x = (x | (x >> 4)) & 0x0300F00F;
+        x = (x | (x >> 8)) & 0x030000FF;
+        x = (x | (x >> 16)) & 0x000003FF;
+        return x;
+    }
+
+    ///
+    /// Moves bit i of the low 21 bits of x to bit 3 * i
+    ///
+    AVML_FINL std::uint64_t spread_bits63(std::uint64_t x) {
+        x &= 0x00000000001FFFFF;
+        x = (x | (x << 32)) & 0x001F00000000FFFF;
+        x = (x | (x << 16)) & 0x001F0000FF0000FF;
+        x = (x | (x << 8)) & 0x100F00F00F00F00F;
+        x = (x | (x << 4)) & 0x10C30C30C30C30C3;
+        x = (x | (x << 2)) & 0x1249249249249249;
+        return x;
+    }
+
+    AVML_FINL std::uint64_t compact_bits63(std::uint64_t x) {
+        x &= 0x1249249249249249;
+        x = (x | (x >> 2)) & 0x10C30C30C30C30C3;
+        x = (x | (x >> 4)) & 0x100F00F00F00F00F;
+        x = (x | (x >> 8)) & 0x001F0000FF0000FF;
+        x = (x | (x >> 16)) & 0x001F00000000FFFF;
+        x = (x | (x >> 32)) & 0x00000000001FFFFF;
+        return x;
+    }
+
+    AVML_FINL std::uint32_t interleave30(std::uint32_t x, std::uint32_t y, std::uint32_t z) {
+        #if defined(AVML_BMI2)
+        return
+            _pdep_u32(x, 0x24924924) |
+            _pdep_u32(y, 0x12492492) |
+            _pdep_u32(z, 0x09249249);
+        #else
+        return (spread_bits30(x) << 2) | (spread_bits30(y) << 1) | spread_bits30(z);
+        #endif
+    }
+
+    AVML_FINL std::uint64_t interleave63(std::uint64_t x, std::uint64_t y, std::uint64_t z) {
+        #if defined(AVML_BMI2)
+        return
+            _pdep_u64(x, 0x4924924924924924) |
+            _pdep_u64(y, 0x2492492492492492) |
+            _pdep_u64(z, 0x1249249249249249);
+        #else
+        return (spread_bits63(x) << 2) | (spread_bits63(y) << 1) | spread_bits63(z);
+        #endif
+    }
+
+    AVML_FINL void deinterleave30(std::uint32_t code, std::uint32_t (&v)[3]) {
+        #if defined(AVML_BMI2)
+        v[0] = _pext_u32(code, 0x24924924);
+        v[1] = _pext_u32(code, 0x12492492);
+        v[2] = _pext_u32(code, 0x09249249);
+        #else
+        v[0] = compact_bits30(code >> 2);
+        v[1] = compact_bits30(code >> 1);
+        v[2] = compact_bits30(code);
+        #endif
+    }
+
+    AVML_FINL void deinterleave63(std::uint64_t code, std::uint32_t (&v)[3]) {
+        #if defined(AVML_BMI2)
+        v[0] = static_cast<std::uint32_t>(_pext_u64(code, 0x4924924924924924));
+        v[1] = static_cast<std::uint32_t>(_pext_u64(code, 0x2492492492492492));
+        v[2] = static_cast<std::uint32_t>(_pext_u64(code, 0x1249249249249249));
+        #else
+        v[0] = static_cast<std::uint32_t>(compact_bits63(code >> 2));
+        v[1] = static_cast<std::uint32_t>(compact_bits63(code >> 1));
+        v[2] = static_cast<std::uint32_t>(compact_bits63(code));
+        #endif
+    }
+
+    //=====================================================
+    // Hilbert transposition
+    //=====================================================
+
+    // Skilling, "Programming the Hilbert curve". A Hilbert code is the
+    // interleaving of its transposed form. The conditional inversions and
+    // exchanges are done with masks so that there are no data dependent
+    // branches.
+
+    AVML_FINL std::uint32_t all_if(std::uint32_t x) {
+        return std::uint32_t(0) - std::uint32_t(x != 0);
+    }
+
+    AVML_FINL void hilbert_invert_or_exchange(std::uint32_t (&x)[3], unsigned i, std::uint32_t q) {
+        std::uint32_t p = q - 1;
+        std::uint32_t invert = all_if(x[i] & q);
+        std::uint32_t t = (x[0] ^ x[i]) & p & ~invert;
+
+        x[0] ^= (p & invert) ^ t;
+        x[i] ^= t;
+    }
+
+    ///
+    /// Converts coordinates of Bits bits into the transposed Hilbert code
+    ///
+    template<unsigned Bits>
+    AVML_FINL void hilbert_axes_to_transpose(std::uint32_t (&x)[3]) {
+        const std::uint32_t m = std::uint32_t(1) << (Bits - 1);
+
+        for (std::uint32_t q = m; q > 1; q >>= 1) {
+            for (unsigned i = 0; i < 3; ++i) {
+                hilbert_invert_or_exchange(x, i, q);
+            }
+        }
+
+        // Gray encode
+        x[1] ^= x[0];
+        x[2] ^= x[1];
+
+        std::uint32_t t = 0;
+        for (std::uint32_t q = m; q > 1; q >>= 1) {
+            t ^= (q - 1) & all_if(x[2] & q);
+        }
+
+        for (unsigned i = 0; i < 3; ++i) {
+            x[i] ^= t;
+        }
+    }
+
+    template<unsigned Bits>
+    AVML_FINL void hilbert_transpose_to_axes(std::uint32_t (&x)[3]) {
+        const std::uint32_t n = std::uint32_t(2) << (Bits - 1);
+
+        // Gray decode
+        std::uint32_t t = x[2] >> 1;
+        x[2] ^= x[1];
+        x[1] ^= x[0];
+        x[0] ^= t;
+
+        for (std::uint32_t q = 2; q != n; q <<= 1) {
+            for (unsigned i = 3; i-- > 0;) {
+                hilbert_invert_or_exchange(x, i, q);
+            }
+        }
+    }
+
+    //=====================================================
+    // Quantization
+    //=====================================================
+
+    ///
+    /// \return Per-axis factor mapping offsets from the minimum of bounds to
+    /// grid coordinates. Zero along axes where bounds is flat.
+    AVML_FINL avml::vec3f quantization_scale(const avml::aabb3f& bounds, unsigned bits) {
+        const float cells = static_cast<float>(std::uint32_t(1) << bits);
+        avml::vec3f extent = bounds.maximum() - bounds.minimum();
+
+        avml::vec3f ret;
+        for (unsigned i = 0; i < 3; ++i) {
+            ret[i] = (extent[i] > 0.0f) ? cells / extent[i] : 0.0f;
+        }
+        return ret;
+    }
+
+    AVML_FINL std::uint32_t quantize1(float p, float lo, float scale, float max_q) {
+        float t = (p - lo) * scale;
+        t = (t > 0.0f) ? t : 0.0f;
+        t = (t < max_q) ? t : max_q;
+        return static_cast<std::uint32_t>(t);
+    }
+
+    AVML_FINL avml::vec3u quantize3(avml::vec3f p, avml::vec3f lo, avml::vec3f scale, float max_q) {
+        return avml::vec3u{
+            quantize1(p[0], lo[0], scale[0], max_q),
+            quantize1(p[1], lo[1], scale[1], max_q),
+            quantize1(p[2], lo[2], scale[2], max_q)
+        };
+    }
+
+    //=====================================================
+    // SIMD helpers
+    //=====================================================
+
+#if defined(AVML_AVX2)
+
+    // NaN positions quantize to zero as in quantize1 since max returns its
+    // second operand when either is NaN
+
+    AVML_FINL __m256i quantize8(__m256 p, float lo, float scale, float max_q) {
+        __m256 t = _mm256_mul_ps(_mm256_sub_ps(p, _mm256_set1_ps(lo)), _mm256_set1_ps(scale));
+        t = _mm256_max_ps(t, _mm256_setzero_ps());
+        t = _mm256_min_ps(t, _mm256_set1_ps(max_q));
+        return _mm256_cvttps_epi32(t);
+    }
+
+    AVML_FINL __m256i spread_bits30x8(__m256i x) {
+        x = _mm256_and_si256(_mm256_or_si256(x, _mm256_slli_epi32(x, 16)), _mm256_set1_epi32(0x030000FF));
+        x = _mm256_and_si256(_mm256_or_si256(x, _mm256_slli_epi32(x, 8)), _mm256_set1_epi32(0x0300F00F));
+        x = _mm256_and_si256(_mm256_or_si256(x, _mm256_slli_epi32(x, 4)), _mm256_set1_epi32(0x030C30C3));
+        x = _mm256_and_si256(_mm256_or_si256(x, _mm256_slli_epi32(x, 2)), _mm256_set1_epi32(0x09249249));
+        return x;
+    }
+
+    AVML_FINL __m256i spread_bits63x4(__m256i x) {
+        x = _mm256_and_si256(_mm256_or_si256(x, _mm256_slli_epi64(x, 32)), _mm256_set1_epi64x(0x001F00000000FFFF));
+        x = _mm256_and_si256(_mm256_or_si256(x, _mm256_slli_epi64(x, 16)), _mm256_set1_epi64x(0x001F0000FF0000FF));
+        x = _mm256_and_si256(_mm256_or_si256(x, _mm256_slli_epi64(x, 8)), _mm256_set1_epi64x(0x100F00F00F00F00F));
+        x = _mm256_and_si256(_mm256_or_si256(x, _mm256_slli_epi64(x, 4)), _mm256_set1_epi64x(0x10C30C30C30C30C3));
+        x = _mm256_and_si256(_mm256_or_si256(x, _mm256_slli_epi64(x, 2)), _mm256_set1_epi64x(0x1249249249249249));
+        return x;
+    }
+
+    AVML_FINL __m256i interleave63x4(__m128i x, __m128i y, __m128i z) {
+        __m256i sx = spread_bits63x4(_mm256_cvtepu32_epi64(x));
+        __m256i sy = spread_bits63x4(_mm256_cvtepu32_epi64(y));
+        __m256i sz = spread_bits63x4(_mm256_cvtepu32_epi64(z));
+        return _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi64(sx, 2), _mm256_slli_epi64(sy, 1)), sz);
+    }
+
+#endif
+
+#if defined(AVML_AVX512F)
+
+    // (a | b) & c and a | b | c as single ternary logic instructions
+    constexpr int ternary_or_and = 0xA8;
+    constexpr int ternary_or_or = 0xFE;
+
+    AVML_FINL __m512i quantize16(__m512 p, float lo, float scale, float max_q) {
+        __m512 t = _mm512_mul_ps(_mm512_sub_ps(p, _mm512_set1_ps(lo)), _mm512_set1_ps(scale));
+        t = _mm512_max_ps(t, _mm512_setzero_ps());
+        t = _mm512_min_ps(t, _mm512_set1_ps(max_q));
+        return _mm512_cvttps_epi32(t);
+    }
+
+    AVML_FINL __m512i spread_bits30x16(__m512i x) {
+        x = _mm512_ternarylogic_epi32(x, _mm512_slli_epi32(x, 16), _mm512_set1_epi32(0x030000FF), ternary_or_and);
+        x = _mm512_ternarylogic_epi32(x, _mm512_slli_epi32(x, 8), _mm512_set1_epi32(0x0300F00F), ternary_or_and);
+        x = _mm512_ternarylogic_epi32(x, _mm512_slli_epi32(x, 4), _mm512_set1_epi32(0x030C30C3), ternary_or_and);
+        x = _mm512_ternarylogic_epi32(x, _mm512_slli_epi32(x, 2), _mm512_set1_epi32(0x09249249), ternary_or_and);
+        return x;
+    }
+
+    AVML_FINL __m512i spread_bits63x8(__m512i x) {
+        x = _mm512_ternarylogic_epi64(x, _mm512_slli_epi64(x, 32), _mm512_set1_epi64(0x001F00000000FFFF), ternary_or_and);
+        x = _mm512_ternarylogic_epi64(x, _mm512_slli_epi64(x, 16), _mm512_set1_epi64(0x001F0000FF0000FF), ternary_or_and);
+        x = _mm512_ternarylogic_epi64(x, _mm512_slli_epi64(x, 8), _mm512_set1_epi64(0x100F00F00F00F00F), ternary_or_and);
+        x = _mm512_ternarylogic_epi64(x, _mm512_slli_epi64(x, 4), _mm512_set1_epi64(0x10C30C30C30C30C3), ternary_or_and);
+        x = _mm512_ternarylogic_epi64(x, _mm512_slli_epi64(x, 2), _mm512_set1_epi64(0x1249249249249249), ternary_or_and);
+        return x;
+    }
+
+#endif
+
+    //=====================================================
+    // Radix sort
+    //=====================================================
+
+    template<class K>
+    AVML_FINL void radix_sort(K* keys, std::uint32_t* values, std::size_t n) {
+        constexpr unsigned digits = sizeof(K);
+
+        if (n < 2) {
+            return;
+        }
+
+        // Histograms of every digit are gathered in a single pass
+        std::size_t counts[digits][256] = {};
+        for (std::size_t i = 0; i < n; ++i) {
+            K key = keys[i];
+            for (unsigned d = 0; d < digits; ++d) {
+                ++counts[d][(key >> (8 * d)) & 0xFF];
+            }
+        }
+
+        std::vector<K> key_buffer(n);
+        std::vector<std::uint32_t> value_buffer(values ? n : 0);
+
+        K* src_keys = keys;
+        K* dst_keys = key_buffer.data();
+        std::uint32_t* src_values = values;
+        std::uint32_t* dst_values = values ? value_buffer.data() : nullptr;
+
+        for (unsigned d = 0; d < digits; ++d) {
+            const unsigned shift = 8 * d;
+            std::size_t (&count)[256] = counts[d];
+
+            if (count[(src_keys[0] >> shift) & 0xFF] == n) {
+                continue;
+            }
+
+            std::size_t offset = 0;
+            for (std::size_t& c : count) {
+                std::size_t t = c;
+                c = offset;
+                offset += t;
+            }
+
+            for (std::size_t i = 0; i < n; ++i) {
+                std::size_t j = count[(src_keys[i] >> shift) & 0xFF]++;
+                dst_keys[j] = src_keys[i];
+                if (src_values) {
+                    dst_values[j] = src_values[i];
+                }
+            }
+
+            std::swap(src_keys, dst_keys);
+            std::swap(src_values, dst_values);
+        }
+
+        if (src_keys != keys) {
+            std::copy(src_keys, src_keys + n, keys);
+            if (values) {
+                std::copy(src_values, src_values + n, values);
+            }
+        }
+    }
+
+}
+
+namespace avml {
+
+    //=====================================================
+    // Quantization
+    //=====================================================
+
+    inline vec3u quantize(const aabb3f& bounds, vec3f p, unsigned bits) {
+        const float max_q = static_cast<float>((std::uint32_t(1) << bits) - 1);
+        vec3f scale = avml_impl::quantization_scale(bounds, bits);
+        return avml_impl::quantize3(p, bounds.minimum(), scale, max_q);
+    }
+
+    //=====================================================
+    // Space-filling curves
+    //=====================================================
+
+    inline std::uint32_t morton_encode30(vec3u v) {
+        return avml_impl::interleave30(v[0] & 0x3FF, v[1] & 0x3FF, v[2] & 0x3FF);
+    }
+
+    inline std::uint64_t morton_encode63(vec3u v) {
+        return avml_impl::interleave63(v[0] & 0x1FFFFF, v[1] & 0x1FFFFF, v[2] & 0x1FFFFF);
+    }
+
+    inline vec3u morton_decode30(std::uint32_t code) {
+        std::uint32_t v[3];
+        avml_impl::deinterleave30(code, v);
+        return vec3u{v[0], v[1], v[2]};
+    }
+
+    inline vec3u morton_decode63(std::uint64_t code) {
+        std::uint32_t v[3];
+        avml_impl::deinterleave63(code, v);
+        return vec3u{v[0], v[1], v[2]};
+    }
+
+    inline std::uint32_t hilbert_encode30(vec3u v) {
+        std::uint32_t x[3] = {v[0] & 0x3FF, v[1] & 0x3FF, v[2] & 0x3FF};
+        avml_impl::hilbert_axes_to_transpose<10>(x);
+        return avml_impl::interleave30(x[0], x[1], x[2]);
+    }
+
+    inline std::uint64_t hilbert_encode63(vec3u v) {
+        std::uint32_t x[3] = {v[0] & 0x1FFFFF, v[1] & 0x1FFFFF, v[2] & 0x1FFFFF};
+        avml_impl::hilbert_axes_to_transpose<21>(x);
+        return avml_impl::interleave63(x[0], x[1], x[2]);
+    }
+
+    inline vec3u hilbert_decode30(std::uint32_t code) {
+        std::uint32_t x[3];
+        avml_impl::deinterleave30(code, x);
+        avml_impl::hilbert_transpose_to_axes<10>(x);
+        return vec3u{x[0], x[1], x[2]};
+    }
+
+    inline vec3u hilbert_decode63(std::uint64_t code) {
+        std::uint32_t x[3];
+        avml_impl::deinterleave63(code, x);
+        avml_impl::hilbert_transpose_to_axes<21>(x);
+        return vec3u{x[0], x[1], x[2]};
+    }
+
+    //=====================================================
+    // Batch codes
+    //=====================================================
+
+    inline void morton_codes30(const aabb3f& bounds, const vec3f* in, std::uint32_t* out, std::size_t n) {
+        AVML_PROFILE_BATCH("morton_codes30[batch]", n);
+
+        const float max_q = 1023.0f;
+        const vec3f lo = bounds.minimum();
+        const vec3f scale = avml_impl::quantization_scale(bounds, 10);
+
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        const float* src = reinterpret_cast<const float*>(in);
+        for (; i + 16 <= n; i += 16) {
+            __m512 x, y, z;
+            avml_impl::load3x16f(src + 3 * i, x, y, z);
+
+            __m512i sx = avml_impl::spread_bits30x16(avml_impl::quantize16(x, lo[0], scale[0], max_q));
+            __m512i sy = avml_impl::spread_bits30x16(avml_impl::quantize16(y, lo[1], scale[1], max_q));
+            __m512i sz = avml_impl::spread_bits30x16(avml_impl::quantize16(z, lo[2], scale[2], max_q));
+
+            __m512i code = _mm512_ternarylogic_epi32(
+                _mm512_slli_epi32(sx, 2),
+                _mm512_slli_epi32(sy, 1),
+                sz,
+                avml_impl::ternary_or_or
+            );
+            _mm512_storeu_si512(out + i, code);
+        }
+
+        #elif defined(AVML_AVX2)
+        const float* src = reinterpret_cast<const float*>(in);
+        for (; i + 8 <= n; i += 8) {
+            __m256 x, y, z;
+            avml_impl::load3x8f(src + 3 * i, x, y, z);
+
+            __m256i sx = avml_impl::spread_bits30x8(avml_impl::quantize8(x, lo[0], scale[0], max_q));
+            __m256i sy = avml_impl::spread_bits30x8(avml_impl::quantize8(y, lo[1], scale[1], max_q));
+            __m256i sz = avml_impl::spread_bits30x8(avml_impl::quantize8(z, lo[2], scale[2], max_q));
+
+            __m256i code = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(sx, 2), _mm256_slli_epi32(sy, 1)), sz);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), code);
+        }
+
+        #endif
+        for (; i < n; ++i) {
+            out[i] = morton_encode30(avml_impl::quantize3(in[i], lo, scale, max_q));
+        }
+    }
+
+    inline void morton_codes63(const aabb3f& bounds, const vec3f* in, std::uint64_t* out, std::size_t n) {
+        AVML_PROFILE_BATCH("morton_codes63[batch]", n);
+
+        const float max_q = 2097151.0f;
+        const vec3f lo = bounds.minimum();
+        const vec3f scale = avml_impl::quantization_scale(bounds, 21);
+
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        const float* src = reinterpret_cast<const float*>(in);
+        for (; i + 8 <= n; i += 8) {
+            __m256 x, y, z;
+            avml_impl::load3x8f(src + 3 * i, x, y, z);
+
+            __m512i sx = avml_impl::spread_bits63x8(_mm512_cvtepu32_epi64(avml_impl::quantize8(x, lo[0], scale[0], max_q)));
+            __m512i sy = avml_impl::spread_bits63x8(_mm512_cvtepu32_epi64(avml_impl::quantize8(y, lo[1], scale[1], max_q)));
+            __m512i sz = avml_impl::spread_bits63x8(_mm512_cvtepu32_epi64(avml_impl::quantize8(z, lo[2], scale[2], max_q)));
+
+            __m512i code = _mm512_ternarylogic_epi64(
+                _mm512_slli_epi64(sx, 2),
+                _mm512_slli_epi64(sy, 1),
+                sz,
+                avml_impl::ternary_or_or
+            );
+            _mm512_storeu_si512(out + i, code);
+        }
+
+        #elif defined(AVML_AVX2)
+        const float* src = reinterpret_cast<const float*>(in);
+        for (; i + 8 <= n; i += 8) {
+            __m256 x, y, z;
+            avml_impl::load3x8f(src + 3 * i, x, y, z);
+
+            __m256i qx = avml_impl::quantize8(x, lo[0], scale[0], max_q);
+            __m256i qy = avml_impl::quantize8(y, lo[1], scale[1], max_q);
+            __m256i qz = avml_impl::quantize8(z, lo[2], scale[2], max_q);
+
+            __m256i code0 = avml_impl::interleave63x4(
+                _mm256_castsi256_si128(qx),
+                _mm256_castsi256_si128(qy),
+                _mm256_castsi256_si128(qz)
+            );
+            __m256i code1 = avml_impl::interleave63x4(
+                _mm256_extracti128_si256(qx, 1),
+                _mm256_extracti128_si256(qy, 1),
+                _mm256_extracti128_si256(qz, 1)
+            );
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i + 0), code0);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i + 4), code1);
+        }
+
+        #endif
+        for (; i < n; ++i) {
+            out[i] = morton_encode63(avml_impl::quantize3(in[i], lo, scale, max_q));
+        }
+    }
+
+    inline void hilbert_codes30(const aabb3f& bounds, const vec3f* in, std::uint32_t* out, std::size_t n) {
+        AVML_PROFILE_BATCH("hilbert_codes30[batch]", n);
+
+        const float max_q = 1023.0f;
+        const vec3f lo = bounds.minimum();
+        const vec3f scale = avml_impl::quantization_scale(bounds, 10);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = hilbert_encode30(avml_impl::quantize3(in[i], lo, scale, max_q));
+        }
+    }
+
+    inline void hilbert_codes63(const aabb3f& bounds, const vec3f* in, std::uint64_t* out, std::size_t n) {
+        AVML_PROFILE_BATCH("hilbert_codes63[batch]", n);
+
+        const float max_q = 2097151.0f;
+        const vec3f lo = bounds.minimum();
+        const vec3f scale = avml_impl::quantization_scale(bounds, 21);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = hilbert_encode63(avml_impl::quantize3(in[i], lo, scale, max_q));
+        }
+    }
+
+    //=====================================================
+    // Parallel batch codes
+    //=====================================================
+
+    inline void morton_codes30(const aabb3f& bounds, const vec3f* in, std::uint32_t* out, std::size_t n, Executor& executor) {
+        executor.parallel_for(n, default_grain<vec3f, std::uint32_t>(), [&](std::size_t begin, std::size_t end) {
+            morton_codes30(bounds, in + begin, out + begin, end - begin);
+        });
+    }
+
+    inline void morton_codes63(const aabb3f& bounds, const vec3f* in, std::uint64_t* out, std::size_t n, Executor& executor) {
+        executor.parallel_for(n, default_grain<vec3f, std::uint64_t>(), [&](std::size_t begin, std::size_t end) {
+            morton_codes63(bounds, in + begin, out + begin, end - begin);
+        });
+    }
+
+    inline void hilbert_codes30(const aabb3f& bounds, const vec3f* in, std::uint32_t* out, std::size_t n, Executor& executor) {
+        executor.parallel_for(n, default_grain<vec3f, std::uint32_t>(), [&](std::size_t begin, std::size_t end) {
+            hilbert_codes30(bounds, in + begin, out + begin, end - begin);
+        });
+    }
+
+    inline void hilbert_codes63(const aabb3f& bounds, const vec3f* in, std::uint64_t* out, std::size_t n, Executor& executor) {
+        executor.parallel_for(n, default_grain<vec3f, std::uint64_t>(), [&](std::size_t begin, std::size_t end) {
+            hilbert_codes63(bounds, in + begin, out + begin, end - begin);
+        });
+    }
+
+    //=====================================================
+    // Sorting
+    //=====================================================
+
+    inline void radix_sort(std::uint32_t* keys, std::uint32_t* values, std::size_t n) {
+        AVML_PROFILE_BATCH("radix_sort(uint32)", n);
+
+        avml_impl::radix_sort(keys, values, n);
+    }
+
+    inline void radix_sort(std::uint64_t* keys, std::uint32_t* values, std::size_t n) {
+        AVML_PROFILE_BATCH("radix_sort(uint64)", n);
+
+        avml_impl::radix_sort(keys, values, n);
+    }
+
+}
+
+#endif
@@ -0,0 +1,543 @@
+#ifndef AVML_STREAMING_IPP
+#define AVML_STREAMING_IPP
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define AVML_POSIX_MMAP
+
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace avml {
+
+    //=====================================================
+    // Mapped_file
+    //=====================================================
+
+    inline Mapped_file Mapped_file::open_read(const char* path) {
+        Mapped_file ret;
+
+        #if defined(AVML_POSIX_MMAP)
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) {
+            return ret;
+        }
+
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            return ret;
+        }
+
+        std::size_t length = static_cast<std::size_t>(info.st_size);
+        if (length != 0) {
+            void* p = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                ::close(fd);
+                return ret;
+            }
+
+            ::madvise(p, length, MADV_SEQUENTIAL);
+            ret.ptr = p;
+        }
+
+        ::close(fd);
+        ret.length = length;
+        ret.open = true;
+        #endif
+
+        return ret;
+    }
+
+    inline Mapped_file Mapped_file::create(const char* path, std::size_t size) {
+        Mapped_file ret;
+
+        #if defined(AVML_POSIX_MMAP)
+        int fd = ::open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+            return ret;
+        }
+
+        if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            ::close(fd);
+            return ret;
+        }
+
+        if (size != 0) {
+            void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (p == MAP_FAILED) {
+                ::close(fd);
+                return ret;
+            }
+
+            ::madvise(p, size, MADV_SEQUENTIAL);
+            ret.ptr = p;
+        }
+
+        ::close(fd);
+        ret.length = size;
+        ret.open = true;
+        #endif
+
+        return ret;
+    }
+
+    inline Mapped_file::Mapped_file(Mapped_file&& other) noexcept:
+        ptr(other.ptr),
+        length(other.length),
+        open(other.open) {
+
+        other.ptr = nullptr;
+        other.length = 0;
+        other.open = false;
+    }
+
+    inline Mapped_file::~Mapped_file() {
+        close();
+    }
+
+    inline Mapped_file& Mapped_file::operator=(Mapped_file&& other) noexcept {
+        if (this != &other) {
+            close();
+            std::swap(ptr, other.ptr);
+            std::swap(length, other.length);
+            std::swap(open, other.open);
+        }
+        return *this;
+    }
+
+    inline bool Mapped_file::is_open() const {
+        return open;
+    }
+
+    inline Mapped_file::operator bool() const {
+        return open;
+    }
+
+    inline void* Mapped_file::data() {
+        return ptr;
+    }
+
+    inline const void* Mapped_file::data() const {
+        return ptr;
+    }
+
+    inline std::size_t Mapped_file::size() const {
+        return length;
+    }
+
+    inline void Mapped_file::close() {
+        #if defined(AVML_POSIX_MMAP)
+        if (ptr) {
+            ::munmap(ptr, length);
+        }
+        #endif
+
+        ptr = nullptr;
+        length = 0;
+        open = false;
+    }
+
+}
+
+namespace avml_impl {
+
+    //=====================================================
+    // Stream helpers
+    //=====================================================
+
+    AVML_FINL bool is_aligned(const void* p, std::size_t alignment) {
+        return (reinterpret_cast<std::uintptr_t>(p) % alignment) == 0;
+    }
+
+    template<class R>
+    AVML_FINL avml::Vector3R<R> stream_point(const avml::Matrix4x4R<R>& m, const R* in, R* out) {
+        avml::Vector3R<R> p = transform_point(m, avml::Vector3R<R>::read(in));
+        out[0] = p[0];
+        out[1] = p[1];
+        out[2] = p[2];
+        return p;
+    }
+
+    template<class R>
+    AVML_FINL avml::Vector3R<R> quantization_scale(const avml::Aabb3R<R>& box) {
+        avml::Vector3R<R> e = extent(box);
+        return avml::Vector3R<R>{
+            (e[0] > R(0)) ? R(65535) / e[0] : R(0),
+            (e[1] > R(0)) ? R(65535) / e[1] : R(0),
+            (e[2] > R(0)) ? R(65535) / e[2] : R(0)
+        };
+    }
+
+    ///
+    /// NaN coordinates fail the first comparison and quantize to zero as in
+    /// the SIMD loop, where max returns its second operand
+    ///
+    template<class R>
+    AVML_FINL void quantize_point(avml::Vector3R<R> lo, avml::Vector3R<R> scale, const R* in, std::uint16_t* out) {
+        for (unsigned i = 0; i < 3; ++i) {
+            R t = (in[i] - lo[i]) * scale[i];
+            t = (t > R(0)) ? t : R(0);
+            t = (t < R(65535)) ? t : R(65535);
+            out[i] = static_cast<std::uint16_t>(std::nearbyint(t));
+        }
+    }
+
+    ///
+    /// Number of points per chunk when a stream is split across an executor
+    ///
+    template<class R>
+    constexpr std::size_t stream_grain() {
+        return avml::default_grain<R[3]>();
+    }
+
+}
+
+namespace avml {
+
+    //=====================================================
+    // Array streams
+    //=====================================================
+
+    inline aabb3f stream_transform(const mat4x4f& m, const float* in, float* out, std::size_t n) {
+        AVML_PROFILE_BATCH("stream_transform[float]", n);
+
+        aabb3f ret = aabb3f::empty();
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        for (; i < n && i < 16 && !avml_impl::is_aligned(out + 3 * i, 64); ++i) {
+            ret = extend(ret, avml_impl::stream_point(m, in + 3 * i, out + 3 * i));
+        }
+
+        if (i + 16 <= n) {
+            const bool aligned = avml_impl::is_aligned(out + 3 * i, 64);
+            const avml_impl::Affine16f a = avml_impl::broadcast_affine16f(m);
+            avml_impl::Bounds16f b = avml_impl::empty_bounds16f();
+
+            for (; i + 16 <= n; i += 16) {
+                __m512 x, y, z;
+                avml_impl::load3x16f(in + 3 * i, x, y, z);
+                avml_impl::transform3x16f(a, x, y, z);
+                avml_impl::extend16f(b, x, y, z);
+
+                if (aligned) {
+                    avml_impl::stream3x16f(out + 3 * i, x, y, z);
+                } else {
+                    avml_impl::store3x16f(out + 3 * i, x, y, z);
+                }
+            }
+
+            _mm_sfence();
+            ret = merge(ret, avml_impl::reduce_bounds16f(b));
+        }
+
+        #elif defined(AVML_AVX)
+        for (; i < n && i < 8 && !avml_impl::is_aligned(out + 3 * i, 32); ++i) {
+            ret = extend(ret, avml_impl::stream_point(m, in + 3 * i, out + 3 * i));
+        }
+
+        if (i + 8 <= n) {
+            const bool aligned = avml_impl::is_aligned(out + 3 * i, 32);
+            const avml_impl::Affine8f a = avml_impl::broadcast_affine8f(m);
+            avml_impl::Bounds8f b = avml_impl::empty_bounds8f();
+
+            for (; i + 8 <= n; i += 8) {
+                __m256 x, y, z;
+                avml_impl::load3x8f(in + 3 * i, x, y, z);
+                avml_impl::transform3x8f(a, x, y, z);
+                avml_impl::extend8f(b, x, y, z);
+
+                if (aligned) {
+                    avml_impl::stream3x8f(out + 3 * i, x, y, z);
+                } else {
+                    avml_impl::store3x8f(out + 3 * i, x, y, z);
+                }
+            }
+
+            _mm_sfence();
+            ret = merge(ret, avml_impl::reduce_bounds8f(b));
+        }
+
+        #endif
+        for (; i < n; ++i) {
+            ret = extend(ret, avml_impl::stream_point(m, in + 3 * i, out + 3 * i));
+        }
+
+        return ret;
+    }
+
+    inline aabb3d stream_transform(const mat4x4d& m, const double* in, double* out, std::size_t n) {
+        AVML_PROFILE_BATCH("stream_transform[double]", n);
+
+        aabb3d ret = aabb3d::empty();
+        std::size_t i = 0;
+
+        #if defined(AVML_SSE2)
+        // Two points span three 16-byte blocks
+        if (i < n && !avml_impl::is_aligned(out, 16)) {
+            ret = extend(ret, avml_impl::stream_point(m, in, out));
+            ++i;
+        }
+
+        if (avml_impl::is_aligned(out + 3 * i, 16)) {
+            for (; i + 2 <= n; i += 2) {
+                vec3d p = avml_impl::transform_point(m, vec3d::read(in + 3 * i + 0));
+                vec3d q = avml_impl::transform_point(m, vec3d::read(in + 3 * i + 3));
+                ret = extend(extend(ret, p), q);
+
+                double* dst = out + 3 * i;
+                _mm_stream_pd(dst + 0, _mm_setr_pd(p[0], p[1]));
+                _mm_stream_pd(dst + 2, _mm_setr_pd(p[2], q[0]));
+                _mm_stream_pd(dst + 4, _mm_setr_pd(q[1], q[2]));
+            }
+
+            _mm_sfence();
+        }
+
+        #endif
+        for (; i < n; ++i) {
+            ret = extend(ret, avml_impl::stream_point(m, in + 3 * i, out + 3 * i));
+        }
+
+        return ret;
+    }
+
+    inline void stream_quantize(const aabb3f& box, const float* in, std::uint16_t* out, std::size_t n) {
+        AVML_PROFILE_BATCH("stream_quantize[float]", n);
+
+        const vec3f lo = box.minimum();
+        const vec3f scale = avml_impl::quantization_scale(box);
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX2)
+        for (; i < n && i < 8 && !avml_impl::is_aligned(out + 3 * i, 16); ++i) {
+            avml_impl::quantize_point(lo, scale, in + 3 * i, out + 3 * i);
+        }
+
+        if (i + 8 <= n) {
+            const bool aligned = avml_impl::is_aligned(out + 3 * i, 16);
+
+            const __m256 lo_x = _mm256_set1_ps(lo[0]);
+            const __m256 lo_y = _mm256_set1_ps(lo[1]);
+            const __m256 lo_z = _mm256_set1_ps(lo[2]);
+
+            const __m256 scale_x = _mm256_set1_ps(scale[0]);
+            const __m256 scale_y = _mm256_set1_ps(scale[1]);
+            const __m256 scale_z = _mm256_set1_ps(scale[2]);
+
+            const __m256 zero = _mm256_setzero_ps();
+            const __m256 top = _mm256_set1_ps(65535.0f);
+
+            for (; i + 8 <= n; i += 8) {
+                __m256 x, y, z;
+                avml_impl::load3x8f(in + 3 * i, x, y, z);
+
+                x = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_sub_ps(x, lo_x), scale_x), zero), top);
+                y = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_sub_ps(y, lo_y), scale_y), zero), top);
+                z = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_sub_ps(z, lo_z), scale_z), zero), top);
+
+                __m256 a, b, c;
+                avml_impl::interleave3x8f(x, y, z, a, b, c);
+
+                // packus operates within 128-bit lanes so the 64-bit
+                // quarters are put back in order afterwards
+                __m256i ab = _mm256_packus_epi32(_mm256_cvtps_epi32(a), _mm256_cvtps_epi32(b));
+                __m256i cc = _mm256_packus_epi32(_mm256_cvtps_epi32(c), _mm256_cvtps_epi32(c));
+                ab = _mm256_permute4x64_epi64(ab, _MM_SHUFFLE(3, 1, 2, 0));
+                cc = _mm256_permute4x64_epi64(cc, _MM_SHUFFLE(3, 1, 2, 0));
+
+                __m128i* dst = reinterpret_cast<__m128i*>(out + 3 * i);
+                if (aligned) {
+                    _mm_stream_si128(dst + 0, _mm256_castsi256_si128(ab));
+                    _mm_stream_si128(dst + 1, _mm256_extracti128_si256(ab, 1));
+                    _mm_stream_si128(dst + 2, _mm256_castsi256_si128(cc));
+                } else {
+                    _mm_storeu_si128(dst + 0, _mm256_castsi256_si128(ab));
+                    _mm_storeu_si128(dst + 1, _mm256_extracti128_si256(ab, 1));
+                    _mm_storeu_si128(dst + 2, _mm256_castsi256_si128(cc));
+                }
+            }
+
+            _mm_sfence();
+        }
+
+        #endif
+        for (; i < n; ++i) {
+            avml_impl::quantize_point(lo, scale, in + 3 * i, out + 3 * i);
+        }
+    }
+
+    inline void stream_quantize(const aabb3d& box, const double* in, std::uint16_t* out, std::size_t n) {
+        AVML_PROFILE_BATCH("stream_quantize[double]", n);
+
+        const vec3d lo = box.minimum();
+        const vec3d scale = avml_impl::quantization_scale(box);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            avml_impl::quantize_point(lo, scale, in + 3 * i, out + 3 * i);
+        }
+    }
+
+    inline vec3f dequantize(const aabb3f& box, const std::uint16_t* q) {
+        vec3f step = extent(box) / 65535.0f;
+        return box.minimum() + vec3f{float(q[0]), float(q[1]), float(q[2])} * step;
+    }
+
+    inline vec3d dequantize(const aabb3d& box, const std::uint16_t* q) {
+        vec3d step = extent(box) / 65535.0;
+        return box.minimum() + vec3d{double(q[0]), double(q[1]), double(q[2])} * step;
+    }
+
+    //=====================================================
+    // Parallel array streams
+    //=====================================================
+
+    inline aabb3f stream_transform(const mat4x4f& m, const float* in, float* out, std::size_t n, Executor& executor) {
+        const std::size_t grain = avml_impl::stream_grain<float>();
+        std::vector<aabb3f> partial((n + grain - 1) / grain, aabb3f::empty());
+
+        executor.parallel_for(n, grain, [&](std::size_t begin, std::size_t end) {
+            partial[begin / grain] = stream_transform(m, in + 3 * begin, out + 3 * begin, end - begin);
+        });
+
+        aabb3f ret = aabb3f::empty();
+        for (const aabb3f& b : partial) {
+            ret = merge(ret, b);
+        }
+        return ret;
+    }
+
+    inline aabb3d stream_transform(const mat4x4d& m, const double* in, double* out, std::size_t n, Executor& executor) {
+        const std::size_t grain = avml_impl::stream_grain<double>();
+        std::vector<aabb3d> partial((n + grain - 1) / grain, aabb3d::empty());
+
+        executor.parallel_for(n, grain, [&](std::size_t begin, std::size_t end) {
+            partial[begin / grain] = stream_transform(m, in + 3 * begin, out + 3 * begin, end - begin);
+        });
+
+        aabb3d ret = aabb3d::empty();
+        for (const aabb3d& b : partial) {
+            ret = merge(ret, b);
+        }
+        return ret;
+    }
+
+    inline void stream_quantize(const aabb3f& box, const float* in, std::uint16_t* out, std::size_t n, Executor& executor) {
+        executor.parallel_for(n, avml_impl::stream_grain<float>(), [&](std::size_t begin, std::size_t end) {
+            stream_quantize(box, in + 3 * begin, out + 3 * begin, end - begin);
+        });
+    }
+
+    inline void stream_quantize(const aabb3d& box, const double* in, std::uint16_t* out, std::size_t n, Executor& executor) {
+        executor.parallel_for(n, avml_impl::stream_grain<double>(), [&](std::size_t begin, std::size_t end) {
+            stream_quantize(box, in + 3 * begin, out + 3 * begin, end - begin);
+        });
+    }
+
+}
+
+namespace avml_impl {
+
+    template<class R, class M, class B>
+    inline bool transform_file(const char* in_path, const char* out_path, const M& m, avml::Executor& executor, B* bounds) {
+        avml::Mapped_file in = avml::Mapped_file::open_read(in_path);
+        if (!in || (in.size() % (3 * sizeof(R))) != 0) {
+            return false;
+        }
+
+        avml::Mapped_file out = avml::Mapped_file::create(out_path, in.size());
+        if (!out) {
+            return false;
+        }
+
+        B b = avml::stream_transform(
+            m,
+            static_cast<const R*>(in.data()),
+            static_cast<R*>(out.data()),
+            in.size() / (3 * sizeof(R)),
+            executor
+        );
+
+        if (bounds) {
+            *bounds = b;
+        }
+        return true;
+    }
+
+    template<class R, class B>
+    inline bool quantize_file(const char* in_path, const char* out_path, const B& box, avml::Executor& executor) {
+        avml::Mapped_file in = avml::Mapped_file::open_read(in_path);
+        if (!in || (in.size() % (3 * sizeof(R))) != 0) {
+            return false;
+        }
+
+        std::size_t n = in.size() / (3 * sizeof(R));
+        avml::Mapped_file out = avml::Mapped_file::create(out_path, n * 3 * sizeof(std::uint16_t));
+        if (!out) {
+            return false;
+        }
+
+        avml::stream_quantize(
+            box,
+            static_cast<const R*>(in.data()),
+            static_cast<std::uint16_t*>(out.data()),
+            n,
+            executor
+        );
+        return true;
+    }
+
+}
+
+namespace avml {
+
+    //=====================================================
+    // File streams
+    //=====================================================
+
+    inline bool transform_file(const char* in_path, const char* out_path, const mat4x4f& m, aabb3f* bounds) {
+        Serial_executor executor{};
+        return avml_impl::transform_file<float>(in_path, out_path, m, executor, bounds);
+    }
+
+    inline bool transform_file(const char* in_path, const char* out_path, const mat4x4f& m, Executor& executor, aabb3f* bounds) {
+        return avml_impl::transform_file<float>(in_path, out_path, m, executor, bounds);
+    }
+
+    inline bool transform_file(const char* in_path, const char* out_path, const mat4x4d& m, aabb3d* bounds) {
+        Serial_executor executor{};
+        return avml_impl::transform_file<double>(in_path, out_path, m, executor, bounds);
+    }
+
+    inline bool transform_file(const char* in_path, const char* out_path, const mat4x4d& m, Executor& executor, aabb3d* bounds) {
+        return avml_impl::transform_file<double>(in_path, out_path, m, executor, bounds);
+    }
+
+    inline bool quantize_file(const char* in_path, const char* out_path, const aabb3f& box) {
+        Serial_executor executor{};
+        return avml_impl::quantize_file<float>(in_path, out_path, box, executor);
+    }
+
+    inline bool quantize_file(const char* in_path, const char* out_path, const aabb3f& box, Executor& executor) {
+        return avml_impl::quantize_file<float>(in_path, out_path, box, executor);
+    }
+
+    inline bool quantize_file(const char* in_path, const char* out_path, const aabb3d& box) {
+        Serial_executor executor{};
+        return avml_impl::quantize_file<double>(in_path, out_path, box, executor);
+    }
+
+    inline bool quantize_file(const char* in_path, const char* out_path, const aabb3d& box, Executor& executor) {
+        return avml_impl::quantize_file<double>(in_path, out_path, box, executor);
+    }
+
+}
+
+#endif
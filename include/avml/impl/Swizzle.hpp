@@ -0,0 +1,185 @@
+#ifndef AVML_SWIZZLE_HPP
+#define AVML_SWIZZLE_HPP
+
+#include "Capabilities.hpp"
+#include "Shared.hpp"
+
+namespace avml_impl {
+
+    //=====================================================
+    // Result types
+    //=====================================================
+
+    template<class V, unsigned N>
+    struct Swizzle_result;
+
+    template<class R>
+    struct Swizzle_result<avml::Vector2R<R>, 2> { using type = avml::Vector2R<R>; };
+    template<class R>
+    struct Swizzle_result<avml::Vector2R<R>, 3> { using type = avml::Vector3R<R>; };
+    template<class R>
+    struct Swizzle_result<avml::Vector2R<R>, 4> { using type = avml::Vector4R<R>; };
+
+    template<class R>
+    struct Swizzle_result<avml::Vector3R<R>, 2> { using type = avml::Vector2R<R>; };
+    template<class R>
+    struct Swizzle_result<avml::Vector3R<R>, 3> { using type = avml::Vector3R<R>; };
+    template<class R>
+    struct Swizzle_result<avml::Vector3R<R>, 4> { using type = avml::Vector4R<R>; };
+
+    template<class R>
+    struct Swizzle_result<avml::Vector4R<R>, 2> { using type = avml::Vector2R<R>; };
+    template<class R>
+    struct Swizzle_result<avml::Vector4R<R>, 3> { using type = avml::Vector3R<R>; };
+    template<class R>
+    struct Swizzle_result<avml::Vector4R<R>, 4> { using type = avml::Vector4R<R>; };
+
+    template<class I>
+    struct Swizzle_result<avml::Vector2I<I>, 2> { using type = avml::Vector2I<I>; };
+    template<class I>
+    struct Swizzle_result<avml::Vector2I<I>, 3> { using type = avml::Vector3I<I>; };
+    template<class I>
+    struct Swizzle_result<avml::Vector2I<I>, 4> { using type = avml::Vector4I<I>; };
+
+    template<class I>
+    struct Swizzle_result<avml::Vector3I<I>, 2> { using type = avml::Vector2I<I>; };
+    template<class I>
+    struct Swizzle_result<avml::Vector3I<I>, 3> { using type = avml::Vector3I<I>; };
+    template<class I>
+    struct Swizzle_result<avml::Vector3I<I>, 4> { using type = avml::Vector4I<I>; };
+
+    template<class I>
+    struct Swizzle_result<avml::Vector4I<I>, 2> { using type = avml::Vector2I<I>; };
+    template<class I>
+    struct Swizzle_result<avml::Vector4I<I>, 3> { using type = avml::Vector3I<I>; };
+    template<class I>
+    struct Swizzle_result<avml::Vector4I<I>, 4> { using type = avml::Vector4I<I>; };
+
+    AVML_FINL constexpr bool indices_within(unsigned) {
+        return true;
+    }
+
+    template<class... Rest>
+    AVML_FINL constexpr bool indices_within(unsigned width, unsigned i, Rest... rest) {
+        return i < width && indices_within(width, rest...);
+    }
+
+    //=====================================================
+    // Component loads
+    //=====================================================
+
+    #if defined(AVML_SSE2)
+
+    template<unsigned N>
+    struct Float_components;
+
+    template<>
+    struct Float_components<2> {
+        AVML_FINL static Register4f load(const float* p) { return load2f(p); }
+        AVML_FINL static void store(float* p, Register4f r) { store2f(p, r); }
+    };
+
+    template<>
+    struct Float_components<3> {
+        AVML_FINL static Register4f load(const float* p) { return load3f(p); }
+        AVML_FINL static void store(float* p, Register4f r) { store3f(p, r); }
+    };
+
+    template<>
+    struct Float_components<4> {
+        AVML_FINL static Register4f load(const float* p) { return load4f(p); }
+        AVML_FINL static void store(float* p, Register4f r) { store4f(p, r); }
+    };
+
+    ///
+    /// Loads the components of a float vector into the low lanes of a
+    /// register. Lanes past the vector's width are zero.
+    ///
+    template<template<class> class V>
+    AVML_FINL Register4f load_components(const V<float>& v) {
+        return Float_components<V<float>::width>::load(v.data());
+    }
+
+    template<template<class> class V>
+    AVML_FINL void store_components(V<float>& v, Register4f r) {
+        Float_components<V<float>::width>::store(v.data(), r);
+    }
+
+    #endif
+
+    #if defined(AVML_SSE2)
+
+    /// Immediate for _mm_shuffle_ps/_mm_permute_ps selecting lanes x, y, z, w
+    AVML_FINL constexpr int shuffle_mask(unsigned x, unsigned y, unsigned z = 0, unsigned w = 0) {
+        return static_cast<int>(x | (y << 2) | (z << 4) | (w << 6));
+    }
+
+    template<int Mask>
+    AVML_FINL __m128 permute(__m128 r) {
+        #if defined(AVML_AVX)
+        return _mm_permute_ps(r, Mask);
+        #else
+        return _mm_shuffle_ps(r, r, Mask);
+        #endif
+    }
+
+    #endif
+
+    //=====================================================
+    // Swizzlers
+    //=====================================================
+
+    template<class V, unsigned... I>
+    struct Swizzler {
+        using result = typename Swizzle_result<V, sizeof...(I)>::type;
+
+        AVML_FINL static result apply(const V& v) {
+            return result{v[I]...};
+        }
+    };
+
+    #if defined(AVML_SSE2)
+
+    template<template<class> class V, unsigned... I>
+    struct Float_swizzler {
+        using result = typename Swizzle_result<V<float>, sizeof...(I)>::type;
+
+        AVML_FINL static result apply(const V<float>& v) {
+            result ret;
+            store_components(ret, permute<shuffle_mask(I...)>(load_components(v)));
+            return ret;
+        }
+    };
+
+    template<unsigned... I>
+    struct Swizzler<avml::Vector2R<float>, I...> : Float_swizzler<avml::Vector2R, I...> {};
+
+    template<unsigned... I>
+    struct Swizzler<avml::Vector3R<float>, I...> : Float_swizzler<avml::Vector3R, I...> {};
+
+    template<unsigned... I>
+    struct Swizzler<avml::Vector4R<float>, I...> : Float_swizzler<avml::Vector4R, I...> {};
+
+    #endif
+
+}
+
+namespace avml {
+
+    ///
+    /// Builds a vector from the components of v selected by the indices I,
+    /// e.g. swizzle<3, 2, 1, 0>(v) reverses a four component vector. The
+    /// result has as many components as there are indices.
+    ///
+    /// For float vectors the shuffle immediate is computed at compile time so
+    /// the permutation is a single shuffle instruction.
+    ///
+    template<unsigned... I, class V>
+    AVML_FINL typename avml_impl::Swizzle_result<V, sizeof...(I)>::type swizzle(V v) {
+        static_assert(avml_impl::indices_within(V::width, I...), "Swizzle index out of range.");
+        return avml_impl::Swizzler<V, I...>::apply(v);
+    }
+
+}
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef AVML_AFFINE3X4F_IPP
+#define AVML_AFFINE3X4F_IPP
+
+namespace avml {
+
+#if defined(AVML_SSE)
+
+    AVML_FINL Affine3x4R<float> operator*(const Affine3x4R<float>& lhs, const Affine3x4R<float>& rhs) {
+        __m128 b0 = _mm_loadu_ps(rhs.data() + 0x0);
+        __m128 b1 = _mm_loadu_ps(rhs.data() + 0x4);
+        __m128 b2 = _mm_loadu_ps(rhs.data() + 0x8);
+
+        // Translation column of lhs is carried through by the implicit
+        // {0, 0, 0, 1} row of rhs
+        const __m128 w_mask = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+
+        Affine3x4R<float> ret;
+        for (unsigned i = 0; i < Affine3x4R<float>::height; ++i) {
+            __m128 a = _mm_loadu_ps(lhs.data() + 4 * i);
+
+            __m128 r = _mm_and_ps(a, w_mask);
+            r = avml_impl::fmadd4f(_mm_shuffle_ps(a, a, 0x00), b0, r);
+            r = avml_impl::fmadd4f(_mm_shuffle_ps(a, a, 0x55), b1, r);
+            r = avml_impl::fmadd4f(_mm_shuffle_ps(a, a, 0xAA), b2, r);
+
+            _mm_storeu_ps(ret.data() + 4 * i, r);
+        }
+
+        return ret;
+    }
+
+    AVML_FINL Affine3x4R<float> rigid_inverse(const Affine3x4R<float>& a) {
+        AVML_PROFILE("rigid_inverse(Affine3x4R)");
+
+        const __m128 xyz_mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+
+        __m128 r0 = _mm_loadu_ps(a.data() + 0x0);
+        __m128 r1 = _mm_loadu_ps(a.data() + 0x4);
+        __m128 r2 = _mm_loadu_ps(a.data() + 0x8);
+
+        // -R^T * t, built from the rows of R scaled by the components of t
+        __m128 t = _mm_mul_ps(_mm_shuffle_ps(r0, r0, 0xFF), r0);
+        t = avml_impl::fmadd4f(_mm_shuffle_ps(r1, r1, 0xFF), r1, t);
+        t = avml_impl::fmadd4f(_mm_shuffle_ps(r2, r2, 0xFF), r2, t);
+        t = _mm_sub_ps(_mm_setzero_ps(), t);
+
+        r0 = _mm_and_ps(r0, xyz_mask);
+        r1 = _mm_and_ps(r1, xyz_mask);
+        r2 = _mm_and_ps(r2, xyz_mask);
+
+        // Transposing places R^T in the top three rows and -R^T * t in the
+        // last column
+        _MM_TRANSPOSE4_PS(r0, r1, r2, t);
+
+        Affine3x4R<float> ret;
+        _mm_storeu_ps(ret.data() + 0x0, r0);
+        _mm_storeu_ps(ret.data() + 0x4, r1);
+        _mm_storeu_ps(ret.data() + 0x8, r2);
+        return ret;
+    }
+
+#endif
+
+}
+
+#endif
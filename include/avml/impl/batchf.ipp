@@ -0,0 +1,695 @@
+#ifndef AVML_BATCHF_IPP
+#define AVML_BATCHF_IPP
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "Lanes.hpp"
+
+namespace avml_impl {
+
+    //=====================================================
+    // Kernel helpers
+    //=====================================================
+
+#if defined(AVML_AVX512F)
+
+    ///
+    /// Upper three rows of an affine matrix with each element broadcast
+    ///
+    struct Affine16f {
+        __m512 m[3][4];
+    };
+
+    struct Bounds16f {
+        __m512 lo[3];
+        __m512 hi[3];
+    };
+
+    AVML_FINL Affine16f broadcast_affine16f(const avml::mat4x4f& m) {
+        Affine16f ret;
+        for (unsigned i = 0; i < 3; ++i) {
+            for (unsigned j = 0; j < 4; ++j) {
+                ret.m[i][j] = _mm512_set1_ps(m[i][j]);
+            }
+        }
+        return ret;
+    }
+
+    AVML_FINL void transform3x16f(const Affine16f& a, __m512& x, __m512& y, __m512& z) {
+        __m512 tx = _mm512_fmadd_ps(a.m[0][2], z, _mm512_fmadd_ps(a.m[0][1], y, _mm512_fmadd_ps(a.m[0][0], x, a.m[0][3])));
+        __m512 ty = _mm512_fmadd_ps(a.m[1][2], z, _mm512_fmadd_ps(a.m[1][1], y, _mm512_fmadd_ps(a.m[1][0], x, a.m[1][3])));
+        __m512 tz = _mm512_fmadd_ps(a.m[2][2], z, _mm512_fmadd_ps(a.m[2][1], y, _mm512_fmadd_ps(a.m[2][0], x, a.m[2][3])));
+        x = tx;
+        y = ty;
+        z = tz;
+    }
+
+    AVML_FINL Bounds16f empty_bounds16f() {
+        const __m512 inf = _mm512_set1_ps(std::numeric_limits<float>::infinity());
+        const __m512 ninf = _mm512_set1_ps(-std::numeric_limits<float>::infinity());
+        return Bounds16f{{inf, inf, inf}, {ninf, ninf, ninf}};
+    }
+
+    AVML_FINL Bounds16f bounds16f(__m512 x, __m512 y, __m512 z) {
+        return Bounds16f{{x, y, z}, {x, y, z}};
+    }
+
+    AVML_FINL void extend16f(Bounds16f& b, __m512 x, __m512 y, __m512 z) {
+        b.lo[0] = _mm512_min_ps(b.lo[0], x);
+        b.lo[1] = _mm512_min_ps(b.lo[1], y);
+        b.lo[2] = _mm512_min_ps(b.lo[2], z);
+
+        b.hi[0] = _mm512_max_ps(b.hi[0], x);
+        b.hi[1] = _mm512_max_ps(b.hi[1], y);
+        b.hi[2] = _mm512_max_ps(b.hi[2], z);
+    }
+
+    AVML_FINL avml::aabb3f reduce_bounds16f(const Bounds16f& b) {
+        return avml::aabb3f{
+            avml::vec3f{_mm512_reduce_min_ps(b.lo[0]), _mm512_reduce_min_ps(b.lo[1]), _mm512_reduce_min_ps(b.lo[2])},
+            avml::vec3f{_mm512_reduce_max_ps(b.hi[0]), _mm512_reduce_max_ps(b.hi[1]), _mm512_reduce_max_ps(b.hi[2])}
+        };
+    }
+
+#elif defined(AVML_AVX)
+
+    ///
+    /// Upper three rows of an affine matrix with each element broadcast
+    ///
+    struct Affine8f {
+        __m256 m[3][4];
+    };
+
+    struct Bounds8f {
+        __m256 lo[3];
+        __m256 hi[3];
+    };
+
+    AVML_FINL Affine8f broadcast_affine8f(const avml::mat4x4f& m) {
+        Affine8f ret;
+        for (unsigned i = 0; i < 3; ++i) {
+            for (unsigned j = 0; j < 4; ++j) {
+                ret.m[i][j] = _mm256_set1_ps(m[i][j]);
+            }
+        }
+        return ret;
+    }
+
+    AVML_FINL void transform3x8f(const Affine8f& a, __m256& x, __m256& y, __m256& z) {
+        __m256 tx = fmadd8f(a.m[0][2], z, fmadd8f(a.m[0][1], y, fmadd8f(a.m[0][0], x, a.m[0][3])));
+        __m256 ty = fmadd8f(a.m[1][2], z, fmadd8f(a.m[1][1], y, fmadd8f(a.m[1][0], x, a.m[1][3])));
+        __m256 tz = fmadd8f(a.m[2][2], z, fmadd8f(a.m[2][1], y, fmadd8f(a.m[2][0], x, a.m[2][3])));
+        x = tx;
+        y = ty;
+        z = tz;
+    }
+
+    AVML_FINL Bounds8f empty_bounds8f() {
+        const __m256 inf = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+        const __m256 ninf = _mm256_set1_ps(-std::numeric_limits<float>::infinity());
+        return Bounds8f{{inf, inf, inf}, {ninf, ninf, ninf}};
+    }
+
+    AVML_FINL Bounds8f bounds8f(__m256 x, __m256 y, __m256 z) {
+        return Bounds8f{{x, y, z}, {x, y, z}};
+    }
+
+    AVML_FINL void extend8f(Bounds8f& b, __m256 x, __m256 y, __m256 z) {
+        b.lo[0] = _mm256_min_ps(b.lo[0], x);
+        b.lo[1] = _mm256_min_ps(b.lo[1], y);
+        b.lo[2] = _mm256_min_ps(b.lo[2], z);
+
+        b.hi[0] = _mm256_max_ps(b.hi[0], x);
+        b.hi[1] = _mm256_max_ps(b.hi[1], y);
+        b.hi[2] = _mm256_max_ps(b.hi[2], z);
+    }
+
+    AVML_FINL avml::aabb3f reduce_bounds8f(const Bounds8f& b) {
+        alignas(32) float lo[3][8];
+        alignas(32) float hi[3][8];
+        for (unsigned i = 0; i < 3; ++i) {
+            _mm256_store_ps(lo[i], b.lo[i]);
+            _mm256_store_ps(hi[i], b.hi[i]);
+        }
+
+        avml::aabb3f ret = avml::aabb3f::empty();
+        for (unsigned j = 0; j < 8; ++j) {
+            ret = merge(ret, avml::aabb3f{
+                avml::vec3f{lo[0][j], lo[1][j], lo[2][j]},
+                avml::vec3f{hi[0][j], hi[1][j], hi[2][j]}
+            });
+        }
+        return ret;
+    }
+
+#endif
+
+    template<class R>
+    AVML_FINL avml::Vector3R<R> transform_point(const avml::Matrix4x4R<R>& m, avml::Vector3R<R> p) {
+        return avml::Vector3R<R>{
+            m[0][0] * p[0] + m[0][1] * p[1] + m[0][2] * p[2] + m[0][3],
+            m[1][0] * p[0] + m[1][1] * p[1] + m[1][2] * p[2] + m[1][3],
+            m[2][0] * p[0] + m[2][1] * p[1] + m[2][2] * p[2] + m[2][3]
+        };
+    }
+
+    //=====================================================
+    // Scalar kernels
+    //=====================================================
+
+    // Loops over the vectors [begin, end) of an array of three-component
+    // vectors. They are the whole of an AVML_SCALAR build and the remainder
+    // of the vector loops. Iterations contain no calls and the matrix is
+    // held in locals, since stores through dst could otherwise alias it,
+    // so compilers can vectorize these at -O3. The square root vectorizes
+    // only with -fno-math-errno.
+
+    AVML_FINL void normalize3xnf(const float* src, float* dst, std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const float x = src[3 * i + 0];
+            const float y = src[3 * i + 1];
+            const float z = src[3 * i + 2];
+
+            const float l = std::sqrt(x * x + y * y + z * z);
+            dst[3 * i + 0] = x / l;
+            dst[3 * i + 1] = y / l;
+            dst[3 * i + 2] = z / l;
+        }
+    }
+
+    AVML_FINL void transform3xnf(const avml::mat4x4f& m, const float* src, float* dst, std::size_t begin, std::size_t end) {
+        const float m00 = m[0][0], m01 = m[0][1], m02 = m[0][2], m03 = m[0][3];
+        const float m10 = m[1][0], m11 = m[1][1], m12 = m[1][2], m13 = m[1][3];
+        const float m20 = m[2][0], m21 = m[2][1], m22 = m[2][2], m23 = m[2][3];
+
+        for (std::size_t i = begin; i < end; ++i) {
+            const float x = src[3 * i + 0];
+            const float y = src[3 * i + 1];
+            const float z = src[3 * i + 2];
+
+            dst[3 * i + 0] = m00 * x + m01 * y + m02 * z + m03;
+            dst[3 * i + 1] = m10 * x + m11 * y + m12 * z + m13;
+            dst[3 * i + 2] = m20 * x + m21 * y + m22 * z + m23;
+        }
+    }
+
+}
+
+namespace avml {
+
+    //=====================================================
+    // Normalization
+    //=====================================================
+
+    inline void normalize(const vec3f* in, uvec3f* out, std::size_t n) {
+        AVML_PROFILE_BATCH("normalize[batch]", n);
+
+        const float* src = reinterpret_cast<const float*>(in);
+        float* dst = reinterpret_cast<float*>(out);
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        for (; i + 16 <= n; i += 16) {
+            __m512 x, y, z;
+            avml_impl::load3x16f(src + 3 * i, x, y, z);
+            avml_impl::normalize3x16f(x, y, z);
+            avml_impl::store3x16f(dst + 3 * i, x, y, z);
+        }
+
+        #elif defined(AVML_AVX)
+        for (; i + 8 <= n; i += 8) {
+            __m256 x, y, z;
+            avml_impl::load3x8f(src + 3 * i, x, y, z);
+            avml_impl::normalize3x8f(x, y, z);
+            avml_impl::store3x8f(dst + 3 * i, x, y, z);
+        }
+
+        #endif
+        avml_impl::normalize3xnf(src, dst, i, n);
+    }
+
+    inline void normalize(const vec3f* in, uvec3f* out, std::size_t n, Executor& executor) {
+        avml_impl::parallel_batch<vec3f, uvec3f>(executor, in, out, n, normalize);
+    }
+
+    //=====================================================
+    // Transforms
+    //=====================================================
+
+    inline void transform_points(const mat4x4f& m, const vec3f* in, vec3f* out, std::size_t n) {
+        AVML_PROFILE_BATCH("transform_points[batch]", n);
+
+        const float* src = reinterpret_cast<const float*>(in);
+        float* dst = reinterpret_cast<float*>(out);
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        const avml_impl::Affine16f a = avml_impl::broadcast_affine16f(m);
+        for (; i + 16 <= n; i += 16) {
+            __m512 x, y, z;
+            avml_impl::load3x16f(src + 3 * i, x, y, z);
+            avml_impl::transform3x16f(a, x, y, z);
+            avml_impl::store3x16f(dst + 3 * i, x, y, z);
+        }
+
+        #elif defined(AVML_AVX)
+        const avml_impl::Affine8f a = avml_impl::broadcast_affine8f(m);
+        for (; i + 8 <= n; i += 8) {
+            __m256 x, y, z;
+            avml_impl::load3x8f(src + 3 * i, x, y, z);
+            avml_impl::transform3x8f(a, x, y, z);
+            avml_impl::store3x8f(dst + 3 * i, x, y, z);
+        }
+
+        #endif
+        avml_impl::transform3xnf(m, src, dst, i, n);
+    }
+
+    inline void transform_points(const mat4x4f& m, const vec3f* in, vec3f* out, std::size_t n, Executor& executor) {
+        executor.parallel_for(n, default_grain<vec3f>(), [&](std::size_t begin, std::size_t end) {
+            transform_points(m, in + begin, out + begin, end - begin);
+        });
+    }
+
+    inline void transform_vectors(const mat4x4f& m, const vec3f* in, vec3f* out, std::size_t n) {
+        mat4x4f linear = m;
+        linear[0][3] = 0.0f;
+        linear[1][3] = 0.0f;
+        linear[2][3] = 0.0f;
+        transform_points(linear, in, out, n);
+    }
+
+    inline void transform_vectors(const mat4x4f& m, const vec3f* in, vec3f* out, std::size_t n, Executor& executor) {
+        executor.parallel_for(n, default_grain<vec3f>(), [&](std::size_t begin, std::size_t end) {
+            transform_vectors(m, in + begin, out + begin, end - begin);
+        });
+    }
+
+    //=====================================================
+    // Reductions
+    //=====================================================
+
+    inline aabb3f bounds(const vec3f* in, std::size_t n) {
+        AVML_PROFILE_BATCH("bounds[batch]", n);
+
+        aabb3f ret = aabb3f::empty();
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        const float* src = reinterpret_cast<const float*>(in);
+        if (n >= 16) {
+            __m512 x, y, z;
+            avml_impl::load3x16f(src, x, y, z);
+            avml_impl::Bounds16f b = avml_impl::bounds16f(x, y, z);
+
+            for (i = 16; i + 16 <= n; i += 16) {
+                avml_impl::load3x16f(src + 3 * i, x, y, z);
+                avml_impl::extend16f(b, x, y, z);
+            }
+
+            ret = avml_impl::reduce_bounds16f(b);
+        }
+
+        #elif defined(AVML_AVX)
+        const float* src = reinterpret_cast<const float*>(in);
+        if (n >= 8) {
+            __m256 x, y, z;
+            avml_impl::load3x8f(src, x, y, z);
+            avml_impl::Bounds8f b = avml_impl::bounds8f(x, y, z);
+
+            for (i = 8; i + 8 <= n; i += 8) {
+                avml_impl::load3x8f(src + 3 * i, x, y, z);
+                avml_impl::extend8f(b, x, y, z);
+            }
+
+            ret = avml_impl::reduce_bounds8f(b);
+        }
+
+        #endif
+        for (; i < n; ++i) {
+            ret = extend(ret, in[i]);
+        }
+
+        return ret;
+    }
+
+    inline aabb3f bounds(const vec3f* in, std::size_t n, Executor& executor) {
+        const std::size_t grain = default_grain<vec3f, aabb3f>();
+        std::vector<aabb3f> partial((n + grain - 1) / grain, aabb3f::empty());
+
+        executor.parallel_for(n, grain, [&](std::size_t begin, std::size_t end) {
+            partial[begin / grain] = bounds(in + begin, end - begin);
+        });
+
+        aabb3f ret = aabb3f::empty();
+        for (const aabb3f& b : partial) {
+            ret = merge(ret, b);
+        }
+        return ret;
+    }
+
+}
+
+namespace avml_impl {
+
+    //=====================================================
+    // Matrix kernels
+    //=====================================================
+
+    ///
+    /// out = a * b for row-major 4x4 matrices. out may alias a or b.
+    ///
+    AVML_FINL void multiply4x4f(const float* a, const float* b, float* out) {
+        #if defined(AVML_AVX512F)
+        __m512 b0 = _mm512_broadcast_f32x4(_mm_loadu_ps(b + 0x0));
+        __m512 b1 = _mm512_broadcast_f32x4(_mm_loadu_ps(b + 0x4));
+        __m512 b2 = _mm512_broadcast_f32x4(_mm_loadu_ps(b + 0x8));
+        __m512 b3 = _mm512_broadcast_f32x4(_mm_loadu_ps(b + 0xC));
+
+        __m512 rows = _mm512_loadu_ps(a);
+
+        __m512 r = _mm512_mul_ps(_mm512_permute_ps(rows, 0x00), b0);
+        r = _mm512_fmadd_ps(_mm512_permute_ps(rows, 0x55), b1, r);
+        r = _mm512_fmadd_ps(_mm512_permute_ps(rows, 0xAA), b2, r);
+        r = _mm512_fmadd_ps(_mm512_permute_ps(rows, 0xFF), b3, r);
+
+        _mm512_storeu_ps(out, r);
+
+        #elif defined(AVML_AVX)
+        __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 0x0));
+        __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 0x4));
+        __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 0x8));
+        __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 0xC));
+
+        __m256 rows01 = _mm256_loadu_ps(a + 0x0);
+        __m256 rows23 = _mm256_loadu_ps(a + 0x8);
+
+        __m256 r01 = _mm256_mul_ps(_mm256_permute_ps(rows01, 0x00), b0);
+        r01 = fmadd8f(_mm256_permute_ps(rows01, 0x55), b1, r01);
+        r01 = fmadd8f(_mm256_permute_ps(rows01, 0xAA), b2, r01);
+        r01 = fmadd8f(_mm256_permute_ps(rows01, 0xFF), b3, r01);
+
+        __m256 r23 = _mm256_mul_ps(_mm256_permute_ps(rows23, 0x00), b0);
+        r23 = fmadd8f(_mm256_permute_ps(rows23, 0x55), b1, r23);
+        r23 = fmadd8f(_mm256_permute_ps(rows23, 0xAA), b2, r23);
+        r23 = fmadd8f(_mm256_permute_ps(rows23, 0xFF), b3, r23);
+
+        _mm256_storeu_ps(out + 0x0, r01);
+        _mm256_storeu_ps(out + 0x8, r23);
+
+        #elif defined(AVML_SSE)
+        __m128 b0 = _mm_loadu_ps(b + 0x0);
+        __m128 b1 = _mm_loadu_ps(b + 0x4);
+        __m128 b2 = _mm_loadu_ps(b + 0x8);
+        __m128 b3 = _mm_loadu_ps(b + 0xC);
+
+        for (unsigned i = 0; i < 4; ++i) {
+            __m128 row = _mm_loadu_ps(a + 4 * i);
+
+            __m128 r = _mm_mul_ps(_mm_shuffle_ps(row, row, 0x00), b0);
+            r = fmadd4f(_mm_shuffle_ps(row, row, 0x55), b1, r);
+            r = fmadd4f(_mm_shuffle_ps(row, row, 0xAA), b2, r);
+            r = fmadd4f(_mm_shuffle_ps(row, row, 0xFF), b3, r);
+
+            _mm_storeu_ps(out + 4 * i, r);
+        }
+
+        #else
+        float r[16];
+        for (unsigned i = 0; i < 4; ++i) {
+            for (unsigned j = 0; j < 4; ++j) {
+                r[4 * i + j] =
+                    a[4 * i + 0] * b[0x0 + j] +
+                    a[4 * i + 1] * b[0x4 + j] +
+                    a[4 * i + 2] * b[0x8 + j] +
+                    a[4 * i + 3] * b[0xC + j];
+            }
+        }
+
+        for (unsigned i = 0; i < 16; ++i) {
+            out[i] = r[i];
+        }
+
+        #endif
+    }
+
+    ///
+    /// Inverse of a row-major 4x4 matrix by cofactor expansion. T is float
+    /// or a lane wrapper holding one element of several matrices per lane.
+    ///
+    template<class T>
+    AVML_FINL void inverse4x4(const T (&m)[16], T (&out)[16]) {
+        const T a = m[0x0], b = m[0x1], c = m[0x2], d = m[0x3];
+        const T e = m[0x4], f = m[0x5], g = m[0x6], h = m[0x7];
+        const T i = m[0x8], j = m[0x9], k = m[0xA], l = m[0xB];
+        const T p = m[0xC], q = m[0xD], r = m[0xE], s = m[0xF];
+
+        // 2x2 minors of the bottom two rows
+        const T kslr = k * s - l * r;
+        const T jsln = j * s - l * q;
+        const T jrkq = j * r - k * q;
+        const T islp = i * s - l * p;
+        const T irkp = i * r - k * p;
+        const T iqjp = i * q - j * p;
+
+        // 2x2 minors of the top two rows
+        const T bgcf = b * g - c * f;
+        const T bhdf = b * h - d * f;
+        const T chdg = c * h - d * g;
+        const T agce = a * g - c * e;
+        const T ahde = a * h - d * e;
+        const T afbe = a * f - b * e;
+
+        const T t00 = f * kslr - g * jsln + h * jrkq;
+        const T t10 = -(e * kslr - g * islp + h * irkp);
+        const T t20 = e * jsln - f * islp + h * iqjp;
+        const T t30 = -(e * jrkq - f * irkp + g * iqjp);
+
+        const T det = a * t00 + b * t10 + c * t20 + d * t30;
+        const T rcp = T(1.0f) / det;
+
+        out[0x0] = t00 * rcp;
+        out[0x4] = t10 * rcp;
+        out[0x8] = t20 * rcp;
+        out[0xC] = t30 * rcp;
+
+        out[0x1] = -(b * kslr - c * jsln + d * jrkq) * rcp;
+        out[0x5] = (a * kslr - c * islp + d * irkp) * rcp;
+        out[0x9] = -(a * jsln - b * islp + d * iqjp) * rcp;
+        out[0xD] = (a * jrkq - b * irkp + c * iqjp) * rcp;
+
+        out[0x2] = (q * chdg - r * bhdf + s * bgcf) * rcp;
+        out[0x6] = -(p * chdg - r * ahde + s * agce) * rcp;
+        out[0xA] = (p * bhdf - q * ahde + s * afbe) * rcp;
+        out[0xE] = -(p * bgcf - q * agce + r * afbe) * rcp;
+
+        out[0x3] = -(j * chdg - k * bhdf + l * bgcf) * rcp;
+        out[0x7] = (i * chdg - k * ahde + l * agce) * rcp;
+        out[0xB] = -(i * bhdf - j * ahde + l * afbe) * rcp;
+        out[0xF] = (i * bgcf - j * agce + k * afbe) * rcp;
+    }
+
+#if defined(AVML_AVX)
+
+    ///
+    /// Loads eight consecutive 4x4 matrices so that element e of matrix m
+    /// ends up in lane m of out[e]
+    ///
+    AVML_FINL void load_soa8x16f(const float* p, __m256 (&out)[16]) {
+        __m256 lo[8];
+        __m256 hi[8];
+        for (unsigned m = 0; m < 8; ++m) {
+            lo[m] = _mm256_loadu_ps(p + 16 * m + 0);
+            hi[m] = _mm256_loadu_ps(p + 16 * m + 8);
+        }
+
+        transpose8x8f(lo);
+        transpose8x8f(hi);
+
+        for (unsigned e = 0; e < 8; ++e) {
+            out[e + 0] = lo[e];
+            out[e + 8] = hi[e];
+        }
+    }
+
+    ///
+    /// Inverse of load_soa8x16f
+    ///
+    AVML_FINL void store_soa8x16f(float* p, const __m256 (&in)[16]) {
+        __m256 lo[8];
+        __m256 hi[8];
+        for (unsigned e = 0; e < 8; ++e) {
+            lo[e] = in[e + 0];
+            hi[e] = in[e + 8];
+        }
+
+        transpose8x8f(lo);
+        transpose8x8f(hi);
+
+        for (unsigned m = 0; m < 8; ++m) {
+            _mm256_storeu_ps(p + 16 * m + 0, lo[m]);
+            _mm256_storeu_ps(p + 16 * m + 8, hi[m]);
+        }
+    }
+
+#endif
+
+}
+
+namespace avml {
+
+    //=====================================================
+    // Matrix arrays
+    //=====================================================
+
+    inline void multiply_batch(const mat4x4f* a, const mat4x4f* b, mat4x4f* out, std::size_t n) {
+        AVML_PROFILE_BATCH("multiply_batch[mat4x4f]", n);
+
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        for (; i + 4 <= n; i += 4) {
+            avml_impl::multiply4x4f(a[i + 0].data(), b[i + 0].data(), out[i + 0].data());
+            avml_impl::multiply4x4f(a[i + 1].data(), b[i + 1].data(), out[i + 1].data());
+            avml_impl::multiply4x4f(a[i + 2].data(), b[i + 2].data(), out[i + 2].data());
+            avml_impl::multiply4x4f(a[i + 3].data(), b[i + 3].data(), out[i + 3].data());
+        }
+
+        #elif defined(AVML_AVX)
+        for (; i + 2 <= n; i += 2) {
+            avml_impl::multiply4x4f(a[i + 0].data(), b[i + 0].data(), out[i + 0].data());
+            avml_impl::multiply4x4f(a[i + 1].data(), b[i + 1].data(), out[i + 1].data());
+        }
+
+        #endif
+        for (; i < n; ++i) {
+            avml_impl::multiply4x4f(a[i].data(), b[i].data(), out[i].data());
+        }
+    }
+
+    inline void multiply_batch(const mat4x4f* a, const mat4x4f* b, mat4x4f* out, std::size_t n, Executor& executor) {
+        executor.parallel_for(n, default_grain<mat4x4f, mat4x4f[2]>(), [&](std::size_t begin, std::size_t end) {
+            multiply_batch(a + begin, b + begin, out + begin, end - begin);
+        });
+    }
+
+    inline void multiply_batch(const mat4x4f* a, const std::uint32_t* a_indices, const mat4x4f* b, mat4x4f* out, std::size_t n) {
+        AVML_PROFILE_BATCH("multiply_batch[indexed]", n);
+
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        for (; i + 4 <= n; i += 4) {
+            avml_impl::multiply4x4f(a[a_indices[i + 0]].data(), b[i + 0].data(), out[i + 0].data());
+            avml_impl::multiply4x4f(a[a_indices[i + 1]].data(), b[i + 1].data(), out[i + 1].data());
+            avml_impl::multiply4x4f(a[a_indices[i + 2]].data(), b[i + 2].data(), out[i + 2].data());
+            avml_impl::multiply4x4f(a[a_indices[i + 3]].data(), b[i + 3].data(), out[i + 3].data());
+        }
+
+        #elif defined(AVML_AVX)
+        for (; i + 2 <= n; i += 2) {
+            avml_impl::multiply4x4f(a[a_indices[i + 0]].data(), b[i + 0].data(), out[i + 0].data());
+            avml_impl::multiply4x4f(a[a_indices[i + 1]].data(), b[i + 1].data(), out[i + 1].data());
+        }
+
+        #endif
+        for (; i < n; ++i) {
+            avml_impl::multiply4x4f(a[a_indices[i]].data(), b[i].data(), out[i].data());
+        }
+    }
+
+    inline void multiply_batch(const mat4x4f* a, const std::uint32_t* a_indices, const mat4x4f* b, mat4x4f* out, std::size_t n, Executor& executor) {
+        executor.parallel_for(n, default_grain<mat4x4f, mat4x4f[2]>(), [&](std::size_t begin, std::size_t end) {
+            multiply_batch(a, a_indices + begin, b + begin, out + begin, end - begin);
+        });
+    }
+
+    inline void propagate_hierarchy(const std::uint32_t* parents, const mat4x4f* local, mat4x4f* world, std::size_t n) {
+        AVML_PROFILE_BATCH("propagate_hierarchy", n);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            if (parents[i] == no_parent) {
+                world[i] = local[i];
+            } else {
+                avml_impl::multiply4x4f(world[parents[i]].data(), local[i].data(), world[i].data());
+            }
+        }
+    }
+
+    inline void inverse_batch(const mat4x4f* in, mat4x4f* out, std::size_t n) {
+        AVML_PROFILE_BATCH("inverse_batch[mat4x4f]", n);
+
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        for (; i + 16 <= n; i += 16) {
+            __m256 lo[16];
+            __m256 hi[16];
+            avml_impl::load_soa8x16f(in[i + 0].data(), lo);
+            avml_impl::load_soa8x16f(in[i + 8].data(), hi);
+
+            avml_impl::Lanes16f m[16];
+            for (unsigned e = 0; e < 16; ++e) {
+                __m512d t = _mm512_castpd256_pd512(_mm256_castps_pd(lo[e]));
+                m[e] = _mm512_castpd_ps(_mm512_insertf64x4(t, _mm256_castps_pd(hi[e]), 1));
+            }
+
+            avml_impl::Lanes16f r[16];
+            avml_impl::inverse4x4(m, r);
+
+            for (unsigned e = 0; e < 16; ++e) {
+                lo[e] = _mm512_castps512_ps256(r[e].reg);
+                hi[e] = _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(r[e].reg), 1));
+            }
+
+            avml_impl::store_soa8x16f(out[i + 0].data(), lo);
+            avml_impl::store_soa8x16f(out[i + 8].data(), hi);
+        }
+
+        #endif
+        #if defined(AVML_AVX)
+        for (; i + 8 <= n; i += 8) {
+            __m256 regs[16];
+            avml_impl::load_soa8x16f(in[i].data(), regs);
+
+            avml_impl::Lanes8f m[16];
+            for (unsigned e = 0; e < 16; ++e) {
+                m[e] = regs[e];
+            }
+
+            avml_impl::Lanes8f r[16];
+            avml_impl::inverse4x4(m, r);
+
+            for (unsigned e = 0; e < 16; ++e) {
+                regs[e] = r[e].reg;
+            }
+            avml_impl::store_soa8x16f(out[i].data(), regs);
+        }
+
+        #endif
+        for (; i < n; ++i) {
+            float m[16];
+            float r[16];
+            for (unsigned e = 0; e < 16; ++e) {
+                m[e] = in[i].data()[e];
+            }
+
+            avml_impl::inverse4x4(m, r);
+
+            for (unsigned e = 0; e < 16; ++e) {
+                out[i].data()[e] = r[e];
+            }
+        }
+    }
+
+    inline void inverse_batch(const mat4x4f* in, mat4x4f* out, std::size_t n, Executor& executor) {
+        executor.parallel_for(n, default_grain<mat4x4f>(), [&](std::size_t begin, std::size_t end) {
+            inverse_batch(in + begin, out + begin, end - begin);
+        });
+    }
+
+}
+
+#endif
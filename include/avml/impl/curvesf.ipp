@@ -0,0 +1,252 @@
+#ifndef AVML_CURVESF_IPP
+#define AVML_CURVESF_IPP
+
+#include "Lanes.hpp"
+
+namespace avml_impl {
+
+    //=====================================================
+    // Basis functions
+    //=====================================================
+
+    template<class T>
+    AVML_FINL void cubic_weights(avml::Cubic_basis basis, T t, T (&w)[4]) {
+        T t2 = t * t;
+        T t3 = t2 * t;
+
+        switch (basis) {
+        case avml::Cubic_basis::bezier: {
+            T s = T{1.0f} - t;
+            T s2 = s * s;
+            w[0] = s2 * s;
+            w[1] = T{3.0f} * t * s2;
+            w[2] = T{3.0f} * t2 * s;
+            w[3] = t3;
+            break;
+        }
+        case avml::Cubic_basis::hermite:
+            w[0] = T{2.0f} * t3 - T{3.0f} * t2 + T{1.0f};
+            w[1] = t3 - T{2.0f} * t2 + t;
+            w[2] = T{3.0f} * t2 - T{2.0f} * t3;
+            w[3] = t3 - t2;
+            break;
+        case avml::Cubic_basis::catmull_rom:
+            w[0] = T{0.5f} * (T{2.0f} * t2 - t3 - t);
+            w[1] = T{0.5f} * (T{3.0f} * t3 - T{5.0f} * t2 + T{2.0f});
+            w[2] = T{0.5f} * (T{4.0f} * t2 - T{3.0f} * t3 + t);
+            w[3] = T{0.5f} * (t3 - t2);
+            break;
+        default:
+            // Not a basis, e.g. a value cast from an integer
+            for (unsigned k = 0; k < 4; ++k) {
+                w[k] = T{0.0f};
+            }
+            break;
+        }
+    }
+
+    ///
+    /// Evaluates the curve with control points c at the parameters in t
+    ///
+    template<class T, unsigned D>
+    AVML_FINL void evaluate_curve(avml::Cubic_basis basis, const float (&c)[4][D], T t, T (&r)[D]) {
+        T w[4];
+        cubic_weights(basis, t, w);
+
+        for (unsigned d = 0; d < D; ++d) {
+            r[d] = w[0] * T(c[0][d]);
+            r[d] = lanes_fmadd(w[1], T(c[1][d]), r[d]);
+            r[d] = lanes_fmadd(w[2], T(c[2][d]), r[d]);
+            r[d] = lanes_fmadd(w[3], T(c[3][d]), r[d]);
+        }
+    }
+
+    template<class V>
+    AVML_FINL V combine_control_points(const float (&w)[4], const V* c) {
+        V r = V{w[0]} * c[0];
+        r = avml::fmadd(V{w[1]}, c[1], r);
+        r = avml::fmadd(V{w[2]}, c[2], r);
+        r = avml::fmadd(V{w[3]}, c[3], r);
+        return r;
+    }
+
+    template<class V>
+    AVML_FINL V evaluate_curve(avml::Cubic_basis basis, const V (&c)[4], float t) {
+        float w[4];
+        cubic_weights(basis, t, w);
+        return combine_control_points(w, c);
+    }
+
+    //=====================================================
+    // Batch drivers
+    //=====================================================
+
+#if defined(AVML_AVX)
+
+    ///
+    /// Evaluates the curve at W parameters at a time
+    ///
+    /// \return Number of parameters processed
+    template<class T, unsigned W, unsigned D>
+    AVML_FINL std::size_t sample_curve_groups(
+        avml::Cubic_basis basis, const float (&c)[4][D],
+        const float* t, float* out, std::size_t n) {
+
+        std::size_t i = 0;
+        for (; i + W <= n; i += W) {
+            T r[D];
+            evaluate_curve(basis, c, lanes_load(*reinterpret_cast<const float (*)[W]>(t + i)), r);
+            lanes_store_interleaved(out + D * i, r);
+        }
+        return i;
+    }
+
+#endif
+
+    template<unsigned D, class V>
+    AVML_FINL void sample_curve(avml::Cubic_basis basis, const V (&control)[4], const float* t, V* out, std::size_t n) {
+        float c[4][D];
+        for (unsigned k = 0; k < 4; ++k) {
+            for (unsigned d = 0; d < D; ++d) {
+                c[k][d] = control[k][d];
+            }
+        }
+
+        float* dst = reinterpret_cast<float*>(out);
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        i = sample_curve_groups<Lanes16f, 16>(basis, c, t, dst, n);
+        #elif defined(AVML_AVX)
+        i = sample_curve_groups<Lanes8f, 8>(basis, c, t, dst, n);
+        #endif
+
+        for (; i < n; ++i) {
+            float r[D];
+            evaluate_curve(basis, c, t[i], r);
+            lanes_store_interleaved(dst + D * i, r);
+        }
+    }
+
+    template<unsigned D, class V>
+    AVML_FINL void sample_curve(
+        avml::Cubic_basis basis, const V (&control)[4],
+        const float* t, V* out, std::size_t n, avml::Executor& executor) {
+
+        executor.parallel_for(n, avml::default_grain<float, V>(), [&](std::size_t begin, std::size_t end) {
+            sample_curve<D>(basis, control, t + begin, out + begin, end - begin);
+        });
+    }
+
+    // With a single parameter the weights are shared by all curves, so each
+    // curve reduces to three multiply-adds on whole vectors
+
+    template<class V>
+    AVML_FINL void sample_curves(avml::Cubic_basis basis, const V* control, float t, V* out, std::size_t n) {
+        float w[4];
+        cubic_weights(basis, t, w);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = combine_control_points(w, control + 4 * i);
+        }
+    }
+
+    template<class V>
+    AVML_FINL void sample_curves(
+        avml::Cubic_basis basis, const V* control,
+        float t, V* out, std::size_t n, avml::Executor& executor) {
+
+        executor.parallel_for(n, avml::default_grain<V[4], V>(), [&](std::size_t begin, std::size_t end) {
+            sample_curves(basis, control + 4 * begin, t, out + begin, end - begin);
+        });
+    }
+
+}
+
+namespace avml {
+
+    //=====================================================
+    // Cubic curves
+    //=====================================================
+
+    inline vec2f bezier(vec2f p0, vec2f p1, vec2f p2, vec2f p3, float t) {
+        const vec2f c[] = {p0, p1, p2, p3};
+        return avml_impl::evaluate_curve(Cubic_basis::bezier, c, t);
+    }
+
+    inline vec3f bezier(vec3f p0, vec3f p1, vec3f p2, vec3f p3, float t) {
+        const vec3f c[] = {p0, p1, p2, p3};
+        return avml_impl::evaluate_curve(Cubic_basis::bezier, c, t);
+    }
+
+    inline vec2f hermite(vec2f p0, vec2f m0, vec2f p1, vec2f m1, float t) {
+        const vec2f c[] = {p0, m0, p1, m1};
+        return avml_impl::evaluate_curve(Cubic_basis::hermite, c, t);
+    }
+
+    inline vec3f hermite(vec3f p0, vec3f m0, vec3f p1, vec3f m1, float t) {
+        const vec3f c[] = {p0, m0, p1, m1};
+        return avml_impl::evaluate_curve(Cubic_basis::hermite, c, t);
+    }
+
+    inline vec2f catmull_rom(vec2f p0, vec2f p1, vec2f p2, vec2f p3, float t) {
+        const vec2f c[] = {p0, p1, p2, p3};
+        return avml_impl::evaluate_curve(Cubic_basis::catmull_rom, c, t);
+    }
+
+    inline vec3f catmull_rom(vec3f p0, vec3f p1, vec3f p2, vec3f p3, float t) {
+        const vec3f c[] = {p0, p1, p2, p3};
+        return avml_impl::evaluate_curve(Cubic_basis::catmull_rom, c, t);
+    }
+
+    inline void cubic_weights(Cubic_basis basis, float t, float (&weights)[4]) {
+        avml_impl::cubic_weights(basis, t, weights);
+    }
+
+    //=====================================================
+    // Batch evaluation
+    //=====================================================
+
+    inline void sample_curve(Cubic_basis basis, const vec2f (&control)[4], const float* t, vec2f* out, std::size_t n) {
+        AVML_PROFILE_BATCH("sample_curve(vec2f)[batch]", n);
+
+        avml_impl::sample_curve<2>(basis, control, t, out, n);
+    }
+
+    inline void sample_curve(Cubic_basis basis, const vec3f (&control)[4], const float* t, vec3f* out, std::size_t n) {
+        AVML_PROFILE_BATCH("sample_curve(vec3f)[batch]", n);
+
+        avml_impl::sample_curve<3>(basis, control, t, out, n);
+    }
+
+    inline void sample_curve(Cubic_basis basis, const vec2f (&control)[4], const float* t, vec2f* out, std::size_t n, Executor& executor) {
+        avml_impl::sample_curve<2>(basis, control, t, out, n, executor);
+    }
+
+    inline void sample_curve(Cubic_basis basis, const vec3f (&control)[4], const float* t, vec3f* out, std::size_t n, Executor& executor) {
+        avml_impl::sample_curve<3>(basis, control, t, out, n, executor);
+    }
+
+    inline void sample_curves(Cubic_basis basis, const vec2f* control, float t, vec2f* out, std::size_t n) {
+        AVML_PROFILE_BATCH("sample_curves(vec2f)[batch]", n);
+
+        avml_impl::sample_curves(basis, control, t, out, n);
+    }
+
+    inline void sample_curves(Cubic_basis basis, const vec3f* control, float t, vec3f* out, std::size_t n) {
+        AVML_PROFILE_BATCH("sample_curves(vec3f)[batch]", n);
+
+        avml_impl::sample_curves(basis, control, t, out, n);
+    }
+
+    inline void sample_curves(Cubic_basis basis, const vec2f* control, float t, vec2f* out, std::size_t n, Executor& executor) {
+        avml_impl::sample_curves(basis, control, t, out, n, executor);
+    }
+
+    inline void sample_curves(Cubic_basis basis, const vec3f* control, float t, vec3f* out, std::size_t n, Executor& executor) {
+        avml_impl::sample_curves(basis, control, t, out, n, executor);
+    }
+
+}
+
+#endif
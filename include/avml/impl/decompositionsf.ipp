@@ -0,0 +1,519 @@
+#ifndef AVML_DECOMPOSITIONSF_IPP
+#define AVML_DECOMPOSITIONSF_IPP
+
+#include "Lanes.hpp"
+
+namespace avml_impl {
+
+    //=====================================================
+    // Kernels
+    //=====================================================
+
+    // Templated over the lane type T so that one definition serves single
+    // matrices (float, double) and 8 or 16 matrices in structure-of-arrays
+    // form (Lanes8f, Lanes16f). Matrices are row-major arrays of 9 elements.
+
+    ///
+    /// Computes the cosine and sine of a rotation which reduces the
+    /// off-diagonal element a_pq of a symmetric 2x2 matrix. The angle is
+    /// approximated from its tangent, falling back to pi/4 when that would be
+    /// inaccurate.
+    ///
+    template<class T>
+    AVML_FINL void approximate_givens(T a_pp, T a_pq, T a_qq, T& c, T& s) {
+        const T gamma{5.82842712f}; // 3 + 2 * sqrt(2)
+        const T c_star{0.923879533f}; // cos(pi / 8)
+        const T s_star{0.382683432f}; // sin(pi / 8)
+
+        T ch = T(2.0f) * (a_pp - a_qq);
+        T sh = a_pq;
+
+        auto use_approximation = lanes_less(gamma * sh * sh, ch * ch);
+        T w = lanes_rsqrt(ch * ch + sh * sh);
+
+        ch = lanes_select(use_approximation, w * ch, c_star);
+        sh = lanes_select(use_approximation, w * sh, s_star);
+
+        // Half angle to full angle
+        c = ch * ch - sh * sh;
+        s = T(2.0f) * ch * sh;
+    }
+
+    ///
+    /// Conjugates the symmetric matrix s by a rotation in the pq-plane, with
+    /// r being the remaining index, and accumulates the rotation into v
+    ///
+    template<class T>
+    AVML_FINL void jacobi_rotate(T& s_pp, T& s_qq, T& s_pq, T& s_pr, T& s_qr, T (&v)[9], unsigned p, unsigned q) {
+        T c, s;
+        approximate_givens(s_pp, s_pq, s_qq, c, s);
+
+        T cc = c * c;
+        T ss = s * s;
+        T cs = c * s;
+
+        T a = s_pp;
+        T b = s_pq;
+        T d = s_qq;
+
+        s_pp = cc * a + T(2.0f) * cs * b + ss * d;
+        s_qq = ss * a - T(2.0f) * cs * b + cc * d;
+        s_pq = (cc - ss) * b - cs * (a - d);
+
+        T pr = s_pr;
+        T qr = s_qr;
+
+        s_pr = c * pr + s * qr;
+        s_qr = c * qr - s * pr;
+
+        for (unsigned i = 0; i < 3; ++i) {
+            T vp = v[i * 3 + p];
+            T vq = v[i * 3 + q];
+
+            v[i * 3 + p] = c * vp + s * vq;
+            v[i * 3 + q] = c * vq - s * vp;
+        }
+    }
+
+    ///
+    /// Diagonalizes the symmetric matrix given by its upper triangle in
+    /// place. v receives the accumulated rotation.
+    ///
+    template<class T>
+    AVML_FINL void jacobi3x3(T& s00, T& s01, T& s02, T& s11, T& s12, T& s22, T (&v)[9]) {
+        for (unsigned i = 0; i < 9; ++i) {
+            v[i] = T((i % 4 == 0) ? 1.0f : 0.0f);
+        }
+
+        for (unsigned sweep = 0; sweep < AVML_JACOBI_SWEEPS; ++sweep) {
+            jacobi_rotate(s00, s11, s01, s02, s12, v, 0, 1);
+            jacobi_rotate(s00, s22, s02, s01, s12, v, 0, 2);
+            jacobi_rotate(s11, s22, s12, s01, s02, v, 1, 2);
+        }
+    }
+
+    ///
+    /// Swaps columns p and q of m in lanes where swap is set. The column
+    /// moved into q is negated so that the determinant is preserved.
+    ///
+    template<class T, class Mask>
+    AVML_FINL void conditional_swap_columns(Mask swap, T (&m)[9], unsigned p, unsigned q) {
+        for (unsigned i = 0; i < 3; ++i) {
+            T x = m[i * 3 + p];
+            T y = m[i * 3 + q];
+
+            m[i * 3 + p] = lanes_select(swap, y, x);
+            m[i * 3 + q] = lanes_select(swap, -x, y);
+        }
+    }
+
+    ///
+    /// Orders key and the columns of m and n by decreasing key
+    ///
+    template<class T>
+    AVML_FINL void sort_columns(T (&key)[3], T (&m)[9], T (&n)[9]) {
+        const unsigned pairs[3][2] = {{0, 1}, {0, 2}, {1, 2}};
+
+        for (const auto& pair : pairs) {
+            unsigned p = pair[0];
+            unsigned q = pair[1];
+
+            auto swap = lanes_less(key[p], key[q]);
+            conditional_swap_columns(swap, m, p, q);
+            conditional_swap_columns(swap, n, p, q);
+
+            T kp = key[p];
+            key[p] = lanes_select(swap, key[q], kp);
+            key[q] = lanes_select(swap, kp, key[q]);
+        }
+    }
+
+    ///
+    /// Applies a Givens rotation to rows p and q of b which zeroes b[q][p]
+    /// and accumulates its transpose into the columns of u
+    ///
+    template<class T>
+    AVML_FINL void givens_qr(T (&b)[9], T (&u)[9], unsigned p, unsigned q) {
+        const T epsilon{1.0e-6f};
+
+        T a1 = b[p * 3 + p];
+        T a2 = b[q * 3 + p];
+
+        T rho = lanes_sqrt(a1 * a1 + a2 * a2);
+
+        T sh = lanes_select(lanes_less(epsilon, rho), a2, T(0.0f));
+        T ch = lanes_abs(a1) + lanes_max(rho, epsilon);
+
+        auto negative = lanes_less(a1, T(0.0f));
+        T tmp = sh;
+        sh = lanes_select(negative, ch, sh);
+        ch = lanes_select(negative, tmp, ch);
+
+        T w = lanes_rsqrt(ch * ch + sh * sh);
+        ch = ch * w;
+        sh = sh * w;
+
+        T c = ch * ch - sh * sh;
+        T s = T(2.0f) * ch * sh;
+
+        for (unsigned j = 0; j < 3; ++j) {
+            T bp = b[p * 3 + j];
+            T bq = b[q * 3 + j];
+
+            b[p * 3 + j] = c * bp + s * bq;
+            b[q * 3 + j] = c * bq - s * bp;
+        }
+
+        for (unsigned i = 0; i < 3; ++i) {
+            T up = u[i * 3 + p];
+            T uq = u[i * 3 + q];
+
+            u[i * 3 + p] = c * up + s * uq;
+            u[i * 3 + q] = c * uq - s * up;
+        }
+    }
+
+    template<class T>
+    AVML_FINL void svd3x3(const T (&a)[9], T (&u)[9], T (&sigma)[3], T (&v)[9]) {
+        // Symmetric eigenproblem of transpose(a) * a yields v
+        T s00 = a[0] * a[0] + a[3] * a[3] + a[6] * a[6];
+        T s01 = a[0] * a[1] + a[3] * a[4] + a[6] * a[7];
+        T s02 = a[0] * a[2] + a[3] * a[5] + a[6] * a[8];
+        T s11 = a[1] * a[1] + a[4] * a[4] + a[7] * a[7];
+        T s12 = a[1] * a[2] + a[4] * a[5] + a[7] * a[8];
+        T s22 = a[2] * a[2] + a[5] * a[5] + a[8] * a[8];
+
+        jacobi3x3(s00, s01, s02, s11, s12, s22, v);
+
+        T b[9];
+        for (unsigned i = 0; i < 3; ++i) {
+            for (unsigned j = 0; j < 3; ++j) {
+                b[i * 3 + j] =
+                    a[i * 3 + 0] * v[0 * 3 + j] +
+                    a[i * 3 + 1] * v[1 * 3 + j] +
+                    a[i * 3 + 2] * v[2 * 3 + j];
+            }
+        }
+
+        T norms[3];
+        for (unsigned j = 0; j < 3; ++j) {
+            norms[j] = b[j] * b[j] + b[3 + j] * b[3 + j] + b[6 + j] * b[6 + j];
+        }
+
+        sort_columns(norms, b, v);
+
+        // QR decomposition of a * v yields u and sigma
+        for (unsigned i = 0; i < 9; ++i) {
+            u[i] = T((i % 4 == 0) ? 1.0f : 0.0f);
+        }
+
+        givens_qr(b, u, 0, 1);
+        givens_qr(b, u, 0, 2);
+        givens_qr(b, u, 1, 2);
+
+        sigma[0] = b[0];
+        sigma[1] = b[4];
+        sigma[2] = b[8];
+    }
+
+    template<class T>
+    AVML_FINL void polar3x3(const T (&a)[9], T (&r)[9], T (&s)[9]) {
+        T u[9];
+        T sigma[3];
+        T v[9];
+        svd3x3(a, u, sigma, v);
+
+        for (unsigned i = 0; i < 3; ++i) {
+            for (unsigned j = 0; j < 3; ++j) {
+                r[i * 3 + j] =
+                    u[i * 3 + 0] * v[j * 3 + 0] +
+                    u[i * 3 + 1] * v[j * 3 + 1] +
+                    u[i * 3 + 2] * v[j * 3 + 2];
+
+                s[i * 3 + j] =
+                    v[i * 3 + 0] * sigma[0] * v[j * 3 + 0] +
+                    v[i * 3 + 1] * sigma[1] * v[j * 3 + 1] +
+                    v[i * 3 + 2] * sigma[2] * v[j * 3 + 2];
+            }
+        }
+    }
+
+    template<class T>
+    AVML_FINL void eigen_symmetric3x3(const T (&a)[9], T (&values)[3], T (&vectors)[9]) {
+        T s00 = a[0];
+        T s01 = a[1];
+        T s02 = a[2];
+        T s11 = a[4];
+        T s12 = a[5];
+        T s22 = a[8];
+
+        jacobi3x3(s00, s01, s02, s11, s12, s22, vectors);
+
+        values[0] = s00;
+        values[1] = s11;
+        values[2] = s22;
+
+        T unused[9]{};
+        sort_columns(values, vectors, unused);
+    }
+
+    //=====================================================
+    // Conversions
+    //=====================================================
+
+    template<class R>
+    AVML_FINL void load3x3(const avml::Matrix3x3R<R>& m, R (&out)[9]) {
+        for (unsigned i = 0; i < 3; ++i) {
+            for (unsigned j = 0; j < 3; ++j) {
+                out[i * 3 + j] = m[i][j];
+            }
+        }
+    }
+
+    template<class R>
+    AVML_FINL avml::Matrix3x3R<R> store3x3(const R (&m)[9]) {
+        return avml::Matrix3x3R<R>{
+            m[0], m[1], m[2],
+            m[3], m[4], m[5],
+            m[6], m[7], m[8]
+        };
+    }
+
+    // Each kernel writes its results for one matrix into an array of 21
+    // elements, which the matching write function unpacks
+
+    struct Svd_kernel {
+        template<class T>
+        AVML_FINL void operator()(const T (&a)[9], T (&results)[21]) const {
+            T u[9];
+            T sigma[3];
+            T v[9];
+            svd3x3(a, u, sigma, v);
+
+            for (unsigned e = 0; e < 9; ++e) {
+                results[e] = u[e];
+                results[12 + e] = v[e];
+            }
+            for (unsigned e = 0; e < 3; ++e) {
+                results[9 + e] = sigma[e];
+            }
+        }
+
+        AVML_FINL static void write(const float (&r)[21], avml::svd3x3f& out) {
+            out.u = avml::mat3x3f::read(r + 0);
+            out.sigma = avml::vec3f{r[9], r[10], r[11]};
+            out.v = avml::mat3x3f::read(r + 12);
+        }
+    };
+
+    struct Polar_kernel {
+        template<class T>
+        AVML_FINL void operator()(const T (&a)[9], T (&results)[21]) const {
+            T r[9];
+            T s[9];
+            polar3x3(a, r, s);
+
+            for (unsigned e = 0; e < 9; ++e) {
+                results[e] = r[e];
+                results[9 + e] = s[e];
+            }
+            for (unsigned e = 18; e < 21; ++e) {
+                results[e] = T(0.0f);
+            }
+        }
+
+        AVML_FINL static void write(const float (&r)[21], avml::polar3x3f& out) {
+            out.r = avml::mat3x3f::read(r + 0);
+            out.s = avml::mat3x3f::read(r + 9);
+        }
+    };
+
+    struct Eigen_kernel {
+        template<class T>
+        AVML_FINL void operator()(const T (&a)[9], T (&results)[21]) const {
+            T values[3];
+            T vectors[9];
+            eigen_symmetric3x3(a, values, vectors);
+
+            for (unsigned e = 0; e < 3; ++e) {
+                results[e] = values[e];
+            }
+            for (unsigned e = 0; e < 9; ++e) {
+                results[3 + e] = vectors[e];
+            }
+            for (unsigned e = 12; e < 21; ++e) {
+                results[e] = T(0.0f);
+            }
+        }
+
+        AVML_FINL static void write(const float (&r)[21], avml::eigen3x3f& out) {
+            out.values = avml::vec3f{r[0], r[1], r[2]};
+            out.vectors = avml::mat3x3f::read(r + 3);
+        }
+    };
+
+#if defined(AVML_AVX)
+
+    ///
+    /// Runs kernel over groups of W matrices laid out as a structure of
+    /// arrays of lane type T
+    ///
+    /// \return Number of matrices processed
+    template<class T, unsigned W, class Kernel, class Out>
+    AVML_FINL std::size_t decompose_groups(const avml::mat3x3f* in, Out* out, std::size_t n, Kernel kernel) {
+        std::size_t i = 0;
+        for (; i + W <= n; i += W) {
+            alignas(64) float soa[9][W];
+            for (unsigned l = 0; l < W; ++l) {
+                const float* src = in[i + l].data();
+                for (unsigned e = 0; e < 9; ++e) {
+                    soa[e][l] = src[e];
+                }
+            }
+
+            T a[9];
+            for (unsigned e = 0; e < 9; ++e) {
+                a[e] = lanes_load(soa[e]);
+            }
+
+            T results[21];
+            kernel(a, results);
+
+            alignas(64) float aos[21][W];
+            for (unsigned e = 0; e < 21; ++e) {
+                lanes_store(aos[e], results[e]);
+            }
+
+            for (unsigned l = 0; l < W; ++l) {
+                float lane[21];
+                for (unsigned e = 0; e < 21; ++e) {
+                    lane[e] = aos[e][l];
+                }
+                Kernel::write(lane, out[i + l]);
+            }
+        }
+
+        return i;
+    }
+
+#endif
+
+    ///
+    /// Runs kernel over in[0, n) in the widest available lanes, finishing
+    /// the remainder one matrix at a time
+    ///
+    template<class Kernel, class Out>
+    AVML_FINL void decompose_batch(const avml::mat3x3f* in, Out* out, std::size_t n, Kernel kernel) {
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        i = decompose_groups<Lanes16f, 16>(in, out, n, kernel);
+        #elif defined(AVML_AVX)
+        i = decompose_groups<Lanes8f, 8>(in, out, n, kernel);
+        #endif
+
+        for (; i < n; ++i) {
+            float a[9];
+            load3x3(in[i], a);
+
+            float results[21];
+            kernel(a, results);
+            Kernel::write(results, out[i]);
+        }
+    }
+
+}
+
+namespace avml {
+
+    //=====================================================
+    // Decompositions
+    //=====================================================
+
+    template<class R>
+    Svd3x3R<R> svd(const Matrix3x3R<R>& a) {
+        AVML_PROFILE("svd(Matrix3x3R)");
+
+        R m[9];
+        avml_impl::load3x3(a, m);
+
+        R u[9];
+        R sigma[3];
+        R v[9];
+        avml_impl::svd3x3(m, u, sigma, v);
+
+        return Svd3x3R<R>{
+            avml_impl::store3x3(u),
+            Vector3R<R>{sigma[0], sigma[1], sigma[2]},
+            avml_impl::store3x3(v)
+        };
+    }
+
+    template<class R>
+    Polar3x3R<R> polar_decomposition(const Matrix3x3R<R>& a) {
+        AVML_PROFILE("polar_decomposition(Matrix3x3R)");
+
+        R m[9];
+        avml_impl::load3x3(a, m);
+
+        R r[9];
+        R s[9];
+        avml_impl::polar3x3(m, r, s);
+
+        return Polar3x3R<R>{avml_impl::store3x3(r), avml_impl::store3x3(s)};
+    }
+
+    template<class R>
+    Eigen3x3R<R> eigen_symmetric(const Matrix3x3R<R>& a) {
+        AVML_PROFILE("eigen_symmetric(Matrix3x3R)");
+
+        R m[9];
+        avml_impl::load3x3(a, m);
+
+        R values[3];
+        R vectors[9];
+        avml_impl::eigen_symmetric3x3(m, values, vectors);
+
+        return Eigen3x3R<R>{
+            Vector3R<R>{values[0], values[1], values[2]},
+            avml_impl::store3x3(vectors)
+        };
+    }
+
+    //=====================================================
+    // Batch decompositions
+    //=====================================================
+
+    inline void svd_batch(const mat3x3f* in, svd3x3f* out, std::size_t n) {
+        AVML_PROFILE_BATCH("svd[batch]", n);
+
+        avml_impl::decompose_batch(in, out, n, avml_impl::Svd_kernel{});
+    }
+
+    inline void svd_batch(const mat3x3f* in, svd3x3f* out, std::size_t n, Executor& executor) {
+        avml_impl::parallel_batch<mat3x3f, svd3x3f>(executor, in, out, n, svd_batch);
+    }
+
+    inline void polar_decomposition_batch(const mat3x3f* in, polar3x3f* out, std::size_t n) {
+        AVML_PROFILE_BATCH("polar_decomposition[batch]", n);
+
+        avml_impl::decompose_batch(in, out, n, avml_impl::Polar_kernel{});
+    }
+
+    inline void polar_decomposition_batch(const mat3x3f* in, polar3x3f* out, std::size_t n, Executor& executor) {
+        avml_impl::parallel_batch<mat3x3f, polar3x3f>(executor, in, out, n, polar_decomposition_batch);
+    }
+
+    inline void eigen_symmetric_batch(const mat3x3f* in, eigen3x3f* out, std::size_t n) {
+        AVML_PROFILE_BATCH("eigen_symmetric[batch]", n);
+
+        avml_impl::decompose_batch(in, out, n, avml_impl::Eigen_kernel{});
+    }
+
+    inline void eigen_symmetric_batch(const mat3x3f* in, eigen3x3f* out, std::size_t n, Executor& executor) {
+        avml_impl::parallel_batch<mat3x3f, eigen3x3f>(executor, in, out, n, eigen_symmetric_batch);
+    }
+
+}
+
+#endif
@@ -0,0 +1,581 @@
+#ifndef AVML_ENCODINGSF_IPP
+#define AVML_ENCODINGSF_IPP
+
+#include <cmath>
+#include <cstring>
+
+namespace avml_impl {
+
+    //=====================================================
+    // Scalar helpers
+    //=====================================================
+
+    AVML_FINL float sign_not_zero(float x) {
+        return (x < 0.0f) ? -1.0f : 1.0f;
+    }
+
+    template<unsigned Bits>
+    AVML_FINL std::int32_t quantize_snorm(float x) {
+        const float scale = float((1 << (Bits - 1)) - 1);
+        x = std::fmin(std::fmax(x, -1.0f), 1.0f);
+        return static_cast<std::int32_t>(std::nearbyint(x * scale));
+    }
+
+    template<unsigned Bits>
+    AVML_FINL float dequantize_snorm(std::int32_t x) {
+        const float scale = 1.0f / float((1 << (Bits - 1)) - 1);
+        return std::fmax(float(x) * scale, -1.0f);
+    }
+
+    template<unsigned Bits>
+    AVML_FINL std::int32_t sign_extend(std::uint32_t x) {
+        return static_cast<std::int32_t>(x << (32 - Bits)) >> (32 - Bits);
+    }
+
+    AVML_FINL avml::uvec3f normalize_to_uvec3f(float x, float y, float z) {
+        float length = std::sqrt(x * x + y * y + z * z);
+        float data[3] = {x / length, y / length, z / length};
+        return avml::uvec3f::read(data);
+    }
+
+    AVML_FINL void oct_encode(avml::uvec3f v, float& x, float& y) {
+        float l1 = std::abs(v[0]) + std::abs(v[1]) + std::abs(v[2]);
+        x = v[0] / l1;
+        y = v[1] / l1;
+
+        if (v[2] < 0.0f) {
+            float t = (1.0f - std::abs(y)) * sign_not_zero(x);
+            y = (1.0f - std::abs(x)) * sign_not_zero(y);
+            x = t;
+        }
+    }
+
+    AVML_FINL avml::uvec3f oct_decode(float x, float y) {
+        float z = 1.0f - std::abs(x) - std::abs(y);
+        float t = std::fmax(-z, 0.0f);
+        x -= t * sign_not_zero(x);
+        y -= t * sign_not_zero(y);
+        return normalize_to_uvec3f(x, y, z);
+    }
+
+    //=====================================================
+    // SIMD helpers
+    //=====================================================
+
+#if defined(AVML_AVX512F)
+
+    AVML_FINL __m512 sign_not_zero16f(__m512 x) {
+        __m512i sign = _mm512_and_si512(_mm512_castps_si512(x), _mm512_set1_epi32(0x80000000));
+        return _mm512_castsi512_ps(_mm512_or_si512(sign, _mm512_castps_si512(_mm512_set1_ps(1.0f))));
+    }
+
+    AVML_FINL void oct_encode16f(__m512 x, __m512 y, __m512 z, __m512& px, __m512& py) {
+        __m512 l1 = _mm512_add_ps(_mm512_add_ps(_mm512_abs_ps(x), _mm512_abs_ps(y)), _mm512_abs_ps(z));
+        px = _mm512_div_ps(x, l1);
+        py = _mm512_div_ps(y, l1);
+
+        __mmask16 lower = _mm512_cmp_ps_mask(z, _mm512_setzero_ps(), _CMP_LT_OQ);
+        __m512 one = _mm512_set1_ps(1.0f);
+        __m512 fx = _mm512_mul_ps(_mm512_sub_ps(one, _mm512_abs_ps(py)), sign_not_zero16f(px));
+        __m512 fy = _mm512_mul_ps(_mm512_sub_ps(one, _mm512_abs_ps(px)), sign_not_zero16f(py));
+
+        px = _mm512_mask_blend_ps(lower, px, fx);
+        py = _mm512_mask_blend_ps(lower, py, fy);
+    }
+
+    AVML_FINL void oct_decode16f(__m512 px, __m512 py, __m512& x, __m512& y, __m512& z) {
+        z = _mm512_sub_ps(_mm512_sub_ps(_mm512_set1_ps(1.0f), _mm512_abs_ps(px)), _mm512_abs_ps(py));
+        __m512 t = _mm512_max_ps(_mm512_sub_ps(_mm512_setzero_ps(), z), _mm512_setzero_ps());
+        x = _mm512_fnmadd_ps(t, sign_not_zero16f(px), px);
+        y = _mm512_fnmadd_ps(t, sign_not_zero16f(py), py);
+        normalize3x16f(x, y, z);
+    }
+
+    AVML_FINL __m512i quantize_snorm16f(__m512 x, float scale) {
+        x = _mm512_min_ps(_mm512_max_ps(x, _mm512_set1_ps(-1.0f)), _mm512_set1_ps(1.0f));
+        return _mm512_cvtps_epi32(_mm512_mul_ps(x, _mm512_set1_ps(scale)));
+    }
+
+    AVML_FINL __m512 dequantize_snorm16f(__m512i x, float scale) {
+        __m512 t = _mm512_mul_ps(_mm512_cvtepi32_ps(x), _mm512_set1_ps(1.0f / scale));
+        return _mm512_max_ps(t, _mm512_set1_ps(-1.0f));
+    }
+
+#endif
+
+#if defined(AVML_AVX2)
+
+    AVML_FINL __m256 abs8f(__m256 x) {
+        return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+    }
+
+    AVML_FINL __m256 sign_not_zero8f(__m256 x) {
+        return _mm256_or_ps(_mm256_and_ps(x, _mm256_set1_ps(-0.0f)), _mm256_set1_ps(1.0f));
+    }
+
+    AVML_FINL void oct_encode8f(__m256 x, __m256 y, __m256 z, __m256& px, __m256& py) {
+        __m256 l1 = _mm256_add_ps(_mm256_add_ps(abs8f(x), abs8f(y)), abs8f(z));
+        px = _mm256_div_ps(x, l1);
+        py = _mm256_div_ps(y, l1);
+
+        __m256 lower = _mm256_cmp_ps(z, _mm256_setzero_ps(), _CMP_LT_OQ);
+        __m256 one = _mm256_set1_ps(1.0f);
+        __m256 fx = _mm256_mul_ps(_mm256_sub_ps(one, abs8f(py)), sign_not_zero8f(px));
+        __m256 fy = _mm256_mul_ps(_mm256_sub_ps(one, abs8f(px)), sign_not_zero8f(py));
+
+        px = _mm256_blendv_ps(px, fx, lower);
+        py = _mm256_blendv_ps(py, fy, lower);
+    }
+
+    AVML_FINL void oct_decode8f(__m256 px, __m256 py, __m256& x, __m256& y, __m256& z) {
+        z = _mm256_sub_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), abs8f(px)), abs8f(py));
+        __m256 t = _mm256_max_ps(_mm256_sub_ps(_mm256_setzero_ps(), z), _mm256_setzero_ps());
+        x = _mm256_sub_ps(px, _mm256_mul_ps(t, sign_not_zero8f(px)));
+        y = _mm256_sub_ps(py, _mm256_mul_ps(t, sign_not_zero8f(py)));
+        normalize3x8f(x, y, z);
+    }
+
+    AVML_FINL __m256i quantize_snorm8f(__m256 x, float scale) {
+        x = _mm256_min_ps(_mm256_max_ps(x, _mm256_set1_ps(-1.0f)), _mm256_set1_ps(1.0f));
+        return _mm256_cvtps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(scale)));
+    }
+
+    AVML_FINL __m256 dequantize_snorm8f(__m256i x, float scale) {
+        __m256 t = _mm256_mul_ps(_mm256_cvtepi32_ps(x), _mm256_set1_ps(1.0f / scale));
+        return _mm256_max_ps(t, _mm256_set1_ps(-1.0f));
+    }
+
+    // Packs the low three bytes of each 32-bit lane into 24 consecutive bytes
+    AVML_FINL void store24x8(std::uint8_t* p, __m256i v) {
+        const __m256i mask = _mm256_setr_epi8(
+            0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+            0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1
+        );
+
+        __m256i t = _mm256_shuffle_epi8(v, mask);
+        __m128i lo = _mm256_castsi256_si128(t);
+        __m128i hi = _mm256_extracti128_si256(t, 1);
+
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(p + 0x00), lo);
+        std::uint32_t lo_tail = _mm_cvtsi128_si32(_mm_srli_si128(lo, 8));
+        std::memcpy(p + 0x08, &lo_tail, sizeof(std::uint32_t));
+
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(p + 0x0C), hi);
+        std::uint32_t hi_tail = _mm_cvtsi128_si32(_mm_srli_si128(hi, 8));
+        std::memcpy(p + 0x14, &hi_tail, sizeof(std::uint32_t));
+    }
+
+    // Expands 24 consecutive bytes into the low three bytes of each 32-bit lane
+    AVML_FINL __m256i load24x8(const std::uint8_t* p) {
+        const __m256i mask = _mm256_setr_epi8(
+            0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1,
+            0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1
+        );
+
+        std::uint32_t lo_tail;
+        std::uint32_t hi_tail;
+        std::memcpy(&lo_tail, p + 0x08, sizeof(std::uint32_t));
+        std::memcpy(&hi_tail, p + 0x14, sizeof(std::uint32_t));
+
+        __m128i lo = _mm_unpacklo_epi64(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p + 0x00)),
+            _mm_cvtsi32_si128(lo_tail)
+        );
+        __m128i hi = _mm_unpacklo_epi64(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p + 0x0C)),
+            _mm_cvtsi32_si128(hi_tail)
+        );
+
+        return _mm256_shuffle_epi8(_mm256_set_m128i(hi, lo), mask);
+    }
+
+#endif
+
+}
+
+namespace avml {
+
+    //=====================================================
+    // Single vector encodings
+    //=====================================================
+
+    AVML_FINL std::uint32_t encode_oct32(uvec3f v) {
+        float x, y;
+        avml_impl::oct_encode(v, x, y);
+
+        std::uint32_t qx = std::uint32_t(avml_impl::quantize_snorm<16>(x)) & 0xFFFF;
+        std::uint32_t qy = std::uint32_t(avml_impl::quantize_snorm<16>(y)) & 0xFFFF;
+        return qx | (qy << 16);
+    }
+
+    AVML_FINL uvec3f decode_oct32(std::uint32_t v) {
+        float x = avml_impl::dequantize_snorm<16>(avml_impl::sign_extend<16>(v));
+        float y = avml_impl::dequantize_snorm<16>(avml_impl::sign_extend<16>(v >> 16));
+        return avml_impl::oct_decode(x, y);
+    }
+
+    AVML_FINL Packed_oct24 encode_oct24(uvec3f v) {
+        float x, y;
+        avml_impl::oct_encode(v, x, y);
+
+        std::uint32_t qx = std::uint32_t(avml_impl::quantize_snorm<12>(x)) & 0xFFF;
+        std::uint32_t qy = std::uint32_t(avml_impl::quantize_snorm<12>(y)) & 0xFFF;
+        std::uint32_t t = qx | (qy << 12);
+
+        Packed_oct24 ret;
+        ret.bytes[0] = std::uint8_t(t >> 0x00);
+        ret.bytes[1] = std::uint8_t(t >> 0x08);
+        ret.bytes[2] = std::uint8_t(t >> 0x10);
+        return ret;
+    }
+
+    AVML_FINL uvec3f decode_oct24(Packed_oct24 v) {
+        std::uint32_t t =
+            (std::uint32_t(v.bytes[0]) << 0x00) |
+            (std::uint32_t(v.bytes[1]) << 0x08) |
+            (std::uint32_t(v.bytes[2]) << 0x10);
+
+        float x = avml_impl::dequantize_snorm<12>(avml_impl::sign_extend<12>(t));
+        float y = avml_impl::dequantize_snorm<12>(avml_impl::sign_extend<12>(t >> 12));
+        return avml_impl::oct_decode(x, y);
+    }
+
+    AVML_FINL Packed_snorm16x3 encode_snorm16x3(uvec3f v) {
+        Packed_snorm16x3 ret;
+        ret.elements[0] = std::int16_t(avml_impl::quantize_snorm<16>(v[0]));
+        ret.elements[1] = std::int16_t(avml_impl::quantize_snorm<16>(v[1]));
+        ret.elements[2] = std::int16_t(avml_impl::quantize_snorm<16>(v[2]));
+        return ret;
+    }
+
+    AVML_FINL uvec3f decode_snorm16x3(Packed_snorm16x3 v) {
+        return avml_impl::normalize_to_uvec3f(
+            avml_impl::dequantize_snorm<16>(v.elements[0]),
+            avml_impl::dequantize_snorm<16>(v.elements[1]),
+            avml_impl::dequantize_snorm<16>(v.elements[2])
+        );
+    }
+
+    AVML_FINL std::uint32_t encode_snorm1010102(uvec3f v, std::uint32_t w) {
+        std::uint32_t x = std::uint32_t(avml_impl::quantize_snorm<10>(v[0])) & 0x3FF;
+        std::uint32_t y = std::uint32_t(avml_impl::quantize_snorm<10>(v[1])) & 0x3FF;
+        std::uint32_t z = std::uint32_t(avml_impl::quantize_snorm<10>(v[2])) & 0x3FF;
+        return x | (y << 10) | (z << 20) | (w << 30);
+    }
+
+    AVML_FINL uvec3f decode_snorm1010102(std::uint32_t v) {
+        return avml_impl::normalize_to_uvec3f(
+            avml_impl::dequantize_snorm<10>(avml_impl::sign_extend<10>(v >> 0x00)),
+            avml_impl::dequantize_snorm<10>(avml_impl::sign_extend<10>(v >> 0x0A)),
+            avml_impl::dequantize_snorm<10>(avml_impl::sign_extend<10>(v >> 0x14))
+        );
+    }
+
+    AVML_FINL std::uint32_t extract_snorm1010102_w(std::uint32_t v) {
+        return v >> 30;
+    }
+
+    //=====================================================
+    // Batch encodings
+    //=====================================================
+
+    inline void encode_oct32(const uvec3f* in, std::uint32_t* out, std::size_t n) {
+        AVML_PROFILE_BATCH("encode_oct32[batch]", n);
+
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        const float* src = reinterpret_cast<const float*>(in);
+        for (; i + 16 <= n; i += 16) {
+            __m512 x, y, z, px, py;
+            avml_impl::load3x16f(src + 3 * i, x, y, z);
+            avml_impl::oct_encode16f(x, y, z, px, py);
+
+            __m512i qx = avml_impl::quantize_snorm16f(px, 32767.0f);
+            __m512i qy = avml_impl::quantize_snorm16f(py, 32767.0f);
+            __m512i t = _mm512_or_si512(
+                _mm512_and_si512(qx, _mm512_set1_epi32(0xFFFF)),
+                _mm512_slli_epi32(qy, 16)
+            );
+            _mm512_storeu_si512(out + i, t);
+        }
+
+        #elif defined(AVML_AVX2)
+        const float* src = reinterpret_cast<const float*>(in);
+        for (; i + 8 <= n; i += 8) {
+            __m256 x, y, z, px, py;
+            avml_impl::load3x8f(src + 3 * i, x, y, z);
+            avml_impl::oct_encode8f(x, y, z, px, py);
+
+            __m256i qx = avml_impl::quantize_snorm8f(px, 32767.0f);
+            __m256i qy = avml_impl::quantize_snorm8f(py, 32767.0f);
+            __m256i t = _mm256_or_si256(
+                _mm256_and_si256(qx, _mm256_set1_epi32(0xFFFF)),
+                _mm256_slli_epi32(qy, 16)
+            );
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), t);
+        }
+
+        #endif
+        for (; i < n; ++i) {
+            out[i] = encode_oct32(in[i]);
+        }
+    }
+
+    inline void decode_oct32(const std::uint32_t* in, uvec3f* out, std::size_t n) {
+        AVML_PROFILE_BATCH("decode_oct32[batch]", n);
+
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        float* dst = reinterpret_cast<float*>(out);
+        for (; i + 16 <= n; i += 16) {
+            __m512i t = _mm512_loadu_si512(in + i);
+            __m512 px = avml_impl::dequantize_snorm16f(_mm512_srai_epi32(_mm512_slli_epi32(t, 16), 16), 32767.0f);
+            __m512 py = avml_impl::dequantize_snorm16f(_mm512_srai_epi32(t, 16), 32767.0f);
+
+            __m512 x, y, z;
+            avml_impl::oct_decode16f(px, py, x, y, z);
+            avml_impl::store3x16f(dst + 3 * i, x, y, z);
+        }
+
+        #elif defined(AVML_AVX2)
+        float* dst = reinterpret_cast<float*>(out);
+        for (; i + 8 <= n; i += 8) {
+            __m256i t = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+            __m256 px = avml_impl::dequantize_snorm8f(_mm256_srai_epi32(_mm256_slli_epi32(t, 16), 16), 32767.0f);
+            __m256 py = avml_impl::dequantize_snorm8f(_mm256_srai_epi32(t, 16), 32767.0f);
+
+            __m256 x, y, z;
+            avml_impl::oct_decode8f(px, py, x, y, z);
+            avml_impl::store3x8f(dst + 3 * i, x, y, z);
+        }
+
+        #endif
+        for (; i < n; ++i) {
+            out[i] = decode_oct32(in[i]);
+        }
+    }
+
+    inline void encode_oct24(const uvec3f* in, Packed_oct24* out, std::size_t n) {
+        AVML_PROFILE_BATCH("encode_oct24[batch]", n);
+
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX2)
+        const float* src = reinterpret_cast<const float*>(in);
+        std::uint8_t* dst = reinterpret_cast<std::uint8_t*>(out);
+
+        for (; i + 8 <= n; i += 8) {
+            __m256 x, y, z, px, py;
+            avml_impl::load3x8f(src + 3 * i, x, y, z);
+            avml_impl::oct_encode8f(x, y, z, px, py);
+
+            __m256i qx = avml_impl::quantize_snorm8f(px, 2047.0f);
+            __m256i qy = avml_impl::quantize_snorm8f(py, 2047.0f);
+            __m256i t = _mm256_or_si256(
+                _mm256_and_si256(qx, _mm256_set1_epi32(0xFFF)),
+                _mm256_slli_epi32(_mm256_and_si256(qy, _mm256_set1_epi32(0xFFF)), 12)
+            );
+            avml_impl::store24x8(dst + 3 * i, t);
+        }
+
+        #endif
+        for (; i < n; ++i) {
+            out[i] = encode_oct24(in[i]);
+        }
+    }
+
+    inline void decode_oct24(const Packed_oct24* in, uvec3f* out, std::size_t n) {
+        AVML_PROFILE_BATCH("decode_oct24[batch]", n);
+
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX2)
+        const std::uint8_t* src = reinterpret_cast<const std::uint8_t*>(in);
+        float* dst = reinterpret_cast<float*>(out);
+
+        for (; i + 8 <= n; i += 8) {
+            __m256i t = avml_impl::load24x8(src + 3 * i);
+            __m256 px = avml_impl::dequantize_snorm8f(_mm256_srai_epi32(_mm256_slli_epi32(t, 20), 20), 2047.0f);
+            __m256 py = avml_impl::dequantize_snorm8f(_mm256_srai_epi32(_mm256_slli_epi32(t, 8), 20), 2047.0f);
+
+            __m256 x, y, z;
+            avml_impl::oct_decode8f(px, py, x, y, z);
+            avml_impl::store3x8f(dst + 3 * i, x, y, z);
+        }
+
+        #endif
+        for (; i < n; ++i) {
+            out[i] = decode_oct24(in[i]);
+        }
+    }
+
+    inline void encode_snorm16x3(const uvec3f* in, Packed_snorm16x3* out, std::size_t n) {
+        AVML_PROFILE_BATCH("encode_snorm16x3[batch]", n);
+
+        // Components are quantized independently so the input is treated as
+        // a flat array of 3 * n floats
+        const float* src = reinterpret_cast<const float*>(in);
+        std::int16_t* dst = reinterpret_cast<std::int16_t*>(out);
+        std::size_t count = 3 * n;
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX2)
+        for (; i + 16 <= count; i += 16) {
+            __m256i lo = avml_impl::quantize_snorm8f(_mm256_loadu_ps(src + i + 0), 32767.0f);
+            __m256i hi = avml_impl::quantize_snorm8f(_mm256_loadu_ps(src + i + 8), 32767.0f);
+
+            __m256i t = _mm256_packs_epi32(lo, hi);
+            t = _mm256_permute4x64_epi64(t, _MM_SHUFFLE(3, 1, 2, 0));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), t);
+        }
+
+        #endif
+        for (; i < count; ++i) {
+            dst[i] = std::int16_t(avml_impl::quantize_snorm<16>(src[i]));
+        }
+    }
+
+    inline void decode_snorm16x3(const Packed_snorm16x3* in, uvec3f* out, std::size_t n) {
+        AVML_PROFILE_BATCH("decode_snorm16x3[batch]", n);
+
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX2)
+        const std::int16_t* src = reinterpret_cast<const std::int16_t*>(in);
+        float* dst = reinterpret_cast<float*>(out);
+
+        for (; i + 8 <= n; i += 8) {
+            const std::int16_t* p = src + 3 * i;
+            __m256 a = avml_impl::dequantize_snorm8f(_mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x00))), 32767.0f);
+            __m256 b = avml_impl::dequantize_snorm8f(_mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x08))), 32767.0f);
+            __m256 c = avml_impl::dequantize_snorm8f(_mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x10))), 32767.0f);
+
+            __m256 x, y, z;
+            avml_impl::deinterleave3x8f(a, b, c, x, y, z);
+            avml_impl::normalize3x8f(x, y, z);
+            avml_impl::store3x8f(dst + 3 * i, x, y, z);
+        }
+
+        #endif
+        for (; i < n; ++i) {
+            out[i] = decode_snorm16x3(in[i]);
+        }
+    }
+
+    inline void encode_snorm1010102(const uvec3f* in, std::uint32_t* out, std::size_t n) {
+        AVML_PROFILE_BATCH("encode_snorm1010102[batch]", n);
+
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        const float* src = reinterpret_cast<const float*>(in);
+        for (; i + 16 <= n; i += 16) {
+            __m512 x, y, z;
+            avml_impl::load3x16f(src + 3 * i, x, y, z);
+
+            __m512i mask = _mm512_set1_epi32(0x3FF);
+            __m512i qx = _mm512_and_si512(avml_impl::quantize_snorm16f(x, 511.0f), mask);
+            __m512i qy = _mm512_and_si512(avml_impl::quantize_snorm16f(y, 511.0f), mask);
+            __m512i qz = _mm512_and_si512(avml_impl::quantize_snorm16f(z, 511.0f), mask);
+
+            __m512i t = _mm512_or_si512(qx, _mm512_or_si512(_mm512_slli_epi32(qy, 10), _mm512_slli_epi32(qz, 20)));
+            _mm512_storeu_si512(out + i, t);
+        }
+
+        #elif defined(AVML_AVX2)
+        const float* src = reinterpret_cast<const float*>(in);
+        for (; i + 8 <= n; i += 8) {
+            __m256 x, y, z;
+            avml_impl::load3x8f(src + 3 * i, x, y, z);
+
+            __m256i mask = _mm256_set1_epi32(0x3FF);
+            __m256i qx = _mm256_and_si256(avml_impl::quantize_snorm8f(x, 511.0f), mask);
+            __m256i qy = _mm256_and_si256(avml_impl::quantize_snorm8f(y, 511.0f), mask);
+            __m256i qz = _mm256_and_si256(avml_impl::quantize_snorm8f(z, 511.0f), mask);
+
+            __m256i t = _mm256_or_si256(qx, _mm256_or_si256(_mm256_slli_epi32(qy, 10), _mm256_slli_epi32(qz, 20)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), t);
+        }
+
+        #endif
+        for (; i < n; ++i) {
+            out[i] = encode_snorm1010102(in[i]);
+        }
+    }
+
+    inline void decode_snorm1010102(const std::uint32_t* in, uvec3f* out, std::size_t n) {
+        AVML_PROFILE_BATCH("decode_snorm1010102[batch]", n);
+
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        float* dst = reinterpret_cast<float*>(out);
+        for (; i + 16 <= n; i += 16) {
+            __m512i t = _mm512_loadu_si512(in + i);
+            __m512 x = avml_impl::dequantize_snorm16f(_mm512_srai_epi32(_mm512_slli_epi32(t, 22), 22), 511.0f);
+            __m512 y = avml_impl::dequantize_snorm16f(_mm512_srai_epi32(_mm512_slli_epi32(t, 12), 22), 511.0f);
+            __m512 z = avml_impl::dequantize_snorm16f(_mm512_srai_epi32(_mm512_slli_epi32(t, 2), 22), 511.0f);
+
+            avml_impl::normalize3x16f(x, y, z);
+            avml_impl::store3x16f(dst + 3 * i, x, y, z);
+        }
+
+        #elif defined(AVML_AVX2)
+        float* dst = reinterpret_cast<float*>(out);
+        for (; i + 8 <= n; i += 8) {
+            __m256i t = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+            __m256 x = avml_impl::dequantize_snorm8f(_mm256_srai_epi32(_mm256_slli_epi32(t, 22), 22), 511.0f);
+            __m256 y = avml_impl::dequantize_snorm8f(_mm256_srai_epi32(_mm256_slli_epi32(t, 12), 22), 511.0f);
+            __m256 z = avml_impl::dequantize_snorm8f(_mm256_srai_epi32(_mm256_slli_epi32(t, 2), 22), 511.0f);
+
+            avml_impl::normalize3x8f(x, y, z);
+            avml_impl::store3x8f(dst + 3 * i, x, y, z);
+        }
+
+        #endif
+        for (; i < n; ++i) {
+            out[i] = decode_snorm1010102(in[i]);
+        }
+    }
+
+    //=====================================================
+    // Parallel batch encodings
+    //=====================================================
+
+    inline void encode_oct32(const uvec3f* in, std::uint32_t* out, std::size_t n, Executor& executor) {
+        avml_impl::parallel_batch<uvec3f, std::uint32_t>(executor, in, out, n, encode_oct32);
+    }
+
+    inline void decode_oct32(const std::uint32_t* in, uvec3f* out, std::size_t n, Executor& executor) {
+        avml_impl::parallel_batch<std::uint32_t, uvec3f>(executor, in, out, n, decode_oct32);
+    }
+
+    inline void encode_oct24(const uvec3f* in, Packed_oct24* out, std::size_t n, Executor& executor) {
+        avml_impl::parallel_batch<uvec3f, Packed_oct24>(executor, in, out, n, encode_oct24);
+    }
+
+    inline void decode_oct24(const Packed_oct24* in, uvec3f* out, std::size_t n, Executor& executor) {
+        avml_impl::parallel_batch<Packed_oct24, uvec3f>(executor, in, out, n, decode_oct24);
+    }
+
+    inline void encode_snorm16x3(const uvec3f* in, Packed_snorm16x3* out, std::size_t n, Executor& executor) {
+        avml_impl::parallel_batch<uvec3f, Packed_snorm16x3>(executor, in, out, n, encode_snorm16x3);
+    }
+
+    inline void decode_snorm16x3(const Packed_snorm16x3* in, uvec3f* out, std::size_t n, Executor& executor) {
+        avml_impl::parallel_batch<Packed_snorm16x3, uvec3f>(executor, in, out, n, decode_snorm16x3);
+    }
+
+    inline void encode_snorm1010102(const uvec3f* in, std::uint32_t* out, std::size_t n, Executor& executor) {
+        avml_impl::parallel_batch<uvec3f, std::uint32_t>(executor, in, out, n, encode_snorm1010102);
+    }
+
+    inline void decode_snorm1010102(const std::uint32_t* in, uvec3f* out, std::size_t n, Executor& executor) {
+        avml_impl::parallel_batch<std::uint32_t, uvec3f>(executor, in, out, n, decode_snorm1010102);
+    }
+
+}
+
+#endif
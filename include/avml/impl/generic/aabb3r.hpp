@@ -0,0 +1,126 @@
+#ifndef AVML_GEN_AABB3R_HPP
+#define AVML_GEN_AABB3R_HPP
+
+#include <limits>
+
+namespace avml {
+
+    template<class R>
+    class Aabb3R {
+    public:
+
+        using scalar = R;
+        using vector = Vector3R<R>;
+
+        //=================================================
+        // Creation functions
+        //=================================================
+
+        ///
+        /// \return Box containing no points which acts as the identity for
+        /// merge() and extend()
+        AVML_FINL static Aabb3R empty() {
+            const R inf = std::numeric_limits<R>::infinity();
+            return Aabb3R{vector{inf}, vector{-inf}};
+        }
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        AVML_FINL Aabb3R(vector minimum, vector maximum):
+            lo(minimum),
+            hi(maximum) {}
+
+        Aabb3R() = default;
+        Aabb3R(const Aabb3R&) = default;
+        Aabb3R(Aabb3R&&) noexcept = default;
+        ~Aabb3R() = default;
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        Aabb3R& operator=(const Aabb3R&) = default;
+        Aabb3R& operator=(Aabb3R&&) noexcept = default;
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        AVML_FINL vector& minimum() {
+            return lo;
+        }
+
+        AVML_FINL const vector& minimum() const {
+            return lo;
+        }
+
+        AVML_FINL vector& maximum() {
+            return hi;
+        }
+
+        AVML_FINL const vector& maximum() const {
+            return hi;
+        }
+
+    private:
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        vector lo;
+        vector hi;
+
+    };
+
+    template<class R>
+    AVML_FINL bool operator==(const Aabb3R<R>& lhs, const Aabb3R<R>& rhs) {
+        return (lhs.minimum() == rhs.minimum()) && (lhs.maximum() == rhs.maximum());
+    }
+
+    template<class R>
+    AVML_FINL bool operator!=(const Aabb3R<R>& lhs, const Aabb3R<R>& rhs) {
+        return !(lhs == rhs);
+    }
+
+    template<class R>
+    AVML_FINL bool is_empty(const Aabb3R<R>& b) {
+        return
+            (b.minimum()[0] > b.maximum()[0]) ||
+            (b.minimum()[1] > b.maximum()[1]) ||
+            (b.minimum()[2] > b.maximum()[2]);
+    }
+
+    template<class R>
+    AVML_FINL Aabb3R<R> extend(const Aabb3R<R>& b, Vector3R<R> p) {
+        return Aabb3R<R>{min(b.minimum(), p), max(b.maximum(), p)};
+    }
+
+    template<class R>
+    AVML_FINL Aabb3R<R> merge(const Aabb3R<R>& a, const Aabb3R<R>& b) {
+        return Aabb3R<R>{min(a.minimum(), b.minimum()), max(a.maximum(), b.maximum())};
+    }
+
+    template<class R>
+    AVML_FINL bool contains(const Aabb3R<R>& b, Vector3R<R> p) {
+        return
+            (b.minimum()[0] <= p[0]) && (p[0] <= b.maximum()[0]) &&
+            (b.minimum()[1] <= p[1]) && (p[1] <= b.maximum()[1]) &&
+            (b.minimum()[2] <= p[2]) && (p[2] <= b.maximum()[2]);
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> center(const Aabb3R<R>& b) {
+        return (b.minimum() + b.maximum()) * R(0.5);
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> extent(const Aabb3R<R>& b) {
+        return b.maximum() - b.minimum();
+    }
+
+}
+
+#endif
@@ -0,0 +1,301 @@
+#ifndef AVML_AFFINE3X4R_HPP
+#define AVML_AFFINE3X4R_HPP
+
+namespace avml {
+
+    ///
+    /// Affine transform stored as the top three rows of a 4x4 matrix. The
+    /// fourth row is implicitly {0, 0, 0, 1}.
+    ///
+    template<class R>
+    class Affine3x4R {
+    public:
+
+        using scalar = R;
+        using vector = Vector4R<R>;
+
+        static constexpr unsigned width = 4;
+        static constexpr unsigned height = 3;
+
+        //=================================================
+        // Creation methods
+        //=================================================
+
+        AVML_FINL static Affine3x4R read(const R* ptr) {
+            Affine3x4R ret;
+            ret[0] = vector::read(ptr + 0x0);
+            ret[1] = vector::read(ptr + 0x4);
+            ret[2] = vector::read(ptr + 0x8);
+            return ret;
+        }
+
+        AVML_FINL static Affine3x4R read_aligned(const R* ptr) {
+            Affine3x4R ret;
+            ret[0] = vector::read_aligned(ptr + 0x0);
+            ret[1] = vector::read_aligned(ptr + 0x4);
+            ret[2] = vector::read_aligned(ptr + 0x8);
+            return ret;
+        }
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        AVML_FINL explicit Affine3x4R(R d):
+            rows{
+                vector{d, R(0), R(0), R(0)},
+                vector{R(0), d, R(0), R(0)},
+                vector{R(0), R(0), d, R(0)}
+            } {}
+
+        AVML_FINL Affine3x4R(
+            R a, R b, R c, R d,
+            R e, R f, R g, R h,
+            R i, R j, R k, R l):
+            rows{
+                vector{a, b, c, d},
+                vector{e, f, g, h},
+                vector{i, j, k, l}
+            } {}
+
+        AVML_FINL Affine3x4R(vector a, vector b, vector c):
+            rows{a, b, c} {}
+
+        AVML_FINL Affine3x4R(const Matrix3x3R<R>& linear, Vector3R<R> translation):
+            rows{
+                vector{linear[0], translation[0]},
+                vector{linear[1], translation[1]},
+                vector{linear[2], translation[2]}
+            } {}
+
+        ///
+        /// Drops the last row of m, which is assumed to be {0, 0, 0, 1}
+        ///
+        AVML_FINL explicit Affine3x4R(const Matrix4x4R<R>& m):
+            rows{m[0], m[1], m[2]} {}
+
+        Affine3x4R() = default;
+        Affine3x4R(const Affine3x4R&) = default;
+        Affine3x4R(Affine3x4R&&) = default;
+        ~Affine3x4R() = default;
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        Affine3x4R& operator=(const Affine3x4R&) = default;
+        Affine3x4R& operator=(Affine3x4R&&) = default;
+
+        //=================================================
+        // Arithmetic assignment operators
+        //=================================================
+
+        AVML_FINL Affine3x4R& operator*=(const Affine3x4R& rhs) {
+            Affine3x4R ret;
+            for (unsigned i = 0; i < height; ++i) {
+                ret.rows[i] =
+                    rhs.rows[0] * rows[i][0] +
+                    rhs.rows[1] * rows[i][1] +
+                    rhs.rows[2] * rows[i][2] +
+                    vector{R(0), R(0), R(0), rows[i][3]};
+            }
+
+            *this = ret;
+
+            return *this;
+        }
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        AVML_FINL vector& operator[](unsigned i) {
+            return rows[i];
+        }
+
+        AVML_FINL const vector& operator[](unsigned i) const {
+            return rows[i];
+        }
+
+        AVML_FINL R* data() {
+            return rows[0].data();
+        }
+
+        AVML_FINL const R* data() const {
+            return rows[0].data();
+        }
+
+        //=================================================
+        // Conversion operators
+        //=================================================
+
+        AVML_FINL explicit operator Matrix4x4R<R>() const {
+            return Matrix4x4R<R>{
+                rows[0],
+                rows[1],
+                rows[2],
+                vector{R(0), R(0), R(0), R(1)}
+            };
+        }
+
+    private:
+
+        vector rows[3];
+
+    };
+
+    template<class R>
+    AVML_FINL bool operator==(const Affine3x4R<R>& lhs, const Affine3x4R<R>& rhs) {
+        bool ret = true;
+        for (unsigned i = 0; i < Affine3x4R<R>::height; ++i) {
+            ret &= (lhs[i] == rhs[i]);
+        }
+        return ret;
+    }
+
+    template<class R>
+    AVML_FINL bool operator!=(const Affine3x4R<R>& lhs, const Affine3x4R<R>& rhs) {
+        return !(lhs == rhs);
+    }
+
+    template<class R>
+    AVML_FINL Affine3x4R<R> operator*(Affine3x4R<R> lhs, const Affine3x4R<R>& rhs) {
+        lhs *= rhs;
+        return lhs;
+    }
+
+    template<class R>
+    AVML_FINL Vector4R<R> operator*(const Affine3x4R<R>& lhs, Vector4R<R> rhs) {
+        return Vector4R<R>{
+            dot(lhs[0], rhs),
+            dot(lhs[1], rhs),
+            dot(lhs[2], rhs),
+            rhs[3]
+        };
+    }
+
+    ///
+    /// \return lhs applied to the point p, i.e. with an implicit w of 1
+    ///
+    template<class R>
+    AVML_FINL Vector3R<R> transform_point(const Affine3x4R<R>& lhs, Vector3R<R> p) {
+        Vector4R<R> v = lhs * Vector4R<R>{p, R(1)};
+        return Vector3R<R>{v[0], v[1], v[2]};
+    }
+
+    ///
+    /// \return lhs applied to the direction d, i.e. ignoring translation
+    ///
+    template<class R>
+    AVML_FINL Vector3R<R> transform_vector(const Affine3x4R<R>& lhs, Vector3R<R> d) {
+        Vector4R<R> v = lhs * Vector4R<R>{d, R(0)};
+        return Vector3R<R>{v[0], v[1], v[2]};
+    }
+
+    template<class R>
+    AVML_FINL Matrix3x3R<R> extract3x3(const Affine3x4R<R>& a) {
+        return Matrix3x3R<R>{
+            a[0][0], a[0][1], a[0][2],
+            a[1][0], a[1][1], a[1][2],
+            a[2][0], a[2][1], a[2][2]
+        };
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> translation(const Affine3x4R<R>& a) {
+        return Vector3R<R>{a[0][3], a[1][3], a[2][3]};
+    }
+
+    template<class R>
+    AVML_FINL R determinant(const Affine3x4R<R>& a) {
+        return
+            a[0][0] * (a[1][1] * a[2][2] - a[1][2] * a[2][1]) -
+            a[0][1] * (a[1][0] * a[2][2] - a[1][2] * a[2][0]) +
+            a[0][2] * (a[1][0] * a[2][1] - a[1][1] * a[2][0]);
+    }
+
+}
+
+namespace avml_impl {
+
+    ///
+    /// \return Inverse of the affine transform with translation t whose
+    /// linear part has the inverse l
+    ///
+    template<class R>
+    AVML_FINL avml::Affine3x4R<R> affine_from_inverse_linear(const avml::Matrix3x3R<R>& l, avml::Vector3R<R> t) {
+        return avml::Affine3x4R<R>{
+            l,
+            avml::Vector3R<R>{
+                -(l[0][0] * t[0] + l[0][1] * t[1] + l[0][2] * t[2]),
+                -(l[1][0] * t[0] + l[1][1] * t[1] + l[1][2] * t[2]),
+                -(l[2][0] * t[0] + l[2][1] * t[1] + l[2][2] * t[2])
+            }
+        };
+    }
+
+}
+
+namespace avml {
+
+    ///
+    /// General affine inverse. Inverts the upper 3x3 block by its adjugate.
+    ///
+    template<class R>
+    AVML_FINL Affine3x4R<R> inverse(const Affine3x4R<R>& a) {
+        AVML_PROFILE("inverse(Affine3x4R)");
+
+        R c00 = a[1][1] * a[2][2] - a[1][2] * a[2][1];
+        R c01 = a[1][2] * a[2][0] - a[1][0] * a[2][2];
+        R c02 = a[1][0] * a[2][1] - a[1][1] * a[2][0];
+
+        R inv_det = R(1) / (a[0][0] * c00 + a[0][1] * c01 + a[0][2] * c02);
+
+        Matrix3x3R<R> l{
+            c00 * inv_det,
+            (a[0][2] * a[2][1] - a[0][1] * a[2][2]) * inv_det,
+            (a[0][1] * a[1][2] - a[0][2] * a[1][1]) * inv_det,
+
+            c01 * inv_det,
+            (a[0][0] * a[2][2] - a[0][2] * a[2][0]) * inv_det,
+            (a[0][2] * a[1][0] - a[0][0] * a[1][2]) * inv_det,
+
+            c02 * inv_det,
+            (a[0][1] * a[2][0] - a[0][0] * a[2][1]) * inv_det,
+            (a[0][0] * a[1][1] - a[0][1] * a[1][0]) * inv_det
+        };
+
+        return avml_impl::affine_from_inverse_linear(l, translation(a));
+    }
+
+    ///
+    /// Inverse of a rotation followed by a translation. The linear part of a
+    /// must be orthonormal.
+    ///
+    template<class R>
+    AVML_FINL Affine3x4R<R> rigid_inverse(const Affine3x4R<R>& a) {
+        AVML_PROFILE("rigid_inverse(Affine3x4R)");
+
+        return avml_impl::affine_from_inverse_linear(transpose(extract3x3(a)), translation(a));
+    }
+
+    ///
+    /// Inverse of a scaling, rotation and translation applied in that order.
+    /// The columns of a's linear part must be orthogonal but may have any
+    /// non-zero length.
+    ///
+    template<class R>
+    AVML_FINL Affine3x4R<R> scaled_inverse(const Affine3x4R<R>& a) {
+        AVML_PROFILE("scaled_inverse(Affine3x4R)");
+
+        Matrix3x3R<R> l = transpose(extract3x3(a));
+        for (unsigned i = 0; i < 3; ++i) {
+            l[i] /= dot(l[i], l[i]);
+        }
+
+        return avml_impl::affine_from_inverse_linear(l, translation(a));
+    }
+
+}
+
+#endif
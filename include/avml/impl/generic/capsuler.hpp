@@ -0,0 +1,92 @@
+#ifndef AVML_GEN_CAPSULER_HPP
+#define AVML_GEN_CAPSULER_HPP
+
+namespace avml {
+
+    ///
+    /// Points within radius of the segment from p0 to p1
+    ///
+    template<class R>
+    class CapsuleR {
+    public:
+
+        using scalar = R;
+        using vector = Vector3R<R>;
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        AVML_FINL CapsuleR(vector p0, vector p1, R radius):
+            a(p0),
+            b(p1),
+            r(radius) {}
+
+        CapsuleR() = default;
+        CapsuleR(const CapsuleR&) = default;
+        CapsuleR(CapsuleR&&) noexcept = default;
+        ~CapsuleR() = default;
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        CapsuleR& operator=(const CapsuleR&) = default;
+        CapsuleR& operator=(CapsuleR&&) noexcept = default;
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        AVML_FINL vector& p0() {
+            return a;
+        }
+
+        AVML_FINL const vector& p0() const {
+            return a;
+        }
+
+        AVML_FINL vector& p1() {
+            return b;
+        }
+
+        AVML_FINL const vector& p1() const {
+            return b;
+        }
+
+        AVML_FINL R& radius() {
+            return r;
+        }
+
+        AVML_FINL const R& radius() const {
+            return r;
+        }
+
+    private:
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        vector a;
+        vector b;
+        R r;
+
+    };
+
+    template<class R>
+    AVML_FINL bool operator==(const CapsuleR<R>& lhs, const CapsuleR<R>& rhs) {
+        return
+            (lhs.p0() == rhs.p0()) &&
+            (lhs.p1() == rhs.p1()) &&
+            (lhs.radius() == rhs.radius());
+    }
+
+    template<class R>
+    AVML_FINL bool operator!=(const CapsuleR<R>& lhs, const CapsuleR<R>& rhs) {
+        return !(lhs == rhs);
+    }
+
+}
+
+#endif
@@ -0,0 +1,226 @@
+#ifndef AVML_GEN_DUALQUATR_HPP
+#define AVML_GEN_DUALQUATR_HPP
+
+namespace avml_impl {
+
+    ///
+    /// Hamilton product of quaternions stored as {x, y, z, w}
+    ///
+    template<class R>
+    AVML_FINL avml::Vector4R<R> quaternion_product(avml::Vector4R<R> a, avml::Vector4R<R> b) {
+        return avml::Vector4R<R>{
+            a[3] * b[0] + a[0] * b[3] + a[1] * b[2] - a[2] * b[1],
+            a[3] * b[1] - a[0] * b[2] + a[1] * b[3] + a[2] * b[0],
+            a[3] * b[2] + a[0] * b[1] - a[1] * b[0] + a[2] * b[3],
+            a[3] * b[3] - a[0] * b[0] - a[1] * b[1] - a[2] * b[2]
+        };
+    }
+
+    template<class R>
+    AVML_FINL avml::Vector4R<R> quaternion_conjugate(avml::Vector4R<R> q) {
+        return avml::Vector4R<R>{-q[0], -q[1], -q[2], q[3]};
+    }
+
+}
+
+namespace avml {
+
+    ///
+    /// Rigid transform stored as a unit dual quaternion real + e * dual.
+    /// real is the rotation and dual is half the translation multiplied by
+    /// the rotation. Both parts are quaternions stored as {x, y, z, w}.
+    ///
+    /// Unlike matrices, dual quaternions can be blended linearly without
+    /// introducing scale or shear, which makes them well suited to skinning.
+    ///
+    template<class R>
+    class Dual_quaternionR {
+    public:
+
+        using scalar = R;
+        using vector = Vector4R<R>;
+
+        //=================================================
+        // Creation methods
+        //=================================================
+
+        AVML_FINL static Dual_quaternionR identity() {
+            return Dual_quaternionR{
+                vector{R(0), R(0), R(0), R(1)},
+                vector{R(0), R(0), R(0), R(0)}
+            };
+        }
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        AVML_FINL Dual_quaternionR(vector real, vector dual):
+            parts{real, dual} {}
+
+        ///
+        /// Transform rotating by rotation and then translating by translation
+        ///
+        AVML_FINL Dual_quaternionR(Unit_vector4R<R> rotation, Vector3R<R> translation):
+            parts{
+                vector{rotation},
+                avml_impl::quaternion_product(vector{translation * R(0.5), R(0)}, vector{rotation})
+            } {}
+
+        Dual_quaternionR() = default;
+        Dual_quaternionR(const Dual_quaternionR&) = default;
+        Dual_quaternionR(Dual_quaternionR&&) = default;
+        ~Dual_quaternionR() = default;
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        Dual_quaternionR& operator=(const Dual_quaternionR&) = default;
+        Dual_quaternionR& operator=(Dual_quaternionR&&) = default;
+
+        //=================================================
+        // Arithmetic assignment operators
+        //=================================================
+
+        ///
+        /// Composes the transforms so that rhs is applied first
+        ///
+        AVML_FINL Dual_quaternionR& operator*=(const Dual_quaternionR& rhs) {
+            vector r = avml_impl::quaternion_product(parts[0], rhs.parts[0]);
+            vector d =
+                avml_impl::quaternion_product(parts[0], rhs.parts[1]) +
+                avml_impl::quaternion_product(parts[1], rhs.parts[0]);
+
+            parts[0] = r;
+            parts[1] = d;
+            return *this;
+        }
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        AVML_FINL vector& real() {
+            return parts[0];
+        }
+
+        AVML_FINL const vector& real() const {
+            return parts[0];
+        }
+
+        AVML_FINL vector& dual() {
+            return parts[1];
+        }
+
+        AVML_FINL const vector& dual() const {
+            return parts[1];
+        }
+
+        AVML_FINL R* data() {
+            return parts[0].data();
+        }
+
+        AVML_FINL const R* data() const {
+            return parts[0].data();
+        }
+
+        //=================================================
+        // Conversion operators
+        //=================================================
+
+        AVML_FINL explicit operator Affine3x4R<R>() const {
+            R x = parts[0][0];
+            R y = parts[0][1];
+            R z = parts[0][2];
+            R w = parts[0][3];
+
+            R xx = x * x;
+            R yy = y * y;
+            R zz = z * z;
+            R xy = x * y;
+            R xz = x * z;
+            R yz = y * z;
+            R wx = w * x;
+            R wy = w * y;
+            R wz = w * z;
+
+            Vector3R<R> t = translation(*this);
+
+            return Affine3x4R<R>{
+                R(1) - R(2) * (yy + zz), R(2) * (xy - wz), R(2) * (xz + wy), t[0],
+                R(2) * (xy + wz), R(1) - R(2) * (xx + zz), R(2) * (yz - wx), t[1],
+                R(2) * (xz - wy), R(2) * (yz + wx), R(1) - R(2) * (xx + yy), t[2]
+            };
+        }
+
+    private:
+
+        vector parts[2];
+
+    };
+
+    template<class R>
+    AVML_FINL bool operator==(const Dual_quaternionR<R>& lhs, const Dual_quaternionR<R>& rhs) {
+        return lhs.real() == rhs.real() && lhs.dual() == rhs.dual();
+    }
+
+    template<class R>
+    AVML_FINL bool operator!=(const Dual_quaternionR<R>& lhs, const Dual_quaternionR<R>& rhs) {
+        return !(lhs == rhs);
+    }
+
+    template<class R>
+    AVML_FINL Dual_quaternionR<R> operator*(Dual_quaternionR<R> lhs, const Dual_quaternionR<R>& rhs) {
+        lhs *= rhs;
+        return lhs;
+    }
+
+    ///
+    /// \return Inverse of q, assuming that q is normalized
+    template<class R>
+    AVML_FINL Dual_quaternionR<R> conjugate(const Dual_quaternionR<R>& q) {
+        return Dual_quaternionR<R>{
+            avml_impl::quaternion_conjugate(q.real()),
+            avml_impl::quaternion_conjugate(q.dual())
+        };
+    }
+
+    ///
+    /// Divides both parts by the length of the real part. Blended dual
+    /// quaternions must be normalized before they are used as transforms.
+    ///
+    template<class R>
+    AVML_FINL Dual_quaternionR<R> normalize(const Dual_quaternionR<R>& q) {
+        const Vector4R<R>& r = q.real();
+        R inv = R(1) / std::sqrt(r[0] * r[0] + r[1] * r[1] + r[2] * r[2] + r[3] * r[3]);
+        return Dual_quaternionR<R>{q.real() * inv, q.dual() * inv};
+    }
+
+    template<class R>
+    AVML_FINL Vector4R<R> rotation(const Dual_quaternionR<R>& q) {
+        return q.real();
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> translation(const Dual_quaternionR<R>& q) {
+        Vector4R<R> t = avml_impl::quaternion_product(q.dual(), avml_impl::quaternion_conjugate(q.real()));
+        return Vector3R<R>{R(2) * t[0], R(2) * t[1], R(2) * t[2]};
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> transform_vector(const Dual_quaternionR<R>& q, Vector3R<R> v) {
+        const Vector4R<R>& r = q.real();
+        Vector3R<R> u{r[0], r[1], r[2]};
+        Vector3R<R> t = cross(u, v) * R(2);
+        return v + t * r[3] + cross(u, t);
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> transform_point(const Dual_quaternionR<R>& q, Vector3R<R> p) {
+        return transform_vector(q, p) + translation(q);
+    }
+
+}
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef AVML_GEN_LINER_HPP
+#define AVML_GEN_LINER_HPP
+
+namespace avml {
+
+    ///
+    /// Points origin() + t * direction() for all t
+    ///
+    template<class R>
+    class LineR {
+    public:
+
+        using scalar = R;
+        using vector = Vector3R<R>;
+        using unit_vector = Unit_vector3R<R>;
+
+        //=================================================
+        // Creation functions
+        //=================================================
+
+        ///
+        /// Line through two distinct points, directed from a to b
+        ///
+        AVML_FINL static LineR from_points(vector a, vector b) {
+            return LineR{a, normalize(b - a)};
+        }
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        AVML_FINL LineR(vector origin, unit_vector direction):
+            o(origin),
+            d(direction) {}
+
+        LineR() = default;
+        LineR(const LineR&) = default;
+        LineR(LineR&&) noexcept = default;
+        ~LineR() = default;
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        LineR& operator=(const LineR&) = default;
+        LineR& operator=(LineR&&) noexcept = default;
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        AVML_FINL vector& origin() {
+            return o;
+        }
+
+        AVML_FINL const vector& origin() const {
+            return o;
+        }
+
+        AVML_FINL unit_vector& direction() {
+            return d;
+        }
+
+        AVML_FINL const unit_vector& direction() const {
+            return d;
+        }
+
+    private:
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        vector o;
+        unit_vector d;
+
+    };
+
+    template<class R>
+    AVML_FINL bool operator==(const LineR<R>& lhs, const LineR<R>& rhs) {
+        return (lhs.origin() == rhs.origin()) && (lhs.direction() == rhs.direction());
+    }
+
+    template<class R>
+    AVML_FINL bool operator!=(const LineR<R>& lhs, const LineR<R>& rhs) {
+        return !(lhs == rhs);
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> closest_point(const LineR<R>& line, Vector3R<R> p) {
+        return line.origin() + line.direction() * dot(p - line.origin(), line.direction());
+    }
+
+}
+
+#endif
@@ -36,22 +36,19 @@ namespace avml {
         //=================================================
 
         AVML_FINL explicit Matrix2x2R(R d) noexcept:
-            elements {
-                {d, 0.0f},
-                {0.0f, d}
+            rows{
+                vector{d, 0.0f},
+                vector{0.0f, d}
         } {}
 
         AVML_FINL Matrix2x2R(R a, R b, R c, R d):
-            elements{
-                {a, b},
-                {c, d}
+            rows{
+                vector{a, b},
+                vector{c, d}
             } {}
 
         AVML_FINL Matrix2x2R(vector a, vector b):
-            elements{
-                {a[0], a[1]},
-                {b[0], b[1]}
-        } {}
+            rows{a, b} {}
 
         Matrix2x2R() = default;
         Matrix2x2R(const Matrix2x2R&) = default;
@@ -113,17 +110,19 @@ namespace avml {
         }
 
         AVML_FINL Matrix2x2R& operator*=(const Matrix2x2R& rhs) {
-            auto ret = *this;
+            Matrix2x2R ret;
             for (unsigned i = 0; i < height; ++i) {
                 for (unsigned j = 0; j < width; ++j) {
-                    R tmp = 0.0f;
+                    R tmp{};
                     for (unsigned k = 0; k < width; ++k) {
-                        tmp += elements[i][k] * rhs.elements[k][j];
+                        tmp += rows[i][k] * rhs.rows[k][j];
                     }
-                    ret[i][j] = tmp;
+                    ret.rows[i][j] = tmp;
                 }
             }
 
+            *this = ret;
+
             return *this;
         }
 
@@ -132,27 +131,24 @@ namespace avml {
         //=================================================
 
         AVML_FINL vector& operator[](unsigned i) {
-            return *reinterpret_cast<vector*>(elements[i]);
+            return rows[i];
         }
 
         AVML_FINL const vector& operator[](unsigned i) const {
-            return *reinterpret_cast<const vector*>(elements[i]);
+            return rows[i];
         }
 
         AVML_FINL R* data() {
-            return elements[0];
+            return rows[0].data();
         }
 
         AVML_FINL const R* data() const {
-            return elements[0];
+            return rows[0].data();
         }
 
     private:
 
-        R elements[2][2] {
-            {0.0f, 0.0f},
-            {0.0f, 0.0f}
-        };
+        vector rows[2]{};
 
     };
 
@@ -239,6 +235,8 @@ namespace avml {
 
     template<class R>
     AVML_FINL Matrix2x2R<R> inverse(const Matrix2x2R<R>& m) {
+        AVML_PROFILE("inverse(Matrix2x2R)");
+
         auto det = determinant(m);
 
         return Matrix2x2R<R> {
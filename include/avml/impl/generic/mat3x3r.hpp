@@ -38,28 +38,24 @@ namespace avml {
         //=================================================
 
         AVML_FINL explicit Matrix3x3R(R d):
-            elements {
-                {d, 0.0f, 0.0f},
-                {0.0f, d, 0.0f},
-                {0.0f, 0.0f, d}
+            rows{
+                vector{d, 0.0f, 0.0f},
+                vector{0.0f, d, 0.0f},
+                vector{0.0f, 0.0f, d}
         } {}
 
         AVML_FINL Matrix3x3R(
             R a, R b, R c,
             R d, R e, R f,
             R g, R h, R i):
-            elements{
-                {a, b, c},
-                {d, e, f},
-                {g, h, i}
+            rows{
+                vector{a, b, c},
+                vector{d, e, f},
+                vector{g, h, i}
             } {}
 
         AVML_FINL Matrix3x3R(vector a, vector b, vector c):
-            elements{
-                {a[0], a[1], a[2]},
-                {b[0], b[1], b[2]},
-                {c[0], c[1], c[2]}
-        } {}
+            rows{a, b, c} {}
 
         Matrix3x3R() = default;
         Matrix3x3R(const Matrix3x3R&) = default;
@@ -122,17 +118,19 @@ namespace avml {
         }
 
         AVML_FINL Matrix3x3R& operator*=(const Matrix3x3R& rhs) {
-            auto ret = *this;
+            Matrix3x3R ret;
             for (unsigned i = 0; i < height; ++i) {
                 for (unsigned j = 0; j < width; ++j) {
-                    R tmp = 0.0f;
+                    R tmp{};
                     for (unsigned k = 0; k < width; ++k) {
-                        tmp += elements[i][k] * rhs.elements[k][j];
+                        tmp += rows[i][k] * rhs.rows[k][j];
                     }
-                    ret[i][j] = tmp;
+                    ret.rows[i][j] = tmp;
                 }
             }
 
+            *this = ret;
+
             return *this;
         }
 
@@ -141,28 +139,24 @@ namespace avml {
         //=================================================
 
         AVML_FINL vector& operator[](unsigned i) {
-            return *reinterpret_cast<vector*>(elements[i]);
+            return rows[i];
         }
 
         AVML_FINL const vector& operator[](unsigned i) const {
-            return *reinterpret_cast<const vector*>(elements[i]);
+            return rows[i];
         }
 
         AVML_FINL R* data() {
-            return elements[0];
+            return rows[0].data();
         }
 
         AVML_FINL const R* data() const {
-            return elements[0];
+            return rows[0].data();
         }
 
     private:
 
-        R elements[3][3]{
-            {0.0f, 0.0f, 0.0f},
-            {0.0f, 0.0f, 0.0f},
-            {0.0f, 0.0f, 0.0f}
-        };
+        vector rows[3]{};
 
     };
 
@@ -253,6 +247,8 @@ namespace avml {
 
     template<class R>
     AVML_FINL Matrix3x3R<R> inverse(const Matrix3x3R<R>& m) {
+        AVML_PROFILE("inverse(Matrix3x3R)");
+
         auto det = determinant(m);
 
         return Matrix3x3R<R> {
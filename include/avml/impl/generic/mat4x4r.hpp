@@ -40,11 +40,11 @@ namespace avml {
         //=================================================
 
         AVML_FINL explicit Matrix4x4R(R d):
-            elements {
-                {d, 0.0f, 0.0f, 0.0f},
-                {0.0f, d, 0.0f, 0.0f},
-                {0.0f, 0.0f, d, 0.0f},
-                {0.0f, 0.0f, 0.0f, d}
+            rows{
+                vector{d, 0.0f, 0.0f, 0.0f},
+                vector{0.0f, d, 0.0f, 0.0f},
+                vector{0.0f, 0.0f, d, 0.0f},
+                vector{0.0f, 0.0f, 0.0f, d}
         } {}
 
         AVML_FINL Matrix4x4R(
@@ -52,20 +52,15 @@ namespace avml {
             R e, R f, R g, R h,
             R i, R j, R k, R l,
             R m, R n, R o, R p):
-            elements{
-                {a, b, c, d},
-                {e, f, g, h},
-                {i, j, k, l},
-                {m, n, o, p}
+            rows{
+                vector{a, b, c, d},
+                vector{e, f, g, h},
+                vector{i, j, k, l},
+                vector{m, n, o, p}
             } {}
 
         AVML_FINL Matrix4x4R(vector a, vector b, vector c, vector d):
-            elements{
-                {a[0], a[1], a[2], a[3]},
-                {b[0], b[1], b[2], b[3]},
-                {c[0], c[1], c[2], c[3]},
-                {d[0], d[1], d[2], d[3]}
-        } {}
+            rows{a, b, c, d} {}
 
         Matrix4x4R() = default;
         Matrix4x4R(const Matrix4x4R&) = default;
@@ -129,18 +124,18 @@ namespace avml {
         }
 
         AVML_FINL Matrix4x4R& operator*=(const Matrix4x4R& rhs) {
-            Matrix4x4R result{};
+            Matrix4x4R ret;
             for (unsigned i = 0; i < height; ++i) {
                 for (unsigned j = 0; j < width; ++j) {
                     R tmp{};
                     for (unsigned k = 0; k < width; ++k) {
-                        tmp += elements[i][k] * rhs.elements[k][j];
+                        tmp += rows[i][k] * rhs.rows[k][j];
                     }
-                    result[i][j] = tmp;
+                    ret.rows[i][j] = tmp;
                 }
             }
 
-            *this = result;
+            *this = ret;
 
             return *this;
         }
@@ -150,24 +145,24 @@ namespace avml {
         //=================================================
 
         AVML_FINL vector& operator[](unsigned i) {
-            return *reinterpret_cast<vector*>(elements[i]);
+            return rows[i];
         }
 
         AVML_FINL const vector& operator[](unsigned i) const {
-            return *reinterpret_cast<const vector*>(elements[i]);
+            return rows[i];
         }
 
         AVML_FINL R* data() {
-            return elements[0];
+            return rows[0].data();
         }
 
         AVML_FINL const R* data() const {
-            return elements[0];
+            return rows[0].data();
         }
 
     private:
 
-        R elements[4][4];
+        vector rows[4];
 
     };
 
@@ -255,19 +250,19 @@ namespace avml {
             m[1][3] * (m[2][1] * m[3][2] - m[2][2] * m[3][1])
         );
 
-        R y = m[1][0] * (
+        R y = m[0][1] * (
             m[1][0] * (m[2][2] * m[3][3] - m[2][3] * m[3][2]) -
             m[1][2] * (m[2][0] * m[3][3] - m[2][3] * m[3][0]) +
             m[1][3] * (m[2][0] * m[3][2] - m[2][2] * m[3][0])
         );
 
-        R z = m[2][0] * (
+        R z = m[0][2] * (
             m[1][0] * (m[2][1] * m[3][3] - m[2][3] * m[3][1]) -
             m[1][1] * (m[2][0] * m[3][3] - m[2][3] * m[3][0]) +
             m[1][3] * (m[2][0] * m[3][1] - m[2][1] * m[3][0])
         );
 
-        R w = m[3][0] * (
+        R w = m[0][3] * (
             m[1][0] * (m[2][1] * m[3][2] - m[2][2] * m[3][1]) -
             m[1][1] * (m[2][0] * m[3][2] - m[2][2] * m[3][0]) +
             m[1][2] * (m[2][0] * m[3][1] - m[2][1] * m[3][0])
@@ -278,6 +273,8 @@ namespace avml {
 
     template<class R>
     AVML_FINL Matrix4x4R<R> inverse(const Matrix4x4R<R>& mat) {
+        AVML_PROFILE("inverse(Matrix4x4R)");
+
         auto det = determinant(mat);
 
         R a = mat[0][0];
@@ -304,7 +301,7 @@ namespace avml {
         R io = i * o;
         R ip = i * p;
 
-        R jm = j * p;
+        R jm = j * m;
         R jo = j * o;
         R jp = j * p;
 
@@ -373,7 +370,7 @@ namespace avml {
         R t02 =  b * gp_ho - c * fp_hn + d * fo_gn;
         R t03 = -b * gl_hk + c * fl_hj - d * fk_gj;
 
-        R t10 = -e * kp_lo + g * jp_ln - h * io_km;
+        R t10 = -e * kp_lo + g * ip_lm - h * io_km;
         R t11 =  a * kp_lo - c * ip_lm + d * io_km;
         R t12 = -a * gp_ho + c * ep_hm - d * eo_gm;
         R t13 =  a * gl_hk - c * el_hi + d * ek_gi;
@@ -0,0 +1,118 @@
+#ifndef AVML_GEN_OBBR_HPP
+#define AVML_GEN_OBBR_HPP
+
+namespace avml {
+
+    ///
+    /// Oriented bounding box. Row i of axes() is the box's i-th local axis,
+    /// which should be of unit length, and extents()[i] is the box's half
+    /// width along it.
+    ///
+    template<class R>
+    class ObbR {
+    public:
+
+        using scalar = R;
+        using vector = Vector3R<R>;
+        using matrix = Matrix3x3R<R>;
+
+        //=================================================
+        // Creation functions
+        //=================================================
+
+        AVML_FINL static ObbR from_aabb(const Aabb3R<R>& b) {
+            return ObbR{
+                (b.minimum() + b.maximum()) * R(0.5),
+                matrix{R(1)},
+                (b.maximum() - b.minimum()) * R(0.5)
+            };
+        }
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        AVML_FINL ObbR(vector center, const matrix& axes, vector extents):
+            c(center),
+            u(axes),
+            e(extents) {}
+
+        ObbR() = default;
+        ObbR(const ObbR&) = default;
+        ObbR(ObbR&&) noexcept = default;
+        ~ObbR() = default;
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        ObbR& operator=(const ObbR&) = default;
+        ObbR& operator=(ObbR&&) noexcept = default;
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        AVML_FINL vector& center() {
+            return c;
+        }
+
+        AVML_FINL const vector& center() const {
+            return c;
+        }
+
+        AVML_FINL matrix& axes() {
+            return u;
+        }
+
+        AVML_FINL const matrix& axes() const {
+            return u;
+        }
+
+        AVML_FINL vector& extents() {
+            return e;
+        }
+
+        AVML_FINL const vector& extents() const {
+            return e;
+        }
+
+    private:
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        vector c;
+        matrix u;
+        vector e;
+
+    };
+
+    template<class R>
+    AVML_FINL bool operator==(const ObbR<R>& lhs, const ObbR<R>& rhs) {
+        return
+            (lhs.center() == rhs.center()) &&
+            (lhs.axes() == rhs.axes()) &&
+            (lhs.extents() == rhs.extents());
+    }
+
+    template<class R>
+    AVML_FINL bool operator!=(const ObbR<R>& lhs, const ObbR<R>& rhs) {
+        return !(lhs == rhs);
+    }
+
+    template<class R>
+    AVML_FINL bool contains(const ObbR<R>& b, Vector3R<R> p) {
+        using std::abs;
+
+        Vector3R<R> d = p - b.center();
+        return
+            (abs(dot(d, b.axes()[0])) <= b.extents()[0]) &&
+            (abs(dot(d, b.axes()[1])) <= b.extents()[1]) &&
+            (abs(dot(d, b.axes()[2])) <= b.extents()[2]);
+    }
+
+}
+
+#endif
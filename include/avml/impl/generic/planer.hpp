@@ -0,0 +1,110 @@
+#ifndef AVML_GEN_PLANER_HPP
+#define AVML_GEN_PLANER_HPP
+
+namespace avml {
+
+    ///
+    /// Points p with dot(normal(), p) == distance(). Points on the side the
+    /// normal points to are in front of the plane.
+    ///
+    template<class R>
+    class PlaneR {
+    public:
+
+        using scalar = R;
+        using vector = Vector3R<R>;
+        using unit_vector = Unit_vector3R<R>;
+
+        //=================================================
+        // Creation functions
+        //=================================================
+
+        AVML_FINL static PlaneR from_point(unit_vector normal, vector p) {
+            return PlaneR{normal, dot(p, normal)};
+        }
+
+        ///
+        /// Plane through three points, facing the side from which they
+        /// appear counterclockwise. The points must not be collinear.
+        ///
+        AVML_FINL static PlaneR from_points(vector a, vector b, vector c) {
+            return from_point(normalize(cross(b - a, c - a)), a);
+        }
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        AVML_FINL PlaneR(unit_vector normal, R distance):
+            n(normal),
+            d(distance) {}
+
+        PlaneR() = default;
+        PlaneR(const PlaneR&) = default;
+        PlaneR(PlaneR&&) noexcept = default;
+        ~PlaneR() = default;
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        PlaneR& operator=(const PlaneR&) = default;
+        PlaneR& operator=(PlaneR&&) noexcept = default;
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        AVML_FINL unit_vector& normal() {
+            return n;
+        }
+
+        AVML_FINL const unit_vector& normal() const {
+            return n;
+        }
+
+        AVML_FINL R& distance() {
+            return d;
+        }
+
+        AVML_FINL const R& distance() const {
+            return d;
+        }
+
+    private:
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        unit_vector n;
+        R d;
+
+    };
+
+    template<class R>
+    AVML_FINL bool operator==(const PlaneR<R>& lhs, const PlaneR<R>& rhs) {
+        return (lhs.normal() == rhs.normal()) && (lhs.distance() == rhs.distance());
+    }
+
+    template<class R>
+    AVML_FINL bool operator!=(const PlaneR<R>& lhs, const PlaneR<R>& rhs) {
+        return !(lhs == rhs);
+    }
+
+    ///
+    /// \return Distance of p from the plane, positive in front of it
+    ///
+    template<class R>
+    AVML_FINL R signed_distance(const PlaneR<R>& plane, Vector3R<R> p) {
+        return dot(p, plane.normal()) - plane.distance();
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> closest_point(const PlaneR<R>& plane, Vector3R<R> p) {
+        return p - plane.normal() * signed_distance(plane, p);
+    }
+
+}
+
+#endif
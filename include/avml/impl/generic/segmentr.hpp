@@ -0,0 +1,92 @@
+#ifndef AVML_GEN_SEGMENTR_HPP
+#define AVML_GEN_SEGMENTR_HPP
+
+#include <algorithm>
+
+namespace avml {
+
+    ///
+    /// Points p0() + t * (p1() - p0()) for t in [0, 1]
+    ///
+    template<class R>
+    class SegmentR {
+    public:
+
+        using scalar = R;
+        using vector = Vector3R<R>;
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        AVML_FINL SegmentR(vector p0, vector p1):
+            a(p0),
+            b(p1) {}
+
+        SegmentR() = default;
+        SegmentR(const SegmentR&) = default;
+        SegmentR(SegmentR&&) noexcept = default;
+        ~SegmentR() = default;
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        SegmentR& operator=(const SegmentR&) = default;
+        SegmentR& operator=(SegmentR&&) noexcept = default;
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        AVML_FINL vector& p0() {
+            return a;
+        }
+
+        AVML_FINL const vector& p0() const {
+            return a;
+        }
+
+        AVML_FINL vector& p1() {
+            return b;
+        }
+
+        AVML_FINL const vector& p1() const {
+            return b;
+        }
+
+    private:
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        vector a;
+        vector b;
+
+    };
+
+    template<class R>
+    AVML_FINL bool operator==(const SegmentR<R>& lhs, const SegmentR<R>& rhs) {
+        return (lhs.p0() == rhs.p0()) && (lhs.p1() == rhs.p1());
+    }
+
+    template<class R>
+    AVML_FINL bool operator!=(const SegmentR<R>& lhs, const SegmentR<R>& rhs) {
+        return !(lhs == rhs);
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> closest_point(const SegmentR<R>& s, Vector3R<R> p) {
+        Vector3R<R> ab = s.p1() - s.p0();
+        R ab2 = dot(ab, ab);
+        R t = dot(p - s.p0(), ab);
+
+        // Degenerate segments are points
+        t = (ab2 > R(0)) ? std::max(R(0), std::min(t / ab2, R(1))) : R(0);
+        return s.p0() + ab * t;
+    }
+
+}
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef AVML_GEN_SPHERER_HPP
+#define AVML_GEN_SPHERER_HPP
+
+namespace avml {
+
+    template<class R>
+    class SphereR {
+    public:
+
+        using scalar = R;
+        using vector = Vector3R<R>;
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        AVML_FINL SphereR(vector center, R radius):
+            c(center),
+            r(radius) {}
+
+        SphereR() = default;
+        SphereR(const SphereR&) = default;
+        SphereR(SphereR&&) noexcept = default;
+        ~SphereR() = default;
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        SphereR& operator=(const SphereR&) = default;
+        SphereR& operator=(SphereR&&) noexcept = default;
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        AVML_FINL vector& center() {
+            return c;
+        }
+
+        AVML_FINL const vector& center() const {
+            return c;
+        }
+
+        AVML_FINL R& radius() {
+            return r;
+        }
+
+        AVML_FINL const R& radius() const {
+            return r;
+        }
+
+    private:
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        vector c;
+        R r;
+
+    };
+
+    template<class R>
+    AVML_FINL bool operator==(const SphereR<R>& lhs, const SphereR<R>& rhs) {
+        return (lhs.center() == rhs.center()) && (lhs.radius() == rhs.radius());
+    }
+
+    template<class R>
+    AVML_FINL bool operator!=(const SphereR<R>& lhs, const SphereR<R>& rhs) {
+        return !(lhs == rhs);
+    }
+
+    template<class R>
+    AVML_FINL bool contains(const SphereR<R>& s, Vector3R<R> p) {
+        return length2(p - s.center()) <= s.radius() * s.radius();
+    }
+
+}
+
+#endif
@@ -300,7 +300,7 @@ namespace avml {
 
     template<class I>
     AVML_FINL Vector2I<I> yx(Vector2I<I> v) {
-        return {v[1], v[0]};
+        return swizzle<1, 0>(v);
     }
 
 }
@@ -216,6 +216,8 @@ namespace avml {
 
     template<class R>
     AVML_FINL R dot(Vector2R<R> lhs, Vector2R<R> rhs) {
+        AVML_PROFILE("dot(Vector2R)");
+
         return
             lhs[0] * rhs[0] +
             lhs[1] * rhs[1];
@@ -233,6 +235,8 @@ namespace avml {
 
     template<class R>
     AVML_FINL Unit_vector2R<R> normalize(Vector2R<R> v) {
+        AVML_PROFILE("normalize(Vector2R)");
+
         v /= length(v);
         return Unit_vector2R<R>::read_aligned(v.data());
     }
@@ -329,7 +333,7 @@ namespace avml {
 
     template<class R>
     AVML_FINL Vector2R<R> yx(Vector2R<R> v) {
-        return {v[1], v[0]};
+        return swizzle<1, 0>(v);
     }
 
 }
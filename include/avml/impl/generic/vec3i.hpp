@@ -307,184 +307,184 @@ namespace avml {
 
     template<class I>
     AVML_FINL Vector2I <I> xx(Vector3I<I> v) {
-        return {v[0], v[0]};
+        return swizzle<0, 0>(v);
     }
 
     template<class I>
     AVML_FINL Vector2I <I> xy(Vector3I<I> v) {
-        return {v[0], v[1]};
+        return swizzle<0, 1>(v);
     }
 
     template<class I>
     AVML_FINL Vector2I <I> xz(Vector3I<I> v) {
-        return {v[0], v[2]};
+        return swizzle<0, 2>(v);
     }
 
     template<class I>
     AVML_FINL Vector2I <I> yx(Vector3I<I> v) {
-        return {v[1], v[0]};
+        return swizzle<1, 0>(v);
     }
 
     template<class I>
     AVML_FINL Vector2I <I> yy(Vector3I<I> v) {
-        return {v[1], v[1]};
+        return swizzle<1, 1>(v);
     }
 
     template<class I>
     AVML_FINL Vector2I <I> yz(Vector3I<I> v) {
-        return {v[1], v[2]};
+        return swizzle<1, 2>(v);
     }
 
     template<class I>
     AVML_FINL Vector2I <I> zx(Vector3I<I> v) {
-        return {v[2], v[0]};
+        return swizzle<2, 0>(v);
     }
 
     template<class I>
     AVML_FINL Vector2I <I> zy(Vector3I<I> v) {
-        return {v[2], v[1]};
+        return swizzle<2, 1>(v);
     }
 
     template<class I>
     AVML_FINL Vector2I <I> zz(Vector3I<I> v) {
-        return {v[2], v[2]};
+        return swizzle<2, 2>(v);
     }
 
     // Three components
 
     template<class I>
     AVML_FINL Vector3I<I> xxx(Vector3I<I> v) {
-        return {v[0], v[0], v[0]};
+        return swizzle<0, 0, 0>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> xxy(Vector3I<I> v) {
-        return {v[0], v[0], v[1]};
+        return swizzle<0, 0, 1>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> xxz(Vector3I<I> v) {
-        return {v[0], v[0], v[2]};
+        return swizzle<0, 0, 2>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> xyx(Vector3I<I> v) {
-        return {v[0], v[1], v[0]};
+        return swizzle<0, 1, 0>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> xyy(Vector3I<I> v) {
-        return {v[0], v[1], v[1]};
+        return swizzle<0, 1, 1>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> xyz(Vector3I<I> v) {
-        return {v[0], v[1], v[2]};
+        return swizzle<0, 1, 2>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> xzx(Vector3I<I> v) {
-        return {v[0], v[2], v[0]};
+        return swizzle<0, 2, 0>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> xzy(Vector3I<I> v) {
-        return {v[0], v[2], v[1]};
+        return swizzle<0, 2, 1>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> xzz(Vector3I<I> v) {
-        return {v[0], v[2], v[2]};
+        return swizzle<0, 2, 2>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> yxx(Vector3I<I> v) {
-        return {v[1], v[0], v[0]};
+        return swizzle<1, 0, 0>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> yxy(Vector3I<I> v) {
-        return {v[1], v[0], v[1]};
+        return swizzle<1, 0, 1>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> yxz(Vector3I<I> v) {
-        return {v[1], v[0], v[2]};
+        return swizzle<1, 0, 2>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> yyx(Vector3I<I> v) {
-        return {v[1], v[1], v[0]};
+        return swizzle<1, 1, 0>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> yyy(Vector3I<I> v) {
-        return {v[1], v[1], v[1]};
+        return swizzle<1, 1, 1>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> yyz(Vector3I<I> v) {
-        return {v[1], v[1], v[2]};
+        return swizzle<1, 1, 2>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> yzx(Vector3I<I> v) {
-        return {v[1], v[2], v[0]};
+        return swizzle<1, 2, 0>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> yzy(Vector3I<I> v) {
-        return {v[1], v[2], v[1]};
+        return swizzle<1, 2, 1>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> yzz(Vector3I<I> v) {
-        return {v[1], v[2], v[2]};
+        return swizzle<1, 2, 2>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> zxx(Vector3I<I> v) {
-        return {v[2], v[0], v[0]};
+        return swizzle<2, 0, 0>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> zxy(Vector3I<I> v) {
-        return {v[2], v[0], v[1]};
+        return swizzle<2, 0, 1>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> zxz(Vector3I<I> v) {
-        return {v[2], v[0], v[2]};
+        return swizzle<2, 0, 2>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> zyx(Vector3I<I> v) {
-        return {v[2], v[1], v[0]};
+        return swizzle<2, 1, 0>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> zyy(Vector3I<I> v) {
-        return {v[2], v[1], v[1]};
+        return swizzle<2, 1, 1>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> zyz(Vector3I<I> v) {
-        return {v[2], v[1], v[2]};
+        return swizzle<2, 1, 2>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> zzx(Vector3I<I> v) {
-        return {v[2], v[2], v[0]};
+        return swizzle<2, 2, 0>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> zzy(Vector3I<I> v) {
-        return {v[2], v[2], v[1]};
+        return swizzle<2, 2, 1>(v);
     }
 
     template<class I>
     AVML_FINL Vector3I<I> zzz(Vector3I<I> v) {
-        return {v[2], v[2], v[2]};
+        return swizzle<2, 2, 2>(v);
     }
 
 }
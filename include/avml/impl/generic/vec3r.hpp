@@ -226,6 +226,8 @@ namespace avml {
 
     template<class R>
     AVML_FINL R dot(Vector3R<R> lhs, Vector3R<R> rhs) {
+        AVML_PROFILE("dot(Vector3R)");
+
         return
             lhs[0] * rhs[0] +
             lhs[1] * rhs[1] +
@@ -250,6 +252,8 @@ namespace avml {
 
     template<class R>
     AVML_FINL Unit_vector3R <R> normalize(Vector3R<R> v) {
+        AVML_PROFILE("normalize(Vector3R)");
+
         v /= length(v);
         return assume_normalized(v);
     }
@@ -398,184 +402,184 @@ namespace avml {
 
     template<class R>
     AVML_FINL Vector2R <R> xx(Vector3R<R> v) {
-        return {v[0], v[0]};
+        return swizzle<0, 0>(v);
     }
 
     template<class R>
     AVML_FINL Vector2R <R> xy(Vector3R<R> v) {
-        return {v[0], v[1]};
+        return swizzle<0, 1>(v);
     }
 
     template<class R>
     AVML_FINL Vector2R <R> xz(Vector3R<R> v) {
-        return {v[0], v[2]};
+        return swizzle<0, 2>(v);
     }
 
     template<class R>
     AVML_FINL Vector2R <R> yx(Vector3R<R> v) {
-        return {v[1], v[0]};
+        return swizzle<1, 0>(v);
     }
 
     template<class R>
     AVML_FINL Vector2R <R> yy(Vector3R<R> v) {
-        return {v[1], v[1]};
+        return swizzle<1, 1>(v);
     }
 
     template<class R>
     AVML_FINL Vector2R <R> yz(Vector3R<R> v) {
-        return {v[1], v[2]};
+        return swizzle<1, 2>(v);
     }
 
     template<class R>
     AVML_FINL Vector2R <R> zx(Vector3R<R> v) {
-        return {v[2], v[0]};
+        return swizzle<2, 0>(v);
     }
 
     template<class R>
     AVML_FINL Vector2R <R> zy(Vector3R<R> v) {
-        return {v[2], v[1]};
+        return swizzle<2, 1>(v);
     }
 
     template<class R>
     AVML_FINL Vector2R <R> zz(Vector3R<R> v) {
-        return {v[2], v[2]};
+        return swizzle<2, 2>(v);
     }
 
     // Three components
 
     template<class R>
     AVML_FINL Vector3R<R> xxx(Vector3R<R> v) {
-        return {v[0], v[0], v[0]};
+        return swizzle<0, 0, 0>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> xxy(Vector3R<R> v) {
-        return {v[0], v[0], v[1]};
+        return swizzle<0, 0, 1>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> xxz(Vector3R<R> v) {
-        return {v[0], v[0], v[2]};
+        return swizzle<0, 0, 2>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> xyx(Vector3R<R> v) {
-        return {v[0], v[1], v[0]};
+        return swizzle<0, 1, 0>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> xyy(Vector3R<R> v) {
-        return {v[0], v[1], v[1]};
+        return swizzle<0, 1, 1>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> xyz(Vector3R<R> v) {
-        return {v[0], v[1], v[2]};
+        return swizzle<0, 1, 2>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> xzx(Vector3R<R> v) {
-        return {v[0], v[2], v[0]};
+        return swizzle<0, 2, 0>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> xzy(Vector3R<R> v) {
-        return {v[0], v[2], v[1]};
+        return swizzle<0, 2, 1>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> xzz(Vector3R<R> v) {
-        return {v[0], v[2], v[2]};
+        return swizzle<0, 2, 2>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> yxx(Vector3R<R> v) {
-        return {v[1], v[0], v[0]};
+        return swizzle<1, 0, 0>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> yxy(Vector3R<R> v) {
-        return {v[1], v[0], v[1]};
+        return swizzle<1, 0, 1>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> yxz(Vector3R<R> v) {
-        return {v[1], v[0], v[2]};
+        return swizzle<1, 0, 2>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> yyx(Vector3R<R> v) {
-        return {v[1], v[1], v[0]};
+        return swizzle<1, 1, 0>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> yyy(Vector3R<R> v) {
-        return {v[1], v[1], v[1]};
+        return swizzle<1, 1, 1>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> yyz(Vector3R<R> v) {
-        return {v[1], v[1], v[2]};
+        return swizzle<1, 1, 2>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> yzx(Vector3R<R> v) {
-        return {v[1], v[2], v[0]};
+        return swizzle<1, 2, 0>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> yzy(Vector3R<R> v) {
-        return {v[1], v[2], v[1]};
+        return swizzle<1, 2, 1>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> yzz(Vector3R<R> v) {
-        return {v[1], v[2], v[2]};
+        return swizzle<1, 2, 2>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> zxx(Vector3R<R> v) {
-        return {v[2], v[0], v[0]};
+        return swizzle<2, 0, 0>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> zxy(Vector3R<R> v) {
-        return {v[2], v[0], v[1]};
+        return swizzle<2, 0, 1>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> zxz(Vector3R<R> v) {
-        return {v[2], v[0], v[2]};
+        return swizzle<2, 0, 2>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> zyx(Vector3R<R> v) {
-        return {v[2], v[1], v[0]};
+        return swizzle<2, 1, 0>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> zyy(Vector3R<R> v) {
-        return {v[2], v[1], v[1]};
+        return swizzle<2, 1, 1>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> zyz(Vector3R<R> v) {
-        return {v[2], v[1], v[2]};
+        return swizzle<2, 1, 2>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> zzx(Vector3R<R> v) {
-        return {v[2], v[2], v[0]};
+        return swizzle<2, 2, 0>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> zzy(Vector3R<R> v) {
-        return {v[2], v[2], v[1]};
+        return swizzle<2, 2, 1>(v);
     }
 
     template<class R>
     AVML_FINL Vector3R<R> zzz(Vector3R<R> v) {
-        return {v[2], v[2], v[2]};
+        return swizzle<2, 2, 2>(v);
     }
 
 }
@@ -33,22 +33,19 @@ namespace avml {
         //=================================================
 
         AVML_FINL explicit Matrix2x2R(float d) noexcept:
-            elements {
-                {d, 0.0f},
-                {0.0f, d}
+            rows{
+                vector{d, 0.0f},
+                vector{0.0f, d}
         } {}
 
         AVML_FINL Matrix2x2R(float a, float b, float c, float d):
-            elements{
-                {a, b},
-                {c, d}
+            rows{
+                vector{a, b},
+                vector{c, d}
             } {}
 
         AVML_FINL Matrix2x2R(vector a, vector b):
-            elements{
-                {a[0], a[1]},
-                {b[0], b[1]}
-        } {}
+            rows{a, b} {}
 
         Matrix2x2R() = default;
         Matrix2x2R(const Matrix2x2R&) = default;
@@ -110,17 +107,19 @@ namespace avml {
         }
 
         AVML_FINL Matrix2x2R& operator*=(const Matrix2x2R& rhs) {
-            auto ret = *this;
+            Matrix2x2R ret;
             for (unsigned i = 0; i < height; ++i) {
                 for (unsigned j = 0; j < width; ++j) {
-                    float tmp = 0.0f;
+                    float tmp{};
                     for (unsigned k = 0; k < width; ++k) {
-                        tmp += elements[i][k] * rhs.elements[k][j];
+                        tmp += rows[i][k] * rhs.rows[k][j];
                     }
-                    ret[i][j] = tmp;
+                    ret.rows[i][j] = tmp;
                 }
             }
 
+            *this = ret;
+
             return *this;
         }
 
@@ -129,27 +128,24 @@ namespace avml {
         //=================================================
 
         AVML_FINL vector& operator[](unsigned i) {
-            return *reinterpret_cast<vector*>(elements[i]);
+            return rows[i];
         }
 
         AVML_FINL const vector& operator[](unsigned i) const {
-            return *reinterpret_cast<const vector*>(elements[i]);
+            return rows[i];
         }
 
         AVML_FINL float* data() {
-            return elements[0];
+            return rows[0].data();
         }
 
         AVML_FINL const float* data() const {
-            return elements[0];
+            return rows[0].data();
         }
 
     private:
 
-        float elements[2][2] {
-            {0.0f, 0.0f},
-            {0.0f, 0.0f}
-        };
+        vector rows[2]{};
 
     };
 
@@ -224,6 +220,8 @@ namespace avml {
     }
 
     AVML_FINL Matrix2x2R<float> inverse(const Matrix2x2R<float>& m) {
+        AVML_PROFILE("inverse(mat2x2f)");
+
         auto det = determinant(m);
 
         return Matrix2x2R<float> {
@@ -0,0 +1,53 @@
+#ifndef AVML_MAT4X4F_PRODUCTS_IPP
+#define AVML_MAT4X4F_PRODUCTS_IPP
+
+namespace avml {
+
+#if defined(AVML_SSE2)
+
+    AVML_FINL Matrix4x4R<float> operator*(const Matrix4x4R<float>& lhs, const Matrix4x4R<float>& rhs) {
+        __m128 b0 = _mm_load_ps(rhs.data() + 0x0);
+        __m128 b1 = _mm_load_ps(rhs.data() + 0x4);
+        __m128 b2 = _mm_load_ps(rhs.data() + 0x8);
+        __m128 b3 = _mm_load_ps(rhs.data() + 0xC);
+
+        Matrix4x4R<float> ret;
+        for (unsigned i = 0; i < Matrix4x4R<float>::height; ++i) {
+            __m128 a = _mm_load_ps(lhs.data() + 4 * i);
+
+            __m128 r = _mm_mul_ps(_mm_shuffle_ps(a, a, 0x00), b0);
+            r = avml_impl::fmadd4f(_mm_shuffle_ps(a, a, 0x55), b1, r);
+            r = avml_impl::fmadd4f(_mm_shuffle_ps(a, a, 0xAA), b2, r);
+            r = avml_impl::fmadd4f(_mm_shuffle_ps(a, a, 0xFF), b3, r);
+
+            _mm_store_ps(ret.data() + 4 * i, r);
+        }
+
+        return ret;
+    }
+
+    AVML_FINL Vector4R<float> operator*(const Matrix4x4R<float>& lhs, Vector4R<float> rhs) {
+        // Columns of lhs scaled by the components of rhs
+        __m128 c0 = _mm_load_ps(lhs.data() + 0x0);
+        __m128 c1 = _mm_load_ps(lhs.data() + 0x4);
+        __m128 c2 = _mm_load_ps(lhs.data() + 0x8);
+        __m128 c3 = _mm_load_ps(lhs.data() + 0xC);
+        _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+        __m128 v = _mm_loadu_ps(rhs.data());
+
+        __m128 r = _mm_mul_ps(c0, _mm_shuffle_ps(v, v, 0x00));
+        r = avml_impl::fmadd4f(c1, _mm_shuffle_ps(v, v, 0x55), r);
+        r = avml_impl::fmadd4f(c2, _mm_shuffle_ps(v, v, 0xAA), r);
+        r = avml_impl::fmadd4f(c3, _mm_shuffle_ps(v, v, 0xFF), r);
+
+        Vector4R<float> ret;
+        _mm_storeu_ps(ret.data(), r);
+        return ret;
+    }
+
+#endif
+
+}
+
+#endif
@@ -1,5 +1,6 @@
 #include <cmath>
 #include "Shared.hpp"
+#include "Lanes.hpp"
 
 namespace avml {
 
@@ -31,6 +32,34 @@ namespace avml {
         return (x -  (x * 0.5f)) + (y * 0.5f);
     }
 
+    AVML_FINL double fmadd(double m, double x, double b) {
+        return std::fma(m, x, b);
+    }
+
+    AVML_FINL double fmnadd(double m, double x, double b) {
+        return std::fma(-m, x, b);
+    }
+
+    AVML_FINL double fmsub(double m, double x, double b) {
+        return std::fma(m, x, -b);
+    }
+
+    AVML_FINL double fmnsub(double m, double x, double b) {
+        return std::fma(-m, x, -b);
+    }
+
+    AVML_FINL double fract(double x) {
+        return x - std::floor(x);
+    }
+
+    AVML_FINL double clamp(double x, double lo, double hi) {
+        return std::fmin(std::fmax(x, lo), hi);
+    }
+
+    AVML_FINL double average(double x, double y) {
+        return (x - (x * 0.5)) + (y * 0.5);
+    }
+
     /*
     //TODO: Complete implementation.
     bool compare_equal(float x, float y, std::uint32_t margin) {
@@ -63,3 +92,584 @@ namespace avml {
     */
 
 }
+
+namespace avml_impl {
+
+    //=====================================================
+    // Component-wise operations
+    //=====================================================
+
+    // Written over lane types so that one definition serves scalars, vector
+    // registers and array loops alike
+
+    struct Fmadd_op {
+        template<class T>
+        AVML_FINL T operator()(const T (&a)[3]) const {
+            return lanes_fmadd(a[0], a[1], a[2]);
+        }
+    };
+
+    struct Fmnadd_op {
+        template<class T>
+        AVML_FINL T operator()(const T (&a)[3]) const {
+            return lanes_fmnadd(a[0], a[1], a[2]);
+        }
+    };
+
+    struct Fmsub_op {
+        template<class T>
+        AVML_FINL T operator()(const T (&a)[3]) const {
+            return lanes_fmsub(a[0], a[1], a[2]);
+        }
+    };
+
+    struct Fmnsub_op {
+        template<class T>
+        AVML_FINL T operator()(const T (&a)[3]) const {
+            return lanes_fmnsub(a[0], a[1], a[2]);
+        }
+    };
+
+    struct Fract_op {
+        template<class T>
+        AVML_FINL T operator()(const T (&a)[1]) const {
+            return a[0] - lanes_floor(a[0]);
+        }
+    };
+
+    struct Clamp_op {
+        template<class T>
+        AVML_FINL T operator()(const T (&a)[3]) const {
+            return lanes_min(lanes_max(a[0], a[1]), a[2]);
+        }
+    };
+
+    struct Clamp_bounds_op {
+        float lo;
+        float hi;
+
+        template<class T>
+        AVML_FINL T operator()(const T (&a)[1]) const {
+            return lanes_min(lanes_max(a[0], T(lo)), T(hi));
+        }
+    };
+
+    struct Average_op {
+        template<class T>
+        AVML_FINL T operator()(const T (&a)[2]) const {
+            T half{0.5f};
+            return (a[0] - a[0] * half) + a[1] * half;
+        }
+    };
+
+    struct Lerp_op {
+        template<class T>
+        AVML_FINL T operator()(const T (&a)[3]) const {
+            return lanes_fmadd(a[2], a[1], lanes_fmnadd(a[2], a[0], a[0]));
+        }
+    };
+
+    struct Step_op {
+        template<class T>
+        AVML_FINL T operator()(const T (&a)[2]) const {
+            return lanes_select(lanes_less(a[1], a[0]), T{0.0f}, T{1.0f});
+        }
+    };
+
+    struct Smoothstep_op {
+        template<class T>
+        AVML_FINL T operator()(const T (&a)[3]) const {
+            T t = (a[2] - a[0]) / (a[1] - a[0]);
+            t = lanes_min(lanes_max(t, T{0.0f}), T{1.0f});
+            return t * t * (T{3.0f} - T{2.0f} * t);
+        }
+    };
+
+    struct Smoothstep_edges_op {
+        float edge0;
+        float edge1;
+
+        template<class T>
+        AVML_FINL T operator()(const T (&a)[1]) const {
+            const T args[] = {T(edge0), T(edge1), a[0]};
+            return Smoothstep_op{}(args);
+        }
+    };
+
+    struct Saturate_op {
+        template<class T>
+        AVML_FINL T operator()(const T (&a)[1]) const {
+            return lanes_min(lanes_max(a[0], T{0.0f}), T{1.0f});
+        }
+    };
+
+    ///
+    /// Applies op to the components of N vectors
+    ///
+    template<class V, unsigned N, class Op>
+    AVML_FINL V map_components(const V (&in)[N], Op op) {
+        V ret;
+        for (unsigned i = 0; i < V::width; ++i) {
+            typename V::scalar args[N];
+            for (unsigned j = 0; j < N; ++j) {
+                args[j] = in[j][i];
+            }
+            ret[i] = op(args);
+        }
+        return ret;
+    }
+
+#if defined(AVML_SSE2)
+
+    template<template<class> class V, unsigned N, class Op>
+    AVML_FINL V<float> map_components(const V<float> (&in)[N], Op op) {
+        Lanes4f args[N];
+        for (unsigned j = 0; j < N; ++j) {
+            args[j] = load_components(in[j]);
+        }
+
+        V<float> ret;
+        store_components(ret, op(args).reg);
+        return ret;
+    }
+
+#endif
+
+    ///
+    /// Applies op to W consecutive elements of N arrays at a time
+    ///
+    /// \return Number of elements processed
+    template<class T, unsigned W, unsigned N, class Op>
+    AVML_FINL std::size_t map_groups(const float* const (&in)[N], float* out, std::size_t n, Op op) {
+        std::size_t i = 0;
+        for (; i + W <= n; i += W) {
+            T args[N];
+            for (unsigned j = 0; j < N; ++j) {
+                args[j] = lanes_load(*reinterpret_cast<const float (*)[W]>(in[j] + i));
+            }
+            lanes_store(*reinterpret_cast<float (*)[W]>(out + i), op(args));
+        }
+        return i;
+    }
+
+    template<unsigned N, class Op>
+    AVML_FINL void map_arrays(const float* const (&in)[N], float* out, std::size_t n, Op op) {
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        i = map_groups<Lanes16f, 16>(in, out, n, op);
+        #elif defined(AVML_AVX)
+        i = map_groups<Lanes8f, 8>(in, out, n, op);
+        #elif defined(AVML_SSE2)
+        i = map_groups<Lanes4f, 4>(in, out, n, op);
+        #endif
+
+        for (; i < n; ++i) {
+            float args[N];
+            for (unsigned j = 0; j < N; ++j) {
+                args[j] = in[j][i];
+            }
+            out[i] = op(args);
+        }
+    }
+
+}
+
+namespace avml {
+
+    //=====================================================
+    // Interpolation
+    //=====================================================
+
+    AVML_FINL float lerp(float a, float b, float t) {
+        const float args[] = {a, b, t};
+        return avml_impl::Lerp_op{}(args);
+    }
+
+    AVML_FINL float mix(float a, float b, float t) {
+        return lerp(a, b, t);
+    }
+
+    AVML_FINL float step(float edge, float x) {
+        return (x < edge) ? float(0) : float(1);
+    }
+
+    AVML_FINL float smoothstep(float edge0, float edge1, float x) {
+        const float args[] = {edge0, edge1, x};
+        return avml_impl::Smoothstep_op{}(args);
+    }
+
+    AVML_FINL float saturate(float x) {
+        return clamp(x, float(0), float(1));
+    }
+
+    AVML_FINL double lerp(double a, double b, double t) {
+        const double args[] = {a, b, t};
+        return avml_impl::Lerp_op{}(args);
+    }
+
+    AVML_FINL double mix(double a, double b, double t) {
+        return lerp(a, b, t);
+    }
+
+    AVML_FINL double step(double edge, double x) {
+        return (x < edge) ? double(0) : double(1);
+    }
+
+    AVML_FINL double smoothstep(double edge0, double edge1, double x) {
+        const double args[] = {edge0, edge1, x};
+        return avml_impl::Smoothstep_op{}(args);
+    }
+
+    AVML_FINL double saturate(double x) {
+        return clamp(x, double(0), double(1));
+    }
+
+    //=====================================================
+    // Component-wise vector math
+    //=====================================================
+
+    template<class R>
+    AVML_FINL Vector2R<R> fmadd(Vector2R<R> m, Vector2R<R> x, Vector2R<R> b) {
+        const Vector2R<R> in[] = {m, x, b};
+        return avml_impl::map_components(in, avml_impl::Fmadd_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> fmadd(Vector3R<R> m, Vector3R<R> x, Vector3R<R> b) {
+        const Vector3R<R> in[] = {m, x, b};
+        return avml_impl::map_components(in, avml_impl::Fmadd_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector4R<R> fmadd(Vector4R<R> m, Vector4R<R> x, Vector4R<R> b) {
+        const Vector4R<R> in[] = {m, x, b};
+        return avml_impl::map_components(in, avml_impl::Fmadd_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector2R<R> fmnadd(Vector2R<R> m, Vector2R<R> x, Vector2R<R> b) {
+        const Vector2R<R> in[] = {m, x, b};
+        return avml_impl::map_components(in, avml_impl::Fmnadd_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> fmnadd(Vector3R<R> m, Vector3R<R> x, Vector3R<R> b) {
+        const Vector3R<R> in[] = {m, x, b};
+        return avml_impl::map_components(in, avml_impl::Fmnadd_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector4R<R> fmnadd(Vector4R<R> m, Vector4R<R> x, Vector4R<R> b) {
+        const Vector4R<R> in[] = {m, x, b};
+        return avml_impl::map_components(in, avml_impl::Fmnadd_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector2R<R> fmsub(Vector2R<R> m, Vector2R<R> x, Vector2R<R> b) {
+        const Vector2R<R> in[] = {m, x, b};
+        return avml_impl::map_components(in, avml_impl::Fmsub_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> fmsub(Vector3R<R> m, Vector3R<R> x, Vector3R<R> b) {
+        const Vector3R<R> in[] = {m, x, b};
+        return avml_impl::map_components(in, avml_impl::Fmsub_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector4R<R> fmsub(Vector4R<R> m, Vector4R<R> x, Vector4R<R> b) {
+        const Vector4R<R> in[] = {m, x, b};
+        return avml_impl::map_components(in, avml_impl::Fmsub_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector2R<R> fmnsub(Vector2R<R> m, Vector2R<R> x, Vector2R<R> b) {
+        const Vector2R<R> in[] = {m, x, b};
+        return avml_impl::map_components(in, avml_impl::Fmnsub_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> fmnsub(Vector3R<R> m, Vector3R<R> x, Vector3R<R> b) {
+        const Vector3R<R> in[] = {m, x, b};
+        return avml_impl::map_components(in, avml_impl::Fmnsub_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector4R<R> fmnsub(Vector4R<R> m, Vector4R<R> x, Vector4R<R> b) {
+        const Vector4R<R> in[] = {m, x, b};
+        return avml_impl::map_components(in, avml_impl::Fmnsub_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector2R<R> fract(Vector2R<R> x) {
+        const Vector2R<R> in[] = {x};
+        return avml_impl::map_components(in, avml_impl::Fract_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> fract(Vector3R<R> x) {
+        const Vector3R<R> in[] = {x};
+        return avml_impl::map_components(in, avml_impl::Fract_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector4R<R> fract(Vector4R<R> x) {
+        const Vector4R<R> in[] = {x};
+        return avml_impl::map_components(in, avml_impl::Fract_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector2R<R> clamp(Vector2R<R> x, Vector2R<R> min, Vector2R<R> max) {
+        const Vector2R<R> in[] = {x, min, max};
+        return avml_impl::map_components(in, avml_impl::Clamp_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> clamp(Vector3R<R> x, Vector3R<R> min, Vector3R<R> max) {
+        const Vector3R<R> in[] = {x, min, max};
+        return avml_impl::map_components(in, avml_impl::Clamp_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector4R<R> clamp(Vector4R<R> x, Vector4R<R> min, Vector4R<R> max) {
+        const Vector4R<R> in[] = {x, min, max};
+        return avml_impl::map_components(in, avml_impl::Clamp_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector2R<R> clamp(Vector2R<R> x, R min, R max) {
+        return clamp(x, Vector2R<R>{min}, Vector2R<R>{max});
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> clamp(Vector3R<R> x, R min, R max) {
+        return clamp(x, Vector3R<R>{min}, Vector3R<R>{max});
+    }
+
+    template<class R>
+    AVML_FINL Vector4R<R> clamp(Vector4R<R> x, R min, R max) {
+        return clamp(x, Vector4R<R>{min}, Vector4R<R>{max});
+    }
+
+    template<class R>
+    AVML_FINL Vector2R<R> average(Vector2R<R> x, Vector2R<R> y) {
+        const Vector2R<R> in[] = {x, y};
+        return avml_impl::map_components(in, avml_impl::Average_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> average(Vector3R<R> x, Vector3R<R> y) {
+        const Vector3R<R> in[] = {x, y};
+        return avml_impl::map_components(in, avml_impl::Average_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector4R<R> average(Vector4R<R> x, Vector4R<R> y) {
+        const Vector4R<R> in[] = {x, y};
+        return avml_impl::map_components(in, avml_impl::Average_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector2R<R> lerp(Vector2R<R> a, Vector2R<R> b, Vector2R<R> t) {
+        const Vector2R<R> in[] = {a, b, t};
+        return avml_impl::map_components(in, avml_impl::Lerp_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> lerp(Vector3R<R> a, Vector3R<R> b, Vector3R<R> t) {
+        const Vector3R<R> in[] = {a, b, t};
+        return avml_impl::map_components(in, avml_impl::Lerp_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector4R<R> lerp(Vector4R<R> a, Vector4R<R> b, Vector4R<R> t) {
+        const Vector4R<R> in[] = {a, b, t};
+        return avml_impl::map_components(in, avml_impl::Lerp_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector2R<R> lerp(Vector2R<R> a, Vector2R<R> b, R t) {
+        return lerp(a, b, Vector2R<R>{t});
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> lerp(Vector3R<R> a, Vector3R<R> b, R t) {
+        return lerp(a, b, Vector3R<R>{t});
+    }
+
+    template<class R>
+    AVML_FINL Vector4R<R> lerp(Vector4R<R> a, Vector4R<R> b, R t) {
+        return lerp(a, b, Vector4R<R>{t});
+    }
+
+    template<class R>
+    AVML_FINL Vector2R<R> mix(Vector2R<R> a, Vector2R<R> b, Vector2R<R> t) {
+        return lerp(a, b, t);
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> mix(Vector3R<R> a, Vector3R<R> b, Vector3R<R> t) {
+        return lerp(a, b, t);
+    }
+
+    template<class R>
+    AVML_FINL Vector4R<R> mix(Vector4R<R> a, Vector4R<R> b, Vector4R<R> t) {
+        return lerp(a, b, t);
+    }
+
+    template<class R>
+    AVML_FINL Vector2R<R> mix(Vector2R<R> a, Vector2R<R> b, R t) {
+        return lerp(a, b, Vector2R<R>{t});
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> mix(Vector3R<R> a, Vector3R<R> b, R t) {
+        return lerp(a, b, Vector3R<R>{t});
+    }
+
+    template<class R>
+    AVML_FINL Vector4R<R> mix(Vector4R<R> a, Vector4R<R> b, R t) {
+        return lerp(a, b, Vector4R<R>{t});
+    }
+
+    template<class R>
+    AVML_FINL Vector2R<R> step(Vector2R<R> edge, Vector2R<R> x) {
+        const Vector2R<R> in[] = {edge, x};
+        return avml_impl::map_components(in, avml_impl::Step_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> step(Vector3R<R> edge, Vector3R<R> x) {
+        const Vector3R<R> in[] = {edge, x};
+        return avml_impl::map_components(in, avml_impl::Step_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector4R<R> step(Vector4R<R> edge, Vector4R<R> x) {
+        const Vector4R<R> in[] = {edge, x};
+        return avml_impl::map_components(in, avml_impl::Step_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector2R<R> step(R edge, Vector2R<R> x) {
+        return step(Vector2R<R>{edge}, x);
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> step(R edge, Vector3R<R> x) {
+        return step(Vector3R<R>{edge}, x);
+    }
+
+    template<class R>
+    AVML_FINL Vector4R<R> step(R edge, Vector4R<R> x) {
+        return step(Vector4R<R>{edge}, x);
+    }
+
+    template<class R>
+    AVML_FINL Vector2R<R> smoothstep(Vector2R<R> edge0, Vector2R<R> edge1, Vector2R<R> x) {
+        const Vector2R<R> in[] = {edge0, edge1, x};
+        return avml_impl::map_components(in, avml_impl::Smoothstep_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> smoothstep(Vector3R<R> edge0, Vector3R<R> edge1, Vector3R<R> x) {
+        const Vector3R<R> in[] = {edge0, edge1, x};
+        return avml_impl::map_components(in, avml_impl::Smoothstep_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector4R<R> smoothstep(Vector4R<R> edge0, Vector4R<R> edge1, Vector4R<R> x) {
+        const Vector4R<R> in[] = {edge0, edge1, x};
+        return avml_impl::map_components(in, avml_impl::Smoothstep_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector2R<R> smoothstep(R edge0, R edge1, Vector2R<R> x) {
+        return smoothstep(Vector2R<R>{edge0}, Vector2R<R>{edge1}, x);
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> smoothstep(R edge0, R edge1, Vector3R<R> x) {
+        return smoothstep(Vector3R<R>{edge0}, Vector3R<R>{edge1}, x);
+    }
+
+    template<class R>
+    AVML_FINL Vector4R<R> smoothstep(R edge0, R edge1, Vector4R<R> x) {
+        return smoothstep(Vector4R<R>{edge0}, Vector4R<R>{edge1}, x);
+    }
+
+    template<class R>
+    AVML_FINL Vector2R<R> saturate(Vector2R<R> x) {
+        const Vector2R<R> in[] = {x};
+        return avml_impl::map_components(in, avml_impl::Saturate_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector3R<R> saturate(Vector3R<R> x) {
+        const Vector3R<R> in[] = {x};
+        return avml_impl::map_components(in, avml_impl::Saturate_op{});
+    }
+
+    template<class R>
+    AVML_FINL Vector4R<R> saturate(Vector4R<R> x) {
+        const Vector4R<R> in[] = {x};
+        return avml_impl::map_components(in, avml_impl::Saturate_op{});
+    }
+
+    //=====================================================
+    // Array math
+    //=====================================================
+
+    inline void fmadd(const float* m, const float* x, const float* b, float* out, std::size_t n) {
+        const float* const in[] = {m, x, b};
+        avml_impl::map_arrays(in, out, n, avml_impl::Fmadd_op{});
+    }
+
+    inline void fmnadd(const float* m, const float* x, const float* b, float* out, std::size_t n) {
+        const float* const in[] = {m, x, b};
+        avml_impl::map_arrays(in, out, n, avml_impl::Fmnadd_op{});
+    }
+
+    inline void fmsub(const float* m, const float* x, const float* b, float* out, std::size_t n) {
+        const float* const in[] = {m, x, b};
+        avml_impl::map_arrays(in, out, n, avml_impl::Fmsub_op{});
+    }
+
+    inline void fmnsub(const float* m, const float* x, const float* b, float* out, std::size_t n) {
+        const float* const in[] = {m, x, b};
+        avml_impl::map_arrays(in, out, n, avml_impl::Fmnsub_op{});
+    }
+
+    inline void fract(const float* x, float* out, std::size_t n) {
+        const float* const in[] = {x};
+        avml_impl::map_arrays(in, out, n, avml_impl::Fract_op{});
+    }
+
+    inline void clamp(const float* x, float min, float max, float* out, std::size_t n) {
+        const float* const in[] = {x};
+        avml_impl::map_arrays(in, out, n, avml_impl::Clamp_bounds_op{min, max});
+    }
+
+    inline void average(const float* x, const float* y, float* out, std::size_t n) {
+        const float* const in[] = {x, y};
+        avml_impl::map_arrays(in, out, n, avml_impl::Average_op{});
+    }
+
+
+    inline void lerp(const float* a, const float* b, const float* t, float* out, std::size_t n) {
+        const float* const in[] = {a, b, t};
+        avml_impl::map_arrays(in, out, n, avml_impl::Lerp_op{});
+    }
+
+    inline void smoothstep(float edge0, float edge1, const float* x, float* out, std::size_t n) {
+        const float* const in[] = {x};
+        avml_impl::map_arrays(in, out, n, avml_impl::Smoothstep_edges_op{edge0, edge1});
+    }
+
+    inline void saturate(const float* x, float* out, std::size_t n) {
+        const float* const in[] = {x};
+        avml_impl::map_arrays(in, out, n, avml_impl::Saturate_op{});
+    }
+
+}
@@ -0,0 +1,529 @@
+#ifndef AVML_NOISEF_IPP
+#define AVML_NOISEF_IPP
+
+#include "Lanes.hpp"
+
+namespace avml_impl {
+
+    //=====================================================
+    // Hashing
+    //=====================================================
+
+    // Kernels are templated over the float lane type T and the dimension D.
+    // Integer work happens in the matching unsigned lanes U.
+
+    ///
+    /// \return Hash of the lattice point c, mixed with seed
+    template<class U, unsigned D>
+    AVML_FINL U hash_lattice(const U (&c)[D], std::uint32_t seed) {
+        const std::uint32_t primes[4] = {0x8DA6B343, 0xD8163841, 0xCB1AB31F, 0x165667B1};
+
+        U h{seed};
+        for (unsigned d = 0; d < D; ++d) {
+            h = h + c[d] * U(primes[d]);
+        }
+
+        // Finalizer with low bias from Wellons' hash prospector
+        h = h ^ (h >> 16);
+        h = h * U(0x7FEB352D);
+        h = h ^ (h >> 15);
+        h = h * U(0x846CA68B);
+        h = h ^ (h >> 16);
+        return h;
+    }
+
+    ///
+    /// \return Byte i of h mapped to [0, 1)
+    template<class T, class U>
+    AVML_FINL T hash_byte(U h, unsigned i) {
+        return (lanes_to_float((h >> (8 * i)) & U(0xFF)) + T(0.5f)) * T(1.0f / 256.0f);
+    }
+
+    ///
+    /// \return h mapped to [-1, 1)
+    template<class T, class U>
+    AVML_FINL T hash_signed(U h) {
+        return lanes_to_float(h >> 8) * T(2.0f / 16777216.0f) - T(1.0f);
+    }
+
+    ///
+    /// \return Dot product of x with a gradient whose components are the
+    /// bytes of h mapped to [-1, 1)
+    template<class T, class U, unsigned D>
+    AVML_FINL T gradient_dot(U h, const T (&x)[D]) {
+        T ret = T(0.0f);
+        for (unsigned d = 0; d < D; ++d) {
+            ret = ret + (T(2.0f) * hash_byte<T>(h, d) - T(1.0f)) * x[d];
+        }
+        return ret;
+    }
+
+    template<class T>
+    AVML_FINL T fade(T t) {
+        return t * t * t * (t * (t * T(6.0f) - T(15.0f)) + T(10.0f));
+    }
+
+    //=====================================================
+    // Kernels
+    //=====================================================
+
+    // Scale factors bring the observed extremes of each noise to about
+    // [-1, 1]. Gradients aren't normalized, so they depend on dimension.
+
+    template<unsigned D>
+    struct Noise_scale;
+
+    template<>
+    struct Noise_scale<2> {
+        static constexpr float perlin = 1.3f;
+        static constexpr float simplex = 72.0f;
+    };
+
+    template<>
+    struct Noise_scale<3> {
+        static constexpr float perlin = 1.25f;
+        static constexpr float simplex = 65.0f;
+    };
+
+    template<>
+    struct Noise_scale<4> {
+        static constexpr float perlin = 1.2f;
+        static constexpr float simplex = 60.0f;
+    };
+
+    ///
+    /// Splits p into the integer cell coordinates c and the offsets f within
+    /// the cell
+    ///
+    template<class T, class U, unsigned D>
+    AVML_FINL void lattice_cell(const T (&p)[D], U (&c)[D], T (&f)[D]) {
+        for (unsigned d = 0; d < D; ++d) {
+            T fl = lanes_floor(p[d]);
+            f[d] = p[d] - fl;
+            c[d] = lanes_to_uint(fl);
+        }
+    }
+
+    ///
+    /// Interpolates the corner values of a cell, where bit d of the index
+    /// of a corner is its offset along dimension d
+    ///
+    template<class T, unsigned D>
+    AVML_FINL T interpolate_corners(T (&values)[1 << D], const T (&f)[D]) {
+        for (unsigned d = 0; d < D; ++d) {
+            T w = fade(f[d]);
+            for (unsigned k = 0; k < (1u << (D - d - 1)); ++k) {
+                values[k] = values[2 * k] + w * (values[2 * k + 1] - values[2 * k]);
+            }
+        }
+        return values[0];
+    }
+
+    template<class T, unsigned D>
+    AVML_FINL T value_noise(const T (&p)[D], std::uint32_t seed) {
+        using U = typename Lanes_uint<T>::type;
+
+        U c0[D];
+        T f[D];
+        lattice_cell(p, c0, f);
+
+        T values[1 << D];
+        for (unsigned corner = 0; corner < (1u << D); ++corner) {
+            U c[D];
+            for (unsigned d = 0; d < D; ++d) {
+                c[d] = ((corner >> d) & 1) ? c0[d] + U(1) : c0[d];
+            }
+            values[corner] = hash_signed<T>(hash_lattice(c, seed));
+        }
+
+        return interpolate_corners(values, f);
+    }
+
+    template<class T, unsigned D>
+    AVML_FINL T perlin_noise(const T (&p)[D], std::uint32_t seed) {
+        using U = typename Lanes_uint<T>::type;
+
+        U c0[D];
+        T f[D];
+        lattice_cell(p, c0, f);
+
+        T values[1 << D];
+        for (unsigned corner = 0; corner < (1u << D); ++corner) {
+            U c[D];
+            T x[D];
+            for (unsigned d = 0; d < D; ++d) {
+                bool upper = (corner >> d) & 1;
+                c[d] = upper ? c0[d] + U(1) : c0[d];
+                x[d] = upper ? f[d] - T(1.0f) : f[d];
+            }
+            values[corner] = gradient_dot(hash_lattice(c, seed), x);
+        }
+
+        return interpolate_corners(values, f) * T(Noise_scale<D>::perlin);
+    }
+
+    template<class T, unsigned D>
+    AVML_FINL T simplex_noise(const T (&p)[D], std::uint32_t seed) {
+        using U = typename Lanes_uint<T>::type;
+
+        const float root = std::sqrt(float(D + 1));
+        const T skew{(root - 1.0f) / float(D)};
+        const T unskew{(1.0f - 1.0f / root) / float(D)};
+
+        // Cell of the skewed lattice and offset from its origin
+        T s = T(0.0f);
+        for (unsigned d = 0; d < D; ++d) {
+            s = s + p[d];
+        }
+        s = s * skew;
+
+        T cell[D];
+        T t = T(0.0f);
+        for (unsigned d = 0; d < D; ++d) {
+            cell[d] = lanes_floor(p[d] + s);
+            t = t + cell[d];
+        }
+        t = t * unskew;
+
+        T x0[D];
+        U c0[D];
+        for (unsigned d = 0; d < D; ++d) {
+            x0[d] = p[d] - (cell[d] - t);
+            c0[d] = lanes_to_uint(cell[d]);
+        }
+
+        // Rank of each component of x0. Vertex k of the simplex is offset by
+        // one along the k components of highest rank.
+        T rank[D];
+        for (unsigned d = 0; d < D; ++d) {
+            rank[d] = T(0.0f);
+        }
+        for (unsigned i = 0; i < D; ++i) {
+            for (unsigned j = i + 1; j < D; ++j) {
+                auto i_greater = lanes_less(x0[j], x0[i]);
+                rank[i] = rank[i] + lanes_select(i_greater, T(1.0f), T(0.0f));
+                rank[j] = rank[j] + lanes_select(i_greater, T(0.0f), T(1.0f));
+            }
+        }
+
+        T ret = T(0.0f);
+        for (unsigned k = 0; k <= D; ++k) {
+            const T threshold{float(D - k) - 0.5f};
+
+            U c[D];
+            T x[D];
+            T r2 = T(0.5f);
+            for (unsigned d = 0; d < D; ++d) {
+                T offset = lanes_select(lanes_less(threshold, rank[d]), T(1.0f), T(0.0f));
+                c[d] = c0[d] + lanes_to_uint(offset);
+                x[d] = x0[d] - offset + T(float(k)) * unskew;
+                r2 = r2 - x[d] * x[d];
+            }
+
+            T falloff = lanes_max(r2, T(0.0f));
+            falloff = falloff * falloff;
+            ret = ret + falloff * falloff * gradient_dot(hash_lattice(c, seed), x);
+        }
+
+        return ret * T(Noise_scale<D>::simplex);
+    }
+
+    template<class T, unsigned D>
+    AVML_FINL T worley_noise(const T (&p)[D], std::uint32_t seed) {
+        using U = typename Lanes_uint<T>::type;
+
+        U c0[D];
+        T f[D];
+        lattice_cell(p, c0, f);
+
+        unsigned neighbours = 1;
+        for (unsigned d = 0; d < D; ++d) {
+            neighbours *= 3;
+        }
+
+        T nearest = T(16.0f);
+        for (unsigned cell = 0; cell < neighbours; ++cell) {
+            U c[D];
+            T x[D];
+            unsigned index = cell;
+            for (unsigned d = 0; d < D; ++d) {
+                unsigned offset = index % 3;
+                index /= 3;
+
+                c[d] = c0[d] + U(offset) + U(0xFFFFFFFF);
+                x[d] = f[d] - T(float(offset) - 1.0f);
+            }
+
+            U h = hash_lattice(c, seed);
+
+            T distance2 = T(0.0f);
+            for (unsigned d = 0; d < D; ++d) {
+                T delta = x[d] - hash_byte<T>(h, d);
+                distance2 = distance2 + delta * delta;
+            }
+            nearest = lanes_min(nearest, distance2);
+        }
+
+        return lanes_sqrt(nearest);
+    }
+
+    template<class T, unsigned D>
+    AVML_FINL T basis_noise(avml::Noise_basis basis, const T (&p)[D], std::uint32_t seed) {
+        switch (basis) {
+            case avml::Noise_basis::value: return value_noise(p, seed);
+            case avml::Noise_basis::perlin: return perlin_noise(p, seed);
+            case avml::Noise_basis::simplex: return simplex_noise(p, seed);
+            case avml::Noise_basis::worley: return worley_noise(p, seed);
+        }
+        return T(0.0f);
+    }
+
+    template<class T, unsigned D>
+    AVML_FINL T fbm(avml::Noise_basis basis, const T (&p)[D], const avml::Fbm_settings& settings) {
+        T ret = T(0.0f);
+
+        float frequency = 1.0f;
+        float amplitude = 1.0f;
+        float total = 0.0f;
+        for (unsigned o = 0; o < settings.octaves; ++o) {
+            T q[D];
+            for (unsigned d = 0; d < D; ++d) {
+                q[d] = p[d] * T(frequency);
+            }
+
+            ret = ret + T(amplitude) * basis_noise(basis, q, settings.seed + o);
+
+            total += amplitude;
+            frequency *= settings.lacunarity;
+            amplitude *= settings.gain;
+        }
+
+        return (total > 0.0f) ? ret * T(1.0f / total) : ret;
+    }
+
+    //=====================================================
+    // Batch drivers
+    //=====================================================
+
+#if defined(AVML_AVX2)
+
+    ///
+    /// Evaluates groups of W points in lanes of type T
+    ///
+    /// \return Number of points evaluated
+    template<class T, unsigned W, unsigned D>
+    AVML_FINL std::size_t fbm_groups(
+        avml::Noise_basis basis, const avml::Fbm_settings& settings,
+        const float* const (&in)[D], float* out, std::size_t n) {
+
+        std::size_t i = 0;
+        for (; i + W <= n; i += W) {
+            T p[D];
+            for (unsigned d = 0; d < D; ++d) {
+                alignas(64) float lanes[W];
+                for (unsigned l = 0; l < W; ++l) {
+                    lanes[l] = in[d][i + l];
+                }
+                p[d] = lanes_load(lanes);
+            }
+
+            alignas(64) float result[W];
+            lanes_store(result, fbm(basis, p, settings));
+            for (unsigned l = 0; l < W; ++l) {
+                out[i + l] = result[l];
+            }
+        }
+
+        return i;
+    }
+
+#endif
+
+    template<unsigned D>
+    AVML_FINL void fbm_batch(
+        avml::Noise_basis basis, const avml::Fbm_settings& settings,
+        const float* const (&in)[D], float* out, std::size_t n) {
+
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        i = fbm_groups<Lanes16f, 16>(basis, settings, in, out, n);
+        #elif defined(AVML_AVX2)
+        i = fbm_groups<Lanes8f, 8>(basis, settings, in, out, n);
+        #endif
+
+        for (; i < n; ++i) {
+            float p[D];
+            for (unsigned d = 0; d < D; ++d) {
+                p[d] = in[d][i];
+            }
+            out[i] = fbm(basis, p, settings);
+        }
+    }
+
+    template<unsigned D>
+    AVML_FINL void fbm_batch(
+        avml::Noise_basis basis, const avml::Fbm_settings& settings,
+        const float* const (&in)[D], float* out, std::size_t n, avml::Executor& executor) {
+
+        executor.parallel_for(n, avml::default_grain<float[D], float>(), [&](std::size_t begin, std::size_t end) {
+            const float* chunk[D];
+            for (unsigned d = 0; d < D; ++d) {
+                chunk[d] = in[d] + begin;
+            }
+            fbm_batch<D>(basis, settings, chunk, out + begin, end - begin);
+        });
+    }
+
+    template<unsigned D, class V>
+    AVML_FINL void load_point(V v, float (&p)[D]) {
+        for (unsigned d = 0; d < D; ++d) {
+            p[d] = v[d];
+        }
+    }
+
+}
+
+namespace avml {
+
+    //=====================================================
+    // Noise functions
+    //=====================================================
+
+    inline float value_noise(vec2f p, std::uint32_t seed) {
+        float q[2];
+        avml_impl::load_point(p, q);
+        return avml_impl::value_noise(q, seed);
+    }
+
+    inline float value_noise(vec3f p, std::uint32_t seed) {
+        float q[3];
+        avml_impl::load_point(p, q);
+        return avml_impl::value_noise(q, seed);
+    }
+
+    inline float value_noise(vec4f p, std::uint32_t seed) {
+        float q[4];
+        avml_impl::load_point(p, q);
+        return avml_impl::value_noise(q, seed);
+    }
+
+    inline float perlin_noise(vec2f p, std::uint32_t seed) {
+        float q[2];
+        avml_impl::load_point(p, q);
+        return avml_impl::perlin_noise(q, seed);
+    }
+
+    inline float perlin_noise(vec3f p, std::uint32_t seed) {
+        float q[3];
+        avml_impl::load_point(p, q);
+        return avml_impl::perlin_noise(q, seed);
+    }
+
+    inline float perlin_noise(vec4f p, std::uint32_t seed) {
+        float q[4];
+        avml_impl::load_point(p, q);
+        return avml_impl::perlin_noise(q, seed);
+    }
+
+    inline float simplex_noise(vec2f p, std::uint32_t seed) {
+        float q[2];
+        avml_impl::load_point(p, q);
+        return avml_impl::simplex_noise(q, seed);
+    }
+
+    inline float simplex_noise(vec3f p, std::uint32_t seed) {
+        float q[3];
+        avml_impl::load_point(p, q);
+        return avml_impl::simplex_noise(q, seed);
+    }
+
+    inline float simplex_noise(vec4f p, std::uint32_t seed) {
+        float q[4];
+        avml_impl::load_point(p, q);
+        return avml_impl::simplex_noise(q, seed);
+    }
+
+    inline float worley_noise(vec2f p, std::uint32_t seed) {
+        float q[2];
+        avml_impl::load_point(p, q);
+        return avml_impl::worley_noise(q, seed);
+    }
+
+    inline float worley_noise(vec3f p, std::uint32_t seed) {
+        float q[3];
+        avml_impl::load_point(p, q);
+        return avml_impl::worley_noise(q, seed);
+    }
+
+    inline float worley_noise(vec4f p, std::uint32_t seed) {
+        float q[4];
+        avml_impl::load_point(p, q);
+        return avml_impl::worley_noise(q, seed);
+    }
+
+    //=====================================================
+    // Fractal noise
+    //=====================================================
+
+    inline float fbm(Noise_basis basis, vec2f p, const Fbm_settings& settings) {
+        float q[2];
+        avml_impl::load_point(p, q);
+        return avml_impl::fbm(basis, q, settings);
+    }
+
+    inline float fbm(Noise_basis basis, vec3f p, const Fbm_settings& settings) {
+        float q[3];
+        avml_impl::load_point(p, q);
+        return avml_impl::fbm(basis, q, settings);
+    }
+
+    inline float fbm(Noise_basis basis, vec4f p, const Fbm_settings& settings) {
+        float q[4];
+        avml_impl::load_point(p, q);
+        return avml_impl::fbm(basis, q, settings);
+    }
+
+    //=====================================================
+    // Batch noise
+    //=====================================================
+
+    inline void fbm_batch(Noise_basis basis, const Fbm_settings& settings, const float* x, const float* y, float* out, std::size_t n) {
+        AVML_PROFILE_BATCH("fbm(vec2f)[batch]", n);
+
+        const float* in[2] = {x, y};
+        avml_impl::fbm_batch<2>(basis, settings, in, out, n);
+    }
+
+    inline void fbm_batch(Noise_basis basis, const Fbm_settings& settings, const float* x, const float* y, const float* z, float* out, std::size_t n) {
+        AVML_PROFILE_BATCH("fbm(vec3f)[batch]", n);
+
+        const float* in[3] = {x, y, z};
+        avml_impl::fbm_batch<3>(basis, settings, in, out, n);
+    }
+
+    inline void fbm_batch(Noise_basis basis, const Fbm_settings& settings, const float* x, const float* y, const float* z, const float* w, float* out, std::size_t n) {
+        AVML_PROFILE_BATCH("fbm(vec4f)[batch]", n);
+
+        const float* in[4] = {x, y, z, w};
+        avml_impl::fbm_batch<4>(basis, settings, in, out, n);
+    }
+
+    inline void fbm_batch(Noise_basis basis, const Fbm_settings& settings, const float* x, const float* y, float* out, std::size_t n, Executor& executor) {
+        const float* in[2] = {x, y};
+        avml_impl::fbm_batch<2>(basis, settings, in, out, n, executor);
+    }
+
+    inline void fbm_batch(Noise_basis basis, const Fbm_settings& settings, const float* x, const float* y, const float* z, float* out, std::size_t n, Executor& executor) {
+        const float* in[3] = {x, y, z};
+        avml_impl::fbm_batch<3>(basis, settings, in, out, n, executor);
+    }
+
+    inline void fbm_batch(Noise_basis basis, const Fbm_settings& settings, const float* x, const float* y, const float* z, const float* w, float* out, std::size_t n, Executor& executor) {
+        const float* in[4] = {x, y, z, w};
+        avml_impl::fbm_batch<4>(basis, settings, in, out, n, executor);
+    }
+
+}
+
+#endif
@@ -0,0 +1,322 @@
+#ifndef AVML_SKINNINGF_IPP
+#define AVML_SKINNINGF_IPP
+
+#include "Lanes.hpp"
+
+namespace avml_impl {
+
+    //=====================================================
+    // Influences
+    //=====================================================
+
+    // Bone indices and weights of W consecutive vertices, transposed so that
+    // b[k] and w[k] hold the k-th influence of every vertex
+
+    AVML_FINL void load_influences(const std::uint32_t* indices, const float* weights, std::uint32_t (&b)[4], float (&w)[4]) {
+        for (unsigned k = 0; k < 4; ++k) {
+            b[k] = indices[k];
+            w[k] = weights[k];
+        }
+    }
+
+#if defined(AVML_AVX512F)
+
+    AVML_FINL void load_influences(const std::uint32_t* indices, const float* weights, Lanes16u (&b)[4], Lanes16f (&w)[4]) {
+        const Lanes16u offsets{_mm512_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60)};
+        for (unsigned k = 0; k < 4; ++k) {
+            b[k] = lanes_gather(indices + k, offsets);
+            w[k] = lanes_gather(weights + k, offsets);
+        }
+    }
+
+#endif
+
+#if defined(AVML_AVX2)
+
+    AVML_FINL void load_influences(const std::uint32_t* indices, const float* weights, Lanes8u (&b)[4], Lanes8f (&w)[4]) {
+        const Lanes8u offsets{_mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28)};
+        for (unsigned k = 0; k < 4; ++k) {
+            b[k] = lanes_gather(indices + k, offsets);
+            w[k] = lanes_gather(weights + k, offsets);
+        }
+    }
+
+#endif
+
+    //=====================================================
+    // Kernels
+    //=====================================================
+
+    template<class T>
+    AVML_FINL void renormalize(T (&n)[3]) {
+        T inv = T{1.0f} / lanes_sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        n[0] = n[0] * inv;
+        n[1] = n[1] * inv;
+        n[2] = n[2] * inv;
+    }
+
+    ///
+    /// Bones are rows of a 3x4 affine transform, stride floats apart
+    ///
+    struct Linear_blend_kernel {
+        const float* bones;
+        std::uint32_t stride;
+
+        template<class T, class U>
+        AVML_FINL void operator()(const U (&b)[4], const T (&w)[4], T (&p)[3], T (&n)[3], bool normals) const {
+            U offsets[4];
+            for (unsigned k = 0; k < 4; ++k) {
+                offsets[k] = b[k] * U(stride);
+            }
+
+            T m[12];
+            for (unsigned c = 0; c < 12; ++c) {
+                m[c] = w[0] * lanes_gather(bones + c, offsets[0]);
+            }
+            for (unsigned k = 1; k < 4; ++k) {
+                for (unsigned c = 0; c < 12; ++c) {
+                    m[c] = lanes_fmadd(w[k], lanes_gather(bones + c, offsets[k]), m[c]);
+                }
+            }
+
+            T x = p[0];
+            T y = p[1];
+            T z = p[2];
+            for (unsigned d = 0; d < 3; ++d) {
+                p[d] = lanes_fmadd(m[4 * d + 0], x, lanes_fmadd(m[4 * d + 1], y, lanes_fmadd(m[4 * d + 2], z, m[4 * d + 3])));
+            }
+
+            if (normals) {
+                x = n[0];
+                y = n[1];
+                z = n[2];
+                for (unsigned d = 0; d < 3; ++d) {
+                    n[d] = lanes_fmadd(m[4 * d + 0], x, lanes_fmadd(m[4 * d + 1], y, m[4 * d + 2] * z));
+                }
+                renormalize(n);
+            }
+        }
+    };
+
+    ///
+    /// Bones are dual quaternions of eight floats, real part first
+    ///
+    struct Dual_quaternion_kernel {
+        const float* bones;
+
+        template<class T, class U>
+        AVML_FINL void operator()(const U (&b)[4], const T (&w)[4], T (&p)[3], T (&n)[3], bool normals) const {
+            T first[8];
+            T q[8];
+            U offset = b[0] * U(8);
+            for (unsigned c = 0; c < 8; ++c) {
+                first[c] = lanes_gather(bones + c, offset);
+                q[c] = w[0] * first[c];
+            }
+
+            for (unsigned k = 1; k < 4; ++k) {
+                T g[8];
+                offset = b[k] * U(8);
+                for (unsigned c = 0; c < 8; ++c) {
+                    g[c] = lanes_gather(bones + c, offset);
+                }
+
+                // q and -q are the same rotation. Blending across hemispheres
+                // would take the long way around.
+                T d = first[0] * g[0] + first[1] * g[1] + first[2] * g[2] + first[3] * g[3];
+                T s = lanes_select(lanes_less(d, T{0.0f}), -w[k], w[k]);
+                for (unsigned c = 0; c < 8; ++c) {
+                    q[c] = lanes_fmadd(s, g[c], q[c]);
+                }
+            }
+
+            T inv = T{1.0f} / lanes_sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+            for (unsigned c = 0; c < 8; ++c) {
+                q[c] = q[c] * inv;
+            }
+
+            // Translation 2 * (r_w * d_xyz - d_w * r_xyz + r_xyz x d_xyz)
+            T two{2.0f};
+            T t[3] = {
+                two * (q[3] * q[4] - q[7] * q[0] + q[1] * q[6] - q[2] * q[5]),
+                two * (q[3] * q[5] - q[7] * q[1] + q[2] * q[4] - q[0] * q[6]),
+                two * (q[3] * q[6] - q[7] * q[2] + q[0] * q[5] - q[1] * q[4])
+            };
+
+            rotate(q, p);
+            p[0] = p[0] + t[0];
+            p[1] = p[1] + t[1];
+            p[2] = p[2] + t[2];
+
+            if (normals) {
+                rotate(q, n);
+                renormalize(n);
+            }
+        }
+
+        ///
+        /// v + r_w * u + r_xyz x u, where u = 2 * r_xyz x v
+        ///
+        template<class T>
+        AVML_FINL static void rotate(const T (&q)[8], T (&v)[3]) {
+            T two{2.0f};
+            T u[3] = {
+                two * (q[1] * v[2] - q[2] * v[1]),
+                two * (q[2] * v[0] - q[0] * v[2]),
+                two * (q[0] * v[1] - q[1] * v[0])
+            };
+
+            v[0] = lanes_fmadd(q[3], u[0], v[0]) + (q[1] * u[2] - q[2] * u[1]);
+            v[1] = lanes_fmadd(q[3], u[1], v[1]) + (q[2] * u[0] - q[0] * u[2]);
+            v[2] = lanes_fmadd(q[3], u[2], v[2]) + (q[0] * u[1] - q[1] * u[0]);
+        }
+    };
+
+    //=====================================================
+    // Drivers
+    //=====================================================
+
+    ///
+    /// Skins W vertices at a time with lanes of type T
+    ///
+    /// \return Number of vertices skinned
+    template<class T, unsigned W, class Kernel>
+    AVML_FINL std::size_t skin_groups(
+        const Kernel& kernel, const std::uint32_t* indices, const float* weights,
+        const float* positions, const float* normals,
+        float* out_positions, float* out_normals, std::size_t n) {
+
+        using U = typename Lanes_uint<T>::type;
+        bool has_normals = normals && out_normals;
+
+        std::size_t i = 0;
+        for (; i + W <= n; i += W) {
+            U b[4];
+            T w[4];
+            load_influences(indices + 4 * i, weights + 4 * i, b, w);
+
+            T p[3];
+            T nn[3]{};
+            lanes_load_interleaved(positions + 3 * i, p);
+            if (has_normals) {
+                lanes_load_interleaved(normals + 3 * i, nn);
+            }
+
+            kernel(b, w, p, nn, has_normals);
+
+            lanes_store_interleaved(out_positions + 3 * i, p);
+            if (has_normals) {
+                lanes_store_interleaved(out_normals + 3 * i, nn);
+            }
+        }
+
+        return i;
+    }
+
+    template<class Kernel>
+    AVML_FINL void skin(
+        const Kernel& kernel, const std::uint32_t* indices, const float* weights,
+        const avml::vec3f* positions, const avml::vec3f* normals,
+        avml::vec3f* out_positions, avml::vec3f* out_normals, std::size_t n) {
+
+        const float* p = reinterpret_cast<const float*>(positions);
+        const float* nn = reinterpret_cast<const float*>(normals);
+        float* out_p = reinterpret_cast<float*>(out_positions);
+        float* out_n = reinterpret_cast<float*>(out_normals);
+
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        i = skin_groups<Lanes16f, 16>(kernel, indices, weights, p, nn, out_p, out_n, n);
+        #elif defined(AVML_AVX2)
+        i = skin_groups<Lanes8f, 8>(kernel, indices, weights, p, nn, out_p, out_n, n);
+        #endif
+
+        skin_groups<float, 1>(
+            kernel, indices + 4 * i, weights + 4 * i,
+            p + 3 * i, nn ? nn + 3 * i : nullptr,
+            out_p + 3 * i, out_n ? out_n + 3 * i : nullptr, n - i);
+    }
+
+    template<class Kernel>
+    AVML_FINL void skin(
+        const Kernel& kernel, const std::uint32_t* indices, const float* weights,
+        const avml::vec3f* positions, const avml::vec3f* normals,
+        avml::vec3f* out_positions, avml::vec3f* out_normals, std::size_t n, avml::Executor& executor) {
+
+        executor.parallel_for(n, avml::default_grain<avml::vec3f[2], avml::vec3f[2]>(), [&](std::size_t begin, std::size_t end) {
+            skin(
+                kernel, indices + 4 * begin, weights + 4 * begin,
+                positions + begin, normals ? normals + begin : nullptr,
+                out_positions + begin, out_normals ? out_normals + begin : nullptr, end - begin);
+        });
+    }
+
+}
+
+namespace avml {
+
+    //=====================================================
+    // Skinning
+    //=====================================================
+
+    inline void linear_blend_skinning(
+        const affine3x4f* bones, const std::uint32_t* bone_indices, const float* bone_weights,
+        const vec3f* positions, const vec3f* normals,
+        vec3f* out_positions, vec3f* out_normals, std::size_t n) {
+        AVML_PROFILE_BATCH("linear_blend_skinning[affine3x4f]", n);
+
+        const avml_impl::Linear_blend_kernel kernel{reinterpret_cast<const float*>(bones), 12};
+        avml_impl::skin(kernel, bone_indices, bone_weights, positions, normals, out_positions, out_normals, n);
+    }
+
+    inline void linear_blend_skinning(
+        const mat4x4f* bones, const std::uint32_t* bone_indices, const float* bone_weights,
+        const vec3f* positions, const vec3f* normals,
+        vec3f* out_positions, vec3f* out_normals, std::size_t n) {
+        AVML_PROFILE_BATCH("linear_blend_skinning[mat4x4f]", n);
+
+        const avml_impl::Linear_blend_kernel kernel{reinterpret_cast<const float*>(bones), 16};
+        avml_impl::skin(kernel, bone_indices, bone_weights, positions, normals, out_positions, out_normals, n);
+    }
+
+    inline void dual_quaternion_skinning(
+        const dualquatf* bones, const std::uint32_t* bone_indices, const float* bone_weights,
+        const vec3f* positions, const vec3f* normals,
+        vec3f* out_positions, vec3f* out_normals, std::size_t n) {
+        AVML_PROFILE_BATCH("dual_quaternion_skinning", n);
+
+        const avml_impl::Dual_quaternion_kernel kernel{reinterpret_cast<const float*>(bones)};
+        avml_impl::skin(kernel, bone_indices, bone_weights, positions, normals, out_positions, out_normals, n);
+    }
+
+    inline void linear_blend_skinning(
+        const affine3x4f* bones, const std::uint32_t* bone_indices, const float* bone_weights,
+        const vec3f* positions, const vec3f* normals,
+        vec3f* out_positions, vec3f* out_normals, std::size_t n, Executor& executor) {
+
+        const avml_impl::Linear_blend_kernel kernel{reinterpret_cast<const float*>(bones), 12};
+        avml_impl::skin(kernel, bone_indices, bone_weights, positions, normals, out_positions, out_normals, n, executor);
+    }
+
+    inline void linear_blend_skinning(
+        const mat4x4f* bones, const std::uint32_t* bone_indices, const float* bone_weights,
+        const vec3f* positions, const vec3f* normals,
+        vec3f* out_positions, vec3f* out_normals, std::size_t n, Executor& executor) {
+
+        const avml_impl::Linear_blend_kernel kernel{reinterpret_cast<const float*>(bones), 16};
+        avml_impl::skin(kernel, bone_indices, bone_weights, positions, normals, out_positions, out_normals, n, executor);
+    }
+
+    inline void dual_quaternion_skinning(
+        const dualquatf* bones, const std::uint32_t* bone_indices, const float* bone_weights,
+        const vec3f* positions, const vec3f* normals,
+        vec3f* out_positions, vec3f* out_normals, std::size_t n, Executor& executor) {
+
+        const avml_impl::Dual_quaternion_kernel kernel{reinterpret_cast<const float*>(bones)};
+        avml_impl::skin(kernel, bone_indices, bone_weights, positions, normals, out_positions, out_normals, n, executor);
+    }
+
+}
+
+#endif
@@ -0,0 +1,671 @@
+#ifndef AVML_SOLVERSF_IPP
+#define AVML_SOLVERSF_IPP
+
+#include <limits>
+
+#include "Lanes.hpp"
+
+namespace avml_impl {
+
+    //=====================================================
+    // Kernels
+    //=====================================================
+
+    // Templated over the lane type T like the decomposition kernels. Matrices
+    // are row-major arrays of N * N elements. Pivoting is done with selects
+    // rather than branches so that every lane follows the same path.
+
+    ///
+    /// Overwrites a with its Cholesky factor. The upper triangle is zeroed.
+    ///
+    /// \return Smallest pivot, which is positive iff a was positive definite
+    template<class T, unsigned N>
+    AVML_FINL T cholesky_factor(T (&a)[N * N]) {
+        T min_pivot = a[0];
+
+        for (unsigned j = 0; j < N; ++j) {
+            T d = a[j * N + j];
+            for (unsigned k = 0; k < j; ++k) {
+                d = d - a[j * N + k] * a[j * N + k];
+            }
+
+            min_pivot = lanes_min(min_pivot, d);
+
+            T l_jj = lanes_sqrt(d);
+            T inv = T(1.0f) / l_jj;
+            a[j * N + j] = l_jj;
+
+            for (unsigned i = j + 1; i < N; ++i) {
+                T sum = a[i * N + j];
+                for (unsigned k = 0; k < j; ++k) {
+                    sum = sum - a[i * N + k] * a[j * N + k];
+                }
+
+                a[i * N + j] = sum * inv;
+                a[j * N + i] = T(0.0f);
+            }
+        }
+
+        return min_pivot;
+    }
+
+    ///
+    /// Overwrites x, initially the right-hand side, with the solution of
+    /// l * transpose(l) * x = b
+    ///
+    template<class T, unsigned N>
+    AVML_FINL void cholesky_substitute(const T (&l)[N * N], T (&x)[N]) {
+        for (unsigned i = 0; i < N; ++i) {
+            T sum = x[i];
+            for (unsigned k = 0; k < i; ++k) {
+                sum = sum - l[i * N + k] * x[k];
+            }
+            x[i] = sum / l[i * N + i];
+        }
+
+        for (unsigned i = N; i-- > 0;) {
+            T sum = x[i];
+            for (unsigned k = i + 1; k < N; ++k) {
+                sum = sum - l[k * N + i] * x[k];
+            }
+            x[i] = sum / l[i * N + i];
+        }
+    }
+
+    ///
+    /// Overwrites a with its LU factors using partial pivoting. Row swaps
+    /// are applied to c as well, which is either the right-hand side or the
+    /// row indices when the permutation itself is wanted.
+    ///
+    /// \return Smallest pivot magnitude. Rounding rarely leaves the pivots of
+    /// a singular a at exactly zero, so callers compare this against the
+    /// magnitude of a's entries with lu_pivot_ok().
+    template<class T, unsigned N>
+    AVML_FINL T lu_factor(T (&a)[N * N], T (&c)[N]) {
+        // The first pivot is the largest entry of the first column
+        T min_pivot = lanes_abs(a[0]);
+        for (unsigned i = 1; i < N; ++i) {
+            min_pivot = lanes_max(min_pivot, lanes_abs(a[i * N]));
+        }
+
+        for (unsigned k = 0; k < N; ++k) {
+            // Each row below k is swapped into row k if its entry in column
+            // k is larger, leaving the largest there at the end
+            for (unsigned i = k + 1; i < N; ++i) {
+                auto swap = lanes_less(lanes_abs(a[k * N + k]), lanes_abs(a[i * N + k]));
+
+                for (unsigned j = 0; j < N; ++j) {
+                    T x = a[k * N + j];
+                    T y = a[i * N + j];
+                    a[k * N + j] = lanes_select(swap, y, x);
+                    a[i * N + j] = lanes_select(swap, x, y);
+                }
+
+                T x = c[k];
+                T y = c[i];
+                c[k] = lanes_select(swap, y, x);
+                c[i] = lanes_select(swap, x, y);
+            }
+
+            T pivot = a[k * N + k];
+            min_pivot = lanes_min(min_pivot, lanes_abs(pivot));
+
+            T inv = T(1.0f) / pivot;
+            for (unsigned i = k + 1; i < N; ++i) {
+                T l = a[i * N + k] * inv;
+                a[i * N + k] = l;
+
+                for (unsigned j = k + 1; j < N; ++j) {
+                    a[i * N + j] = a[i * N + j] - l * a[k * N + j];
+                }
+            }
+        }
+
+        return min_pivot;
+    }
+
+    ///
+    /// Overwrites x, initially the permuted right-hand side, with the
+    /// solution of l * u * x = b
+    ///
+    template<class T, unsigned N>
+    AVML_FINL void lu_substitute(const T (&lu)[N * N], T (&x)[N]) {
+        for (unsigned i = 1; i < N; ++i) {
+            T sum = x[i];
+            for (unsigned k = 0; k < i; ++k) {
+                sum = sum - lu[i * N + k] * x[k];
+            }
+            x[i] = sum;
+        }
+
+        for (unsigned i = N; i-- > 0;) {
+            T sum = x[i];
+            for (unsigned k = i + 1; k < N; ++k) {
+                sum = sum - lu[i * N + k] * x[k];
+            }
+            x[i] = sum / lu[i * N + i];
+        }
+    }
+
+    //=====================================================
+    // Scalar drivers
+    //=====================================================
+
+    // The public functions forward to these through data() so that every
+    // matrix type shares one implementation per operation
+
+    ///
+    /// \return True if min_pivot, as returned by lu_factor() for the N by N
+    /// matrix a, is large enough for a to be considered non-singular
+    template<unsigned N, class R>
+    AVML_FINL bool lu_pivot_ok(const R* a, R min_pivot) {
+        R max_entry = R(0);
+        for (unsigned i = 0; i < N * N; ++i) {
+            max_entry = lanes_max(max_entry, lanes_abs(a[i]));
+        }
+
+        return min_pivot > R(N) * std::numeric_limits<R>::epsilon() * max_entry;
+    }
+
+    template<unsigned N, class R>
+    AVML_FINL bool cholesky(const R* a, R* l) {
+        R m[N * N];
+        for (unsigned i = 0; i < N * N; ++i) {
+            m[i] = a[i];
+        }
+
+        if (!(cholesky_factor<R, N>(m) > R(0))) {
+            return false;
+        }
+
+        for (unsigned i = 0; i < N * N; ++i) {
+            l[i] = m[i];
+        }
+        return true;
+    }
+
+    template<unsigned N, class R>
+    AVML_FINL void cholesky_solve(const R* l, const R* b, R* x) {
+        R m[N * N];
+        for (unsigned i = 0; i < N * N; ++i) {
+            m[i] = l[i];
+        }
+
+        R y[N];
+        for (unsigned i = 0; i < N; ++i) {
+            y[i] = b[i];
+        }
+
+        cholesky_substitute<R, N>(m, y);
+
+        for (unsigned i = 0; i < N; ++i) {
+            x[i] = y[i];
+        }
+    }
+
+    template<unsigned N, class R>
+    AVML_FINL bool lu(const R* a, R* lu, unsigned* permutation) {
+        R m[N * N];
+        for (unsigned i = 0; i < N * N; ++i) {
+            m[i] = a[i];
+        }
+
+        R rows[N];
+        for (unsigned i = 0; i < N; ++i) {
+            rows[i] = R(i);
+        }
+
+        if (!lu_pivot_ok<N>(a, lu_factor<R, N>(m, rows))) {
+            return false;
+        }
+
+        for (unsigned i = 0; i < N * N; ++i) {
+            lu[i] = m[i];
+        }
+        for (unsigned i = 0; i < N; ++i) {
+            permutation[i] = static_cast<unsigned>(rows[i]);
+        }
+        return true;
+    }
+
+    template<unsigned N, class R>
+    AVML_FINL void lu_solve(const R* lu, const unsigned* permutation, const R* b, R* x) {
+        R m[N * N];
+        for (unsigned i = 0; i < N * N; ++i) {
+            m[i] = lu[i];
+        }
+
+        R y[N];
+        for (unsigned i = 0; i < N; ++i) {
+            y[i] = b[permutation[i]];
+        }
+
+        lu_substitute<R, N>(m, y);
+
+        for (unsigned i = 0; i < N; ++i) {
+            x[i] = y[i];
+        }
+    }
+
+    template<unsigned N, class R>
+    AVML_FINL bool solve(const R* a, const R* b, R* x) {
+        R m[N * N];
+        for (unsigned i = 0; i < N * N; ++i) {
+            m[i] = a[i];
+        }
+
+        R y[N];
+        for (unsigned i = 0; i < N; ++i) {
+            y[i] = b[i];
+        }
+
+        if (!lu_pivot_ok<N>(a, lu_factor<R, N>(m, y))) {
+            return false;
+        }
+
+        lu_substitute<R, N>(m, y);
+
+        for (unsigned i = 0; i < N; ++i) {
+            x[i] = y[i];
+        }
+        return true;
+    }
+
+    template<unsigned N, class R>
+    AVML_FINL bool solve_spd(const R* a, const R* b, R* x) {
+        R m[N * N];
+        for (unsigned i = 0; i < N * N; ++i) {
+            m[i] = a[i];
+        }
+
+        if (!(cholesky_factor<R, N>(m) > R(0))) {
+            return false;
+        }
+
+        R y[N];
+        for (unsigned i = 0; i < N; ++i) {
+            y[i] = b[i];
+        }
+
+        cholesky_substitute<R, N>(m, y);
+
+        for (unsigned i = 0; i < N; ++i) {
+            x[i] = y[i];
+        }
+        return true;
+    }
+
+    //=====================================================
+    // Batch drivers
+    //=====================================================
+
+    template<bool Spd, class T, unsigned N>
+    AVML_FINL void solve_lanes(T (&a)[N * N], T (&x)[N]) {
+        if (Spd) {
+            cholesky_factor<T, N>(a);
+            cholesky_substitute<T, N>(a, x);
+        } else {
+            lu_factor<T, N>(a, x);
+            lu_substitute<T, N>(a, x);
+        }
+    }
+
+#if defined(AVML_AVX)
+
+    ///
+    /// Solves groups of W systems laid out as a structure of arrays of lane
+    /// type T
+    ///
+    /// \return Number of systems solved
+    template<bool Spd, class T, unsigned W, unsigned N, class Mat, class Vec>
+    AVML_FINL std::size_t solve_groups(const Mat* a, const Vec* b, Vec* x, std::size_t n) {
+        std::size_t i = 0;
+        for (; i + W <= n; i += W) {
+            alignas(64) float soa_a[N * N][W];
+            alignas(64) float soa_x[N][W];
+            for (unsigned l = 0; l < W; ++l) {
+                const float* src_a = a[i + l].data();
+                const float* src_b = b[i + l].data();
+                for (unsigned e = 0; e < N * N; ++e) {
+                    soa_a[e][l] = src_a[e];
+                }
+                for (unsigned e = 0; e < N; ++e) {
+                    soa_x[e][l] = src_b[e];
+                }
+            }
+
+            T m[N * N];
+            for (unsigned e = 0; e < N * N; ++e) {
+                m[e] = lanes_load(soa_a[e]);
+            }
+
+            T y[N];
+            for (unsigned e = 0; e < N; ++e) {
+                y[e] = lanes_load(soa_x[e]);
+            }
+
+            solve_lanes<Spd, T, N>(m, y);
+
+            for (unsigned e = 0; e < N; ++e) {
+                lanes_store(soa_x[e], y[e]);
+            }
+
+            for (unsigned l = 0; l < W; ++l) {
+                float* dst = x[i + l].data();
+                for (unsigned e = 0; e < N; ++e) {
+                    dst[e] = soa_x[e][l];
+                }
+            }
+        }
+
+        return i;
+    }
+
+#endif
+
+    template<bool Spd, unsigned N, class Mat, class Vec>
+    AVML_FINL void solve_batch(const Mat* a, const Vec* b, Vec* x, std::size_t n) {
+        std::size_t i = 0;
+
+        #if defined(AVML_AVX512F)
+        i = solve_groups<Spd, Lanes16f, 16, N>(a, b, x, n);
+        #elif defined(AVML_AVX)
+        i = solve_groups<Spd, Lanes8f, 8, N>(a, b, x, n);
+        #endif
+
+        for (; i < n; ++i) {
+            float m[N * N];
+            const float* src_a = a[i].data();
+            for (unsigned e = 0; e < N * N; ++e) {
+                m[e] = src_a[e];
+            }
+
+            float y[N];
+            const float* src_b = b[i].data();
+            for (unsigned e = 0; e < N; ++e) {
+                y[e] = src_b[e];
+            }
+
+            solve_lanes<Spd, float, N>(m, y);
+
+            float* dst = x[i].data();
+            for (unsigned e = 0; e < N; ++e) {
+                dst[e] = y[e];
+            }
+        }
+    }
+
+    template<bool Spd, unsigned N, class Mat, class Vec>
+    AVML_FINL void solve_batch(const Mat* a, const Vec* b, Vec* x, std::size_t n, avml::Executor& executor) {
+        executor.parallel_for(n, avml::default_grain<Mat, Vec>(), [=](std::size_t begin, std::size_t end) {
+            solve_batch<Spd, N>(a + begin, b + begin, x + begin, end - begin);
+        });
+    }
+
+}
+
+namespace avml {
+
+    //=====================================================
+    // Linear systems
+    //=====================================================
+
+    template<class R>
+    bool cholesky(const Matrix2x2R<R>& a, Matrix2x2R<R>& l) {
+        AVML_PROFILE("cholesky(Matrix2x2R)");
+
+        return avml_impl::cholesky<2>(a.data(), l.data());
+    }
+
+    template<class R>
+    bool cholesky(const Matrix3x3R<R>& a, Matrix3x3R<R>& l) {
+        AVML_PROFILE("cholesky(Matrix3x3R)");
+
+        return avml_impl::cholesky<3>(a.data(), l.data());
+    }
+
+    template<class R>
+    bool cholesky(const Matrix4x4R<R>& a, Matrix4x4R<R>& l) {
+        AVML_PROFILE("cholesky(Matrix4x4R)");
+
+        return avml_impl::cholesky<4>(a.data(), l.data());
+    }
+
+    template<class R, unsigned N>
+    bool cholesky(const Matrix<R, N, N>& a, Matrix<R, N, N>& l) {
+        AVML_PROFILE("cholesky(Matrix)");
+
+        return avml_impl::cholesky<N>(a.data(), l.data());
+    }
+
+    template<class R>
+    Vector2R<R> cholesky_solve(const Matrix2x2R<R>& l, const Vector2R<R>& b) {
+        Vector2R<R> x;
+        avml_impl::cholesky_solve<2>(l.data(), b.data(), x.data());
+        return x;
+    }
+
+    template<class R>
+    Vector3R<R> cholesky_solve(const Matrix3x3R<R>& l, const Vector3R<R>& b) {
+        Vector3R<R> x;
+        avml_impl::cholesky_solve<3>(l.data(), b.data(), x.data());
+        return x;
+    }
+
+    template<class R>
+    Vector4R<R> cholesky_solve(const Matrix4x4R<R>& l, const Vector4R<R>& b) {
+        Vector4R<R> x;
+        avml_impl::cholesky_solve<4>(l.data(), b.data(), x.data());
+        return x;
+    }
+
+    template<class R, unsigned N>
+    Matrix<R, N, 1> cholesky_solve(const Matrix<R, N, N>& l, const Matrix<R, N, 1>& b) {
+        Matrix<R, N, 1> x;
+        avml_impl::cholesky_solve<N>(l.data(), b.data(), x.data());
+        return x;
+    }
+
+    template<class R>
+    bool lu(const Matrix2x2R<R>& a, Matrix2x2R<R>& lu, unsigned (&permutation)[2]) {
+        AVML_PROFILE("lu(Matrix2x2R)");
+
+        return avml_impl::lu<2>(a.data(), lu.data(), permutation);
+    }
+
+    template<class R>
+    bool lu(const Matrix3x3R<R>& a, Matrix3x3R<R>& lu, unsigned (&permutation)[3]) {
+        AVML_PROFILE("lu(Matrix3x3R)");
+
+        return avml_impl::lu<3>(a.data(), lu.data(), permutation);
+    }
+
+    template<class R>
+    bool lu(const Matrix4x4R<R>& a, Matrix4x4R<R>& lu, unsigned (&permutation)[4]) {
+        AVML_PROFILE("lu(Matrix4x4R)");
+
+        return avml_impl::lu<4>(a.data(), lu.data(), permutation);
+    }
+
+    template<class R, unsigned N>
+    bool lu(const Matrix<R, N, N>& a, Matrix<R, N, N>& lu, unsigned (&permutation)[N]) {
+        AVML_PROFILE("lu(Matrix)");
+
+        return avml_impl::lu<N>(a.data(), lu.data(), permutation);
+    }
+
+    template<class R>
+    Vector2R<R> lu_solve(const Matrix2x2R<R>& lu, const unsigned (&permutation)[2], const Vector2R<R>& b) {
+        Vector2R<R> x;
+        avml_impl::lu_solve<2>(lu.data(), permutation, b.data(), x.data());
+        return x;
+    }
+
+    template<class R>
+    Vector3R<R> lu_solve(const Matrix3x3R<R>& lu, const unsigned (&permutation)[3], const Vector3R<R>& b) {
+        Vector3R<R> x;
+        avml_impl::lu_solve<3>(lu.data(), permutation, b.data(), x.data());
+        return x;
+    }
+
+    template<class R>
+    Vector4R<R> lu_solve(const Matrix4x4R<R>& lu, const unsigned (&permutation)[4], const Vector4R<R>& b) {
+        Vector4R<R> x;
+        avml_impl::lu_solve<4>(lu.data(), permutation, b.data(), x.data());
+        return x;
+    }
+
+    template<class R, unsigned N>
+    Matrix<R, N, 1> lu_solve(const Matrix<R, N, N>& lu, const unsigned (&permutation)[N], const Matrix<R, N, 1>& b) {
+        Matrix<R, N, 1> x;
+        avml_impl::lu_solve<N>(lu.data(), permutation, b.data(), x.data());
+        return x;
+    }
+
+    template<class R>
+    bool solve(const Matrix2x2R<R>& a, const Vector2R<R>& b, Vector2R<R>& x) {
+        AVML_PROFILE("solve(Matrix2x2R)");
+
+        return avml_impl::solve<2>(a.data(), b.data(), x.data());
+    }
+
+    template<class R>
+    bool solve(const Matrix3x3R<R>& a, const Vector3R<R>& b, Vector3R<R>& x) {
+        AVML_PROFILE("solve(Matrix3x3R)");
+
+        return avml_impl::solve<3>(a.data(), b.data(), x.data());
+    }
+
+    template<class R>
+    bool solve(const Matrix4x4R<R>& a, const Vector4R<R>& b, Vector4R<R>& x) {
+        AVML_PROFILE("solve(Matrix4x4R)");
+
+        return avml_impl::solve<4>(a.data(), b.data(), x.data());
+    }
+
+    template<class R, unsigned N>
+    bool solve(const Matrix<R, N, N>& a, const Matrix<R, N, 1>& b, Matrix<R, N, 1>& x) {
+        AVML_PROFILE("solve(Matrix)");
+
+        return avml_impl::solve<N>(a.data(), b.data(), x.data());
+    }
+
+    template<class R>
+    bool solve_spd(const Matrix2x2R<R>& a, const Vector2R<R>& b, Vector2R<R>& x) {
+        AVML_PROFILE("solve_spd(Matrix2x2R)");
+
+        return avml_impl::solve_spd<2>(a.data(), b.data(), x.data());
+    }
+
+    template<class R>
+    bool solve_spd(const Matrix3x3R<R>& a, const Vector3R<R>& b, Vector3R<R>& x) {
+        AVML_PROFILE("solve_spd(Matrix3x3R)");
+
+        return avml_impl::solve_spd<3>(a.data(), b.data(), x.data());
+    }
+
+    template<class R>
+    bool solve_spd(const Matrix4x4R<R>& a, const Vector4R<R>& b, Vector4R<R>& x) {
+        AVML_PROFILE("solve_spd(Matrix4x4R)");
+
+        return avml_impl::solve_spd<4>(a.data(), b.data(), x.data());
+    }
+
+    template<class R, unsigned N>
+    bool solve_spd(const Matrix<R, N, N>& a, const Matrix<R, N, 1>& b, Matrix<R, N, 1>& x) {
+        AVML_PROFILE("solve_spd(Matrix)");
+
+        return avml_impl::solve_spd<N>(a.data(), b.data(), x.data());
+    }
+
+    //=====================================================
+    // Batch linear systems
+    //=====================================================
+
+    inline void solve_batch(const mat2x2f* a, const vec2f* b, vec2f* x, std::size_t n) {
+        AVML_PROFILE_BATCH("solve(Matrix2x2R)[batch]", n);
+
+        avml_impl::solve_batch<false, 2>(a, b, x, n);
+    }
+
+    inline void solve_batch(const mat2x2f* a, const vec2f* b, vec2f* x, std::size_t n, Executor& executor) {
+        avml_impl::solve_batch<false, 2>(a, b, x, n, executor);
+    }
+
+    inline void solve_batch(const mat3x3f* a, const vec3f* b, vec3f* x, std::size_t n) {
+        AVML_PROFILE_BATCH("solve(Matrix3x3R)[batch]", n);
+
+        avml_impl::solve_batch<false, 3>(a, b, x, n);
+    }
+
+    inline void solve_batch(const mat3x3f* a, const vec3f* b, vec3f* x, std::size_t n, Executor& executor) {
+        avml_impl::solve_batch<false, 3>(a, b, x, n, executor);
+    }
+
+    inline void solve_batch(const mat4x4f* a, const vec4f* b, vec4f* x, std::size_t n) {
+        AVML_PROFILE_BATCH("solve(Matrix4x4R)[batch]", n);
+
+        avml_impl::solve_batch<false, 4>(a, b, x, n);
+    }
+
+    inline void solve_batch(const mat4x4f* a, const vec4f* b, vec4f* x, std::size_t n, Executor& executor) {
+        avml_impl::solve_batch<false, 4>(a, b, x, n, executor);
+    }
+
+    template<unsigned N>
+    void solve_batch(const Matrix<float, N, N>* a, const Matrix<float, N, 1>* b, Matrix<float, N, 1>* x, std::size_t n) {
+        AVML_PROFILE_BATCH("solve(Matrix)[batch]", n);
+
+        avml_impl::solve_batch<false, N>(a, b, x, n);
+    }
+
+    template<unsigned N>
+    void solve_batch(const Matrix<float, N, N>* a, const Matrix<float, N, 1>* b, Matrix<float, N, 1>* x, std::size_t n, Executor& executor) {
+        avml_impl::solve_batch<false, N>(a, b, x, n, executor);
+    }
+
+    inline void solve_spd_batch(const mat2x2f* a, const vec2f* b, vec2f* x, std::size_t n) {
+        AVML_PROFILE_BATCH("solve_spd(Matrix2x2R)[batch]", n);
+
+        avml_impl::solve_batch<true, 2>(a, b, x, n);
+    }
+
+    inline void solve_spd_batch(const mat2x2f* a, const vec2f* b, vec2f* x, std::size_t n, Executor& executor) {
+        avml_impl::solve_batch<true, 2>(a, b, x, n, executor);
+    }
+
+    inline void solve_spd_batch(const mat3x3f* a, const vec3f* b, vec3f* x, std::size_t n) {
+        AVML_PROFILE_BATCH("solve_spd(Matrix3x3R)[batch]", n);
+
+        avml_impl::solve_batch<true, 3>(a, b, x, n);
+    }
+
+    inline void solve_spd_batch(const mat3x3f* a, const vec3f* b, vec3f* x, std::size_t n, Executor& executor) {
+        avml_impl::solve_batch<true, 3>(a, b, x, n, executor);
+    }
+
+    inline void solve_spd_batch(const mat4x4f* a, const vec4f* b, vec4f* x, std::size_t n) {
+        AVML_PROFILE_BATCH("solve_spd(Matrix4x4R)[batch]", n);
+
+        avml_impl::solve_batch<true, 4>(a, b, x, n);
+    }
+
+    inline void solve_spd_batch(const mat4x4f* a, const vec4f* b, vec4f* x, std::size_t n, Executor& executor) {
+        avml_impl::solve_batch<true, 4>(a, b, x, n, executor);
+    }
+
+    template<unsigned N>
+    void solve_spd_batch(const Matrix<float, N, N>* a, const Matrix<float, N, 1>* b, Matrix<float, N, 1>* x, std::size_t n) {
+        AVML_PROFILE_BATCH("solve_spd(Matrix)[batch]", n);
+
+        avml_impl::solve_batch<true, N>(a, b, x, n);
+    }
+
+    template<unsigned N>
+    void solve_spd_batch(const Matrix<float, N, N>* a, const Matrix<float, N, 1>* b, Matrix<float, N, 1>* x, std::size_t n, Executor& executor) {
+        avml_impl::solve_batch<true, N>(a, b, x, n, executor);
+    }
+
+}
+
+#endif
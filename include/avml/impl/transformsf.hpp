@@ -1,3 +1,23 @@
+#include <cmath>
+
+namespace avml_impl {
+
+    ///
+    /// Computes the sine and cosine of x with a single call where the C
+    /// library provides one. sincosf is a GNU extension, which other C
+    /// libraries, e.g. Apple's, don't have whatever the compiler.
+    ///
+    AVML_FINL void sincos(float x, float& s, float& c) {
+        #if defined(__GLIBC__)
+        sincosf(x, &s, &c);
+        #else
+        s = std::sin(x);
+        c = std::cos(x);
+        #endif
+    }
+
+}
+
 namespace avml {
 
     AVML_FINL mat3x3f translation_matrix(float x, float y) {
@@ -25,8 +45,8 @@ namespace avml {
     }
 
     AVML_FINL mat3x3f rotation_matrix(float angle) {
-        float s = std::sin(angle);
-        float c = std::cos(angle);
+        float s, c;
+        avml_impl::sincos(angle, s, c);
 
         return mat3x3f{
             {c, -s, 0.0f},
@@ -64,8 +84,8 @@ namespace avml {
     }
 
     AVML_FINL mat4x4f x_rotation_matrix(float angle) {
-        float s = std::sin(angle);
-        float c = std::cos(angle);
+        float s, c;
+        avml_impl::sincos(angle, s, c);
 
         return mat4x4f{
             {1.0f, 0.0f, 0.0f, 0.0f},
@@ -76,8 +96,8 @@ namespace avml {
     }
 
     AVML_FINL mat4x4f y_rotation_matrix(float angle) {
-        float s = std::sin(angle);
-        float c = std::cos(angle);
+        float s, c;
+        avml_impl::sincos(angle, s, c);
 
         return mat4x4f{
             {c, 0.0f, s, 0.0f},
@@ -88,8 +108,8 @@ namespace avml {
     }
 
     AVML_FINL mat4x4f z_rotation_matrix(float angle) {
-        float s = std::sin(angle);
-        float c = std::cos(angle);
+        float s, c;
+        avml_impl::sincos(angle, s, c);
 
         return mat4x4f{
             {c, -s, 0.0f, 0.0f},
@@ -100,8 +120,8 @@ namespace avml {
     }
 
     AVML_FINL mat4x4f rotation_matrix(uvec3f axis, float angle) {
-        float s = std::sin(angle);
-        float c = std::cos(angle);
+        float s, c;
+        avml_impl::sincos(angle, s, c);
 
         float ic = 1.0f - c;
 
@@ -110,11 +130,108 @@ namespace avml {
         float z = axis[2];
 
         return mat4x4f{
-            {c + x * x * ic, x * y * ic - z * s, x * z + y * s, 0.0f},
+            {c + x * x * ic, x * y * ic - z * s, x * z * ic + y * s, 0.0f},
             {y * x * ic + z * s, c + y * y * ic, y * z * ic - x * s , 0.0f},
             {z * x * ic - y * s, z * y * ic + x * s, c + z * z * ic, 0.0f},
             {0.0f, 0.0f, 0.0f , 1.0f}
         };
     }
 
+
+
+    AVML_FINL mat4x4f trs_matrix(vec3f t, uvec4f r, vec3f s) {
+        float x = r[0];
+        float y = r[1];
+        float z = r[2];
+        float w = r[3];
+
+        float x2 = x + x;
+        float y2 = y + y;
+        float z2 = z + z;
+
+        float xx = x * x2;
+        float yy = y * y2;
+        float zz = z * z2;
+        float xy = x * y2;
+        float xz = x * z2;
+        float yz = y * z2;
+        float wx = w * x2;
+        float wy = w * y2;
+        float wz = w * z2;
+
+        return mat4x4f{
+            {(1.0f - yy - zz) * s[0], (xy - wz) * s[1], (xz + wy) * s[2], t[0]},
+            {(xy + wz) * s[0], (1.0f - xx - zz) * s[1], (yz - wx) * s[2], t[1]},
+            {(xz - wy) * s[0], (yz + wx) * s[1], (1.0f - xx - yy) * s[2], t[2]},
+            {0.0f, 0.0f, 0.0f, 1.0f}
+        };
+    }
+
+    AVML_FINL mat4x4f trs_matrix(vec3f t, uvec3f axis, float angle, vec3f s) {
+        float sn, c;
+        avml_impl::sincos(angle, sn, c);
+
+        float ic = 1.0f - c;
+
+        float x = axis[0];
+        float y = axis[1];
+        float z = axis[2];
+
+        return mat4x4f{
+            {(c + x * x * ic) * s[0], (x * y * ic - z * sn) * s[1], (x * z * ic + y * sn) * s[2], t[0]},
+            {(y * x * ic + z * sn) * s[0], (c + y * y * ic) * s[1], (y * z * ic - x * sn) * s[2], t[1]},
+            {(z * x * ic - y * sn) * s[0], (z * y * ic + x * sn) * s[1], (c + z * z * ic) * s[2], t[2]},
+            {0.0f, 0.0f, 0.0f, 1.0f}
+        };
+    }
+
+    AVML_FINL affine3x4f trs_affine(vec3f t, uvec4f r, vec3f s) {
+        return affine3x4f{trs_matrix(t, r, s)};
+    }
+
+    AVML_FINL affine3x4f trs_affine(vec3f t, uvec3f axis, float angle, vec3f s) {
+        return affine3x4f{trs_matrix(t, axis, angle, s)};
+    }
+
+    AVML_FINL mat4x4f look_at(vec3f eye, vec3f target, vec3f up) {
+        vec3f f = normalize(target - eye);
+        vec3f r = normalize(cross(f, up));
+        vec3f u = cross(r, f);
+
+        return mat4x4f{
+            {r[0], r[1], r[2], -dot(r, eye)},
+            {u[0], u[1], u[2], -dot(u, eye)},
+            {-f[0], -f[1], -f[2], dot(f, eye)},
+            {0.0f, 0.0f, 0.0f, 1.0f}
+        };
+    }
+
+    AVML_FINL mat4x4f perspective(float fov_y, float aspect, float z_near, float z_far) {
+        float sn, c;
+        avml_impl::sincos(0.5f * fov_y, sn, c);
+
+        float f = c / sn;
+        float inv_depth = 1.0f / (z_near - z_far);
+
+        return mat4x4f{
+            {f / aspect, 0.0f, 0.0f, 0.0f},
+            {0.0f, f, 0.0f, 0.0f},
+            {0.0f, 0.0f, (z_far + z_near) * inv_depth, 2.0f * z_far * z_near * inv_depth},
+            {0.0f, 0.0f, -1.0f, 0.0f}
+        };
+    }
+
+    AVML_FINL mat4x4f orthographic(float left, float right, float bottom, float top, float z_near, float z_far) {
+        float inv_width = 1.0f / (right - left);
+        float inv_height = 1.0f / (top - bottom);
+        float inv_depth = 1.0f / (z_far - z_near);
+
+        return mat4x4f{
+            {2.0f * inv_width, 0.0f, 0.0f, -(right + left) * inv_width},
+            {0.0f, 2.0f * inv_height, 0.0f, -(top + bottom) * inv_height},
+            {0.0f, 0.0f, -2.0f * inv_depth, -(z_far + z_near) * inv_depth},
+            {0.0f, 0.0f, 0.0f, 1.0f}
+        };
+    }
+
 }
@@ -100,7 +100,7 @@ namespace avml {
             avml_impl::store3f(elements, d);
 
             #else
-            float length = (x * x + y * y + z * z);
+            float length = std::sqrt(x * x + y * y + z * z);
             elements[0] = x / length;
             elements[1] = y / length;
             elements[2] = z / length;
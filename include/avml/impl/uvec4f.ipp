@@ -85,10 +85,10 @@ namespace avml {
             __m128 r_xyzw = _mm_movelh_ps(r_xy00, r_zw00);
 
             __m128 t0 = _mm_mul_ps(r_xyzw, r_xyzw);
-            __m128 t1 = _mm_movelh_ps(t0, t0);
+            __m128 t1 = _mm_movehl_ps(t0, t0);
             __m128 t2 = _mm_add_ps(t0, t1);
             __m128 t3 = _mm_permute_ps(t2, 0x55);
-            __m128 r_l000 = _mm_permute_ps(t3, 0x00);
+            __m128 r_l000 = _mm_add_ss(t2, t3);
             r_l000 = _mm_sqrt_ss(r_l000);
             __m128 r_llll = _mm_permute_ps(r_l000, 0x00);
 
@@ -107,10 +107,10 @@ namespace avml {
             __m128 r_xyzw = _mm_movelh_ps(r_xy00, r_zw00);
 
             __m128 t0 = _mm_mul_ps(r_xyzw, r_xyzw);
-            __m128 t1 = _mm_movelh_ps(t0, t0);
+            __m128 t1 = _mm_movehl_ps(t0, t0);
             __m128 t2 = _mm_add_ps(t0, t1);
             __m128 t3 = _mm_shuffle_ps(t2, t2, 0x55);
-            __m128 r_l000 = _mm_shuffle_ps(t3, t3, 0x00);
+            __m128 r_l000 = _mm_add_ss(t2, t3);
             r_l000 = _mm_sqrt_ss(r_l000);
             __m128 r_llll = _mm_shuffle_ps(r_l000, r_l000, 0x00);
 
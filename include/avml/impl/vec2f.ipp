@@ -374,7 +374,17 @@ namespace avml {
     //=====================================================
 
     AVML_FINL float dot(Vector2R<float> lhs, Vector2R<float> rhs) {
-        #if defined(AVML_SSE3)
+        AVML_PROFILE("dot(vec2f)");
+
+        #if defined(AVML_FMA)
+        __m128 a = avml_impl::load2f(lhs.data());
+        __m128 b = avml_impl::load2f(rhs.data());
+
+        __m128 t0 = _mm_mul_ss(a, b);
+        __m128 t1 = _mm_fmadd_ss(_mm_movehdup_ps(a), _mm_movehdup_ps(b), t0);
+        return _mm_cvtss_f32(t1);
+
+        #elif defined(AVML_SSE3)
         __m128 a = avml_impl::load2f(lhs.data());
         __m128 b = avml_impl::load2f(rhs.data());
 
@@ -408,12 +418,20 @@ namespace avml {
     AVML_FINL float length(Unit_vector2R<float>) = delete;
 
     AVML_FINL float length(Vector2R<float> v) {
+        #if defined(AVML_SSE)
         __m128 t0 = _mm_set_ss(length2(v));
         __m128 t1 = _mm_sqrt_ss(t0);
         return _mm_cvtss_f32(t1);
+
+        #else
+        return std::sqrt(length2(v));
+
+        #endif
     }
 
     AVML_FINL Unit_vector2R<float> normalize(Vector2R<float> v) {
+        AVML_PROFILE("normalize(vec2f)");
+
         v /= length(v);
         return Unit_vector2R<float>::read_aligned(v.data());
     }
@@ -514,7 +532,19 @@ namespace avml {
     }
 
     AVML_FINL Vector2R<float> reflect(Vector2R<float> v, Unit_vector2R<float> normal) {
+        #if defined(AVML_SSE2)
+        __m128 d = _mm_set1_ps(2.0f * dot(v, normal));
+        __m128 n = avml_impl::load2f(normal.data());
+        __m128 r = avml_impl::fmsub4f(d, n, avml_impl::load2f(v.data()));
+
+        Vector2R<float> ret;
+        avml_impl::store2f(ret.data(), r);
+        return ret;
+
+        #else
         return 2.0f * dot(v, normal) * normal - v;
+
+        #endif
     }
 
     AVML_FINL Unit_vector2R<float> reflect(Unit_vector2R<float> v, Unit_vector2R<float> normal) {
@@ -606,16 +636,7 @@ namespace avml {
 
     // Two component
     AVML_FINL Vector2R<float> xx(Vector2R<float> v) {
-        #if defined(AVML_SSE)
-        __m128 t = avml_impl::load2f(v.data());
-        t = _mm_unpacklo_ps(t, t);
-        avml_impl::store2f(v.data(), t);
-        return v;
-
-        #else
-        return {v[0], v[0]};
-
-        #endif
+        return swizzle<0, 0>(v);
     }
 
     AVML_FINL Vector2R<float> xy(Vector2R<float> v) {
@@ -623,41 +644,11 @@ namespace avml {
     }
 
     AVML_FINL Vector2R<float> yx(Vector2R<float> v) {
-        #if defined(AVML_AVX)
-        __m128 t0 = avml_impl::load2f(v.data());
-        __m128 t1 = _mm_permute_ps(t0, 0x01);
-        avml_impl::store2f(v.data(), t1);
-        return v;
-
-        #elif defined(AVML_SSE)
-        __m128 t0 = avml_impl::load2f(v.data());
-        __m128 t1 = _mm_shuffle_ps(t0, t0, 0x01);
-        avml_impl::store2f(v.data(), t1);
-        return v;
-
-        #else
-        return {v[1], v[0]};
-
-        #endif
+        return swizzle<1, 0>(v);
     }
 
     AVML_FINL Vector2R<float> yy(Vector2R<float> v) {
-        #if defined(AVML_SSE3)
-        __m128 t0 = avml_impl::load2f(v.data());
-        __m128 t1 = _mm_movehdup_ps(t0);
-        avml_impl::store2f(v.data(), t1);
-        return v;
-
-        #elif defined(AVML_SSE)
-        __m128 t0 = avml_impl::load2f(v.data());
-        __m128 t1 = _mm_shuffle_ps(t0, t0, 0x55);
-        avml_impl::store2f(v.data(), t1);
-        return v;
-
-        #else
-        return {v[1], v[0]};
-
-        #endif
+        return swizzle<1, 1>(v);
     }
 
 }
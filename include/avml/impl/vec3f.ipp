@@ -1,3 +1,5 @@
+#if defined(AVML_SSE)
+
 namespace avml_impl {
 
     struct vec3fw {
@@ -52,6 +54,8 @@ namespace avml {
 
 }
 
+#endif
+
 namespace avml {
 
     template<>
@@ -372,7 +376,7 @@ namespace avml {
     #else
         Vector3R<float> ret = lhs;
         ret *= rhs;
-        return lhs;
+        return ret;
     #endif
     }
 
@@ -405,7 +409,18 @@ namespace avml {
     //=====================================================
 
     AVML_FINL float dot(Vector3R<float> lhs, Vector3R<float> rhs) {
-        #if defined(AVML_AVX)
+        AVML_PROFILE("dot(vec3f)");
+
+        #if defined(AVML_FMA)
+        __m128 a = avml_impl::load3f(lhs.data());
+        __m128 b = avml_impl::load3f(rhs.data());
+
+        __m128 t0 = _mm_mul_ss(a, b);
+        __m128 t1 = _mm_fmadd_ss(_mm_permute_ps(a, 0x01), _mm_permute_ps(b, 0x01), t0);
+        __m128 t2 = _mm_fmadd_ss(_mm_movehl_ps(a, a), _mm_movehl_ps(b, b), t1);
+        return _mm_cvtss_f32(t2);
+
+        #elif defined(AVML_AVX)
         __m128 a = avml_impl::load3f(lhs.data());
         __m128 b = avml_impl::load3f(rhs.data());
 
@@ -445,9 +460,15 @@ namespace avml {
     AVML_FINL float length(Unit_vector3R<float>) = delete;
 
     AVML_FINL float length(Vector3R<float> v) {
+        #if defined(AVML_SSE)
         __m128 t0 = _mm_set_ss(length2(v));
         __m128 t1 = _mm_sqrt_ss(t0);
         return _mm_cvtss_f32(t1);
+
+        #else
+        return std::sqrt(length2(v));
+
+        #endif
     }
 
     AVML_FINL Unit_vector3R<float> assume_normalized(Vector3R<float> v) {
@@ -455,6 +476,8 @@ namespace avml {
     }
 
     AVML_FINL Unit_vector3R<float> normalize(Vector3R<float> v) {
+        AVML_PROFILE("normalize(vec3f)");
+
         v /= length(v);
         return assume_normalized(v);
     }
@@ -476,7 +499,19 @@ namespace avml {
     }
 
     AVML_FINL Vector3R<float> project_onto_plane(Vector3R<float> v, Unit_vector3R<float> normal) {
+        #if defined(AVML_SSE2)
+        __m128 d = _mm_set1_ps(dot(v, normal));
+        __m128 n = avml_impl::load3f(normal.data());
+        __m128 r = avml_impl::fnmadd4f(d, n, avml_impl::load3f(v.data()));
+
+        Vector3R<float> ret;
+        avml_impl::store3f(ret.data(), r);
+        return ret;
+
+        #else
         return (v - project(v, normal));
+
+        #endif
     }
 
     AVML_FINL Vector3R<float> rotate(Vector3R<float> v, float angle, Unit_vector3R<float> axis) {
@@ -521,7 +556,19 @@ namespace avml {
     }
 
     AVML_FINL Vector3R<float> reflect(Vector3R<float> v, Unit_vector3R<float> normal) {
+        #if defined(AVML_SSE2)
+        __m128 d = _mm_set1_ps(2.0f * dot(v, normal));
+        __m128 n = avml_impl::load3f(normal.data());
+        __m128 r = avml_impl::fmsub4f(d, n, avml_impl::load3f(v.data()));
+
+        Vector3R<float> ret;
+        avml_impl::store3f(ret.data(), r);
+        return ret;
+
+        #else
         return 2 * dot(v, normal) * normal - v;
+
+        #endif
     }
 
     AVML_FINL Unit_vector3R<float> reflect(Unit_vector3R<float> v, Unit_vector3R<float> normal) {
@@ -578,75 +625,61 @@ namespace avml {
     // Two components
 
     AVML_FINL Vector2R<float> xx(Vector3R<float> v) {
-        return {v[0], v[0]};
+        return swizzle<0, 0>(v);
     }
 
     AVML_FINL Vector2R<float> xy(Vector3R<float> v) {
-        return {v[0], v[1]};
+        return swizzle<0, 1>(v);
     }
 
     AVML_FINL Vector2R<float> xz(Vector3R<float> v) {
-        return {v[0], v[2]};
+        return swizzle<0, 2>(v);
     }
 
     AVML_FINL Vector2R<float> yx(Vector3R<float> v) {
-        return {v[1], v[0]};
+        return swizzle<1, 0>(v);
     }
 
     AVML_FINL Vector2R<float> yy(Vector3R<float> v) {
-        return {v[1], v[1]};
+        return swizzle<1, 1>(v);
     }
 
     AVML_FINL Vector2R<float> yz(Vector3R<float> v) {
-        return {v[1], v[2]};
+        return swizzle<1, 2>(v);
     }
 
     AVML_FINL Vector2R<float> zx(Vector3R<float> v) {
-        return {v[2], v[0]};
+        return swizzle<2, 0>(v);
     }
 
     AVML_FINL Vector2R<float> zy(Vector3R<float> v) {
-        return {v[2], v[1]};
+        return swizzle<2, 1>(v);
     }
 
     AVML_FINL Vector2R<float> zz(Vector3R<float> v) {
-        return {v[2], v[2]};
+        return swizzle<2, 2>(v);
     }
 
     // Three components
 
     AVML_FINL Vector3R<float> xxx(Vector3R<float> v) {
-        return {v[0], v[0], v[0]};
+        return swizzle<0, 0, 0>(v);
     }
 
     AVML_FINL Vector3R<float> xxy(Vector3R<float> v) {
-        #if defined(AVML_SSE)
-        __m128 t = avml_impl::load2f(v.data());
-        t = _mm_unpacklo_ps(t, t);
-        avml_impl::store2f(v.data(), t);
-        return v;
-        #else
-        return {v[0], v[0], v[1]};
-        #endif
+        return swizzle<0, 0, 1>(v);
     }
 
     AVML_FINL Vector3R<float> xxz(Vector3R<float> v) {
-        return {v[0], v[0], v[2]};
+        return swizzle<0, 0, 2>(v);
     }
 
     AVML_FINL Vector3R<float> xyx(Vector3R<float> v) {
-        #if defined(AVML_SSE)
-        __m128 t = avml_impl::load2f(v.data());
-        t = _mm_movelh_ps(t, t);
-        avml_impl::store2f(v.data(), t);
-        return v;
-        #else
-        return {v[0], v[1], v[0]};
-        #endif
+        return swizzle<0, 1, 0>(v);
     }
 
     AVML_FINL Vector3R<float> xyy(Vector3R<float> v) {
-        return {v[0], v[1], v[1]};
+        return swizzle<0, 1, 1>(v);
     }
 
     AVML_FINL Vector3R<float> xyz(Vector3R<float> v) {
@@ -654,87 +687,87 @@ namespace avml {
     }
 
     AVML_FINL Vector3R<float> xzx(Vector3R<float> v) {
-        return {v[0], v[2], v[0]};
+        return swizzle<0, 2, 0>(v);
     }
 
     AVML_FINL Vector3R<float> xzy(Vector3R<float> v) {
-        return {v[0], v[2], v[1]};
+        return swizzle<0, 2, 1>(v);
     }
 
     AVML_FINL Vector3R<float> xzz(Vector3R<float> v) {
-        return {v[0], v[2], v[2]};
+        return swizzle<0, 2, 2>(v);
     }
 
     AVML_FINL Vector3R<float> yxx(Vector3R<float> v) {
-        return {v[1], v[0], v[0]};
+        return swizzle<1, 0, 0>(v);
     }
 
     AVML_FINL Vector3R<float> yxy(Vector3R<float> v) {
-        return {v[1], v[0], v[1]};
+        return swizzle<1, 0, 1>(v);
     }
 
     AVML_FINL Vector3R<float> yxz(Vector3R<float> v) {
-        return {v[1], v[0], v[2]};
+        return swizzle<1, 0, 2>(v);
     }
 
     AVML_FINL Vector3R<float> yyx(Vector3R<float> v) {
-        return {v[1], v[1], v[0]};
+        return swizzle<1, 1, 0>(v);
     }
 
     AVML_FINL Vector3R<float> yyy(Vector3R<float> v) {
-        return {v[1], v[1], v[1]};
+        return swizzle<1, 1, 1>(v);
     }
 
     AVML_FINL Vector3R<float> yyz(Vector3R<float> v) {
-        return {v[1], v[1], v[2]};
+        return swizzle<1, 1, 2>(v);
     }
 
     AVML_FINL Vector3R<float> yzx(Vector3R<float> v) {
-        return {v[1], v[2], v[0]};
+        return swizzle<1, 2, 0>(v);
     }
 
     AVML_FINL Vector3R<float> yzy(Vector3R<float> v) {
-        return {v[1], v[2], v[1]};
+        return swizzle<1, 2, 1>(v);
     }
 
     AVML_FINL Vector3R<float> yzz(Vector3R<float> v) {
-        return {v[1], v[2], v[2]};
+        return swizzle<1, 2, 2>(v);
     }
 
     AVML_FINL Vector3R<float> zxx(Vector3R<float> v) {
-        return {v[2], v[0], v[0]};
+        return swizzle<2, 0, 0>(v);
     }
 
     AVML_FINL Vector3R<float> zxy(Vector3R<float> v) {
-        return {v[2], v[0], v[1]};
+        return swizzle<2, 0, 1>(v);
     }
 
     AVML_FINL Vector3R<float> zxz(Vector3R<float> v) {
-        return {v[2], v[0], v[2]};
+        return swizzle<2, 0, 2>(v);
     }
 
     AVML_FINL Vector3R<float> zyx(Vector3R<float> v) {
-        return {v[2], v[1], v[0]};
+        return swizzle<2, 1, 0>(v);
     }
 
     AVML_FINL Vector3R<float> zyy(Vector3R<float> v) {
-        return {v[2], v[1], v[1]};
+        return swizzle<2, 1, 1>(v);
     }
 
     AVML_FINL Vector3R<float> zyz(Vector3R<float> v) {
-        return {v[2], v[1], v[2]};
+        return swizzle<2, 1, 2>(v);
     }
 
     AVML_FINL Vector3R<float> zzx(Vector3R<float> v) {
-        return {v[2], v[2], v[0]};
+        return swizzle<2, 2, 0>(v);
     }
 
     AVML_FINL Vector3R<float> zzy(Vector3R<float> v) {
-        return {v[2], v[2], v[1]};
+        return swizzle<2, 2, 1>(v);
     }
 
     AVML_FINL Vector3R<float> zzz(Vector3R<float> v) {
-        return {v[2], v[2], v[2]};
+        return swizzle<2, 2, 2>(v);
     }
 
 }
@@ -10,10 +10,36 @@
 //#include "vector/vec3i_tests.hpp"
 //#include "vector/vec4i_tests.hpp"
 
+#include "vector/uvec3f_encoding_tests.hpp"
+#include "vector/Swizzle_tests.hpp"
+
+#include "Capabilities_tests.hpp"
+#include "Parallel_tests.hpp"
+#include "Streaming_tests.hpp"
+#include "Memory_tests.hpp"
+#include "Instrumentation_tests.hpp"
+#include "Math_tests.hpp"
+#include "Differential_tests.hpp"
+
 //#include "matrix/Mat2x2f_tests.hpp"
 //#include "matrix/Mat3x3f_tests.hpp"
 //#include "matrix/Mat4x4f_tests.hpp"
 
+#include "matrix/Mat4x4f_batch_tests.hpp"
+#include "matrix/Affine3x4f_tests.hpp"
+#include "matrix/Mat3x3f_decomposition_tests.hpp"
+#include "matrix/Linear_system_tests.hpp"
+
+#include "Transforms_tests.hpp"
+#include "Dense_tests.hpp"
+#include "Spatial_tests.hpp"
+#include "Noise_tests.hpp"
+#include "Curves_tests.hpp"
+#include "Skinning_tests.hpp"
+#include "Overlap_tests.hpp"
+#include "Convex_tests.hpp"
+#include "Planes_tests.hpp"
+
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
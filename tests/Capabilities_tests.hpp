@@ -0,0 +1,109 @@
+#ifndef AVML_CAPABILITIES_TESTS_HPP
+#define AVML_CAPABILITIES_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+namespace avml_tests {
+
+    using namespace avml;
+
+    TEST(Capabilities, Compiled) {
+        constexpr Capabilities compiled = compiled_capabilities();
+        static_assert(compiled.covers(compiled), "");
+
+        #if defined(AVML_AVX2)
+        static_assert(compiled.has(Isa_feature::avx2) && compiled.has(Isa_feature::avx), "");
+        static_assert(compiled.has(Isa_feature::sse2), "");
+        #endif
+
+        #if defined(AVML_FMA)
+        static_assert(compiled.has(Isa_feature::fma), "");
+        #endif
+
+        #if defined(AVML_SCALAR)
+        static_assert(compiled.features == 0, "");
+        #endif
+
+        #if defined(AVML_SSE2) || defined(AVML_NEON)
+        EXPECT_NE(compiled_tier(), Isa_tier::scalar);
+        #else
+        EXPECT_EQ(compiled_tier(), Isa_tier::scalar);
+        EXPECT_EQ(compiled.features, 0u);
+        #endif
+
+        Capabilities c{feature_bit(Isa_feature::sse2) | feature_bit(Isa_feature::avx2)};
+        EXPECT_EQ(to_string(c), "SSE2 AVX2");
+        EXPECT_EQ(c.missing(Capabilities{feature_bit(Isa_feature::fma) | feature_bit(Isa_feature::sse2)}).features, feature_bit(Isa_feature::fma));
+    }
+
+    TEST(Capabilities, Cpu) {
+        // The tests are running, so the CPU supports what they were built for
+        Capabilities cpu = cpu_capabilities();
+        EXPECT_TRUE(cpu.covers(compiled_capabilities())) << to_string(cpu.missing(compiled_capabilities()));
+        require_cpu_support();
+
+        std::ostringstream stream;
+        capabilities_report(stream);
+        EXPECT_NE(stream.str().find(to_string(compiled_tier())), std::string::npos);
+
+        std::vector<Code_path> paths = code_paths();
+        ASSERT_FALSE(paths.empty());
+        for (const Code_path& p : paths) {
+            EXPECT_EQ(p.simd, std::string{p.isa} != "scalar") << p.name;
+        }
+    }
+
+    inline std::string code_path_isa(const std::string& name) {
+        for (const Code_path& p : code_paths()) {
+            if (name == p.name) {
+                return p.isa;
+            }
+        }
+        return "missing";
+    }
+
+    TEST(Capabilities, Code_paths) {
+        // Pins rows whose kernels skip some tiers, so a change to either the
+        // kernels' guards or to code_paths() has to update this too
+        #if defined(AVML_AVX512F)
+        EXPECT_EQ(code_path_isa("batch transforms"), "AVX-512F");
+        EXPECT_EQ(code_path_isa("float streaming transforms"), "AVX-512F");
+        #elif defined(AVML_AVX)
+        EXPECT_EQ(code_path_isa("batch transforms"), "AVX");
+        EXPECT_EQ(code_path_isa("float streaming transforms"), "AVX");
+        #else
+        EXPECT_EQ(code_path_isa("batch transforms"), "scalar");
+        EXPECT_EQ(code_path_isa("float streaming transforms"), "scalar");
+        #endif
+
+        #if defined(AVML_AVX512F)
+        EXPECT_EQ(code_path_isa("batch matrix products"), "AVX-512F");
+        #elif defined(AVML_AVX)
+        EXPECT_EQ(code_path_isa("batch matrix products"), "AVX");
+        #elif defined(AVML_SSE2)
+        EXPECT_EQ(code_path_isa("batch matrix products"), "SSE2");
+        #else
+        EXPECT_EQ(code_path_isa("batch matrix products"), "scalar");
+        #endif
+
+        #if defined(AVML_SSE2)
+        EXPECT_EQ(code_path_isa("double streaming transforms"), "SSE2");
+        #else
+        EXPECT_EQ(code_path_isa("double streaming transforms"), "scalar");
+        #endif
+
+        #if defined(AVML_AVX2)
+        EXPECT_EQ(code_path_isa("float streaming quantization"), "AVX2");
+        #else
+        EXPECT_EQ(code_path_isa("float streaming quantization"), "scalar");
+        #endif
+
+        EXPECT_EQ(code_path_isa("streaming copies"), "missing");
+    }
+
+}
+
+#endif
@@ -0,0 +1,257 @@
+#ifndef AVML_CONVEX_TESTS_HPP
+#define AVML_CONVEX_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "Test_helpers.hpp"
+
+namespace avml_tests {
+
+    using namespace avml;
+
+    ///
+    /// \return Vertices of b, for checking vertex arrays against the boxes'
+    /// own supports
+    inline std::vector<vec3f> obb_vertices(const obbf& b) {
+        std::vector<vec3f> ret;
+        for (unsigned i = 0; i < 8; ++i) {
+            vec3f p = b.center();
+            for (unsigned k = 0; k < 3; ++k) {
+                p += b.axes()[k] * ((i >> k) & 1 ? b.extents()[k] : -b.extents()[k]);
+            }
+            ret.push_back(p);
+        }
+        return ret;
+    }
+
+    ///
+    /// \return Distance between two boxes, negative by the smallest overlap
+    /// of their intervals if they intersect
+    inline float box_distance(const aabb3f& a, const aabb3f& b) {
+        float outside = 0.0f;
+        float inside = std::numeric_limits<float>::infinity();
+        for (unsigned d = 0; d < 3; ++d) {
+            float gap = std::max(b.minimum()[d] - a.maximum()[d], a.minimum()[d] - b.maximum()[d]);
+            outside += (gap > 0.0f) ? gap * gap : 0.0f;
+            inside = std::min(inside, -gap);
+        }
+        return (outside > 0.0f) ? std::sqrt(outside) : -inside;
+    }
+
+    TEST(Convex, Support_index) {
+        std::mt19937 gen{11};
+        std::uniform_real_distribution<float> dist{-5.0f, 5.0f};
+
+        for (std::size_t n : {0, 1, 7, 8, 15, 16, 17, 33, 1000}) {
+            std::vector<vec3f> v(n);
+            for (auto& p : v) {
+                p = vec3f{dist(gen), dist(gen), dist(gen)};
+            }
+
+            for (unsigned k = 0; k < 20; ++k) {
+                vec3f d{dist(gen), dist(gen), dist(gen)};
+
+                std::size_t expected = 0;
+                for (std::size_t i = 1; i < n; ++i) {
+                    if (dot(v[expected], d) < dot(v[i], d)) {
+                        expected = i;
+                    }
+                }
+
+                std::size_t i = support_index(v.data(), n, d);
+                if (n == 0) {
+                    EXPECT_EQ(i, 0u);
+                } else {
+                    EXPECT_NEAR(dot(v[i], d), dot(v[expected], d), 1e-4f) << n << ' ' << k;
+                }
+            }
+        }
+
+        // Repeated vertices in different lanes and in the tail
+        std::vector<vec3f> ties(40, vec3f{0.0f});
+        ties[21] = vec3f{1.0f, 2.0f, 3.0f};
+        ties[37] = vec3f{1.0f, 2.0f, 3.0f};
+        EXPECT_EQ(support_index(ties.data(), ties.size(), vec3f{0.0f, 0.0f, 1.0f}), 21u);
+    }
+
+    TEST(Convex, Supports) {
+        spheref s{vec3f{1.0f, 2.0f, 3.0f}, 2.0f};
+        EXPECT_EQ(support(s, vec3f{0.0f, 0.0f, 5.0f}), (vec3f{1.0f, 2.0f, 5.0f}));
+        EXPECT_EQ(support(s, vec3f{0.0f}), s.center());
+
+        capsulef c{vec3f{0.0f}, vec3f{0.0f, 4.0f, 0.0f}, 1.0f};
+        expect_near(support(c, vec3f{1.0f, 1.0f, 0.0f} * 3.0f), vec3f{std::sqrt(0.5f), 4.0f + std::sqrt(0.5f), 0.0f}, 1e-6f, 0);
+        EXPECT_EQ(support(c, vec3f{0.0f, -2.0f, 0.0f}), (vec3f{0.0f, -1.0f, 0.0f}));
+
+        aabb3f b{vec3f{-1.0f, -2.0f, -3.0f}, vec3f{1.0f, 2.0f, 3.0f}};
+        EXPECT_EQ(support(b, vec3f{1.0f, -1.0f, 0.5f}), (vec3f{1.0f, -2.0f, 3.0f}));
+        EXPECT_EQ(support(obbf::from_aabb(b), vec3f{1.0f, -1.0f, 0.5f}), (vec3f{1.0f, -2.0f, 3.0f}));
+    }
+
+    TEST(Convex, Gjk) {
+        std::mt19937 gen{13};
+        std::uniform_real_distribution<float> dist{-4.0f, 4.0f};
+        std::uniform_real_distribution<float> size{0.2f, 2.0f};
+
+        auto point = [&]() { return vec3f{dist(gen), dist(gen), dist(gen)}; };
+
+        for (unsigned i = 0; i < 200; ++i) {
+            // Spheres, which converge slowest
+            spheref a{point(), size(gen)};
+            spheref b{point(), size(gen)};
+            float expected = length(b.center() - a.center()) - a.radius() - b.radius();
+
+            Gjk_result<float> r = gjk_distance(a, b);
+            EXPECT_EQ(r.intersecting, expected <= 0.0f) << i;
+            EXPECT_EQ(gjk_intersect(a, b), r.intersecting) << i;
+            EXPECT_NEAR(r.distance, std::max(expected, 0.0f), 1e-3f) << i;
+            if (!r.intersecting) {
+                EXPECT_NEAR(length(r.on_b - r.on_a), r.distance, 1e-4f) << i;
+                EXPECT_NEAR(length(r.on_a - a.center()), a.radius(), 1e-3f) << i;
+                EXPECT_NEAR(length(r.on_b - b.center()), b.radius(), 1e-3f) << i;
+            }
+            EXPECT_LE(r.iterations, 64u);
+
+            // Boxes
+            vec3f c0 = point();
+            vec3f c1 = point();
+            vec3f e0{size(gen), size(gen), size(gen)};
+            vec3f e1{size(gen), size(gen), size(gen)};
+            aabb3f x{c0 - e0, c0 + e0};
+            aabb3f y{c1 - e1, c1 + e1};
+            float boxes = box_distance(x, y);
+
+            r = gjk_distance(x, y);
+            EXPECT_EQ(r.intersecting, boxes <= 0.0f) << i;
+            EXPECT_NEAR(r.distance, std::max(boxes, 0.0f), 1e-5f) << i;
+
+            // Capsules, against the segments' closest points
+            capsulef p{point(), point(), size(gen) * 0.5f};
+            capsulef q{point(), point(), size(gen) * 0.5f};
+            vec3f on_p, on_q;
+            float segments = std::sqrt(closest_points(p, q, on_p, on_q)) - p.radius() - q.radius();
+
+            r = gjk_distance(p, q);
+            EXPECT_EQ(r.intersecting, segments <= 0.0f) << i;
+            EXPECT_NEAR(r.distance, std::max(segments, 0.0f), 1e-3f) << i;
+            EXPECT_EQ(gjk_intersect(p, q), overlaps(p, q)) << i;
+        }
+
+        // Vertex arrays match the boxes they're the corners of
+        for (unsigned i = 0; i < 100; ++i) {
+            obbf a{point(), random_axes(gen), vec3f{size(gen), size(gen), size(gen)}};
+            obbf b{point(), random_axes(gen), vec3f{size(gen), size(gen), size(gen)}};
+            std::vector<vec3f> va = obb_vertices(a);
+            std::vector<vec3f> vb = obb_vertices(b);
+
+            Gjk_result<float> boxes = gjk_distance(a, b);
+            Gjk_result<float> hulls = gjk_distance(Convex_vertices<float>{va.data(), va.size()}, Convex_vertices<float>{vb.data(), vb.size()});
+            EXPECT_EQ(hulls.intersecting, boxes.intersecting) << i;
+            EXPECT_NEAR(hulls.distance, boxes.distance, 1e-4f) << i;
+            EXPECT_EQ(boxes.intersecting, overlaps(a, b)) << i;
+        }
+
+        sphered a{vec3d{0.0, 0.0, 0.0}, 1.0};
+        sphered b{vec3d{3.0, 4.0, 0.0}, 2.0};
+        EXPECT_NEAR(gjk_distance(a, b).distance, 2.0, 1e-6);
+    }
+
+    TEST(Convex, Epa) {
+        // Overlapping boxes are pushed apart along the axis of least overlap
+        aabb3f a{vec3f{-1.0f}, vec3f{1.0f}};
+        aabb3f b{vec3f{0.5f, -0.25f, 0.75f}, vec3f{2.0f, 0.5f, 3.0f}};
+        Penetration<float> p = epa_penetration(a, b);
+        EXPECT_TRUE(p.intersecting);
+        EXPECT_NEAR(p.depth, 0.25f, 1e-5f);
+        EXPECT_NEAR(p.normal[2], 1.0f, 1e-5f);
+        EXPECT_NEAR(p.on_a[2] - p.on_b[2], 0.25f, 1e-5f);
+
+        // Separate shapes report their negative distance
+        p = epa_penetration(a, aabb3f{vec3f{3.0f, -1.0f, -1.0f}, vec3f{4.0f, 1.0f, 1.0f}});
+        EXPECT_FALSE(p.intersecting);
+        EXPECT_NEAR(p.depth, -2.0f, 1e-5f);
+        EXPECT_NEAR(p.normal[0], 1.0f, 1e-5f);
+
+        // Concentric shapes, where GJK ends with the origin on its simplex
+        p = epa_penetration(a, aabb3f{vec3f{-0.5f}, vec3f{0.5f}});
+        EXPECT_TRUE(p.intersecting);
+        EXPECT_NEAR(p.depth, 1.5f, 1e-5f);
+
+        std::mt19937 gen{17};
+        std::uniform_real_distribution<float> dist{-1.5f, 1.5f};
+        std::uniform_real_distribution<float> size{0.5f, 2.0f};
+
+        for (unsigned i = 0; i < 200; ++i) {
+            spheref s{vec3f{dist(gen), dist(gen), dist(gen)}, size(gen)};
+            spheref t{vec3f{dist(gen), dist(gen), dist(gen)}, size(gen)};
+            vec3f d = t.center() - s.center();
+            float expected = s.radius() + t.radius() - length(d);
+            if (expected < 0.05f) {
+                continue;
+            }
+
+            p = epa_penetration(s, t);
+            ASSERT_TRUE(p.intersecting) << i;
+            EXPECT_NEAR(p.depth, expected, 2e-2f * expected) << i;
+            EXPECT_NEAR(length(p.normal), 1.0f, 1e-5f) << i;
+
+            // The spheres' projections onto the normal overlap by about the
+            // depth. The normal itself is poorly conditioned for nearly
+            // concentric spheres, so it is not compared with d.
+            float projected = s.radius() + t.radius() - dot(d, p.normal);
+            EXPECT_GE(projected, expected - 1e-4f) << i;
+            EXPECT_NEAR(projected, expected, 4e-2f * expected) << i;
+            EXPECT_NEAR(length(p.on_a - p.on_b), p.depth, 1e-2f) << i;
+
+            vec3f c0{dist(gen), dist(gen), dist(gen)};
+            vec3f c1{dist(gen), dist(gen), dist(gen)};
+            vec3f e0{size(gen), size(gen), size(gen)};
+            vec3f e1{size(gen), size(gen), size(gen)};
+            aabb3f x{c0 - e0, c0 + e0};
+            aabb3f y{c1 - e1, c1 + e1};
+
+            p = epa_penetration(x, y);
+            EXPECT_EQ(p.intersecting, box_distance(x, y) <= 0.0f) << i;
+            EXPECT_NEAR(p.depth, -box_distance(x, y), 1e-4f) << i;
+        }
+    }
+
+    TEST(Convex, Batch) {
+        const std::size_t n = 300;
+
+        std::mt19937 gen{19};
+        std::uniform_real_distribution<float> dist{-3.0f, 3.0f};
+        std::uniform_real_distribution<float> size{0.2f, 1.5f};
+
+        std::vector<obbf> a;
+        std::vector<capsulef> b;
+        for (std::size_t i = 0; i < n; ++i) {
+            a.push_back(obbf{vec3f{dist(gen), dist(gen), dist(gen)}, random_axes(gen), vec3f{size(gen), size(gen), size(gen)}});
+            b.push_back(capsulef{vec3f{dist(gen), dist(gen), dist(gen)}, vec3f{dist(gen), dist(gen), dist(gen)}, size(gen)});
+        }
+
+        std::vector<Gjk_result<float>> distances(n);
+        std::vector<Penetration<float>> penetrations(n);
+        Thread_pool pool{2};
+        gjk_distance(a.data(), b.data(), distances.data(), n, pool);
+        epa_penetration(a.data(), b.data(), penetrations.data(), n);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            Gjk_result<float> r = gjk_distance(a[i], b[i]);
+            EXPECT_EQ(distances[i].intersecting, r.intersecting) << i;
+            EXPECT_EQ(distances[i].distance, r.distance) << i;
+            EXPECT_EQ(penetrations[i].intersecting, r.intersecting) << i;
+            if (!r.intersecting) {
+                EXPECT_EQ(penetrations[i].depth, -r.distance) << i;
+            } else {
+                EXPECT_GE(penetrations[i].depth, 0.0f) << i;
+            }
+        }
+    }
+
+}
+
+#endif
@@ -0,0 +1,117 @@
+#ifndef AVML_CURVES_TESTS_HPP
+#define AVML_CURVES_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+namespace avml_tests {
+
+    using namespace avml;
+
+    inline void expect_near(vec3f a, vec3f b, float e) {
+        EXPECT_NEAR(a[0], b[0], e);
+        EXPECT_NEAR(a[1], b[1], e);
+        EXPECT_NEAR(a[2], b[2], e);
+    }
+
+    inline void expect_near(vec2f a, vec2f b, float e) {
+        EXPECT_NEAR(a[0], b[0], e);
+        EXPECT_NEAR(a[1], b[1], e);
+    }
+
+    TEST(Curves, Cubics) {
+        vec3f p0{0.0f, 0.0f, 0.0f};
+        vec3f p1{1.0f, 2.0f, 0.0f};
+        vec3f p2{3.0f, 2.0f, 1.0f};
+        vec3f p3{4.0f, 0.0f, -1.0f};
+
+        expect_near(bezier(p0, p1, p2, p3, 0.0f), p0, 1e-6f);
+        expect_near(bezier(p0, p1, p2, p3, 1.0f), p3, 1e-6f);
+
+        // de Casteljau at t = 0.5
+        vec3f a = (p0 + p1) * 0.5f;
+        vec3f b = (p1 + p2) * 0.5f;
+        vec3f c = (p2 + p3) * 0.5f;
+        vec3f mid = ((a + b) * 0.5f + (b + c) * 0.5f) * 0.5f;
+        expect_near(bezier(p0, p1, p2, p3, 0.5f), mid, 1e-6f);
+
+        // A Bezier curve is a Hermite curve with tangents 3 (p1 - p0) and 3 (p3 - p2)
+        for (float t : {0.1f, 0.4f, 0.8f}) {
+            expect_near(hermite(p0, (p1 - p0) * 3.0f, p3, (p3 - p2) * 3.0f, t), bezier(p0, p1, p2, p3, t), 1e-5f);
+        }
+
+        // Catmull-Rom passes through its inner points and reproduces lines
+        expect_near(catmull_rom(p0, p1, p2, p3, 0.0f), p1, 1e-6f);
+        expect_near(catmull_rom(p0, p1, p2, p3, 1.0f), p2, 1e-6f);
+        vec2f line = catmull_rom(vec2f{0.0f, 0.0f}, vec2f{1.0f, 2.0f}, vec2f{2.0f, 4.0f}, vec2f{3.0f, 6.0f}, 0.3f);
+        expect_near(line, vec2f{1.3f, 2.6f}, 1e-6f);
+
+        for (Cubic_basis basis : {Cubic_basis::bezier, Cubic_basis::catmull_rom}) {
+            float w[4];
+            cubic_weights(basis, 0.37f, w);
+            EXPECT_NEAR(w[0] + w[1] + w[2] + w[3], 1.0f, 1e-6f);
+        }
+    }
+
+    TEST(Curves, Batch) {
+        const std::size_t n = 53;
+        std::mt19937 gen{8};
+        std::uniform_real_distribution<float> dist{-10.0f, 10.0f};
+
+        std::vector<float> t(n);
+        std::vector<vec2f> control2(4 * n);
+        std::vector<vec3f> control3(4 * n);
+        for (std::size_t i = 0; i < n; ++i) {
+            t[i] = (dist(gen) + 10.0f) / 20.0f;
+        }
+        for (std::size_t i = 0; i < 4 * n; ++i) {
+            control2[i] = vec2f{dist(gen), dist(gen)};
+            control3[i] = vec3f{dist(gen), dist(gen), dist(gen)};
+        }
+
+        const vec2f curve2[4] = {control2[0], control2[1], control2[2], control2[3]};
+        const vec3f curve3[4] = {control3[0], control3[1], control3[2], control3[3]};
+
+        Thread_pool pool{2};
+        std::vector<vec2f> out2(n), parallel2(n);
+        std::vector<vec3f> out3(n), parallel3(n);
+
+        for (Cubic_basis basis : {Cubic_basis::bezier, Cubic_basis::hermite, Cubic_basis::catmull_rom}) {
+            sample_curve(basis, curve2, t.data(), out2.data(), n);
+            sample_curve(basis, curve3, t.data(), out3.data(), n);
+            for (std::size_t i = 0; i < n; ++i) {
+                float w[4];
+                cubic_weights(basis, t[i], w);
+                vec2f e2 = curve2[0] * w[0] + curve2[1] * w[1] + curve2[2] * w[2] + curve2[3] * w[3];
+                vec3f e3 = curve3[0] * w[0] + curve3[1] * w[1] + curve3[2] * w[2] + curve3[3] * w[3];
+                expect_near(out2[i], e2, 1e-4f);
+                expect_near(out3[i], e3, 1e-4f);
+            }
+
+            sample_curve(basis, curve3, t.data(), parallel3.data(), n, pool);
+            EXPECT_EQ(parallel3, out3);
+
+            sample_curves(basis, control2.data(), 0.3f, out2.data(), n);
+            sample_curves(basis, control3.data(), 0.3f, out3.data(), n);
+            for (std::size_t i = 0; i < n; ++i) {
+                const vec3f* c = control3.data() + 4 * i;
+                float w[4];
+                cubic_weights(basis, 0.3f, w);
+                expect_near(out3[i], c[0] * w[0] + c[1] * w[1] + c[2] * w[2] + c[3] * w[3], 1e-4f);
+            }
+            expect_near(out2[5], (basis == Cubic_basis::bezier) ?
+                bezier(control2[20], control2[21], control2[22], control2[23], 0.3f) :
+                (basis == Cubic_basis::hermite) ?
+                hermite(control2[20], control2[21], control2[22], control2[23], 0.3f) :
+                catmull_rom(control2[20], control2[21], control2[22], control2[23], 0.3f), 1e-6f);
+
+            sample_curves(basis, control2.data(), 0.3f, parallel2.data(), n, pool);
+            EXPECT_EQ(parallel2, out2);
+        }
+    }
+
+}
+
+#endif
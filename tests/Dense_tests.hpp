@@ -0,0 +1,121 @@
+#ifndef AVML_DENSE_TESTS_HPP
+#define AVML_DENSE_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+
+#include <avml/Dense.hpp>
+
+namespace avml_tests {
+
+    using namespace avml;
+
+    template<class R>
+    Dynamic_matrix<R> random_dynamic_matrix(std::size_t h, std::size_t w, unsigned seed) {
+        std::mt19937 gen{seed};
+        std::uniform_real_distribution<R> dist{R(-1), R(1)};
+
+        Dynamic_matrix<R> ret{h, w};
+        for (std::size_t i = 0; i < h * w; ++i) {
+            ret.data()[i] = dist(gen);
+        }
+        return ret;
+    }
+
+    ///
+    /// \return alpha * a * b + beta * c accumulated in double precision
+    template<class R>
+    Dynamic_matrix<R> reference_gemm(R alpha, const Dynamic_matrix<R>& a, const Dynamic_matrix<R>& b, R beta, const Dynamic_matrix<R>& c) {
+        Dynamic_matrix<R> ret{a.height(), b.width()};
+        for (std::size_t i = 0; i < a.height(); ++i) {
+            for (std::size_t j = 0; j < b.width(); ++j) {
+                double sum = 0.0;
+                for (std::size_t p = 0; p < a.width(); ++p) {
+                    sum += double(a(i, p)) * double(b(p, j));
+                }
+                ret(i, j) = R(alpha * sum + beta * double(c(i, j)));
+            }
+        }
+        return ret;
+    }
+
+    template<class R>
+    void expect_near(const Dynamic_matrix<R>& a, const Dynamic_matrix<R>& b, double tolerance) {
+        ASSERT_EQ(a.height(), b.height());
+        ASSERT_EQ(a.width(), b.width());
+        for (std::size_t i = 0; i < a.height(); ++i) {
+            for (std::size_t j = 0; j < a.width(); ++j) {
+                ASSERT_NEAR(a(i, j), b(i, j), tolerance) << "element " << i << ", " << j;
+            }
+        }
+    }
+
+    TEST(Dense, Gemm_sizes) {
+        const std::size_t sizes[][3] = {
+            {1, 1, 1}, {3, 5, 7}, {16, 16, 16}, {37, 53, 29}, {130, 70, 300}, {97, 260, 64}
+        };
+
+        for (const auto& s : sizes) {
+            auto a = random_dynamic_matrix<float>(s[0], s[2], 1);
+            auto b = random_dynamic_matrix<float>(s[2], s[1], 2);
+            auto c = random_dynamic_matrix<float>(s[0], s[1], 3);
+
+            auto expected = reference_gemm(0.5f, a, b, -2.0f, c);
+            ASSERT_TRUE(gemm(0.5f, a, b, -2.0f, c));
+            expect_near(c, expected, 1.0e-4 * std::sqrt(double(s[2])));
+        }
+    }
+
+    TEST(Dense, Gemm_executor) {
+        auto a = random_dynamic_matrix<float>(300, 200, 4);
+        auto b = random_dynamic_matrix<float>(200, 333, 5);
+        dynamic_matf c{300, 333};
+
+        Thread_pool pool{3};
+        ASSERT_TRUE(gemm(1.0f, a, b, 0.0f, c, pool));
+        expect_near(c, reference_gemm(1.0f, a, b, 0.0f, c), 1.0e-3);
+        expect_near(c, a * b, 0.0);
+    }
+
+    TEST(Dense, Gemm_double) {
+        auto a = random_dynamic_matrix<double>(45, 67, 6);
+        auto b = random_dynamic_matrix<double>(67, 23, 7);
+
+        expect_near(a * b, reference_gemm(1.0, a, b, 0.0, dynamic_matd{45, 23}), 1.0e-12);
+    }
+
+    TEST(Dense, Gemm_mismatch) {
+        dynamic_matf a{3, 4};
+        dynamic_matf b{5, 2};
+        dynamic_matf c{3, 2, 7.0f};
+
+        EXPECT_FALSE(gemm(1.0f, a, b, 0.0f, c));
+        EXPECT_EQ(c, (dynamic_matf{3, 2, 7.0f}));
+    }
+
+    TEST(Dense, Fixed_matrix) {
+        auto a = random_dynamic_matrix<float>(16, 24, 8);
+        auto b = random_dynamic_matrix<float>(24, 20, 9);
+
+        Matrix<float, 16, 24> fa = Matrix<float, 16, 24>::read(a.data());
+        Matrix<float, 24, 20> fb = Matrix<float, 24, 20>::read(b.data());
+
+        Matrix<float, 16, 20> fc = fa * fb;
+        dynamic_matf c = a * b;
+        for (unsigned i = 0; i < 16; ++i) {
+            for (unsigned j = 0; j < 20; ++j) {
+                EXPECT_NEAR(fc(i, j), c(i, j), 1.0e-5f);
+            }
+        }
+
+        Matrix<float, 16, 16> identity{1.0f};
+        EXPECT_EQ(identity * fa, fa);
+        EXPECT_EQ(transpose(transpose(fa)), fa);
+        EXPECT_EQ(transpose(fa)(3, 5), fa(5, 3));
+    }
+
+}
+
+#endif //AVML_DENSE_TESTS_HPP
@@ -0,0 +1,408 @@
+#ifndef AVML_DIFFERENTIAL_TESTS_HPP
+#define AVML_DIFFERENTIAL_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <cfloat>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace avml_tests {
+
+    using namespace avml;
+
+    // Runs random inputs through the float paths selected by the build's
+    // AVML_* macros and through scalar references mirroring the formulas of
+    // impl/default/DEF_*.ipp, then reports the distribution of ULP
+    // distances. The DEF_ files specialize the same classes as the SIMD
+    // files, so the references are restated here rather than included.
+    //
+    // Rounding differences from fused multiply-add and summation order are
+    // unbounded in ULPs of the result under cancellation, so bounds are
+    // asserted in ULPs of the sum of the magnitudes of the terms instead.
+    //
+    // AVML_FUZZ_SAMPLES and AVML_FUZZ_SEED override the sample count and
+    // seed for longer fuzzing runs.
+
+    //=====================================================
+    // Error measurement
+    //=====================================================
+
+    /// Maps floats onto integers with the same ordering, with -0 and +0 equal
+    inline std::int64_t ordered_bits(float x) {
+        std::int32_t i;
+        std::memcpy(&i, &x, sizeof(i));
+        return (i < 0) ? -std::int64_t(i & 0x7FFFFFFF) : std::int64_t(i);
+    }
+
+    inline std::uint64_t ulp_distance(float a, float b) {
+        std::int64_t d = ordered_bits(a) - ordered_bits(b);
+        return static_cast<std::uint64_t>(d < 0 ? -d : d);
+    }
+
+    /// Spacing of floats at magnitude x, never less than the smallest denormal
+    inline double ulp_at(double x) {
+        float f = static_cast<float>(std::abs(x));
+        if (!(f < FLT_MAX)) {
+            return double(FLT_MAX) - double(std::nextafter(FLT_MAX, 0.0f));
+        }
+        return double(std::nextafter(f, FLT_MAX)) - double(f);
+    }
+
+    class Ulp_report {
+    public:
+
+        explicit Ulp_report(const char* name):
+            name(name) {}
+
+        ///
+        /// \param scale Magnitude the error is measured against when
+        /// bounding it, e.g. the sum of absolute values of a dot product's
+        /// terms
+        ///
+        void add(float actual, float reference, double scale) {
+            ++samples;
+
+            if (!std::isfinite(actual) || !std::isfinite(reference)) {
+                bool same = (std::isnan(actual) && std::isnan(reference)) || actual == reference;
+                if (same) {
+                    ++buckets[0];
+                } else {
+                    ++mismatches;
+                }
+                return;
+            }
+
+            std::uint64_t d = ulp_distance(actual, reference);
+            unsigned b = 0;
+            if (d != 0) {
+                while ((std::uint64_t{1} << b) < d) {
+                    ++b;
+                }
+                ++b;
+            }
+
+            ++buckets[b];
+            max_ulps = (d < max_ulps) ? max_ulps : d;
+
+            double scaled = std::abs(double(actual) - double(reference)) / ulp_at(scale);
+            max_scaled = (scaled < max_scaled) ? max_scaled : scaled;
+        }
+
+        void print(std::ostream& stream) const {
+            stream << "[   ULPs   ] " << name << " (" << to_string(compiled_tier()) << "): "
+                << samples << " samples, max " << max_ulps << " ULPs, "
+                << max_scaled << " scaled";
+            if (mismatches != 0) {
+                stream << ", " << mismatches << " class mismatches";
+            }
+            stream << "\n[          ]  ";
+
+            for (unsigned b = 0; b < bucket_count; ++b) {
+                if (buckets[b] == 0) {
+                    continue;
+                }
+
+                if (b < 3) {
+                    stream << ' ' << b << ": ";
+                } else {
+                    stream << " <=" << (std::uint64_t{1} << (b - 1)) << ": ";
+                }
+                stream << buckets[b];
+            }
+            stream << '\n';
+        }
+
+        const char* name;
+
+        std::uint64_t samples = 0;
+        std::uint64_t mismatches = 0;
+        std::uint64_t max_ulps = 0;
+        double max_scaled = 0.0;
+
+        /// Bucket 0 holds exact results, bucket b > 0 distances in
+        /// (2^(b-2), 2^(b-1)]
+        static constexpr unsigned bucket_count = 34;
+        std::uint64_t buckets[bucket_count]{};
+    };
+
+    inline void expect_within(const Ulp_report& r, double bound) {
+        r.print(std::cout);
+        EXPECT_EQ(r.mismatches, 0u) << r.name;
+        EXPECT_LE(r.max_scaled, bound) << r.name;
+    }
+
+    //=====================================================
+    // Inputs
+    //=====================================================
+
+    inline unsigned long fuzz_setting(const char* variable, unsigned long fallback) {
+        const char* s = std::getenv(variable);
+        return s ? std::strtoul(s, nullptr, 10) : fallback;
+    }
+
+    inline std::size_t fuzz_samples() {
+        return fuzz_setting("AVML_FUZZ_SAMPLES", 4096);
+    }
+
+    ///
+    /// Random floats with binary exponents in [-max_exponent, max_exponent].
+    /// With specials set, a quarter are zeros, denormals, infinities or NaNs.
+    ///
+    class Fuzz_source {
+    public:
+
+        Fuzz_source(std::uint32_t seed, int max_exponent, bool specials):
+            gen(static_cast<std::uint32_t>(fuzz_setting("AVML_FUZZ_SEED", 1)) * 7919u + seed),
+            exponent(-max_exponent, max_exponent),
+            specials(specials) {}
+
+        float operator()() {
+            std::uint32_t r = gen();
+            float sign = (r & 1) ? -1.0f : 1.0f;
+
+            if (specials) {
+                switch ((r >> 1) & 0xF) {
+                    case 0: return sign * 0.0f;
+                    case 1: return sign * denormal();
+                    case 2: return sign * std::numeric_limits<float>::infinity();
+                    case 3: return std::numeric_limits<float>::quiet_NaN();
+                    default: break;
+                }
+            }
+
+            return sign * std::ldexp(mantissa(gen), exponent(gen));
+        }
+
+        /// Unit vector with finite components
+        uvec3f unit() {
+            vec3f v{};
+            while (!(length2(v) > 0.0f)) {
+                v = vec3f{
+                    std::ldexp(mantissa(gen), exponent(gen)),
+                    std::ldexp(mantissa(gen), exponent(gen)),
+                    std::ldexp(mantissa(gen), exponent(gen))
+                };
+            }
+            return normalize(v);
+        }
+
+    private:
+
+        float denormal() {
+            std::uint32_t bits = (gen() & 0x7FFFFF) | 1;
+            float ret;
+            std::memcpy(&ret, &bits, sizeof(ret));
+            return ret;
+        }
+
+        std::mt19937 gen;
+        std::uniform_int_distribution<int> exponent;
+        std::uniform_real_distribution<float> mantissa{1.0f, 2.0f};
+        bool specials;
+    };
+
+    // Exponent range within which squares and products of three terms
+    // neither overflow nor leave the normal range
+    constexpr int fuzz_exponent = 30;
+
+    //=====================================================
+    // Scalar references
+    //=====================================================
+
+    inline float reference_dot(const float* a, const float* b, unsigned n) {
+        float ret = a[0] * b[0];
+        for (unsigned i = 1; i < n; ++i) {
+            ret += a[i] * b[i];
+        }
+        return ret;
+    }
+
+    inline double magnitude_dot(const float* a, const float* b, unsigned n) {
+        double ret = 0.0;
+        for (unsigned i = 0; i < n; ++i) {
+            ret += std::abs(double(a[i]) * b[i]);
+        }
+        return ret;
+    }
+
+    //=====================================================
+    // Tests
+    //=====================================================
+
+    TEST(Differential, Vectors) {
+        const std::size_t n = fuzz_samples();
+
+        for (bool specials : {false, true}) {
+            Fuzz_source src{specials ? 2u : 1u, fuzz_exponent, specials};
+
+            Ulp_report dot2{specials ? "dot(vec2f), specials" : "dot(vec2f)"};
+            Ulp_report dot3{specials ? "dot(vec3f), specials" : "dot(vec3f)"};
+            Ulp_report len3{specials ? "length(vec3f), specials" : "length(vec3f)"};
+            Ulp_report norm3{specials ? "normalize(vec3f), specials" : "normalize(vec3f)"};
+            Ulp_report cross3{specials ? "cross(vec3f), specials" : "cross(vec3f)"};
+            Ulp_report refl3{specials ? "reflect(vec3f), specials" : "reflect(vec3f)"};
+            Ulp_report proj3{specials ? "project_onto_plane(vec3f), specials" : "project_onto_plane(vec3f)"};
+
+            for (std::size_t t = 0; t < n; ++t) {
+                vec2f a2{src(), src()};
+                vec2f b2{src(), src()};
+                dot2.add(dot(a2, b2), reference_dot(a2.data(), b2.data(), 2), magnitude_dot(a2.data(), b2.data(), 2));
+
+                vec3f a{src(), src(), src()};
+                vec3f b{src(), src(), src()};
+                dot3.add(dot(a, b), reference_dot(a.data(), b.data(), 3), magnitude_dot(a.data(), b.data(), 3));
+
+                float l = std::sqrt(reference_dot(a.data(), a.data(), 3));
+                len3.add(length(a), l, l);
+
+                uvec3f u = normalize(a);
+                for (unsigned i = 0; i < 3; ++i) {
+                    norm3.add(u[i], a[i] / l, a[i] / l);
+                }
+
+                vec3f c = cross(a, b);
+                for (unsigned i = 0; i < 3; ++i) {
+                    unsigned j = (i + 1) % 3;
+                    unsigned k = (i + 2) % 3;
+                    float expected = a[j] * b[k] - a[k] * b[j];
+                    cross3.add(c[i], expected, std::abs(double(a[j]) * b[k]) + std::abs(double(a[k]) * b[j]));
+                }
+
+                uvec3f normal = src.unit();
+                float an = reference_dot(a.data(), normal.data(), 3);
+                double an_magnitude = magnitude_dot(a.data(), normal.data(), 3);
+
+                vec3f r = reflect(a, normal);
+                vec3f p = project_onto_plane(a, normal);
+                for (unsigned i = 0; i < 3; ++i) {
+                    refl3.add(r[i], 2 * an * normal[i] - a[i], 2.0 * an_magnitude * std::abs(normal[i]) + std::abs(a[i]));
+                    proj3.add(p[i], a[i] - an * normal[i], an_magnitude * std::abs(normal[i]) + std::abs(a[i]));
+                }
+
+                // Swizzles move bits, NaN payloads included
+                vec2f s2 = swizzle<1, 0>(a2);
+                vec3f s3 = swizzle<2, 0, 1>(a);
+                vec4f v4{a[0], b[1], a[2], b[0]};
+                vec4f s4 = swizzle<3, 2, 1, 0>(v4);
+                EXPECT_EQ(ordered_bits(s2[0]), ordered_bits(a2[1]));
+                EXPECT_EQ(ordered_bits(s3[0]), ordered_bits(a[2]));
+                EXPECT_EQ(ordered_bits(s3[2]), ordered_bits(a[1]));
+                EXPECT_EQ(ordered_bits(s4[0]), ordered_bits(v4[3]));
+                EXPECT_EQ(ordered_bits(s4[2]), ordered_bits(v4[1]));
+            }
+
+            expect_within(dot2, 3.0);
+            expect_within(dot3, 4.0);
+            expect_within(len3, 3.0);
+            expect_within(norm3, 4.0);
+            expect_within(cross3, 2.0);
+            expect_within(refl3, 6.0);
+            expect_within(proj3, 6.0);
+        }
+    }
+
+    TEST(Differential, Matrices) {
+        const std::size_t n = fuzz_samples() / 4;
+
+        for (bool specials : {false, true}) {
+            Fuzz_source src{specials ? 4u : 3u, fuzz_exponent / 2, specials};
+
+            Ulp_report mat_vec{specials ? "mat4x4f * vec4f, specials" : "mat4x4f * vec4f"};
+            Ulp_report mat_mat{specials ? "mat4x4f * mat4x4f, specials" : "mat4x4f * mat4x4f"};
+
+            for (std::size_t t = 0; t < n; ++t) {
+                mat4x4f a;
+                mat4x4f b;
+                vec4f v{src(), src(), src(), src()};
+                for (unsigned i = 0; i < 4; ++i) {
+                    for (unsigned j = 0; j < 4; ++j) {
+                        a[i][j] = src();
+                        b[i][j] = src();
+                    }
+                }
+
+                vec4f av = a * v;
+                mat4x4f ab = a * b;
+                for (unsigned i = 0; i < 4; ++i) {
+                    mat_vec.add(av[i], reference_dot(a[i].data(), v.data(), 4), magnitude_dot(a[i].data(), v.data(), 4));
+
+                    for (unsigned j = 0; j < 4; ++j) {
+                        const float column[4] = {b[0][j], b[1][j], b[2][j], b[3][j]};
+                        mat_mat.add(ab[i][j], reference_dot(a[i].data(), column, 4), magnitude_dot(a[i].data(), column, 4));
+                    }
+                }
+            }
+
+            expect_within(mat_vec, 6.0);
+            expect_within(mat_mat, 6.0);
+        }
+    }
+
+    TEST(Differential, Batches) {
+        // Odd count so the vector loops' remainders are covered too
+        const std::size_t n = fuzz_samples() + 7;
+
+        for (bool specials : {false, true}) {
+            Fuzz_source src{specials ? 6u : 5u, fuzz_exponent, specials};
+
+            Ulp_report norm{specials ? "normalize[batch], specials" : "normalize[batch]"};
+            Ulp_report moved{specials ? "transform_points[batch], specials" : "transform_points[batch]"};
+            Ulp_report fused{specials ? "fmadd[array], specials" : "fmadd[array]"};
+
+            std::vector<vec3f> points(n);
+            for (vec3f& p : points) {
+                p = vec3f{src(), src(), src()};
+            }
+
+            Fuzz_source finite{specials ? 8u : 7u, fuzz_exponent / 2, false};
+            mat4x4f m;
+            for (unsigned i = 0; i < 4; ++i) {
+                for (unsigned j = 0; j < 4; ++j) {
+                    m[i][j] = finite();
+                }
+            }
+
+            std::vector<uvec3f> units(n);
+            std::vector<vec3f> out(n);
+            normalize(points.data(), units.data(), n);
+            transform_points(m, points.data(), out.data(), n);
+
+            for (std::size_t t = 0; t < n; ++t) {
+                const vec3f& p = points[t];
+                float l = std::sqrt(reference_dot(p.data(), p.data(), 3));
+
+                for (unsigned i = 0; i < 3; ++i) {
+                    norm.add(units[t][i], p[i] / l, p[i] / l);
+
+                    float expected = m[i][0] * p[0] + m[i][1] * p[1] + m[i][2] * p[2] + m[i][3];
+                    moved.add(out[t][i], expected, magnitude_dot(m[i].data(), p.data(), 3) + std::abs(m[i][3]));
+                }
+            }
+
+            std::vector<float> a(n), x(n), b(n), r(n);
+            for (std::size_t t = 0; t < n; ++t) {
+                a[t] = src();
+                x[t] = src();
+                b[t] = src();
+            }
+
+            fmadd(a.data(), x.data(), b.data(), r.data(), n);
+            for (std::size_t t = 0; t < n; ++t) {
+                fused.add(r[t], a[t] * x[t] + b[t], std::abs(double(a[t]) * x[t]) + std::abs(b[t]));
+            }
+
+            expect_within(norm, 4.0);
+            expect_within(moved, 6.0);
+            expect_within(fused, 2.0);
+        }
+    }
+
+}
+
+#endif
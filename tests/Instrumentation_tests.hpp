@@ -0,0 +1,75 @@
+#ifndef AVML_INSTRUMENTATION_TESTS_HPP
+#define AVML_INSTRUMENTATION_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <avml/Instrumentation.hpp>
+#include <avml/Batch.hpp>
+
+namespace avml_tests {
+
+    using namespace avml;
+
+    inline const Profile_entry* find_entry(const std::vector<Profile_entry>& entries, const char* name) {
+        for (const Profile_entry& e : entries) {
+            if (e.name == name) {
+                return &e;
+            }
+        }
+        return nullptr;
+    }
+
+    TEST(Instrumentation, Counts_calls_and_elements) {
+        profile_reset();
+
+        std::vector<vec3f> points(100, vec3f{1.0f, 2.0f, 3.0f});
+        std::vector<uvec3f> normals(points.size());
+
+        float sum = 0.0f;
+        std::thread worker{[&] {
+            for (int i = 0; i < 10; ++i) {
+                sum += dot(points[i], points[i]);
+            }
+        }};
+        worker.join();
+
+        EXPECT_EQ(sum, 140.0f);
+
+        std::vector<Profile_entry> entries = profile_snapshot();
+
+        #if defined(AVML_INSTRUMENT)
+        const Profile_entry* d = find_entry(entries, "dot(vec3f)");
+        ASSERT_NE(d, nullptr);
+        EXPECT_EQ(d->calls, 10u);
+        EXPECT_EQ(d->elements, 10u);
+        #endif
+
+        for (int i = 0; i < 5; ++i) {
+            normalize(points.data(), normals.data(), points.size());
+        }
+        entries = profile_snapshot();
+
+        #if defined(AVML_INSTRUMENT)
+        const Profile_entry* n = find_entry(entries, "normalize[batch]");
+        ASSERT_NE(n, nullptr);
+        EXPECT_EQ(n->calls, 5u);
+        EXPECT_EQ(n->elements, 500u);
+
+        std::ostringstream report;
+        profile_report(report);
+        EXPECT_NE(report.str().find("normalize[batch]"), std::string::npos);
+
+        profile_reset();
+        EXPECT_TRUE(profile_snapshot().empty());
+        #else
+        EXPECT_TRUE(entries.empty());
+        #endif
+    }
+
+}
+
+#endif //AVML_INSTRUMENTATION_TESTS_HPP
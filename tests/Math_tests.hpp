@@ -0,0 +1,221 @@
+#ifndef AVML_MATH_TESTS_HPP
+#define AVML_MATH_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+namespace avml_tests {
+
+    using namespace avml;
+
+    TEST(Math, Scalar) {
+        EXPECT_EQ(fmadd(2.0f, 3.0f, 1.0f), 7.0f);
+        EXPECT_EQ(fmnadd(2.0f, 3.0f, 1.0f), -5.0f);
+        EXPECT_EQ(fmsub(2.0f, 3.0f, 1.0f), 5.0f);
+        EXPECT_EQ(fmnsub(2.0f, 3.0f, 1.0f), -7.0f);
+
+        EXPECT_EQ(fmadd(2.0, 3.0, 1.0), 7.0);
+        EXPECT_EQ(fmnadd(2.0, 3.0, 1.0), -5.0);
+        EXPECT_EQ(fmsub(2.0, 3.0, 1.0), 5.0);
+        EXPECT_EQ(fmnsub(2.0, 3.0, 1.0), -7.0);
+
+        EXPECT_EQ(fract(-1.25f), 0.75f);
+        EXPECT_EQ(fract(-1.25), 0.75);
+        EXPECT_EQ(clamp(4.0, -1.0, 2.0), 2.0);
+        EXPECT_EQ(average(1.0, 4.0), 2.5);
+    }
+
+    TEST(Math, Vectors) {
+        vec4f m{2.0f, -1.5f, 0.25f, 8.0f};
+        vec4f x{3.0f, 4.0f, -2.0f, 0.5f};
+        vec4f b{1.0f, -0.5f, 3.0f, -6.0f};
+
+        vec4f r0 = fmadd(m, x, b);
+        vec4f r1 = fmnadd(m, x, b);
+        vec4f r2 = fmsub(m, x, b);
+        vec4f r3 = fmnsub(m, x, b);
+        vec4f r4 = fract(vec4f{-1.25f, 2.5f, 1e9f, -3.0f});
+        vec4f r5 = clamp(x, -1.0f, 2.0f);
+        vec4f r6 = clamp(x, b, vec4f{5.0f});
+        vec4f r7 = average(m, x);
+
+        const float f[] = {-1.25f, 2.5f, 1e9f, -3.0f};
+        for (unsigned i = 0; i < 4; ++i) {
+            EXPECT_EQ(r0[i], fmadd(m[i], x[i], b[i]));
+            EXPECT_EQ(r1[i], fmnadd(m[i], x[i], b[i]));
+            EXPECT_EQ(r2[i], fmsub(m[i], x[i], b[i]));
+            EXPECT_EQ(r3[i], fmnsub(m[i], x[i], b[i]));
+            EXPECT_EQ(r4[i], fract(f[i]));
+            EXPECT_EQ(r5[i], clamp(x[i], -1.0f, 2.0f));
+            EXPECT_EQ(r6[i], clamp(x[i], b[i], 5.0f));
+            EXPECT_EQ(r7[i], average(m[i], x[i]));
+        }
+
+        EXPECT_EQ(fmadd(vec2f{2.0f, 3.0f}, vec2f{4.0f}, vec2f{1.0f}), (vec2f{9.0f, 13.0f}));
+        EXPECT_EQ(fract(vec3f{0.5f, -0.25f, 7.0f}), (vec3f{0.5f, 0.75f, 0.0f}));
+        EXPECT_EQ(average(vec3f{1.0f, 2.0f, 3.0f}, vec3f{3.0f}), (vec3f{2.0f, 2.5f, 3.0f}));
+
+        vec3d d = clamp(fmadd(vec3d{1.0, 2.0, 3.0}, vec3d{2.0}, vec3d{-1.0}), 0.0, 4.0);
+        EXPECT_EQ(d[0], 1.0);
+        EXPECT_EQ(d[1], 3.0);
+        EXPECT_EQ(d[2], 4.0);
+        EXPECT_EQ(fract(vec2d{-0.5, 1.75})[0], 0.5);
+    }
+
+    TEST(Math, Interpolation) {
+        EXPECT_EQ(lerp(3.0f, 7.0f, 0.0f), 3.0f);
+        EXPECT_EQ(lerp(3.0f, 7.0f, 1.0f), 7.0f);
+        EXPECT_EQ(lerp(3.0f, 7.0f, 0.25f), 4.0f);
+        EXPECT_EQ(lerp(0.1, 0.7, 1.0), 0.7);
+        EXPECT_EQ(mix(-2.0f, 2.0f, 0.5f), 0.0f);
+
+        EXPECT_EQ(step(1.0f, 0.5f), 0.0f);
+        EXPECT_EQ(step(1.0f, 1.0f), 1.0f);
+
+        EXPECT_EQ(smoothstep(1.0f, 3.0f, 0.0f), 0.0f);
+        EXPECT_EQ(smoothstep(1.0f, 3.0f, 2.0f), 0.5f);
+        EXPECT_EQ(smoothstep(1.0f, 3.0f, 5.0f), 1.0f);
+        EXPECT_FLOAT_EQ(smoothstep(0.0f, 1.0f, 0.25f), 0.15625f);
+
+        EXPECT_EQ(saturate(-0.5f), 0.0f);
+        EXPECT_EQ(saturate(0.5), 0.5);
+        EXPECT_EQ(saturate(1.5f), 1.0f);
+
+        vec4f a{0.0f, 1.0f, -4.0f, 10.0f};
+        vec4f b{1.0f, 3.0f, 4.0f, 10.0f};
+        vec4f t{0.5f, 0.25f, 1.0f, 0.75f};
+        EXPECT_EQ(lerp(a, b, t), (vec4f{0.5f, 1.5f, 4.0f, 10.0f}));
+        EXPECT_EQ(mix(a, b, 0.5f), (vec4f{0.5f, 2.0f, 0.0f, 10.0f}));
+        EXPECT_EQ(step(vec4f{0.5f}, t), (vec4f{1.0f, 0.0f, 1.0f, 1.0f}));
+        EXPECT_EQ(step(1.0f, a), (vec4f{0.0f, 1.0f, 0.0f, 1.0f}));
+        EXPECT_EQ(saturate(a), (vec4f{0.0f, 1.0f, 0.0f, 1.0f}));
+
+        vec3f s = smoothstep(vec3f{0.0f}, vec3f{1.0f, 2.0f, 4.0f}, vec3f{0.5f, 1.0f, 5.0f});
+        EXPECT_EQ(s, (vec3f{0.5f, 0.5f, 1.0f}));
+        EXPECT_EQ(smoothstep(0.0f, 2.0f, vec2f{-1.0f, 1.0f}), (vec2f{0.0f, 0.5f}));
+
+        vec3d d = lerp(vec3d{1.0}, vec3d{3.0}, 0.5);
+        EXPECT_EQ(d[0], 2.0);
+        EXPECT_EQ(smoothstep(0.0, 1.0, vec2d{0.5, 2.0})[1], 1.0);
+    }
+
+    TEST(Math, Arrays) {
+        const std::size_t n = 43;
+        std::mt19937 gen{7};
+        std::uniform_real_distribution<float> dist{-100.0f, 100.0f};
+
+        std::vector<float> m(n), x(n), b(n), out(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            // Small multiples of 1/4 keep products exact, whether fused or not
+            m[i] = std::floor(dist(gen)) * 0.25f;
+            x[i] = std::floor(dist(gen) * 0.1f);
+            b[i] = dist(gen);
+        }
+
+        fmadd(m.data(), x.data(), b.data(), out.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(out[i], fmadd(m[i], x[i], b[i])) << i;
+        }
+
+        fmnsub(m.data(), x.data(), b.data(), out.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(out[i], fmnsub(m[i], x[i], b[i])) << i;
+        }
+
+        fract(b.data(), out.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(out[i], fract(b[i])) << i;
+        }
+
+        clamp(b.data(), -10.0f, 20.0f, out.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(out[i], clamp(b[i], -10.0f, 20.0f)) << i;
+        }
+
+        average(m.data(), b.data(), out.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(out[i], average(m[i], b[i])) << i;
+        }
+
+        // t * b isn't exact, so unfused lanes may round differently from
+        // the scalar std::fma
+        lerp(m.data(), b.data(), x.data(), out.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            EXPECT_FLOAT_EQ(out[i], lerp(m[i], b[i], x[i])) << i;
+        }
+
+        smoothstep(-50.0f, 50.0f, b.data(), out.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            EXPECT_FLOAT_EQ(out[i], smoothstep(-50.0f, 50.0f, b[i])) << i;
+        }
+
+        saturate(x.data(), out.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(out[i], saturate(x[i])) << i;
+        }
+
+        // In place
+        std::vector<float> y = x;
+        fmsub(m.data(), y.data(), b.data(), y.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(y[i], fmsub(m[i], x[i], b[i])) << i;
+        }
+    }
+
+    TEST(Math, Products) {
+        // SIMD and FMA paths against double precision references
+        std::mt19937 gen{17};
+        std::uniform_real_distribution<float> dist{-4.0f, 4.0f};
+
+        for (unsigned t = 0; t < 100; ++t) {
+            vec2f a2{dist(gen), dist(gen)};
+            vec2f b2{dist(gen), dist(gen)};
+            EXPECT_NEAR(dot(a2, b2), double(a2[0]) * b2[0] + double(a2[1]) * b2[1], 1.0e-5);
+
+            vec3f a3{dist(gen), dist(gen), dist(gen)};
+            vec3f b3{dist(gen), dist(gen), dist(gen)};
+            double d3 = double(a3[0]) * b3[0] + double(a3[1]) * b3[1] + double(a3[2]) * b3[2];
+            EXPECT_NEAR(dot(a3, b3), d3, 1.0e-5);
+
+            uvec3f n = normalize(b3);
+            vec3f r = reflect(a3, n);
+            vec3f p = project_onto_plane(a3, n);
+            float an = dot(a3, n);
+            for (unsigned i = 0; i < 3; ++i) {
+                EXPECT_NEAR(r[i], 2.0f * an * n[i] - a3[i], 1.0e-5f);
+                EXPECT_NEAR(p[i], a3[i] - an * n[i], 1.0e-5f);
+            }
+
+            mat4x4f m;
+            mat4x4f k;
+            vec4f v{dist(gen), dist(gen), dist(gen), dist(gen)};
+            for (unsigned i = 0; i < 4; ++i) {
+                for (unsigned j = 0; j < 4; ++j) {
+                    m[i][j] = dist(gen);
+                    k[i][j] = dist(gen);
+                }
+            }
+
+            vec4f mv = m * v;
+            mat4x4f mk = m * k;
+            for (unsigned i = 0; i < 4; ++i) {
+                double expected = 0.0;
+                for (unsigned j = 0; j < 4; ++j) {
+                    expected += double(m[i][j]) * v[j];
+
+                    double e = 0.0;
+                    for (unsigned l = 0; l < 4; ++l) {
+                        e += double(m[i][l]) * k[l][j];
+                    }
+                    EXPECT_NEAR(mk[i][j], e, 1.0e-4);
+                }
+                EXPECT_NEAR(mv[i], expected, 1.0e-4);
+            }
+        }
+    }
+
+}
+
+#endif
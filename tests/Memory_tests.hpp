@@ -0,0 +1,97 @@
+#ifndef AVML_MEMORY_TESTS_HPP
+#define AVML_MEMORY_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include <avml/Memory.hpp>
+#include <avml/Matrices.hpp>
+
+namespace avml_tests {
+
+    using namespace avml;
+
+    inline bool is_aligned_to(const void* p, std::size_t alignment) {
+        return (reinterpret_cast<std::uintptr_t>(p) % alignment) == 0;
+    }
+
+    TEST(Memory, Aligned_vector) {
+        aligned_vector<mat4x4f> matrices;
+        aligned_vector<float> floats;
+
+        for (int i = 0; i < 100; ++i) {
+            matrices.push_back(mat4x4f{float(i)});
+            floats.push_back(float(i));
+
+            EXPECT_TRUE(is_aligned_to(matrices.data(), 64));
+            EXPECT_TRUE(is_aligned_to(floats.data(), default_alignment));
+        }
+
+        for (int i = 0; i < 100; ++i) {
+            EXPECT_EQ(matrices[i][3][3], float(i));
+            EXPECT_EQ(floats[i], float(i));
+        }
+    }
+
+    TEST(Memory, Arena_alignment) {
+        Arena arena{1024};
+
+        for (int i = 0; i < 100; ++i) {
+            void* p = arena.allocate(std::size_t(i) * 3 + 1, 8);
+            EXPECT_TRUE(is_aligned_to(p, 8));
+
+            mat4x4f* m = arena.create<mat4x4f>(float(i));
+            EXPECT_TRUE(is_aligned_to(m, alignof(mat4x4f)));
+            EXPECT_EQ((*m)[0][0], float(i));
+
+            void* big = arena.allocate(8, 256);
+            EXPECT_TRUE(is_aligned_to(big, 256));
+        }
+
+        void* huge = arena.allocate(4096);
+        EXPECT_NE(huge, nullptr);
+    }
+
+    TEST(Memory, Arena_reset) {
+        Arena arena{4096};
+
+        vec4f* first = arena.allocate<vec4f>(16);
+        arena.allocate<vec4f>(1000);
+        std::size_t capacity = arena.capacity();
+
+        arena.reset();
+        EXPECT_EQ(arena.allocate<vec4f>(16), first);
+
+        arena.allocate<vec4f>(1000);
+        EXPECT_EQ(arena.capacity(), capacity);
+
+        Arena::Marker m = arena.mark();
+        vec4f* scratch;
+        {
+            Arena_scope scope{arena};
+            scratch = arena.allocate<vec4f>(4);
+        }
+        EXPECT_EQ(arena.allocate<vec4f>(4), scratch);
+
+        arena.rewind(m);
+        EXPECT_EQ(arena.allocate<vec4f>(4), scratch);
+    }
+
+    TEST(Memory, Arena_vector) {
+        Arena arena{};
+        arena_vector<mat4x4f> matrices{Arena_allocator<mat4x4f>{arena}};
+
+        for (int i = 0; i < 50; ++i) {
+            matrices.push_back(mat4x4f{float(i)});
+            EXPECT_TRUE(is_aligned_to(matrices.data(), 64));
+        }
+
+        for (int i = 0; i < 50; ++i) {
+            EXPECT_EQ(matrices[i][1][1], float(i));
+        }
+    }
+
+}
+
+#endif //AVML_MEMORY_TESTS_HPP
@@ -0,0 +1,140 @@
+#ifndef AVML_NOISE_TESTS_HPP
+#define AVML_NOISE_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace avml_tests {
+
+    using namespace avml;
+
+    const Noise_basis noise_bases[] = {
+        Noise_basis::value,
+        Noise_basis::perlin,
+        Noise_basis::simplex,
+        Noise_basis::worley
+    };
+
+    inline float noise(Noise_basis basis, vec3f p, std::uint32_t seed) {
+        switch (basis) {
+        case Noise_basis::value: return value_noise(p, seed);
+        case Noise_basis::perlin: return perlin_noise(p, seed);
+        case Noise_basis::simplex: return simplex_noise(p, seed);
+        case Noise_basis::worley: return worley_noise(p, seed);
+        }
+        return 0.0f;
+    }
+
+    TEST(Noise, Deterministic) {
+        vec3f p{1.3f, -7.25f, 40.5f};
+
+        for (Noise_basis basis : noise_bases) {
+            EXPECT_EQ(noise(basis, p, 3), noise(basis, p, 3));
+            EXPECT_NE(noise(basis, p, 3), noise(basis, p, 4));
+        }
+    }
+
+    TEST(Noise, Lattice) {
+        // Perlin noise vanishes on the lattice while value noise is the
+        // hashed lattice value itself, so it is the same at each corner no
+        // matter which cell it is approached from
+        for (int i = -3; i < 3; ++i) {
+            vec2f p2{float(i), float(2 * i + 1)};
+            vec3f p3{float(i), float(5 - i), float(i * i)};
+            vec4f p4{float(i), 1.0f, float(-i), 3.0f};
+
+            EXPECT_NEAR(perlin_noise(p2), 0.0f, 1e-6f);
+            EXPECT_NEAR(perlin_noise(p3), 0.0f, 1e-6f);
+            EXPECT_NEAR(perlin_noise(p4), 0.0f, 1e-6f);
+
+            const float e = 1e-4f;
+            EXPECT_NEAR(value_noise(p3 - vec3f{e}), value_noise(p3), 1e-3f);
+            EXPECT_NEAR(value_noise(p3 + vec3f{e}), value_noise(p3), 1e-3f);
+        }
+    }
+
+    TEST(Noise, Range_and_continuity) {
+        std::mt19937 gen{5};
+        std::uniform_real_distribution<float> dist{-50.0f, 50.0f};
+
+        for (unsigned i = 0; i < 2000; ++i) {
+            vec2f p2{dist(gen), dist(gen)};
+            vec3f p3{dist(gen), dist(gen), dist(gen)};
+            vec4f p4{dist(gen), dist(gen), dist(gen), dist(gen)};
+
+            for (Noise_basis basis : noise_bases) {
+                Fbm_settings settings;
+                settings.octaves = 1;
+
+                float lo = (basis == Noise_basis::worley) ? 0.0f : -1.1f;
+                float hi = (basis == Noise_basis::worley) ? 1.3f : 1.1f;
+                for (float v : {fbm(basis, p2, settings), fbm(basis, p3, settings), fbm(basis, p4, settings)}) {
+                    EXPECT_GE(v, lo);
+                    EXPECT_LE(v, hi);
+                }
+
+                float step = noise(basis, p3 + vec3f{1e-3f, 0.0f, -1e-3f}, 0) - noise(basis, p3, 0);
+                EXPECT_LT(std::abs(step), 0.05f);
+            }
+        }
+    }
+
+    TEST(Noise, Fbm) {
+        vec3f p{0.37f, 1.91f, -4.2f};
+
+        Fbm_settings single;
+        single.seed = 9;
+        single.octaves = 1;
+        EXPECT_FLOAT_EQ(fbm(Noise_basis::perlin, p, single), perlin_noise(p, 9));
+
+        Fbm_settings two = single;
+        two.octaves = 2;
+        float expected = (perlin_noise(p, 9) + 0.5f * perlin_noise(p * 2.0f, 10)) / 1.5f;
+        EXPECT_NEAR(fbm(Noise_basis::perlin, p, two), expected, 1e-5f);
+    }
+
+    TEST(Noise, Batch) {
+        const std::size_t n = 37;
+        std::mt19937 gen{6};
+        std::uniform_real_distribution<float> dist{-20.0f, 20.0f};
+
+        std::vector<float> x(n), y(n), z(n), w(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            x[i] = dist(gen);
+            y[i] = dist(gen);
+            z[i] = dist(gen);
+            w[i] = dist(gen);
+        }
+
+        Fbm_settings settings;
+        settings.seed = 11;
+        settings.octaves = 4;
+
+        Thread_pool pool{2};
+        std::vector<float> out2(n), out3(n), out4(n), parallel(n);
+        for (Noise_basis basis : noise_bases) {
+            fbm_batch(basis, settings, x.data(), y.data(), out2.data(), n);
+            fbm_batch(basis, settings, x.data(), y.data(), z.data(), out3.data(), n);
+            fbm_batch(basis, settings, x.data(), y.data(), z.data(), w.data(), out4.data(), n);
+
+            for (std::size_t i = 0; i < n; ++i) {
+                EXPECT_NEAR(out2[i], fbm(basis, vec2f{x[i], y[i]}, settings), 1e-4f) << i;
+                EXPECT_NEAR(out3[i], fbm(basis, vec3f{x[i], y[i], z[i]}, settings), 1e-4f) << i;
+                EXPECT_NEAR(out4[i], fbm(basis, vec4f{x[i], y[i], z[i], w[i]}, settings), 1e-4f) << i;
+            }
+
+            // Chunk boundaries change which points take the scalar tail, so
+            // contracted multiply-adds may round differently
+            fbm_batch(basis, settings, x.data(), y.data(), z.data(), parallel.data(), n, pool);
+            for (std::size_t i = 0; i < n; ++i) {
+                EXPECT_NEAR(parallel[i], out3[i], 1e-5f) << i;
+            }
+        }
+    }
+
+}
+
+#endif
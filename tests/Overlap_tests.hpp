@@ -0,0 +1,206 @@
+#ifndef AVML_OVERLAP_TESTS_HPP
+#define AVML_OVERLAP_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "Test_helpers.hpp"
+
+namespace avml_tests {
+
+    using namespace avml;
+
+    ///
+    /// Checks the batch overlaps of query against others, serially and on a
+    /// thread pool, against the pairwise test
+    ///
+    template<class A, class B>
+    void expect_batch_matches(const A& query, const std::vector<B>& others) {
+        const std::size_t n = others.size();
+        std::vector<std::uint64_t> mask((n + 63) / 64, ~std::uint64_t{0});
+        std::vector<std::uint64_t> pooled((n + 63) / 64, ~std::uint64_t{0});
+
+        overlaps(query, others.data(), mask.data(), n);
+
+        Thread_pool pool{2};
+        overlaps(query, others.data(), pooled.data(), n, pool);
+
+        std::size_t hits = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            bool expected = overlaps(query, others[i]);
+            EXPECT_EQ(mask_bit(mask, i), expected) << i;
+            hits += expected;
+        }
+        for (std::size_t i = n; i < 64 * mask.size(); ++i) {
+            EXPECT_FALSE(mask_bit(mask, i)) << i;
+        }
+        EXPECT_EQ(pooled, mask);
+
+        // Both outcomes should be exercised
+        EXPECT_GT(hits, n / 10);
+        EXPECT_LT(hits, n - n / 10);
+    }
+
+    TEST(Overlap, Spheres) {
+        spheref a{vec3f{0.0f, 0.0f, 0.0f}, 1.0f};
+
+        EXPECT_TRUE(overlaps(a, spheref{vec3f{1.5f, 0.0f, 0.0f}, 1.0f}));
+        EXPECT_TRUE(overlaps(a, spheref{vec3f{0.0f, 3.0f, 0.0f}, 2.0f}));
+        EXPECT_FALSE(overlaps(a, spheref{vec3f{0.0f, 0.0f, 3.0f}, 1.5f}));
+
+        aabb3f box{vec3f{1.0f, 1.0f, 1.0f}, vec3f{3.0f, 3.0f, 3.0f}};
+        EXPECT_FALSE(overlaps(a, box));
+        EXPECT_FALSE(overlaps(spheref{vec3f{0.0f}, 1.7f}, box));
+        EXPECT_TRUE(overlaps(spheref{vec3f{0.0f}, 1.75f}, box));
+        EXPECT_TRUE(overlaps(box, spheref{vec3f{2.5f, 2.5f, 2.5f}, 0.1f}));
+        EXPECT_TRUE(overlaps(spheref{vec3f{2.5f, 0.5f, 2.5f}, 0.5f}, box));
+
+        sphered d{vec3d{0.0, 0.0, 0.0}, 1.0};
+        EXPECT_TRUE(overlaps(d, sphered{vec3d{0.0, 2.0, 0.0}, 1.0}));
+        EXPECT_FALSE(overlaps(d, aabb3d{vec3d{1.0, 1.0, 1.0}, vec3d{2.0, 2.0, 2.0}}));
+    }
+
+    TEST(Overlap, Obbs) {
+        obbf unit = obbf::from_aabb(aabb3f{vec3f{-1.0f}, vec3f{1.0f}});
+        EXPECT_TRUE(contains(unit, vec3f{0.9f, -0.9f, 0.9f}));
+        EXPECT_FALSE(contains(unit, vec3f{1.1f, 0.0f, 0.0f}));
+
+        // A box turned 45 degrees about z reaches sqrt(2) along x
+        const float h = std::sqrt(0.5f);
+        mat3x3f turned{vec3f{h, h, 0.0f}, vec3f{-h, h, 0.0f}, vec3f{0.0f, 0.0f, 1.0f}};
+        EXPECT_TRUE(overlaps(unit, obbf{vec3f{2.3f, 0.0f, 0.0f}, turned, vec3f{1.0f}}));
+        EXPECT_FALSE(overlaps(unit, obbf{vec3f{2.5f, 0.0f, 0.0f}, turned, vec3f{1.0f}}));
+
+        // Diagonal neighbour, separated only along one of its own axes
+        mat3x3f tilted{vec3f{1.0f, 0.0f, 0.0f}, vec3f{0.0f, h, h}, vec3f{0.0f, -h, h}};
+        obbf diagonal{vec3f{0.0f, 1.8f, 1.8f}, tilted, vec3f{1.0f}};
+        EXPECT_FALSE(overlaps(unit, diagonal));
+        EXPECT_FALSE(overlaps(diagonal, unit));
+        diagonal.center() = vec3f{0.0f, 1.6f, 1.6f};
+        EXPECT_TRUE(overlaps(unit, diagonal));
+
+        // With axis aligned boxes the test reduces to interval overlap
+        std::mt19937 gen{3};
+        std::uniform_real_distribution<float> dist{-4.0f, 4.0f};
+        std::uniform_real_distribution<float> size{0.1f, 2.0f};
+        for (unsigned i = 0; i < 500; ++i) {
+            vec3f c0{dist(gen), dist(gen), dist(gen)};
+            vec3f c1{dist(gen), dist(gen), dist(gen)};
+            vec3f e0{size(gen), size(gen), size(gen)};
+            vec3f e1{size(gen), size(gen), size(gen)};
+
+            bool expected = true;
+            for (unsigned d = 0; d < 3; ++d) {
+                expected = expected && (std::abs(c1[d] - c0[d]) <= e0[d] + e1[d]);
+            }
+            EXPECT_EQ(overlaps(obbf{c0, mat3x3f{1.0f}, e0}, obbf{c1, mat3x3f{1.0f}, e1}), expected) << i;
+        }
+    }
+
+    TEST(Overlap, Capsules) {
+        capsulef a{vec3f{-1.0f, 0.0f, 0.0f}, vec3f{1.0f, 0.0f, 0.0f}, 0.25f};
+        vec3f on_a, on_b;
+
+        // Crossing above the middle
+        capsulef b{vec3f{0.5f, -1.0f, 1.0f}, vec3f{0.5f, 1.0f, 1.0f}, 0.5f};
+        EXPECT_FLOAT_EQ(closest_points(a, b, on_a, on_b), 1.0f);
+        EXPECT_EQ(on_a, (vec3f{0.5f, 0.0f, 0.0f}));
+        EXPECT_EQ(on_b, (vec3f{0.5f, 0.0f, 1.0f}));
+        EXPECT_FALSE(overlaps(a, b));
+        b.radius() = 0.8f;
+        EXPECT_TRUE(overlaps(a, b));
+
+        // Past the end of a, with b's closest point clamped too
+        capsulef c{vec3f{3.0f, 2.0f, 0.0f}, vec3f{3.0f, 5.0f, 0.0f}, 0.1f};
+        EXPECT_FLOAT_EQ(closest_points(a, c, on_a, on_b), 8.0f);
+        EXPECT_EQ(on_a, (vec3f{1.0f, 0.0f, 0.0f}));
+        EXPECT_EQ(on_b, (vec3f{3.0f, 2.0f, 0.0f}));
+
+        // Parallel and overlapping along their length
+        capsulef p{vec3f{0.0f, 0.5f, 0.0f}, vec3f{4.0f, 0.5f, 0.0f}, 0.25f};
+        EXPECT_FLOAT_EQ(closest_points(a, p, on_a, on_b), 0.25f);
+        EXPECT_TRUE(overlaps(a, p));
+
+        // Degenerate capsules are spheres
+        capsulef point{vec3f{0.0f, 0.0f, 2.0f}, vec3f{0.0f, 0.0f, 2.0f}, 1.0f};
+        EXPECT_FLOAT_EQ(closest_points(a, point, on_a, on_b), 4.0f);
+        EXPECT_FLOAT_EQ(closest_points(point, a, on_a, on_b), 4.0f);
+        EXPECT_FLOAT_EQ(closest_points(point, point, on_a, on_b), 0.0f);
+        EXPECT_FALSE(overlaps(a, point));
+        point.radius() = 1.75f;
+        EXPECT_TRUE(overlaps(point, a));
+
+        // Against the distance between densely sampled points
+        std::mt19937 gen{5};
+        std::uniform_real_distribution<float> dist{-2.0f, 2.0f};
+        for (unsigned i = 0; i < 100; ++i) {
+            capsulef x{vec3f{dist(gen), dist(gen), dist(gen)}, vec3f{dist(gen), dist(gen), dist(gen)}, 0.0f};
+            capsulef y{vec3f{dist(gen), dist(gen), dist(gen)}, vec3f{dist(gen), dist(gen), dist(gen)}, 0.0f};
+
+            float sampled = std::numeric_limits<float>::infinity();
+            for (unsigned s = 0; s <= 100; ++s) {
+                vec3f px = x.p0() + (x.p1() - x.p0()) * (s / 100.0f);
+                for (unsigned t = 0; t <= 100; ++t) {
+                    vec3f py = y.p0() + (y.p1() - y.p0()) * (t / 100.0f);
+                    sampled = std::min(sampled, length(py - px));
+                }
+            }
+
+            float d = std::sqrt(closest_points(x, y, on_a, on_b));
+            EXPECT_LE(d, sampled + 1e-5f) << i;
+            EXPECT_GE(d, sampled - 0.1f) << i;
+            EXPECT_NEAR(length(on_b - on_a), d, 1e-5f) << i;
+        }
+    }
+
+    TEST(Overlap, Batch) {
+        const std::size_t n = 3001;
+
+        std::mt19937 gen{7};
+        std::uniform_real_distribution<float> dist{-6.0f, 6.0f};
+        std::uniform_real_distribution<float> size{0.1f, 2.5f};
+
+        auto point = [&]() { return vec3f{dist(gen), dist(gen), dist(gen)}; };
+        auto extents = [&]() { return vec3f{size(gen), size(gen), size(gen)}; };
+
+        std::vector<spheref> spheres;
+        std::vector<aabb3f> boxes;
+        std::vector<obbf> obbs;
+        std::vector<capsulef> capsules;
+        for (std::size_t i = 0; i < n; ++i) {
+            spheres.push_back(spheref{point(), size(gen)});
+
+            vec3f c = point();
+            vec3f e = extents();
+            boxes.push_back(aabb3f{c - e, c + e});
+
+            obbs.push_back(obbf{point(), random_axes(gen), extents()});
+
+            vec3f p0 = point();
+            capsules.push_back(capsulef{p0, p0 + point() * 0.5f, size(gen) * 0.5f});
+        }
+
+        spheref sphere{vec3f{0.5f, -0.5f, 1.0f}, 4.0f};
+        expect_batch_matches(sphere, spheres);
+        expect_batch_matches(sphere, boxes);
+        expect_batch_matches(aabb3f{vec3f{-3.0f, -2.0f, -4.0f}, vec3f{2.0f, 3.0f, 1.0f}}, spheres);
+        expect_batch_matches(obbf{vec3f{1.0f, 0.0f, -1.0f}, random_axes(gen), vec3f{3.0f, 2.0f, 1.5f}}, obbs);
+        expect_batch_matches(capsulef{vec3f{-4.0f, 0.0f, 0.0f}, vec3f{4.0f, 1.0f, 0.0f}, 2.0f}, capsules);
+
+        // Lengths which leave partial groups and words
+        for (std::size_t m : {0, 1, 7, 17, 63, 64, 65, 130}) {
+            std::vector<spheref> head(spheres.begin(), spheres.begin() + m);
+            std::vector<std::uint64_t> mask((m + 63) / 64 + 1, ~std::uint64_t{0});
+            overlaps(sphere, head.data(), mask.data(), m);
+            for (std::size_t i = 0; i < m; ++i) {
+                EXPECT_EQ(mask_bit(mask, i), overlaps(sphere, head[i])) << m << ' ' << i;
+            }
+            EXPECT_EQ(mask.back(), ~std::uint64_t{0}) << m;
+        }
+    }
+
+}
+
+#endif
@@ -0,0 +1,160 @@
+#ifndef AVML_PARALLEL_TESTS_HPP
+#define AVML_PARALLEL_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <avml/Batch.hpp>
+
+#include "Test_helpers.hpp"
+
+namespace avml_tests {
+
+    using namespace avml;
+
+    TEST(Parallel, Thread_pool_covers_range) {
+        Thread_pool pool{3};
+
+        const std::size_t n = 100003;
+        std::vector<std::atomic<int>> hits(n);
+        for (auto& h : hits) {
+            h.store(0);
+        }
+
+        for (int pass = 0; pass < 8; ++pass) {
+            pool.parallel_for(n, 97, [&](std::size_t begin, std::size_t end) {
+                EXPECT_LE(end - begin, 97u);
+                for (std::size_t i = begin; i < end; ++i) {
+                    hits[i].fetch_add(1);
+                }
+            });
+        }
+
+        for (std::size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(hits[i].load(), 8);
+        }
+    }
+
+    TEST(Parallel, Thread_pool_nested) {
+        Thread_pool pool{2};
+
+        std::atomic<std::size_t> total{0};
+        pool.parallel_for(16, 1, [&](std::size_t, std::size_t) {
+            pool.parallel_for(1000, 10, [&](std::size_t begin, std::size_t end) {
+                total.fetch_add(end - begin);
+            });
+        });
+
+        EXPECT_EQ(total.load(), 16000u);
+    }
+
+    TEST(Parallel, Thread_pool_exceptions) {
+        Thread_pool pool{3};
+
+        for (int pass = 0; pass < 8; ++pass) {
+            std::atomic<std::size_t> total{0};
+            EXPECT_THROW(
+                pool.parallel_for(1000, 10, [&](std::size_t begin, std::size_t end) {
+                    total.fetch_add(end - begin);
+                    if (begin % 100 == 0) {
+                        throw std::runtime_error{"chunk failed"};
+                    }
+                }),
+                std::runtime_error
+            );
+
+            // Every chunk ran before the exception left parallel_for
+            EXPECT_EQ(total.load(), 1000u);
+        }
+
+        std::atomic<std::size_t> total{0};
+        pool.parallel_for(1000, 10, [&](std::size_t begin, std::size_t end) {
+            total.fetch_add(end - begin);
+        });
+        EXPECT_EQ(total.load(), 1000u);
+    }
+
+    TEST(Parallel, Batch_normalize) {
+        auto points = random_points(10007);
+        std::vector<uvec3f> serial(points.size());
+        std::vector<uvec3f> parallel(points.size());
+
+        Thread_pool pool{3};
+        normalize(points.data(), serial.data(), points.size());
+        normalize(points.data(), parallel.data(), points.size(), pool);
+
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            uvec3f expected = normalize(points[i]);
+            for (int j = 0; j < 3; ++j) {
+                EXPECT_NEAR(serial[i][j], expected[j], 1.0e-6f);
+                EXPECT_EQ(serial[i][j], parallel[i][j]);
+            }
+        }
+    }
+
+    TEST(Parallel, Batch_transform) {
+        auto points = random_points(5003);
+        std::vector<vec3f> moved(points.size());
+        std::vector<vec3f> turned(points.size());
+
+        mat4x4f m{
+            0.0f, -2.0f, 0.0f, 5.0f,
+            1.5f,  0.0f, 0.0f, -3.0f,
+            0.0f,  0.0f, 1.0f, 0.5f,
+            0.0f,  0.0f, 0.0f, 1.0f
+        };
+
+        Thread_pool pool{2};
+        transform_points(m, points.data(), moved.data(), points.size(), pool);
+        transform_vectors(m, points.data(), turned.data(), points.size());
+
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            vec3f p = points[i];
+            EXPECT_NEAR(moved[i][0], -2.0f * p[1] + 5.0f, 1.0e-4f);
+            EXPECT_NEAR(moved[i][1], 1.5f * p[0] - 3.0f, 1.0e-4f);
+            EXPECT_NEAR(moved[i][2], p[2] + 0.5f, 1.0e-4f);
+
+            EXPECT_NEAR(turned[i][0], -2.0f * p[1], 1.0e-4f);
+            EXPECT_NEAR(turned[i][1], 1.5f * p[0], 1.0e-4f);
+            EXPECT_NEAR(turned[i][2], p[2], 1.0e-4f);
+        }
+    }
+
+    TEST(Parallel, Batch_bounds) {
+        auto points = random_points(20011);
+        points[12345] = vec3f{-1000.0f, 7.0f, 2000.0f};
+
+        aabb3f expected = aabb3f::empty();
+        for (const vec3f& p : points) {
+            expected = extend(expected, p);
+        }
+
+        Thread_pool pool{3};
+        EXPECT_EQ(bounds(points.data(), points.size()), expected);
+        EXPECT_EQ(bounds(points.data(), points.size(), pool), expected);
+        EXPECT_EQ(bounds(points.data(), 5), bounds(points.data(), 5, pool));
+        EXPECT_TRUE(is_empty(bounds(points.data(), 0, pool)));
+    }
+
+    TEST(Parallel, Batch_encodings) {
+        auto points = random_points(9001);
+        std::vector<uvec3f> units(points.size());
+        normalize(points.data(), units.data(), points.size());
+
+        std::vector<std::uint32_t> serial(points.size());
+        std::vector<std::uint32_t> parallel(points.size());
+
+        Thread_pool pool{3};
+        encode_oct32(units.data(), serial.data(), units.size());
+        encode_oct32(units.data(), parallel.data(), units.size(), pool);
+        EXPECT_EQ(serial, parallel);
+    }
+
+}
+
+#endif //AVML_PARALLEL_TESTS_HPP
@@ -0,0 +1,200 @@
+#ifndef AVML_PLANES_TESTS_HPP
+#define AVML_PLANES_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "Test_helpers.hpp"
+
+namespace avml_tests {
+
+    using namespace avml;
+
+    TEST(Planes, Primitives) {
+        planef p = planef::from_point(uvec3f{0.0f, 0.0f, 1.0f}, vec3f{5.0f, -2.0f, 3.0f});
+        EXPECT_FLOAT_EQ(p.distance(), 3.0f);
+        EXPECT_FLOAT_EQ(signed_distance(p, vec3f{1.0f, 1.0f, 4.5f}), 1.5f);
+        EXPECT_FLOAT_EQ(signed_distance(p, vec3f{1.0f, 1.0f, 1.0f}), -2.0f);
+        EXPECT_EQ(closest_point(p, vec3f{1.0f, 2.0f, -4.0f}), (vec3f{1.0f, 2.0f, 3.0f}));
+
+        planef q = planef::from_points(vec3f{0.0f, 0.0f, 3.0f}, vec3f{1.0f, 0.0f, 3.0f}, vec3f{0.0f, 1.0f, 3.0f});
+        expect_near(vec3f{q.normal()[0], q.normal()[1], q.normal()[2]}, vec3f{0.0f, 0.0f, 1.0f}, 1e-6f, 0);
+        EXPECT_NEAR(q.distance(), 3.0f, 1e-6f);
+
+        EXPECT_EQ(classify(p, vec3f{0.0f, 0.0f, 3.05f}, 0.1f), Plane_side::on);
+        EXPECT_EQ(classify(p, vec3f{0.0f, 0.0f, 3.2f}, 0.1f), Plane_side::front);
+        EXPECT_EQ(classify(p, vec3f{0.0f, 0.0f, 2.8f}, 0.1f), Plane_side::back);
+
+        linef l = linef::from_points(vec3f{0.0f, 0.0f, 0.0f}, vec3f{2.0f, 0.0f, 0.0f});
+        EXPECT_EQ(closest_point(l, vec3f{-3.0f, 1.0f, 2.0f}), (vec3f{-3.0f, 0.0f, 0.0f}));
+
+        segmentf s{vec3f{0.0f, 0.0f, 0.0f}, vec3f{2.0f, 0.0f, 0.0f}};
+        EXPECT_EQ(closest_point(s, vec3f{-3.0f, 1.0f, 2.0f}), (vec3f{0.0f, 0.0f, 0.0f}));
+        EXPECT_EQ(closest_point(s, vec3f{1.5f, 1.0f, 2.0f}), (vec3f{1.5f, 0.0f, 0.0f}));
+        EXPECT_EQ(closest_point(s, vec3f{4.0f, 1.0f, 2.0f}), (vec3f{2.0f, 0.0f, 0.0f}));
+        EXPECT_EQ(closest_point(segmentf{vec3f{1.0f}, vec3f{1.0f}}, vec3f{4.0f}), vec3f{1.0f});
+
+        vec3f on_a, on_b;
+        EXPECT_FLOAT_EQ(closest_points(s, segmentf{vec3f{1.0f, -1.0f, 2.0f}, vec3f{1.0f, 1.0f, 2.0f}}, on_a, on_b), 4.0f);
+        EXPECT_EQ(on_a, (vec3f{1.0f, 0.0f, 0.0f}));
+        EXPECT_EQ(on_b, (vec3f{1.0f, 0.0f, 2.0f}));
+    }
+
+    TEST(Planes, Intersection) {
+        planef p{uvec3f{0.0f, 1.0f, 0.0f}, 1.0f};
+        float t = -1.0f;
+
+        EXPECT_TRUE(intersect(p, linef{vec3f{0.0f, 3.0f, 0.0f}, uvec3f{0.0f, -1.0f, 0.0f}}, t));
+        EXPECT_FLOAT_EQ(t, 2.0f);
+        EXPECT_FALSE(intersect(p, linef{vec3f{0.0f, 3.0f, 0.0f}, uvec3f{1.0f, 0.0f, 0.0f}}, t));
+
+        segmentf s{vec3f{0.0f, 3.0f, 0.0f}, vec3f{4.0f, -1.0f, 0.0f}};
+        EXPECT_TRUE(intersect(p, s, t));
+        EXPECT_FLOAT_EQ(t, 0.5f);
+        EXPECT_FALSE(intersect(p, segmentf{vec3f{0.0f, 3.0f, 0.0f}, vec3f{1.0f, 2.0f, 0.0f}}, t));
+        EXPECT_TRUE(intersect(p, segmentf{vec3f{0.0f, 1.0f, 0.0f}, vec3f{1.0f, 1.0f, 0.0f}}, t));
+        EXPECT_EQ(t, 0.0f);
+
+        // Only the part in front of the plane is kept
+        segmentf c = s;
+        EXPECT_TRUE(clip(p, c));
+        EXPECT_EQ(c.p0(), s.p0());
+        expect_near(c.p1(), vec3f{2.0f, 1.0f, 0.0f}, 1e-6f, 0);
+
+        c = segmentf{s.p1(), s.p0()};
+        EXPECT_TRUE(clip(p, c));
+        expect_near(c.p0(), vec3f{2.0f, 1.0f, 0.0f}, 1e-6f, 0);
+        EXPECT_EQ(c.p1(), s.p0());
+
+        segmentf behind{vec3f{0.0f, -3.0f, 0.0f}, vec3f{1.0f, 0.5f, 0.0f}};
+        c = behind;
+        EXPECT_FALSE(clip(p, c));
+        EXPECT_EQ(c, behind);
+
+        segmentf in_front{vec3f{0.0f, 3.0f, 0.0f}, vec3f{1.0f, 1.0f, 0.0f}};
+        c = in_front;
+        EXPECT_TRUE(clip(p, c));
+        EXPECT_EQ(c, in_front);
+    }
+
+    TEST(Planes, Batch) {
+        const std::size_t n = 1001;
+
+        std::mt19937 gen{23};
+        std::uniform_real_distribution<float> dist{-4.0f, 4.0f};
+        auto point = [&]() { return vec3f{dist(gen), dist(gen), dist(gen)}; };
+
+        std::vector<vec3f> points;
+        std::vector<segmentf> segments;
+        for (std::size_t i = 0; i < n; ++i) {
+            points.push_back(point());
+            segments.push_back(segmentf{point(), point()});
+        }
+
+        const planef plane = planef::from_point(normalize(vec3f{1.0f, -2.0f, 0.5f}), vec3f{0.5f, 0.0f, 1.0f});
+        const float epsilon = 0.5f;
+        Thread_pool pool{2};
+
+        std::vector<float> distances(n);
+        std::vector<float> pooled_distances(n);
+        signed_distances(plane, points.data(), distances.data(), n);
+        signed_distances(plane, points.data(), pooled_distances.data(), n, pool);
+        EXPECT_EQ(pooled_distances, distances);
+        for (std::size_t i = 0; i < n; ++i) {
+            EXPECT_NEAR(distances[i], signed_distance(plane, points[i]), 1e-5f) << i;
+        }
+
+        const std::size_t words = (n + 63) / 64;
+        std::vector<std::uint64_t> front(words, ~std::uint64_t{0});
+        std::vector<std::uint64_t> back(words, ~std::uint64_t{0});
+        std::vector<std::uint64_t> pooled_front(words, ~std::uint64_t{0});
+        std::vector<std::uint64_t> pooled_back(words, ~std::uint64_t{0});
+        classify(plane, points.data(), front.data(), back.data(), n, epsilon);
+        classify(plane, points.data(), pooled_front.data(), pooled_back.data(), n, epsilon, pool);
+        EXPECT_EQ(pooled_front, front);
+        EXPECT_EQ(pooled_back, back);
+
+        std::vector<std::uint32_t> expected[3];
+        for (std::size_t i = 0; i < n; ++i) {
+            Plane_side side = classify(plane, points[i], epsilon);
+            EXPECT_EQ(mask_bit(front, i), side == Plane_side::front) << i;
+            EXPECT_EQ(mask_bit(back, i), side == Plane_side::back) << i;
+            expected[static_cast<int>(side) + 1].push_back(static_cast<std::uint32_t>(i));
+        }
+        for (std::size_t i = n; i < 64 * words; ++i) {
+            EXPECT_FALSE(mask_bit(front, i)) << i;
+            EXPECT_FALSE(mask_bit(back, i)) << i;
+        }
+
+        for (Plane_side side : {Plane_side::back, Plane_side::on, Plane_side::front}) {
+            const std::vector<std::uint32_t>& e = expected[static_cast<int>(side) + 1];
+            EXPECT_GT(e.size(), n / 10);
+
+            std::vector<std::uint32_t> indices(n);
+            indices.resize(select(plane, points.data(), n, side, epsilon, indices.data()));
+            EXPECT_EQ(indices, e);
+        }
+
+        std::vector<segmentf> clipped(n);
+        std::vector<segmentf> pooled_clipped(segments);
+        std::vector<std::uint64_t> kept(words, ~std::uint64_t{0});
+        std::vector<std::uint64_t> pooled_kept(words, ~std::uint64_t{0});
+        clip(plane, segments.data(), clipped.data(), kept.data(), n);
+        clip(plane, pooled_clipped.data(), pooled_clipped.data(), pooled_kept.data(), n, pool);
+        EXPECT_EQ(pooled_clipped, clipped);
+        EXPECT_EQ(pooled_kept, kept);
+
+        std::size_t hits = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            segmentf s = segments[i];
+            bool expected_kept = clip(plane, s);
+            EXPECT_EQ(mask_bit(kept, i), expected_kept) << i;
+            expect_near(clipped[i].p0(), s.p0(), 1e-5f, i);
+            expect_near(clipped[i].p1(), s.p1(), 1e-5f, i);
+            hits += expected_kept;
+        }
+        EXPECT_GT(hits, n / 10);
+        EXPECT_LT(hits, n - n / 10);
+
+        const linef line = linef::from_points(vec3f{-1.0f, 2.0f, 0.0f}, vec3f{3.0f, 1.0f, 2.0f});
+        const segmentf segment{vec3f{-1.0f, 2.0f, 0.0f}, vec3f{3.0f, 1.0f, 2.0f}};
+
+        std::vector<vec3f> on_plane(n);
+        std::vector<vec3f> on_line(n);
+        std::vector<vec3f> on_segment(n);
+        closest_points(plane, points.data(), on_plane.data(), n);
+        closest_points(line, points.data(), on_line.data(), n);
+        closest_points(segment, points.data(), on_segment.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            expect_near(on_plane[i], closest_point(plane, points[i]), 1e-5f, i);
+            expect_near(on_line[i], closest_point(line, points[i]), 1e-5f, i);
+            expect_near(on_segment[i], closest_point(segment, points[i]), 1e-5f, i);
+        }
+
+        // In place
+        std::vector<vec3f> in_place(points);
+        closest_points(segment, in_place.data(), in_place.data(), n, pool);
+        EXPECT_EQ(in_place, on_segment);
+
+        // Lengths which leave partial groups and words
+        for (std::size_t m : {0, 1, 7, 17, 63, 64, 65, 130}) {
+            std::vector<std::uint64_t> f((m + 63) / 64 + 1, ~std::uint64_t{0});
+            std::vector<std::uint64_t> b((m + 63) / 64 + 1, ~std::uint64_t{0});
+            classify(plane, points.data(), f.data(), b.data(), m, epsilon);
+            for (std::size_t i = 0; i < m; ++i) {
+                EXPECT_EQ(mask_bit(f, i), mask_bit(front, i)) << m << ' ' << i;
+                EXPECT_EQ(mask_bit(b, i), mask_bit(back, i)) << m << ' ' << i;
+            }
+            EXPECT_EQ(f.back(), ~std::uint64_t{0}) << m;
+
+            std::vector<float> d(m + 1, -1.0f);
+            signed_distances(plane, points.data(), d.data(), m);
+            EXPECT_EQ(d.back(), -1.0f) << m;
+        }
+    }
+
+}
+
+#endif
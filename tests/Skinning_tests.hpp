@@ -0,0 +1,155 @@
+#ifndef AVML_SKINNING_TESTS_HPP
+#define AVML_SKINNING_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "Test_helpers.hpp"
+
+namespace avml_tests {
+
+    using namespace avml;
+
+    TEST(Dual_quaternion, Transforms) {
+        uvec4f r = axis_angle_quaternion(vec3f{1.0f, 2.0f, -0.5f}, 0.8f);
+        vec3f t{3.0f, -1.0f, 2.0f};
+        dualquatf q{r, t};
+
+        mat4x4f m = trs_matrix(t, r, vec3f{1.0f});
+        affine3x4f a{q};
+        for (unsigned i = 0; i < 3; ++i) {
+            for (unsigned j = 0; j < 4; ++j) {
+                EXPECT_NEAR(a[i][j], m[i][j], 1e-5f);
+            }
+        }
+
+        vec3f p{0.5f, -2.0f, 4.0f};
+        vec3f expected{
+            m[0][0] * p[0] + m[0][1] * p[1] + m[0][2] * p[2] + m[0][3],
+            m[1][0] * p[0] + m[1][1] * p[1] + m[1][2] * p[2] + m[1][3],
+            m[2][0] * p[0] + m[2][1] * p[1] + m[2][2] * p[2] + m[2][3]
+        };
+        expect_near(transform_point(q, p), expected, 1e-5f, 0);
+        expect_near(translation(q), t, 1e-5f, 0);
+
+        // Composition applies the right hand side first
+        dualquatf s{axis_angle_quaternion(vec3f{0.0f, 0.0f, 1.0f}, 1.3f), vec3f{-1.0f, 0.5f, 0.0f}};
+        expect_near(transform_point(q * s, p), transform_point(q, transform_point(s, p)), 1e-4f, 0);
+
+        // The conjugate of a unit dual quaternion is its inverse
+        expect_near(transform_point(conjugate(q), transform_point(q, p)), p, 1e-4f, 0);
+        expect_near(transform_point(dualquatf::identity(), p), p, 0.0f, 0);
+
+        dualquatf doubled{q.real() * 2.0f, q.dual() * 2.0f};
+        expect_near(transform_point(normalize(doubled), p), expected, 1e-5f, 0);
+    }
+
+    TEST(Skinning, Batch) {
+        const std::size_t bone_count = 7;
+        const std::size_t n = 75;
+
+        std::mt19937 gen{9};
+        std::uniform_real_distribution<float> dist{-3.0f, 3.0f};
+        std::uniform_int_distribution<std::uint32_t> bone{0, bone_count - 1};
+
+        std::vector<dualquatf> dq;
+        std::vector<affine3x4f> affine;
+        aligned_vector<mat4x4f> matrices;
+        for (std::size_t b = 0; b < bone_count; ++b) {
+            uvec4f r = axis_angle_quaternion(vec3f{dist(gen), dist(gen), dist(gen)}, dist(gen));
+            vec3f t{dist(gen), dist(gen), dist(gen)};
+
+            // Alternate signs to exercise the hemisphere correction
+            if (b % 2) {
+                r = uvec4f{-r[0], -r[1], -r[2], -r[3]};
+            }
+            dq.push_back(dualquatf{r, t});
+            affine.push_back(affine3x4f{dq.back()});
+            matrices.push_back(trs_matrix(t, r, vec3f{1.0f}));
+        }
+
+        std::vector<std::uint32_t> indices(4 * n);
+        std::vector<float> weights(4 * n);
+        std::vector<vec3f> positions(n);
+        std::vector<vec3f> normals(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            float sum = 0.0f;
+            for (unsigned k = 0; k < 4; ++k) {
+                indices[4 * i + k] = bone(gen);
+                weights[4 * i + k] = (k == 3 && i % 3 == 0) ? 0.0f : dist(gen) + 3.5f;
+                sum += weights[4 * i + k];
+            }
+            for (unsigned k = 0; k < 4; ++k) {
+                weights[4 * i + k] /= sum;
+            }
+            positions[i] = vec3f{dist(gen), dist(gen), dist(gen)};
+            vec3f nrm{dist(gen), dist(gen), dist(gen) + 4.0f};
+            normals[i] = nrm / length(nrm);
+        }
+
+        std::vector<vec3f> out_p(n), out_n(n), out_p2(n), out_n2(n);
+
+        // Linear blending, checked against blending matrices one vertex at a time
+        linear_blend_skinning(affine.data(), indices.data(), weights.data(), positions.data(), normals.data(), out_p.data(), out_n.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            vec3f p{0.0f}, nrm{0.0f};
+            for (unsigned k = 0; k < 4; ++k) {
+                const affine3x4f& a = affine[indices[4 * i + k]];
+                float w = weights[4 * i + k];
+                for (unsigned d = 0; d < 3; ++d) {
+                    p[d] += w * (a[d][0] * positions[i][0] + a[d][1] * positions[i][1] + a[d][2] * positions[i][2] + a[d][3]);
+                    nrm[d] += w * (a[d][0] * normals[i][0] + a[d][1] * normals[i][1] + a[d][2] * normals[i][2]);
+                }
+            }
+            expect_near(out_p[i], p, 1e-4f, i);
+            expect_near(out_n[i], nrm / length(nrm), 1e-4f, i);
+        }
+
+        linear_blend_skinning(matrices.data(), indices.data(), weights.data(), positions.data(), nullptr, out_p2.data(), nullptr, n);
+        for (std::size_t i = 0; i < n; ++i) {
+            expect_near(out_p2[i], out_p[i], 1e-4f, i);
+        }
+
+        // Dual quaternion blending, checked against blending dual quaternions
+        dual_quaternion_skinning(dq.data(), indices.data(), weights.data(), positions.data(), normals.data(), out_p.data(), out_n.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            const dualquatf& first = dq[indices[4 * i]];
+            vec4f real{0.0f}, dual{0.0f};
+            for (unsigned k = 0; k < 4; ++k) {
+                const dualquatf& q = dq[indices[4 * i + k]];
+                float w = weights[4 * i + k];
+                if (dot(q.real(), first.real()) < 0.0f) {
+                    w = -w;
+                }
+                real = real + q.real() * w;
+                dual = dual + q.dual() * w;
+            }
+            dualquatf blended = normalize(dualquatf{real, dual});
+
+            expect_near(out_p[i], transform_point(blended, positions[i]), 1e-4f, i);
+            expect_near(out_n[i], transform_vector(blended, normals[i]), 1e-4f, i);
+            EXPECT_NEAR(length(out_n[i]), 1.0f, 1e-5f) << i;
+        }
+
+        Thread_pool pool{2};
+        dual_quaternion_skinning(dq.data(), indices.data(), weights.data(), positions.data(), normals.data(), out_p2.data(), out_n2.data(), n, pool);
+        for (std::size_t i = 0; i < n; ++i) {
+            expect_near(out_p2[i], out_p[i], 1e-5f, i);
+            expect_near(out_n2[i], out_n[i], 1e-5f, i);
+        }
+
+        // A single rigid bone gives the same result under both methods
+        std::vector<std::uint32_t> single(4 * n, 3);
+        linear_blend_skinning(affine.data(), single.data(), weights.data(), positions.data(), nullptr, out_p.data(), nullptr, n, pool);
+        dual_quaternion_skinning(dq.data(), single.data(), weights.data(), positions.data(), nullptr, out_p2.data(), nullptr, n);
+        for (std::size_t i = 0; i < n; ++i) {
+            expect_near(out_p2[i], out_p[i], 1e-4f, i);
+        }
+    }
+
+}
+
+#endif
@@ -0,0 +1,159 @@
+#ifndef AVML_SPATIAL_TESTS_HPP
+#define AVML_SPATIAL_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "Test_helpers.hpp"
+
+namespace avml_tests {
+
+    using namespace avml;
+
+    inline std::uint64_t naive_morton(vec3u v, unsigned bits) {
+        std::uint64_t ret = 0;
+        for (unsigned b = 0; b < bits; ++b) {
+            ret |= std::uint64_t((v[0] >> b) & 1) << (3 * b + 2);
+            ret |= std::uint64_t((v[1] >> b) & 1) << (3 * b + 1);
+            ret |= std::uint64_t((v[2] >> b) & 1) << (3 * b + 0);
+        }
+        return ret;
+    }
+
+    TEST(Spatial, Quantize) {
+        aabb3f bounds{vec3f{-1.0f, 0.0f, 2.0f}, vec3f{1.0f, 4.0f, 2.0f}};
+
+        EXPECT_EQ(quantize(bounds, vec3f{-1.0f, 0.0f, 2.0f}, 10), (vec3u{0, 0, 0}));
+        EXPECT_EQ(quantize(bounds, vec3f{1.0f, 4.0f, 2.0f}, 10), (vec3u{1023, 1023, 0}));
+        EXPECT_EQ(quantize(bounds, vec3f{0.0f, 1.0f, 7.0f}, 10), (vec3u{512, 256, 0}));
+        EXPECT_EQ(quantize(bounds, vec3f{-5.0f, 9.0f, 0.0f}, 4), (vec3u{0, 15, 0}));
+    }
+
+    TEST(Spatial, Morton) {
+        std::mt19937 gen{1};
+        std::uniform_int_distribution<std::uint32_t> dist{0, (1u << 21) - 1};
+
+        for (unsigned i = 0; i < 1000; ++i) {
+            vec3u v{dist(gen), dist(gen), dist(gen)};
+            vec3u v10{v[0] & 0x3FF, v[1] & 0x3FF, v[2] & 0x3FF};
+
+            std::uint32_t code30 = morton_encode30(v10);
+            std::uint64_t code63 = morton_encode63(v);
+
+            EXPECT_EQ(code30, naive_morton(v10, 10));
+            EXPECT_EQ(code63, naive_morton(v, 21));
+            EXPECT_EQ(morton_decode30(code30), v10);
+            EXPECT_EQ(morton_decode63(code63), v);
+        }
+    }
+
+    TEST(Spatial, Hilbert) {
+        // Every cell of a 16^3 grid is visited once and consecutive codes
+        // are face neighbours
+        const unsigned cells = 16;
+        std::vector<bool> visited(cells * cells * cells, false);
+
+        vec3u previous = hilbert_decode30(0);
+        for (std::uint32_t code = 0; code < cells * cells * cells; ++code) {
+            // A 16^3 grid is the prefix of the 1024^3 curve scaled by 64
+            vec3u v = hilbert_decode30(code << 18);
+            for (unsigned i = 0; i < 3; ++i) {
+                v[i] >>= 6;
+            }
+            ASSERT_LT(v[0], cells);
+            ASSERT_LT(v[1], cells);
+            ASSERT_LT(v[2], cells);
+
+            std::uint32_t index = (v[0] * cells + v[1]) * cells + v[2];
+            EXPECT_FALSE(visited[index]);
+            visited[index] = true;
+
+            if (code != 0) {
+                unsigned distance = 0;
+                for (unsigned i = 0; i < 3; ++i) {
+                    distance += (v[i] > previous[i]) ? v[i] - previous[i] : previous[i] - v[i];
+                }
+                EXPECT_EQ(distance, 1u) << "code " << code;
+            }
+            previous = v;
+        }
+
+        std::mt19937 gen{2};
+        std::uniform_int_distribution<std::uint32_t> dist{0, (1u << 21) - 1};
+        for (unsigned i = 0; i < 1000; ++i) {
+            vec3u v{dist(gen), dist(gen), dist(gen)};
+            vec3u v10{v[0] & 0x3FF, v[1] & 0x3FF, v[2] & 0x3FF};
+
+            EXPECT_EQ(hilbert_decode30(hilbert_encode30(v10)), v10);
+            EXPECT_EQ(hilbert_decode63(hilbert_encode63(v)), v);
+        }
+    }
+
+    TEST(Spatial, Batch_codes) {
+        const std::size_t n = 101;
+        std::vector<vec3f> points = random_points(n, 3);
+        points[7] = vec3f{-200.0f, 200.0f, 0.0f};
+
+        // Most points are inside, a few are clamped
+        aabb3f bounds{vec3f{-90.0f}, vec3f{80.0f}};
+
+        std::vector<std::uint32_t> m30(n);
+        std::vector<std::uint64_t> m63(n);
+        std::vector<std::uint32_t> h30(n);
+        std::vector<std::uint64_t> h63(n);
+
+        morton_codes30(bounds, points.data(), m30.data(), n);
+        morton_codes63(bounds, points.data(), m63.data(), n);
+        hilbert_codes30(bounds, points.data(), h30.data(), n);
+        hilbert_codes63(bounds, points.data(), h63.data(), n);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(m30[i], morton_encode30(quantize(bounds, points[i], 10))) << i;
+            EXPECT_EQ(m63[i], morton_encode63(quantize(bounds, points[i], 21))) << i;
+            EXPECT_EQ(h30[i], hilbert_encode30(quantize(bounds, points[i], 10))) << i;
+            EXPECT_EQ(h63[i], hilbert_encode63(quantize(bounds, points[i], 21))) << i;
+        }
+
+        Thread_pool pool{2};
+        std::vector<std::uint64_t> parallel(n);
+        morton_codes63(bounds, points.data(), parallel.data(), n, pool);
+        EXPECT_EQ(parallel, m63);
+    }
+
+    TEST(Spatial, Radix_sort) {
+        std::mt19937 gen{4};
+        std::uniform_int_distribution<std::uint32_t> dist{0, (1u << 30) - 1};
+
+        const std::size_t n = 1000;
+        std::vector<std::uint32_t> keys(n);
+        std::vector<std::uint32_t> values(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            keys[i] = dist(gen) & 0x3FFF00FF;
+            values[i] = static_cast<std::uint32_t>(i);
+        }
+        std::vector<std::uint32_t> original = keys;
+
+        radix_sort(keys.data(), values.data(), n);
+
+        EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+        for (std::size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(keys[i], original[values[i]]);
+        }
+
+        std::vector<std::uint64_t> wide(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            wide[i] = (std::uint64_t(original[i]) << 33) | (i % 3);
+        }
+        std::vector<std::uint64_t> expected = wide;
+        std::sort(expected.begin(), expected.end());
+
+        radix_sort(wide.data(), nullptr, n);
+        EXPECT_EQ(wide, expected);
+    }
+
+}
+
+#endif
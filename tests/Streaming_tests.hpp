@@ -0,0 +1,173 @@
+#ifndef AVML_STREAMING_TESTS_HPP
+#define AVML_STREAMING_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <avml/Streaming.hpp>
+
+namespace avml_tests {
+
+    using namespace avml;
+
+    template<class R>
+    std::vector<R> random_coordinates(std::size_t n) {
+        std::mt19937 gen{523};
+        std::uniform_real_distribution<R> dist{R(-50), R(50)};
+
+        std::vector<R> ret(3 * n);
+        for (R& x : ret) {
+            x = dist(gen);
+        }
+        return ret;
+    }
+
+    template<class R>
+    bool write_file(const std::string& path, const std::vector<R>& data) {
+        std::FILE* f = std::fopen(path.c_str(), "wb");
+        if (!f) {
+            return false;
+        }
+        std::size_t written = std::fwrite(data.data(), sizeof(R), data.size(), f);
+        std::fclose(f);
+        return written == data.size();
+    }
+
+    inline const mat4x4f& stream_test_matrix() {
+        static const mat4x4f m{
+            0.0f, -2.0f, 0.0f, 5.0f,
+            1.5f,  0.0f, 0.0f, -3.0f,
+            0.0f,  0.0f, 1.0f, 0.5f,
+            0.0f,  0.0f, 0.0f, 1.0f
+        };
+        return m;
+    }
+
+    TEST(Streaming, Transform_array_offsets) {
+        const std::size_t n = 1000;
+        auto in = random_coordinates<float>(n);
+        std::vector<float> out(3 * n + 64);
+
+        // Every alignment of the output relative to the non-temporal stores
+        for (std::size_t offset = 0; offset < 16; ++offset) {
+            aabb3f b = stream_transform(stream_test_matrix(), in.data(), out.data() + offset, n - offset);
+
+            aabb3f expected = aabb3f::empty();
+            for (std::size_t i = 0; i < n - offset; ++i) {
+                vec3f p = vec3f::read(in.data() + 3 * i);
+                vec3f q{-2.0f * p[1] + 5.0f, 1.5f * p[0] - 3.0f, p[2] + 0.5f};
+                expected = extend(expected, vec3f::read(out.data() + offset + 3 * i));
+
+                for (int j = 0; j < 3; ++j) {
+                    EXPECT_NEAR(out[offset + 3 * i + j], q[j], 1.0e-4f);
+                }
+            }
+
+            EXPECT_EQ(b, expected);
+        }
+    }
+
+    TEST(Streaming, Transform_file) {
+        const std::size_t n = 100003;
+        auto in = random_coordinates<double>(n);
+
+        const std::string in_path = ::testing::TempDir() + "avml_stream_in.bin";
+        const std::string out_path = ::testing::TempDir() + "avml_stream_out.bin";
+        ASSERT_TRUE(write_file(in_path, in));
+
+        mat4x4d m{
+            1.0, 0.0, 0.0, 10.0,
+            0.0, 2.0, 0.0, 0.0,
+            0.0, 0.0, 1.0, -1.0,
+            0.0, 0.0, 0.0, 1.0
+        };
+
+        Thread_pool pool{3};
+        aabb3d b = aabb3d::empty();
+        ASSERT_TRUE(transform_file(in_path.c_str(), out_path.c_str(), m, pool, &b));
+
+        Mapped_file out = Mapped_file::open_read(out_path.c_str());
+        ASSERT_TRUE(out.is_open());
+        ASSERT_EQ(out.size(), in.size() * sizeof(double));
+
+        const double* result = static_cast<const double*>(out.data());
+        aabb3d expected = aabb3d::empty();
+        for (std::size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(result[3 * i + 0], in[3 * i + 0] + 10.0);
+            EXPECT_EQ(result[3 * i + 1], in[3 * i + 1] * 2.0);
+            EXPECT_EQ(result[3 * i + 2], in[3 * i + 2] - 1.0);
+            expected = extend(expected, vec3d::read(result + 3 * i));
+        }
+        EXPECT_EQ(b, expected);
+
+        out.close();
+        std::remove(in_path.c_str());
+        std::remove(out_path.c_str());
+
+        EXPECT_FALSE(transform_file(in_path.c_str(), out_path.c_str(), m));
+    }
+
+    template<class R>
+    void expect_quantize_clamps() {
+        // Long enough to cover the unaligned head, SIMD body and scalar tail
+        const std::size_t n = 37;
+        std::vector<R> in(3 * n);
+        for (std::size_t i = 0; i < n; ++i) {
+            in[3 * i + 0] = (i % 2) ? std::numeric_limits<R>::quiet_NaN() : R(2);
+            in[3 * i + 1] = R(-5);
+            in[3 * i + 2] = (i % 3) ? R(5) : std::numeric_limits<R>::quiet_NaN();
+        }
+
+        const Aabb3R<R> box{Vector3R<R>{R(0)}, Vector3R<R>{R(4)}};
+        std::vector<std::uint16_t> out(3 * n + 1);
+        stream_quantize(box, in.data(), out.data() + 1, n);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            const std::uint16_t* q = out.data() + 1 + 3 * i;
+            EXPECT_EQ(q[0], (i % 2) ? 0u : 32768u) << i;
+            EXPECT_EQ(q[1], 0u) << i;
+            EXPECT_EQ(q[2], (i % 3) ? 65535u : 0u) << i;
+        }
+    }
+
+    TEST(Streaming, Quantize_clamps) {
+        expect_quantize_clamps<float>();
+        expect_quantize_clamps<double>();
+    }
+
+    TEST(Streaming, Quantize_file) {
+        const std::size_t n = 20011;
+        auto in = random_coordinates<float>(n);
+
+        const std::string in_path = ::testing::TempDir() + "avml_quantize_in.bin";
+        const std::string out_path = ::testing::TempDir() + "avml_quantize_out.bin";
+        ASSERT_TRUE(write_file(in_path, in));
+
+        aabb3f box = bounds(reinterpret_cast<const vec3f*>(in.data()), n);
+        ASSERT_TRUE(quantize_file(in_path.c_str(), out_path.c_str(), box));
+
+        Mapped_file out = Mapped_file::open_read(out_path.c_str());
+        ASSERT_EQ(out.size(), 3 * n * sizeof(std::uint16_t));
+
+        const std::uint16_t* q = static_cast<const std::uint16_t*>(out.data());
+        vec3f step = extent(box) / 65535.0f;
+        for (std::size_t i = 0; i < n; ++i) {
+            vec3f p = dequantize(box, q + 3 * i);
+            for (int j = 0; j < 3; ++j) {
+                EXPECT_NEAR(p[j], in[3 * i + j], step[j] * 0.5f + 1.0e-4f);
+            }
+        }
+
+        out.close();
+        std::remove(in_path.c_str());
+        std::remove(out_path.c_str());
+    }
+
+}
+
+#endif //AVML_STREAMING_TESTS_HPP
@@ -0,0 +1,75 @@
+#ifndef AVML_TEST_HELPERS_HPP
+#define AVML_TEST_HELPERS_HPP
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <avml/AVML.hpp>
+
+namespace avml_tests {
+
+    using namespace avml;
+
+    //=====================================================
+    // Inputs
+    //=====================================================
+
+    inline std::vector<vec3f> random_points(std::size_t n, unsigned seed = 311) {
+        std::mt19937 gen{seed};
+        std::uniform_real_distribution<float> dist{-100.0f, 100.0f};
+
+        std::vector<vec3f> ret;
+        ret.reserve(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            ret.push_back(vec3f{dist(gen), dist(gen), dist(gen)});
+        }
+        return ret;
+    }
+
+    inline uvec4f axis_angle_quaternion(vec3f axis, float angle) {
+        vec3f a = axis / length(axis);
+        float s = std::sin(angle * 0.5f);
+        return uvec4f{a[0] * s, a[1] * s, a[2] * s, std::cos(angle * 0.5f)};
+    }
+
+    inline mat3x3f random_axes(std::mt19937& gen) {
+        std::uniform_real_distribution<float> dist{-3.0f, 3.0f};
+
+        uvec4f r = axis_angle_quaternion(vec3f{dist(gen), dist(gen), dist(gen) + 0.5f}, dist(gen));
+        affine3x4f a = trs_affine(vec3f{0.0f}, r, vec3f{1.0f});
+        return mat3x3f{
+            vec3f{a[0][0], a[1][0], a[2][0]},
+            vec3f{a[0][1], a[1][1], a[2][1]},
+            vec3f{a[0][2], a[1][2], a[2][2]}
+        };
+    }
+
+    //=====================================================
+    // Comparisons
+    //=====================================================
+
+    inline bool mask_bit(const std::vector<std::uint64_t>& mask, std::size_t i) {
+        return (mask[i / 64] >> (i % 64)) & 1;
+    }
+
+    inline void expect_near(vec3f a, vec3f b, float e, std::size_t i) {
+        EXPECT_NEAR(a[0], b[0], e) << i;
+        EXPECT_NEAR(a[1], b[1], e) << i;
+        EXPECT_NEAR(a[2], b[2], e) << i;
+    }
+
+    inline void expect_near(const mat4x4f& a, const mat4x4f& b, float tolerance) {
+        for (unsigned i = 0; i < 4; ++i) {
+            for (unsigned j = 0; j < 4; ++j) {
+                EXPECT_NEAR(a[i][j], b[i][j], tolerance) << "element " << i << ", " << j;
+            }
+        }
+    }
+
+}
+
+#endif //AVML_TEST_HELPERS_HPP
@@ -0,0 +1,82 @@
+#ifndef AVML_TRANSFORMS_TESTS_HPP
+#define AVML_TRANSFORMS_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "Test_helpers.hpp"
+
+namespace avml_tests {
+
+    using namespace avml;
+
+    inline vec3f project_point(const mat4x4f& m, vec3f p) {
+        vec4f v = m * vec4f{p, 1.0f};
+        return vec3f{v[0] / v[3], v[1] / v[3], v[2] / v[3]};
+    }
+
+    TEST(Transforms, Trs_axis_angle) {
+        vec3f t{1.0f, -2.0f, 3.0f};
+        vec3f s{2.0f, 0.5f, 1.5f};
+        uvec3f axis = normalize(vec3f{0.3f, 1.0f, -0.4f});
+
+        mat4x4f expected = translation_matrix(t) * rotation_matrix(axis, 0.8f) * scaling_matrix(s);
+        expect_near(trs_matrix(t, axis, 0.8f, s), expected, 1.0e-5f);
+        EXPECT_EQ(static_cast<mat4x4f>(trs_affine(t, axis, 0.8f, s)), trs_matrix(t, axis, 0.8f, s));
+    }
+
+    TEST(Transforms, Trs_quaternion) {
+        vec3f t{1.0f, -2.0f, 3.0f};
+        vec3f s{2.0f, 0.5f, 1.5f};
+        uvec3f axis = normalize(vec3f{0.3f, 1.0f, -0.4f});
+
+        float half = 0.4f;
+        uvec4f q{axis[0] * std::sin(half), axis[1] * std::sin(half), axis[2] * std::sin(half), std::cos(half)};
+
+        mat4x4f expected = translation_matrix(t) * rotation_matrix(axis, 0.8f) * scaling_matrix(s);
+        expect_near(trs_matrix(t, q, s), expected, 1.0e-5f);
+    }
+
+    TEST(Transforms, Look_at) {
+        vec3f eye{1.0f, 2.0f, 3.0f};
+        vec3f target{4.0f, 2.0f, -1.0f};
+        mat4x4f view = look_at(eye, target, vec3f{0.0f, 1.0f, 0.0f});
+
+        vec3f e = project_point(view, eye);
+        vec3f f = project_point(view, target);
+        for (unsigned i = 0; i < 3; ++i) {
+            EXPECT_NEAR(e[i], 0.0f, 1.0e-5f);
+        }
+
+        EXPECT_NEAR(f[0], 0.0f, 1.0e-5f);
+        EXPECT_NEAR(f[1], 0.0f, 1.0e-5f);
+        EXPECT_NEAR(f[2], -5.0f, 1.0e-5f);
+    }
+
+    TEST(Transforms, Perspective) {
+        mat4x4f p = perspective(1.2f, 1.5f, 0.5f, 100.0f);
+
+        EXPECT_NEAR(project_point(p, vec3f{0.0f, 0.0f, -0.5f})[2], -1.0f, 1.0e-5f);
+        EXPECT_NEAR(project_point(p, vec3f{0.0f, 0.0f, -100.0f})[2], 1.0f, 1.0e-4f);
+
+        // Top edge of the view frustum maps to y = 1
+        float y = 10.0f * std::tan(0.6f);
+        EXPECT_NEAR(project_point(p, vec3f{0.0f, y, -10.0f})[1], 1.0f, 1.0e-5f);
+        EXPECT_NEAR(project_point(p, vec3f{1.5f * y, 0.0f, -10.0f})[0], 1.0f, 1.0e-5f);
+    }
+
+    TEST(Transforms, Orthographic) {
+        mat4x4f o = orthographic(-2.0f, 4.0f, -1.0f, 3.0f, 0.5f, 10.0f);
+
+        vec3f lo = project_point(o, vec3f{-2.0f, -1.0f, -0.5f});
+        vec3f hi = project_point(o, vec3f{4.0f, 3.0f, -10.0f});
+        for (unsigned i = 0; i < 3; ++i) {
+            EXPECT_NEAR(lo[i], -1.0f, 1.0e-5f);
+            EXPECT_NEAR(hi[i], 1.0f, 1.0e-5f);
+        }
+    }
+
+}
+
+#endif //AVML_TRANSFORMS_TESTS_HPP
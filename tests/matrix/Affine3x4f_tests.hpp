@@ -0,0 +1,106 @@
+#ifndef AVML_AFFINE3X4F_TESTS_HPP
+#define AVML_AFFINE3X4F_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+namespace avml_tests {
+
+    using namespace avml;
+
+    inline void expect_near(const affine3x4f& a, const affine3x4f& b, float tolerance) {
+        for (unsigned i = 0; i < 3; ++i) {
+            for (unsigned j = 0; j < 4; ++j) {
+                EXPECT_NEAR(a[i][j], b[i][j], tolerance) << "element " << i << ", " << j;
+            }
+        }
+    }
+
+    inline affine3x4f test_rigid_transform() {
+        uvec3f axis = normalize(vec3f{1.0f, -2.0f, 0.5f});
+        return affine3x4f{translation_matrix(3.0f, -1.0f, 2.5f) * rotation_matrix(axis, 0.7f)};
+    }
+
+    TEST(Affine3x4f, Layout) {
+        EXPECT_EQ(sizeof(affine3x4f), 48u);
+    }
+
+    TEST(Affine3x4f, Conversion) {
+        mat4x4f m = translation_matrix(1.0f, 2.0f, 3.0f) * scaling_matrix(2.0f, 3.0f, 4.0f);
+        affine3x4f a{m};
+
+        EXPECT_EQ(static_cast<mat4x4f>(a), m);
+        EXPECT_EQ(translation(a), (vec3f{1.0f, 2.0f, 3.0f}));
+        EXPECT_FLOAT_EQ(determinant(a), 24.0f);
+    }
+
+    TEST(Affine3x4f, Composition) {
+        mat4x4f m0 = translation_matrix(1.0f, 2.0f, 3.0f) * x_rotation_matrix(0.3f) * scaling_matrix(2.0f, 1.0f, 0.5f);
+        mat4x4f m1 = translation_matrix(-4.0f, 0.5f, 1.0f) * y_rotation_matrix(1.1f);
+
+        affine3x4f a0{m0};
+        affine3x4f a1{m1};
+
+        expect_near(a0 * a1, affine3x4f{m0 * m1}, 1.0e-5f);
+
+        affine3x4f a2 = a0;
+        a2 *= a1;
+        expect_near(a2, affine3x4f{m0 * m1}, 1.0e-5f);
+
+        vec3f p{0.5f, -1.5f, 2.0f};
+        vec4f mp = m0 * vec4f{p, 1.0f};
+        vec4f mv = m0 * vec4f{p, 0.0f};
+        vec3f tp = transform_point(a0, p);
+        vec3f tv = transform_vector(a0, p);
+        for (unsigned i = 0; i < 3; ++i) {
+            EXPECT_NEAR(tp[i], mp[i], 1.0e-5f);
+            EXPECT_NEAR(tv[i], mv[i], 1.0e-5f);
+        }
+    }
+
+    TEST(Affine3x4f, Inverse) {
+        mat4x4f m{
+            2.0f, 0.5f, -1.0f, 3.0f,
+            0.25f, 1.5f, 0.75f, -2.0f,
+            -0.5f, 1.0f, 3.0f, 1.0f,
+            0.0f, 0.0f, 0.0f, 1.0f
+        };
+        affine3x4f a{m};
+
+        expect_near(inverse(a), affine3x4f{inverse(m)}, 1.0e-5f);
+        expect_near(a * inverse(a), affine3x4f{1.0f}, 1.0e-5f);
+    }
+
+    TEST(Affine3x4f, Rigid_inverse) {
+        affine3x4f a = test_rigid_transform();
+
+        expect_near(rigid_inverse(a), inverse(a), 1.0e-5f);
+        expect_near(a * rigid_inverse(a), affine3x4f{1.0f}, 1.0e-5f);
+    }
+
+    TEST(Affine3x4f, Scaled_inverse) {
+        affine3x4f a = test_rigid_transform() * affine3x4f{scaling_matrix(2.0f, 0.5f, 3.0f)};
+
+        expect_near(scaled_inverse(a), inverse(a), 1.0e-5f);
+        expect_near(a * scaled_inverse(a), affine3x4f{1.0f}, 1.0e-5f);
+    }
+
+    TEST(Affine3x4d, Inverse) {
+        affine3x4d a{
+            2.0, 0.5, -1.0, 3.0,
+            0.25, 1.5, 0.75, -2.0,
+            -0.5, 1.0, 3.0, 1.0
+        };
+
+        affine3x4d identity = a * inverse(a);
+        for (unsigned i = 0; i < 3; ++i) {
+            for (unsigned j = 0; j < 4; ++j) {
+                EXPECT_NEAR(identity[i][j], (i == j) ? 1.0 : 0.0, 1.0e-12);
+            }
+        }
+    }
+
+}
+
+#endif //AVML_AFFINE3X4F_TESTS_HPP
@@ -0,0 +1,241 @@
+#ifndef AVML_LINEAR_SYSTEM_TESTS_HPP
+#define AVML_LINEAR_SYSTEM_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+namespace avml_tests {
+
+    using namespace avml;
+
+    ///
+    /// \return Random symmetric positive definite matrix of size n stored
+    /// row-major into out
+    inline void random_spd(std::mt19937& gen, unsigned n, float* out) {
+        std::uniform_real_distribution<float> dist{-1.0f, 1.0f};
+
+        std::vector<float> m(n * n);
+        for (float& e : m) {
+            e = dist(gen);
+        }
+
+        for (unsigned i = 0; i < n; ++i) {
+            for (unsigned j = 0; j < n; ++j) {
+                float sum = (i == j) ? float(n) : 0.0f;
+                for (unsigned k = 0; k < n; ++k) {
+                    sum += m[i * n + k] * m[j * n + k];
+                }
+                out[i * n + j] = sum;
+            }
+        }
+    }
+
+    inline void random_general(std::mt19937& gen, unsigned n, float* out) {
+        std::uniform_real_distribution<float> dist{-2.0f, 2.0f};
+        for (unsigned i = 0; i < n * n; ++i) {
+            out[i] = dist(gen);
+        }
+    }
+
+    inline void expect_solution(unsigned n, const float* a, const float* b, const float* x, float tolerance) {
+        for (unsigned i = 0; i < n; ++i) {
+            float sum = 0.0f;
+            for (unsigned j = 0; j < n; ++j) {
+                sum += a[i * n + j] * x[j];
+            }
+            EXPECT_NEAR(sum, b[i], tolerance) << "row " << i;
+        }
+    }
+
+    TEST(Linear_systems, Cholesky) {
+        std::mt19937 gen{3};
+
+        mat4x4f a;
+        random_spd(gen, 4, a.data());
+
+        mat4x4f l;
+        ASSERT_TRUE(cholesky(a, l));
+
+        for (unsigned i = 0; i < 4; ++i) {
+            for (unsigned j = i + 1; j < 4; ++j) {
+                EXPECT_EQ(l[i][j], 0.0f);
+            }
+        }
+        mat4x4f product = l * transpose(l);
+        for (unsigned i = 0; i < 16; ++i) {
+            EXPECT_NEAR(product.data()[i], a.data()[i], 1.0e-4f);
+        }
+
+        vec4f b{1.0f, -2.0f, 3.0f, 0.5f};
+        vec4f x = cholesky_solve(l, b);
+        expect_solution(4, a.data(), b.data(), x.data(), 1.0e-4f);
+
+        mat3x3f indefinite{
+            1.0f, 2.0f, 0.0f,
+            2.0f, 1.0f, 0.0f,
+            0.0f, 0.0f, 1.0f
+        };
+        mat3x3f untouched{7.0f};
+        EXPECT_FALSE(cholesky(indefinite, untouched));
+        EXPECT_EQ(untouched, mat3x3f{7.0f});
+    }
+
+    TEST(Linear_systems, Lu) {
+        // Zero leading element forces a pivot
+        mat3x3f a{
+            0.0f, 2.0f, 1.0f,
+            1.0f, 1.0f, 1.0f,
+            4.0f, -1.0f, 3.0f
+        };
+
+        mat3x3f factors;
+        unsigned permutation[3];
+        ASSERT_TRUE(lu(a, factors, permutation));
+        EXPECT_EQ(permutation[0], 2u);
+
+        for (unsigned i = 0; i < 3; ++i) {
+            for (unsigned j = 0; j < 3; ++j) {
+                float sum = 0.0f;
+                for (unsigned k = 0; k <= std::min(i, j); ++k) {
+                    float l = (k == i) ? 1.0f : factors[i][k];
+                    sum += l * factors[k][j];
+                }
+                EXPECT_NEAR(sum, a[permutation[i]][j], 1.0e-5f);
+            }
+        }
+
+        vec3f b{1.0f, 2.0f, 3.0f};
+        vec3f x = lu_solve(factors, permutation, b);
+        expect_solution(3, a.data(), b.data(), x.data(), 1.0e-5f);
+
+        mat3x3f singular{
+            1.0f, 2.0f, 3.0f,
+            2.0f, 4.0f, 6.0f,
+            0.0f, 1.0f, 1.0f
+        };
+        EXPECT_FALSE(lu(singular, factors, permutation));
+
+        vec3f untouched{5.0f};
+        EXPECT_FALSE(solve(singular, b, untouched));
+        EXPECT_EQ(untouched, vec3f{5.0f});
+
+        // Singular, but rounding leaves a tiny non-zero last pivot
+        mat3x3f rank2{
+            1.0f, 2.0f, 3.0f,
+            4.0f, 5.0f, 6.0f,
+            7.0f, 8.0f, 9.0f
+        };
+        EXPECT_FALSE(lu(rank2, factors, permutation));
+        EXPECT_FALSE(solve(rank2, vec3f{1.0f, 0.0f, 0.0f}, untouched));
+        EXPECT_EQ(untouched, vec3f{5.0f});
+
+        mat3x3d rank2d{
+            1.0, 2.0, 3.0,
+            4.0, 5.0, 6.0,
+            7.0, 8.0, 9.0
+        };
+        vec3d untouched_d{5.0};
+        EXPECT_FALSE(solve(rank2d, vec3d{1.0, 0.0, 0.0}, untouched_d));
+        EXPECT_EQ(untouched_d, vec3d{5.0});
+    }
+
+    TEST(Linear_systems, Solve) {
+        std::mt19937 gen{5};
+
+        mat2x2f a2;
+        random_general(gen, 2, a2.data());
+        vec2f b2{1.0f, -1.0f};
+        vec2f x2;
+        ASSERT_TRUE(solve(a2, b2, x2));
+        expect_solution(2, a2.data(), b2.data(), x2.data(), 1.0e-4f);
+
+        mat4x4f a4;
+        random_general(gen, 4, a4.data());
+        vec4f b4{1.0f, 2.0f, 3.0f, 4.0f};
+        vec4f x4;
+        ASSERT_TRUE(solve(a4, b4, x4));
+        expect_solution(4, a4.data(), b4.data(), x4.data(), 1.0e-3f);
+
+        mat3x3f a3;
+        random_spd(gen, 3, a3.data());
+        vec3f b3{0.5f, 0.25f, -1.0f};
+        vec3f x3;
+        ASSERT_TRUE(solve_spd(a3, b3, x3));
+        expect_solution(3, a3.data(), b3.data(), x3.data(), 1.0e-5f);
+
+        Matrix<float, 6, 6> a6;
+        random_spd(gen, 6, a6.data());
+        Matrix<float, 6, 1> b6{};
+        for (unsigned i = 0; i < 6; ++i) {
+            b6(i, 0) = float(i) - 2.5f;
+        }
+
+        Matrix<float, 6, 1> x6;
+        ASSERT_TRUE(solve_spd(a6, b6, x6));
+        expect_solution(6, a6.data(), b6.data(), x6.data(), 1.0e-4f);
+
+        ASSERT_TRUE(solve(a6, b6, x6));
+        expect_solution(6, a6.data(), b6.data(), x6.data(), 1.0e-4f);
+    }
+
+    TEST(Linear_systems, Batch) {
+        const std::size_t n = 37;
+        std::mt19937 gen{9};
+
+        std::vector<mat3x3f> a3(n);
+        std::vector<vec3f> b3(n);
+        std::vector<vec3f> x3(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            random_general(gen, 3, a3[i].data());
+            b3[i] = vec3f{float(i), 1.0f, -2.0f};
+        }
+
+        solve_batch(a3.data(), b3.data(), x3.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            vec3f expected;
+            ASSERT_TRUE(solve(a3[i], b3[i], expected));
+            for (unsigned j = 0; j < 3; ++j) {
+                EXPECT_NEAR(x3[i][j], expected[j], 1.0e-3f * (1.0f + std::abs(expected[j])));
+            }
+        }
+
+        aligned_vector<mat4x4f> a4(n);
+        aligned_vector<vec4f> b4(n);
+        aligned_vector<vec4f> x4(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            random_spd(gen, 4, a4[i].data());
+            b4[i] = vec4f{1.0f, float(i), 0.0f, -1.0f};
+        }
+
+        Thread_pool pool{2};
+        solve_spd_batch(a4.data(), b4.data(), x4.data(), n, pool);
+        for (std::size_t i = 0; i < n; ++i) {
+            expect_solution(4, a4[i].data(), b4[i].data(), x4[i].data(), 1.0e-4f * (1.0f + float(i)));
+        }
+
+        std::vector<Matrix<float, 6, 6>> a6(n);
+        std::vector<Matrix<float, 6, 1>> b6(n);
+        std::vector<Matrix<float, 6, 1>> x6(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            random_spd(gen, 6, a6[i].data());
+            for (unsigned j = 0; j < 6; ++j) {
+                b6[i](j, 0) = float(j) + 0.5f;
+            }
+        }
+
+        solve_spd_batch(a6.data(), b6.data(), x6.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            expect_solution(6, a6[i].data(), b6[i].data(), x6[i].data(), 1.0e-4f);
+        }
+
+        solve_batch(a6.data(), b6.data(), x6.data(), n, pool);
+        for (std::size_t i = 0; i < n; ++i) {
+            expect_solution(6, a6[i].data(), b6[i].data(), x6[i].data(), 1.0e-4f);
+        }
+    }
+
+}
+
+#endif
@@ -0,0 +1,145 @@
+#ifndef AVML_MAT3X3F_DECOMPOSITION_TESTS_HPP
+#define AVML_MAT3X3F_DECOMPOSITION_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+namespace avml_tests {
+
+    using namespace avml;
+
+    inline void expect_near(const mat3x3f& a, const mat3x3f& b, float tolerance) {
+        for (unsigned i = 0; i < 3; ++i) {
+            for (unsigned j = 0; j < 3; ++j) {
+                EXPECT_NEAR(a[i][j], b[i][j], tolerance) << "element " << i << ", " << j;
+            }
+        }
+    }
+
+    inline void expect_rotation(const mat3x3f& m, float tolerance) {
+        expect_near(transpose(m) * m, mat3x3f{1.0f}, tolerance);
+        EXPECT_NEAR(determinant(m), 1.0f, tolerance);
+    }
+
+    inline mat3x3f diagonal(vec3f d) {
+        return mat3x3f{
+            d[0], 0.0f, 0.0f,
+            0.0f, d[1], 0.0f,
+            0.0f, 0.0f, d[2]
+        };
+    }
+
+    inline std::vector<mat3x3f> random_matrices3x3(std::size_t n, unsigned seed) {
+        std::mt19937 gen{seed};
+        std::uniform_real_distribution<float> dist{-2.0f, 2.0f};
+
+        std::vector<mat3x3f> ret(n);
+        for (auto& m : ret) {
+            for (unsigned i = 0; i < 3; ++i) {
+                for (unsigned j = 0; j < 3; ++j) {
+                    m[i][j] = dist(gen);
+                }
+            }
+        }
+        return ret;
+    }
+
+    inline void expect_valid_svd(const mat3x3f& a, const svd3x3f& d) {
+        expect_rotation(d.u, 1.0e-4f);
+        expect_rotation(d.v, 1.0e-4f);
+        expect_near(d.u * diagonal(d.sigma) * transpose(d.v), a, 1.0e-4f);
+
+        EXPECT_GE(d.sigma[0], d.sigma[1] - 1.0e-5f);
+        EXPECT_GE(d.sigma[1], std::abs(d.sigma[2]) - 1.0e-5f);
+        EXPECT_GE(d.sigma[1], 0.0f);
+    }
+
+    TEST(Mat3x3f_decomposition, Svd) {
+        for (const mat3x3f& a : random_matrices3x3(200, 7)) {
+            svd3x3f d = svd(a);
+            expect_valid_svd(a, d);
+
+            EXPECT_EQ(d.sigma[2] < 0.0f, determinant(a) < 0.0f);
+        }
+    }
+
+    TEST(Mat3x3f_decomposition, Svd_degenerate) {
+        expect_valid_svd(mat3x3f{1.0f}, svd(mat3x3f{1.0f}));
+        expect_valid_svd(mat3x3f{0.0f}, svd(mat3x3f{0.0f}));
+
+        mat3x3f rank_one{
+            1.0f, 2.0f, 3.0f,
+            2.0f, 4.0f, 6.0f,
+            -1.0f, -2.0f, -3.0f
+        };
+        expect_valid_svd(rank_one, svd(rank_one));
+
+        mat3x3f reflection = diagonal(vec3f{1.0f, -1.0f, 1.0f});
+        svd3x3f d = svd(reflection);
+        expect_valid_svd(reflection, d);
+        EXPECT_NEAR(d.sigma[2], -1.0f, 1.0e-5f);
+    }
+
+    TEST(Mat3x3f_decomposition, Polar) {
+        for (const mat3x3f& a : random_matrices3x3(100, 11)) {
+            if (determinant(a) < 0.0f) {
+                continue;
+            }
+
+            polar3x3f p = polar_decomposition(a);
+            expect_rotation(p.r, 1.0e-4f);
+            expect_near(p.s, transpose(p.s), 1.0e-5f);
+            expect_near(p.r * p.s, a, 1.0e-4f);
+        }
+    }
+
+    TEST(Mat3x3f_decomposition, Eigen_symmetric) {
+        for (const mat3x3f& m : random_matrices3x3(200, 13)) {
+            mat3x3f a = m + transpose(m);
+
+            eigen3x3f e = eigen_symmetric(a);
+            expect_rotation(e.vectors, 1.0e-4f);
+            expect_near(e.vectors * diagonal(e.values) * transpose(e.vectors), a, 1.0e-4f);
+
+            EXPECT_GE(e.values[0], e.values[1]);
+            EXPECT_GE(e.values[1], e.values[2]);
+        }
+    }
+
+    TEST(Mat3x3f_decomposition, Batch) {
+        const std::size_t n = 37;
+        std::vector<mat3x3f> in = random_matrices3x3(n, 17);
+
+        std::vector<mat3x3f> symmetric(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            symmetric[i] = in[i] + transpose(in[i]);
+        }
+
+        std::vector<svd3x3f> svds(n);
+        std::vector<polar3x3f> polars(n);
+        std::vector<eigen3x3f> eigens(n);
+
+        svd_batch(in.data(), svds.data(), n);
+        polar_decomposition_batch(in.data(), polars.data(), n);
+        eigen_symmetric_batch(symmetric.data(), eigens.data(), n);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            expect_valid_svd(in[i], svds[i]);
+            expect_near(polars[i].r * polars[i].s, in[i], 1.0e-4f);
+            expect_near(eigens[i].vectors * diagonal(eigens[i].values) * transpose(eigens[i].vectors), symmetric[i], 1.0e-4f);
+        }
+
+        Thread_pool pool{2};
+        std::vector<svd3x3f> parallel(n);
+        svd_batch(in.data(), parallel.data(), n, pool);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            expect_valid_svd(in[i], parallel[i]);
+        }
+    }
+
+}
+
+#endif
@@ -0,0 +1,117 @@
+#ifndef AVML_MAT4X4F_BATCH_TESTS_HPP
+#define AVML_MAT4X4F_BATCH_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <avml/Batch.hpp>
+#include <avml/Memory.hpp>
+
+#include "../Test_helpers.hpp"
+
+namespace avml_tests {
+
+    using namespace avml;
+
+    inline aligned_vector<mat4x4f> random_matrices(std::size_t n, unsigned seed) {
+        std::mt19937 gen{seed};
+        std::uniform_real_distribution<float> dist{-1.0f, 1.0f};
+
+        aligned_vector<mat4x4f> ret(n);
+        for (mat4x4f& m : ret) {
+            for (unsigned i = 0; i < 4; ++i) {
+                for (unsigned j = 0; j < 4; ++j) {
+                    m[i][j] = dist(gen) + ((i == j) ? 3.0f : 0.0f);
+                }
+            }
+        }
+        return ret;
+    }
+
+    TEST(Mat4x4f_batch, Multiply) {
+        for (std::size_t n : {0u, 1u, 3u, 7u, 37u}) {
+            auto a = random_matrices(n, 1);
+            auto b = random_matrices(n, 2);
+            aligned_vector<mat4x4f> out(n);
+
+            multiply_batch(a.data(), b.data(), out.data(), n);
+            for (std::size_t i = 0; i < n; ++i) {
+                expect_near(out[i], a[i] * b[i], 1.0e-5f);
+            }
+
+            // In place
+            multiply_batch(a.data(), b.data(), a.data(), n);
+            for (std::size_t i = 0; i < n; ++i) {
+                EXPECT_EQ(a[i], out[i]);
+            }
+        }
+    }
+
+    TEST(Mat4x4f_batch, Multiply_indexed) {
+        const std::size_t n = 1001;
+        auto parents = random_matrices(10, 3);
+        auto local = random_matrices(n, 4);
+        aligned_vector<mat4x4f> out(n);
+
+        std::vector<std::uint32_t> indices(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            indices[i] = std::uint32_t((i * 7) % parents.size());
+        }
+
+        Thread_pool pool{2};
+        multiply_batch(parents.data(), indices.data(), local.data(), out.data(), n, pool);
+        for (std::size_t i = 0; i < n; ++i) {
+            expect_near(out[i], parents[indices[i]] * local[i], 1.0e-5f);
+        }
+    }
+
+    TEST(Mat4x4f_batch, Propagate_hierarchy) {
+        const std::size_t n = 50;
+        auto local = random_matrices(n, 5);
+        for (mat4x4f& m : local) {
+            m = m * 0.25f;
+        }
+
+        std::vector<std::uint32_t> parents(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            parents[i] = (i % 10 == 0) ? no_parent : std::uint32_t(i / 2);
+        }
+
+        aligned_vector<mat4x4f> world(n);
+        propagate_hierarchy(parents.data(), local.data(), world.data(), n);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            mat4x4f expected = local[i];
+            for (std::uint32_t p = parents[i]; p != no_parent; p = parents[p]) {
+                expected = local[p] * expected;
+            }
+            expect_near(world[i], expected, 1.0e-5f);
+        }
+    }
+
+    TEST(Mat4x4f_batch, Inverse) {
+        for (std::size_t n : {1u, 8u, 15u, 16u, 41u}) {
+            auto in = random_matrices(n, 6);
+            aligned_vector<mat4x4f> out(n);
+
+            inverse_batch(in.data(), out.data(), n);
+            for (std::size_t i = 0; i < n; ++i) {
+                expect_near(out[i], inverse(in[i]), 1.0e-5f);
+                expect_near(in[i] * out[i], mat4x4f{1.0f}, 1.0e-5f);
+            }
+
+            Thread_pool pool{2};
+            inverse_batch(in.data(), in.data(), n, pool);
+            for (std::size_t i = 0; i < n; ++i) {
+                EXPECT_EQ(in[i], out[i]);
+            }
+        }
+    }
+
+}
+
+#endif //AVML_MAT4X4F_BATCH_TESTS_HPP
@@ -0,0 +1,92 @@
+#ifndef AVML_SWIZZLE_TESTS_HPP
+#define AVML_SWIZZLE_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+namespace avml_tests {
+
+    using namespace avml;
+
+    // Checks swizzle<X, Y, Z, W> against element reads for every mask from M
+    // up to 255
+    template<unsigned M>
+    struct Check_swizzles {
+        static void run(vec4f v) {
+            vec4f s = swizzle<(M & 3), ((M >> 2) & 3), ((M >> 4) & 3), (M >> 6)>(v);
+            EXPECT_EQ(s, (vec4f{v[M & 3], v[(M >> 2) & 3], v[(M >> 4) & 3], v[M >> 6]})) << M;
+
+            Check_swizzles<M + 1>::run(v);
+        }
+    };
+
+    template<>
+    struct Check_swizzles<256> {
+        static void run(vec4f) {}
+    };
+
+    TEST(Swizzle, All_vec4f) {
+        Check_swizzles<0>::run(vec4f{1.0f, 2.0f, 3.0f, 4.0f});
+    }
+
+    TEST(Swizzle, Widths) {
+        vec2f v2{1.0f, 2.0f};
+        vec3f v3{1.0f, 2.0f, 3.0f};
+        vec4f v4{1.0f, 2.0f, 3.0f, 4.0f};
+
+        EXPECT_EQ((swizzle<1, 0>(v2)), (vec2f{2.0f, 1.0f}));
+        EXPECT_EQ((swizzle<1, 1, 0>(v2)), (vec3f{2.0f, 2.0f, 1.0f}));
+        EXPECT_EQ((swizzle<0, 1, 1, 0>(v2)), (vec4f{1.0f, 2.0f, 2.0f, 1.0f}));
+
+        EXPECT_EQ((swizzle<2, 0>(v3)), (vec2f{3.0f, 1.0f}));
+        EXPECT_EQ((swizzle<2, 1, 0>(v3)), (vec3f{3.0f, 2.0f, 1.0f}));
+        EXPECT_EQ((swizzle<2, 2, 1, 0>(v3)), (vec4f{3.0f, 3.0f, 2.0f, 1.0f}));
+
+        EXPECT_EQ((swizzle<3, 1>(v4)), (vec2f{4.0f, 2.0f}));
+        EXPECT_EQ((swizzle<3, 0, 3>(v4)), (vec3f{4.0f, 1.0f, 4.0f}));
+
+        vec4d d{1.0, 2.0, 3.0, 4.0};
+        EXPECT_EQ((swizzle<3, 2, 1, 0>(d)), (vec4d{4.0, 3.0, 2.0, 1.0}));
+        EXPECT_EQ((swizzle<0, 3>(d)), (vec2d{1.0, 4.0}));
+
+        vec3u u{7, 8, 9};
+        EXPECT_EQ((swizzle<2, 2, 0>(u)), (vec3u{9, 9, 7}));
+        EXPECT_EQ((swizzle<1, 0>(u)), (vec2u{8, 7}));
+    }
+
+    TEST(Swizzle, Named) {
+        vec2f v2{1.0f, 2.0f};
+        vec3f v3{1.0f, 2.0f, 3.0f};
+        vec4f v4{1.0f, 2.0f, 3.0f, 4.0f};
+
+        EXPECT_EQ(yx(v2), (vec2f{2.0f, 1.0f}));
+        EXPECT_EQ(yy(v2), (vec2f{2.0f, 2.0f}));
+
+        EXPECT_EQ(zx(v3), (vec2f{3.0f, 1.0f}));
+        EXPECT_EQ(xxy(v3), (vec3f{1.0f, 1.0f, 2.0f}));
+        EXPECT_EQ(zyx(v3), (vec3f{3.0f, 2.0f, 1.0f}));
+
+        EXPECT_EQ(wy(v4), (vec2f{4.0f, 2.0f}));
+        EXPECT_EQ(wzx(v4), (vec3f{4.0f, 3.0f, 1.0f}));
+        EXPECT_EQ(wzyx(v4), (vec4f{4.0f, 3.0f, 2.0f, 1.0f}));
+        EXPECT_EQ(xxzw(v4), (vec4f{1.0f, 1.0f, 3.0f, 4.0f}));
+
+        vec4d d{1.0, 2.0, 3.0, 4.0};
+        EXPECT_EQ(wwyx(d), (vec4d{4.0, 4.0, 2.0, 1.0}));
+        EXPECT_EQ(zx(d), (vec2d{3.0, 1.0}));
+    }
+
+    // zw and ww returned {z, z} and {w, z} before the named swizzles were
+    // generated from swizzle<I...>
+    TEST(Swizzle, Corrected_zw_ww) {
+        vec4f v4{1.0f, 2.0f, 3.0f, 4.0f};
+        EXPECT_EQ(zw(v4), (vec2f{3.0f, 4.0f}));
+        EXPECT_EQ(ww(v4), (vec2f{4.0f, 4.0f}));
+
+        vec4d d{1.0, 2.0, 3.0, 4.0};
+        EXPECT_EQ(zw(d), (vec2d{3.0, 4.0}));
+        EXPECT_EQ(ww(d), (vec2d{4.0, 4.0}));
+    }
+
+}
+
+#endif
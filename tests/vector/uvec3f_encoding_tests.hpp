@@ -0,0 +1,115 @@
+#ifndef AVML_UVEC3F_ENCODING_TESTS_HPP
+#define AVML_UVEC3F_ENCODING_TESTS_HPP
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <avml/Encodings.hpp>
+
+namespace avml_tests {
+
+    using namespace avml;
+
+    inline std::vector<uvec3f> random_unit_vectors(std::size_t n) {
+        std::mt19937 gen{947};
+        std::normal_distribution<float> dist{};
+
+        std::vector<uvec3f> ret;
+        ret.reserve(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            ret.push_back(uvec3f{dist(gen), dist(gen), dist(gen)});
+        }
+
+        ret[0] = uvec3f{0.0f, 0.0f, 1.0f};
+        ret[1] = uvec3f{0.0f, 0.0f, -1.0f};
+        ret[2] = uvec3f{-1.0f, 0.0f, 0.0f};
+        return ret;
+    }
+
+    inline float angle_between(uvec3f a, uvec3f b) {
+        double d = double(a[0]) * b[0] + double(a[1]) * b[1] + double(a[2]) * b[2];
+        double x = double(a[1]) * b[2] - double(a[2]) * b[1];
+        double y = double(a[2]) * b[0] - double(a[0]) * b[2];
+        double z = double(a[0]) * b[1] - double(a[1]) * b[0];
+        return float(std::atan2(std::sqrt(x * x + y * y + z * z), d));
+    }
+
+    inline float length_error(uvec3f v) {
+        double l = std::sqrt(double(v[0]) * v[0] + double(v[1]) * v[1] + double(v[2]) * v[2]);
+        return float(std::abs(l - 1.0));
+    }
+
+    TEST(uvec3f_encoding, Oct32_round_trip) {
+        auto in = random_unit_vectors(1027);
+        std::vector<std::uint32_t> packed(in.size());
+        std::vector<uvec3f> out(in.size());
+
+        encode_oct32(in.data(), packed.data(), in.size());
+        decode_oct32(packed.data(), out.data(), out.size());
+
+        for (std::size_t i = 0; i < in.size(); ++i) {
+            EXPECT_EQ(packed[i], encode_oct32(in[i]));
+            EXPECT_LE(angle_between(in[i], out[i]), oct32_max_error);
+            EXPECT_LE(length_error(out[i]), 1e-6f);
+        }
+    }
+
+    TEST(uvec3f_encoding, Oct24_round_trip) {
+        auto in = random_unit_vectors(1027);
+        std::vector<Packed_oct24> packed(in.size());
+        std::vector<uvec3f> out(in.size());
+
+        encode_oct24(in.data(), packed.data(), in.size());
+        decode_oct24(packed.data(), out.data(), out.size());
+
+        for (std::size_t i = 0; i < in.size(); ++i) {
+            Packed_oct24 p = encode_oct24(in[i]);
+            EXPECT_EQ(packed[i].bytes[0], p.bytes[0]);
+            EXPECT_EQ(packed[i].bytes[1], p.bytes[1]);
+            EXPECT_EQ(packed[i].bytes[2], p.bytes[2]);
+            EXPECT_LE(angle_between(in[i], out[i]), oct24_max_error);
+            EXPECT_LE(length_error(out[i]), 1e-6f);
+        }
+    }
+
+    TEST(uvec3f_encoding, Snorm16x3_round_trip) {
+        auto in = random_unit_vectors(1027);
+        std::vector<Packed_snorm16x3> packed(in.size());
+        std::vector<uvec3f> out(in.size());
+
+        encode_snorm16x3(in.data(), packed.data(), in.size());
+        decode_snorm16x3(packed.data(), out.data(), out.size());
+
+        for (std::size_t i = 0; i < in.size(); ++i) {
+            EXPECT_LE(angle_between(in[i], out[i]), snorm16x3_max_error);
+            EXPECT_LE(length_error(out[i]), 1e-6f);
+        }
+    }
+
+    TEST(uvec3f_encoding, Snorm1010102_round_trip) {
+        auto in = random_unit_vectors(1027);
+        std::vector<std::uint32_t> packed(in.size());
+        std::vector<uvec3f> out(in.size());
+
+        encode_snorm1010102(in.data(), packed.data(), in.size());
+        decode_snorm1010102(packed.data(), out.data(), out.size());
+
+        for (std::size_t i = 0; i < in.size(); ++i) {
+            EXPECT_EQ(packed[i], encode_snorm1010102(in[i]));
+            EXPECT_LE(angle_between(in[i], out[i]), snorm1010102_max_error);
+            EXPECT_LE(length_error(out[i]), 1e-6f);
+        }
+    }
+
+    TEST(uvec3f_encoding, Snorm1010102_w) {
+        std::uint32_t v = encode_snorm1010102(uvec3f{0.0f, 1.0f, 0.0f}, 0x3);
+        EXPECT_EQ(extract_snorm1010102_w(v), 0x3u);
+    }
+
+}
+
+#endif